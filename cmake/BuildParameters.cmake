@@ -29,6 +29,7 @@ if(UNIX AND NOT APPLE)
 	option(X11_API "Enable X11 support" ON)
 	option(WAYLAND_API "Enable Wayland support" ON)
 	option(USE_BACKTRACE "Enable libbacktrace support" ON)
+	option(USE_PERF_JITDUMP "Write recompiled code to a jitdump file for perf inject" OFF)
 endif()
 
 if(UNIX)
@@ -215,6 +216,10 @@ if(USE_VTUNE)
 	list(APPEND PCSX2_DEFS ENABLE_VTUNE)
 endif()
 
+if(USE_PERF_JITDUMP)
+	list(APPEND PCSX2_DEFS ENABLE_PERF_JITDUMP)
+endif()
+
 if(USE_OPENGL)
 	list(APPEND PCSX2_DEFS ENABLE_OPENGL)
 endif()
@@ -22,6 +22,7 @@
 #include <X11/Xlib.h>
 #include <X11/extensions/XInput2.h>
 
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -368,7 +369,12 @@ bool Common::PlaySoundAsync(const char* path)
 
 void Threading::Sleep(int ms)
 {
-	usleep(1000 * ms);
+	// usleep() returns early when a signal arrives (e.g. the hot block profiler's SIGPROF), keep sleeping the rest
+	struct timespec ts;
+	ts.tv_sec = static_cast<time_t>(ms / 1000);
+	ts.tv_nsec = static_cast<long>(ms % 1000) * 1000000L;
+	while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+		;
 }
 
 void Threading::SleepUntil(u64 ticks)
@@ -376,5 +382,6 @@ void Threading::SleepUntil(u64 ticks)
 	struct timespec ts;
 	ts.tv_sec = static_cast<time_t>(ticks / 1000000000ULL);
 	ts.tv_nsec = static_cast<long>(ticks % 1000000000ULL);
-	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+		;
 }
@@ -23,8 +23,8 @@
 #include <sys/syscall.h>
 #endif
 
+// Writes a perf map instead of a jitdump, see USE_PERF_JITDUMP for the latter.
 //#define ProfileWithPerf
-//#define ProfileWithPerfJitDump
 
 #if defined(ENABLE_VTUNE) && defined(_WIN32)
 #pragma comment(lib, "jitprofiling.lib")
@@ -40,11 +40,35 @@ namespace Perf
 	Group vif("VIF");
 
 // Perf is only supported on linux
+#if defined(__linux__) && (defined(ProfileWithPerf) || defined(ENABLE_PERF_JITDUMP))
+	// perf only reads the files once the process exits, so writes are buffered rather than flushed
+	// per block. The buffer is still flushed every so often, so a crash doesn't lose everything.
+	static constexpr size_t BUFFER_SIZE = 1024 * 1024;
+	static constexpr u64 FLUSH_INTERVAL_NS = 1000000000ULL;
+
+	static u64 GetTimestamp()
+	{
+		struct timespec ts = {};
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (static_cast<u64>(ts.tv_sec) * 1000000000ULL) + static_cast<u64>(ts.tv_nsec);
+	}
+
+	static void FlushPeriodically(std::FILE* fp, u64 timestamp)
+	{
+		static u64 s_last_flush = 0;
+		if ((timestamp - s_last_flush) < FLUSH_INTERVAL_NS)
+			return;
+
+		std::fflush(fp);
+		s_last_flush = timestamp;
+	}
+#endif
+
 #if defined(__linux__) && defined(ProfileWithPerf)
 	static std::FILE* s_map_file = nullptr;
 	static bool s_map_file_opened = false;
 	static std::mutex s_mutex;
-	static void RegisterMethod(const void* ptr, size_t size, const char* symbol)
+	static void RegisterMethod(const void* ptr, size_t size, const char* symbol, const char* source, std::span<const LineInfo> lines)
 	{
 		std::unique_lock lock(s_mutex);
 
@@ -59,12 +83,14 @@ namespace Perf
 			s_map_file_opened = true;
 			if (!s_map_file)
 				return;
+
+			std::setvbuf(s_map_file, nullptr, _IOFBF, BUFFER_SIZE);
 		}
 
 		std::fprintf(s_map_file, "%" PRIx64 " %zx %s\n", static_cast<u64>(reinterpret_cast<uintptr_t>(ptr)), size, symbol);
-		std::fflush(s_map_file);
+		FlushPeriodically(s_map_file, GetTimestamp());
 	}
-#elif defined(__linux__) && defined(ProfileWithPerfJitDump)
+#elif defined(__linux__) && defined(ENABLE_PERF_JITDUMP)
 	enum : u32
 	{
 		JIT_CODE_LOAD = 0,
@@ -103,40 +129,82 @@ namespace Perf
 		u64 code_index;
 		// name
 	};
-#pragma pack(pop)
-
-	static u64 JitDumpTimestamp()
+	struct JITDUMP_DEBUG_INFO
 	{
-		struct timespec ts = {};
-		clock_gettime(CLOCK_MONOTONIC, &ts);
-		return (static_cast<u64>(ts.tv_sec) * 1000000000ULL) + static_cast<u64>(ts.tv_nsec);
-	}
+		JITDUMP_RECORD_HEADER header;
+		u64 code_addr;
+		u64 nr_entry;
+		// entries
+	};
+	struct JITDUMP_DEBUG_ENTRY
+	{
+		u64 addr;
+		s32 lineno;
+		s32 discrim;
+		// filename, or "\xff" for the same as the previous entry
+	};
+#pragma pack(pop)
 
 	static FILE* s_jitdump_file = nullptr;
 	static bool s_jitdump_file_opened = false;
 	static std::mutex s_jitdump_mutex;
 	static u32 s_jitdump_record_id;
 
-	static void RegisterMethod(const void* ptr, size_t size, const char* symbol)
+	// Written ahead of the code load, perf inject turns it into a line table for the block. The guest
+	// PC is used as the line number, so perf annotate and srcline show which guest instruction the
+	// host code came from.
+	static void WriteDebugInfo(const void* ptr, const char* source, std::span<const LineInfo> lines, u64 timestamp)
+	{
+		static constexpr char SAME_FILE[] = "\xff";
+		const u32 source_len = static_cast<u32>(std::strlen(source)) + 1;
+
+		JITDUMP_DEBUG_INFO di = {};
+		di.header.id = JIT_CODE_DEBUG_INFO;
+		di.header.total_size = static_cast<u32>(sizeof(di) + lines.size() * sizeof(JITDUMP_DEBUG_ENTRY) + source_len +
+												 (lines.size() - 1) * sizeof(SAME_FILE));
+		di.header.timestamp = timestamp;
+		di.code_addr = static_cast<u64>(reinterpret_cast<uintptr_t>(ptr));
+		di.nr_entry = lines.size();
+		std::fwrite(&di, sizeof(di), 1, s_jitdump_file);
+
+		for (size_t i = 0; i < lines.size(); i++)
+		{
+			JITDUMP_DEBUG_ENTRY de = {};
+			de.addr = di.code_addr + lines[i].host_offset;
+
+			// Line numbers are signed, the top bit only selects a mirror of the same memory anyway.
+			de.lineno = static_cast<s32>(lines[i].guest_pc & 0x7FFFFFFFu);
+			std::fwrite(&de, sizeof(de), 1, s_jitdump_file);
+			if (i == 0)
+				std::fwrite(source, source_len, 1, s_jitdump_file);
+			else
+				std::fwrite(SAME_FILE, sizeof(SAME_FILE), 1, s_jitdump_file);
+		}
+	}
+
+	static void RegisterMethod(const void* ptr, size_t size, const char* symbol, const char* source, std::span<const LineInfo> lines)
 	{
 		const u32 namelen = std::strlen(symbol) + 1;
 
 		std::unique_lock lock(s_jitdump_mutex);
 		if (!s_jitdump_file)
 		{
-			if (!s_jitdump_file_opened)
-			{
-				char file[256];
-				snprintf(file, std::size(file), "jit-%d.dump", getpid());
-				s_jitdump_file = fopen(file, "w+b");
-				s_jitdump_file_opened = true;
-				if (!s_jitdump_file)
-					return;
-			}
+			if (s_jitdump_file_opened)
+				return;
+
+			char file[256];
+			snprintf(file, std::size(file), "jit-%d.dump", getpid());
+			s_jitdump_file = fopen(file, "w+b");
+			s_jitdump_file_opened = true;
+			if (!s_jitdump_file)
+				return;
 
+			// perf record picks the file up through this mapping.
 			void* perf_marker = mmap(nullptr, 4096, PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(s_jitdump_file), 0);
 			pxAssertRel(perf_marker != MAP_FAILED, "Map perf marker");
 
+			std::setvbuf(s_jitdump_file, nullptr, _IOFBF, BUFFER_SIZE);
+
 			JITDUMP_HEADER jh = {};
 #if defined(_M_X86)
 			jh.elf_mach = EM_X86_64;
@@ -146,14 +214,18 @@ namespace Perf
 #error Unhandled architecture.
 #endif
 			jh.pid = getpid();
-			jh.timestamp = JitDumpTimestamp();
+			jh.timestamp = GetTimestamp();
 			std::fwrite(&jh, sizeof(jh), 1, s_jitdump_file);
 		}
 
+		const u64 timestamp = GetTimestamp();
+		if (!lines.empty())
+			WriteDebugInfo(ptr, source, lines, timestamp);
+
 		JITDUMP_CODE_LOAD cl = {};
 		cl.header.id = JIT_CODE_LOAD;
 		cl.header.total_size = sizeof(cl) + namelen + static_cast<u32>(size);
-		cl.header.timestamp = JitDumpTimestamp();
+		cl.header.timestamp = timestamp;
 		cl.pid = getpid();
 		cl.tid = syscall(SYS_gettid);
 		cl.vma = 0;
@@ -163,10 +235,10 @@ namespace Perf
 		std::fwrite(&cl, sizeof(cl), 1, s_jitdump_file);
 		std::fwrite(symbol, namelen, 1, s_jitdump_file);
 		std::fwrite(ptr, size, 1, s_jitdump_file);
-		std::fflush(s_jitdump_file);
+		FlushPeriodically(s_jitdump_file, timestamp);
 	}
 #elif defined(ENABLE_VTUNE)
-	static void RegisterMethod(const void* ptr, size_t size, const char* symbol)
+	static void RegisterMethod(const void* ptr, size_t size, const char* symbol, const char* source, std::span<const LineInfo> lines)
 	{
 		iJIT_Method_Load_V2 ml = {};
 		ml.method_id = iJIT_GetNewMethodID();
@@ -177,7 +249,7 @@ namespace Perf
 	}
 #endif
 
-#if (defined(__linux__) && (defined(ProfileWithPerf) || defined(ProfileWithPerfJitDump))) || defined(ENABLE_VTUNE)
+#if (defined(__linux__) && (defined(ProfileWithPerf) || defined(ENABLE_PERF_JITDUMP))) || defined(ENABLE_VTUNE)
 	void Group::Register(const void* ptr, size_t size, const char* symbol)
 	{
 		char full_symbol[128];
@@ -185,17 +257,22 @@ namespace Perf
 			std::snprintf(full_symbol, std::size(full_symbol), "%s_%s", m_prefix, symbol);
 		else
 			StringUtil::Strlcpy(full_symbol, symbol, std::size(full_symbol));
-		RegisterMethod(ptr, size, full_symbol);
+		RegisterMethod(ptr, size, full_symbol, nullptr, {});
 	}
 
 	void Group::RegisterPC(const void* ptr, size_t size, u32 pc)
+	{
+		RegisterPC(ptr, size, pc, {});
+	}
+
+	void Group::RegisterPC(const void* ptr, size_t size, u32 pc, std::span<const LineInfo> lines)
 	{
 		char full_symbol[128];
 		if (HasPrefix())
 			std::snprintf(full_symbol, std::size(full_symbol), "%s_%08X", m_prefix, pc);
 		else
 			std::snprintf(full_symbol, std::size(full_symbol), "%08X", pc);
-		RegisterMethod(ptr, size, full_symbol);
+		RegisterMethod(ptr, size, full_symbol, HasPrefix() ? m_prefix : "JIT", lines);
 	}
 
 	void Group::RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key)
@@ -205,11 +282,12 @@ namespace Perf
 			std::snprintf(full_symbol, std::size(full_symbol), "%s_%s%016" PRIX64, m_prefix, prefix, key);
 		else
 			std::snprintf(full_symbol, std::size(full_symbol), "%s%016" PRIX64, prefix, key);
-		RegisterMethod(ptr, size, full_symbol);
+		RegisterMethod(ptr, size, full_symbol, nullptr, {});
 	}
 #else
 	void Group::Register(const void* ptr, size_t size, const char* symbol) {}
 	void Group::RegisterPC(const void* ptr, size_t size, u32 pc) {}
+	void Group::RegisterPC(const void* ptr, size_t size, u32 pc, std::span<const LineInfo> lines) {}
 	void Group::RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key) {}
 #endif
 } // namespace Perf
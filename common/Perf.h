@@ -5,10 +5,25 @@
 
 #include <vector>
 #include <cstdio>
+#include <span>
 #include "common/Pcsx2Types.h"
 
 namespace Perf
 {
+	/// Host code offset within a block, and the guest instruction it was generated from.
+	struct LineInfo
+	{
+		u32 host_offset;
+		u32 guest_pc;
+	};
+
+#if defined(__linux__) && defined(ENABLE_PERF_JITDUMP)
+	/// Recompilers only build line tables when something will consume them.
+	static constexpr bool LineInfoEnabled = true;
+#else
+	static constexpr bool LineInfoEnabled = false;
+#endif
+
 	class Group
 	{
 		const char* m_prefix;
@@ -19,6 +34,7 @@ namespace Perf
 
 		void Register(const void* ptr, size_t size, const char* symbol);
 		void RegisterPC(const void* ptr, size_t size, u32 pc);
+		void RegisterPC(const void* ptr, size_t size, u32 pc, std::span<const LineInfo> lines);
 		void RegisterKey(const void* ptr, size_t size, const char* prefix, u64 key);
 	};
 
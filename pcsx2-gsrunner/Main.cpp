@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
 // SPDX-License-Identifier: GPL-3.0+
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <csignal>
@@ -19,12 +20,15 @@
 #include "common/CocoaTools.h"
 #include "common/Console.h"
 #include "common/CrashHandler.h"
+#include "common/Error.h"
 #include "common/FileSystem.h"
+#include "common/Image.h"
 #include "common/MemorySettingsInterface.h"
 #include "common/Path.h"
 #include "common/ProgressCallback.h"
 #include "common/SettingsWrapper.h"
 #include "common/StringUtil.h"
+#include "common/Timer.h"
 
 #include "pcsx2/PrecompiledHeader.h"
 
@@ -32,6 +36,10 @@
 #include "pcsx2/CDVD/CDVD.h"
 #include "pcsx2/GS.h"
 #include "pcsx2/GS/GSPerfMon.h"
+#include "pcsx2/GS/GSXXH.h"
+#include "pcsx2/GS/Renderers/Common/GSFunctionMap.h"
+#include "pcsx2/GS/Renderers/Common/GSRenderer.h"
+#include "pcsx2/GS/Renderers/HW/GSStereoTrace.h"
 #include "pcsx2/GSDumpReplayer.h"
 #include "pcsx2/GameList.h"
 #include "pcsx2/Host.h"
@@ -62,6 +70,16 @@ namespace GSRunner
 	static void SettingsOverride();
 	static bool ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& params);
 	static void DumpStats();
+	static void DumpStereoRuleStats();
+	static bool RunSWThreadScaling(const VMBootParameters& params);
+	static std::string GetDumpTitle(const std::string_view path);
+	static bool AddBatchDumps(const std::string& path);
+	static void UpdateBatchStats(const std::string& frame_hashes);
+	static bool RunBatch();
+	static bool OpenFrameHashLog(const std::string_view relative_prefix);
+	static u32 CloseFrameHashLog();
+	static std::string GetFrameHashes(u32* width, u32* height);
+	static std::string HashFrame();
 
 	static bool CreatePlatformWindow();
 	static void DestroyPlatformWindow();
@@ -77,6 +95,7 @@ static MemorySettingsInterface s_settings_interface;
 
 static std::string s_output_prefix;
 static s32 s_loop_count = 1;
+static s32 s_dump_last_frame = -1;
 static std::optional<bool> s_use_window;
 static bool s_no_console = false;
 
@@ -100,6 +119,45 @@ static u64 s_total_readbacks = 0;
 static u32 s_total_frames = 0;
 static u32 s_total_drawn_frames = 0;
 
+// Stereo rule analysis, the first rules file is used for the replay, the second only for the diff.
+static std::string s_stereo_trace_path;
+static std::vector<std::string> s_stereo_rules_paths;
+static int s_swthreads_scaling_first = -1;
+static int s_swthreads_scaling_last = -1;
+static std::atomic<u32> s_presented_frames{0};
+
+// batch mode
+static std::vector<std::string> s_batch_paths;
+static std::string s_batch_output_dir;
+static std::string s_batch_summary_path;
+static bool s_batch_mode = false;
+
+struct BatchStats
+{
+	u32 frames;
+	u64 draws;
+	double last_draws;
+	u64 hash;
+	Common::Timer::Value last_present;
+	std::vector<float> frame_times;
+};
+static BatchStats s_batch_stats;
+
+// frame hashing
+static bool s_frame_hash = false;
+static std::string s_frame_hash_ref_dir;
+static std::vector<std::pair<u32, u32>> s_frame_hash_regions;
+
+struct FrameHashState
+{
+	FileSystem::ManagedCFilePtr log;
+	std::unordered_map<u32, std::string> reference;
+	bool has_reference;
+	u32 mismatches;
+	std::vector<u32> pixels;
+};
+static FrameHashState s_frame_hash_state;
+
 bool GSRunner::InitializeConfig()
 {
 	EmuFolders::SetAppRoot();
@@ -223,7 +281,14 @@ void Host::ReleaseRenderWindow()
 
 void Host::BeginPresentFrame()
 {
-	if (s_loop_number == 0 && !s_output_prefix.empty())
+	s_presented_frames.fetch_add(1, std::memory_order_relaxed);
+
+	std::string frame_hashes;
+	if (s_loop_number == 0 && !s_output_prefix.empty() && s_frame_hash)
+	{
+		frame_hashes = GSRunner::HashFrame();
+	}
+	else if (s_loop_number == 0 && !s_output_prefix.empty())
 	{
 		// when we wrap around, don't race other files
 		GSJoinSnapshotThreads();
@@ -262,6 +327,9 @@ void Host::BeginPresentFrame()
 
 		std::atomic_thread_fence(std::memory_order_release);
 	}
+
+	if (s_batch_mode)
+		GSRunner::UpdateBatchStats(frame_hashes);
 }
 
 void Host::RequestResizeHostDisplay(s32 width, s32 height)
@@ -432,6 +500,7 @@ static void PrintCommandLineHelp(const char* progname)
 {
 	PrintCommandLineVersion();
 	std::fprintf(stderr, "Usage: %s [parameters] [--] [filename]\n", progname);
+	std::fprintf(stderr, "       %s [parameters] -batch <dir|list>\n", progname);
 	std::fprintf(stderr, "\n");
 	std::fprintf(stderr, "  -help: Displays this information and exits.\n");
 	std::fprintf(stderr, "  -version: Displays version information and exits.\n");
@@ -444,13 +513,31 @@ static void PrintCommandLineHelp(const char* progname)
 	std::fprintf(stderr, "  -dumprangef NF[,LF,BF]: Start dumping from frame NF (base 0), stops after LF frames, "
 		"and only those frames that are multiples of BF (intersection of -dumprange and -dumprangef used).\n"
 		"Defaults to 0,-1,1 (all frames). Only used if -dump is used.\n");
+	std::fprintf(stderr, "  -lastframe <frame>: Stops playback after frame N of the dump (base 0, inclusive), without reading\n"
+						 "    the rest of it. Ignored if -loop is used.\n");
 	std::fprintf(stderr, "  -loop <count>: Loops dump playback N times. Defaults to 1. 0 will loop infinitely.\n");
+	std::fprintf(stderr, "  -batch <dir|list>: Replays every GS dump in dir, or listed one per line in list, in this process.\n"
+						 "    Frames of each dump go to their own subdirectory of -dumpdir. Can be given more than once.\n");
+	std::fprintf(stderr, "  -summary <filename>: Writes frame times, draw counts and, with -framehash, output hashes\n"
+						 "    of a batch as JSON.\n");
+	std::fprintf(stderr, "  -framehash: Instead of saving every frame to -dumpdir, writes an XXH3 hash of each frame to\n"
+						 "    <dumpdir>/<name>.framehash.\n");
+	std::fprintf(stderr, "  -framehashref <dir>: Compares the hashes against those in the -dumpdir of an earlier -framehash run,\n"
+						 "    and only saves the frames that differ.\n");
+	std::fprintf(stderr, "  -framehashmem <offset>,<size>: Also hashes a region of GS local memory (hex bytes) each frame.\n");
 	std::fprintf(stderr, "  -renderer <renderer>: Sets the graphics renderer. Defaults to Auto.\n");
 	std::fprintf(stderr, "  -swthreads <threads>: Sets the number of threads for the software renderer.\n");
+	std::fprintf(stderr, "  -swthreads <first>-<last>: Replays the dump with the software renderer once per thread count,\n"
+						 "    doubling from first up to last, and prints the speedup of each run over the first.\n");
 	std::fprintf(stderr, "  -window: Forces a window to be displayed.\n");
 	std::fprintf(stderr, "  -surfaceless: Disables showing a window.\n");
 	std::fprintf(stderr, "  -logfile <filename>: Writes emu log to filename.\n");
 	std::fprintf(stderr, "  -noshadercache: Disables the shader cache (useful for parallel runs).\n");
+	std::fprintf(stderr, "  -stereo <sbs|tab>: Replays with side by side or top and bottom stereo output. With -framehash and\n"
+						 "    -framehashref this gives reference hashes for the software renderer's stereo output.\n");
+	std::fprintf(stderr, "  -stereotrace <filename>: Writes the HW renderer's per-draw stereo decisions to filename.\n");
+	std::fprintf(stderr, "  -stereorules <ini>: Replays with the [EmuCore/GS] stereo options from ini and prints per-rule\n"
+						 "    hit counts. Give it twice to also print the draws whose decision differs with the second ini.\n");
 	std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
 						 "    parameters make up the filename. Use when the filename contains\n"
 						 "    spaces or starts with a dash.\n");
@@ -589,6 +676,50 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 				s_settings_interface.SetStringValue("EmuCore/GS", "SWDumpDirectory", argv[++i]);
 				continue;
 			}
+			else if (CHECK_ARG_PARAM("-batch"))
+			{
+				if (!AddBatchDumps(std::string(StringUtil::StripWhitespace(argv[++i]))))
+					return false;
+
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-summary"))
+			{
+				s_batch_summary_path = StringUtil::StripWhitespace(argv[++i]);
+				continue;
+			}
+			else if (CHECK_ARG("-framehash"))
+			{
+				s_frame_hash = true;
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-framehashref"))
+			{
+				s_frame_hash = true;
+				s_frame_hash_ref_dir = StringUtil::StripWhitespace(argv[++i]);
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-framehashmem"))
+			{
+				const std::vector<std::string_view> split = StringUtil::SplitString(argv[++i], ',');
+				const std::optional<u32> offset = (split.size() == 2) ? StringUtil::FromChars<u32>(split[0], 16) : std::nullopt;
+				const std::optional<u32> size = (split.size() == 2) ? StringUtil::FromChars<u32>(split[1], 16) : std::nullopt;
+				if (!offset.has_value() || !size.has_value() || size.value() == 0 ||
+					offset.value() >= GSLocalMemory::m_vmsize || size.value() > GSLocalMemory::m_vmsize - offset.value())
+				{
+					Console.Error("Invalid local memory region");
+					return false;
+				}
+
+				s_frame_hash = true;
+				s_frame_hash_regions.emplace_back(offset.value(), size.value());
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-lastframe"))
+			{
+				s_dump_last_frame = StringUtil::FromChars<s32>(argv[++i]).value_or(-1);
+				continue;
+			}
 			else if (CHECK_ARG_PARAM("-loop"))
 			{
 				s_loop_count = StringUtil::FromChars<s32>(argv[++i]).value_or(0);
@@ -634,7 +765,25 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 			}
 			else if (CHECK_ARG_PARAM("-swthreads"))
 			{
-				const int swthreads = StringUtil::FromChars<int>(argv[++i]).value_or(0);
+				const std::string_view str(argv[++i]);
+				const std::string_view::size_type sep = str.find('-', 1);
+				if (sep != std::string_view::npos)
+				{
+					const std::optional<int> first = StringUtil::FromChars<int>(str.substr(0, sep));
+					const std::optional<int> last = StringUtil::FromChars<int>(str.substr(sep + 1));
+					if (!first.has_value() || !last.has_value() || first.value() < 0 || last.value() < first.value())
+					{
+						Console.WriteLn("Invalid software thread range");
+						return false;
+					}
+
+					Console.WriteLn(fmt::format("Measuring software renderer scaling from {} to {} threads", first.value(), last.value()));
+					s_swthreads_scaling_first = first.value();
+					s_swthreads_scaling_last = last.value();
+					continue;
+				}
+
+				const int swthreads = StringUtil::FromChars<int>(str).value_or(0);
 				if (swthreads < 0)
 				{
 					Console.WriteLn("Invalid number of software threads");
@@ -723,6 +872,55 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 				s_settings_interface.SetBoolValue("EmuCore/GS", "DisableShaderCache", true);
 				continue;
 			}
+			else if (CHECK_ARG_PARAM("-stereo"))
+			{
+				const char* mode = argv[++i];
+				GSStereoMode type;
+				if (StringUtil::Strcasecmp(mode, "sbs") == 0)
+					type = GSStereoMode::SideBySide;
+				else if (StringUtil::Strcasecmp(mode, "tab") == 0)
+					type = GSStereoMode::TopAndBottom;
+				else
+				{
+					Console.Error("Unknown stereo mode '%s'", mode);
+					return false;
+				}
+
+				Console.WriteLn("Using %s stereo output.", Pcsx2Config::GSOptions::StereoModeNames[static_cast<int>(type)]);
+				s_settings_interface.SetStringValue("EmuCore/GS", "StereoMode",
+					Pcsx2Config::GSOptions::StereoModeNames[static_cast<int>(type)]);
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-stereotrace"))
+			{
+				s_stereo_trace_path = StringUtil::StripWhitespace(argv[++i]);
+				continue;
+			}
+			else if (CHECK_ARG_PARAM("-stereorules"))
+			{
+				std::string path = std::string(StringUtil::StripWhitespace(argv[++i]));
+				if (s_stereo_rules_paths.size() == 2)
+				{
+					Console.Error("At most two stereo rules files can be compared.");
+					return false;
+				}
+
+				INISettingsInterface si_ini(path);
+				if (!si_ini.Load())
+				{
+					Console.ErrorFmt("Unable to load stereo rules from {}.", path);
+					return false;
+				}
+
+				if (s_stereo_rules_paths.empty())
+				{
+					for (const auto& [key, value] : si_ini.GetKeyValueList("EmuCore/GS"))
+						s_settings_interface.SetStringValue("EmuCore/GS", key.c_str(), value.c_str());
+				}
+
+				s_stereo_rules_paths.push_back(std::move(path));
+				continue;
+			}
 			else if (CHECK_ARG("-window"))
 			{
 				Console.WriteLn("Creating window");
@@ -755,6 +953,36 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 		params.filename += argv[i];
 	}
 
+	if (s_frame_hash && (dumpdir.empty() || s_settings_interface.GetBoolValue("EmuCore/GS", "DumpGSData")))
+	{
+		Console.Error("-framehash requires -dumpdir, and can't be combined with -dump.");
+		return false;
+	}
+
+	if (!s_batch_paths.empty())
+	{
+		if (!params.filename.empty())
+		{
+			Console.Error("A dump filename can't be combined with -batch.");
+			return false;
+		}
+		if (s_swthreads_scaling_first >= 0 || !s_stereo_trace_path.empty() || !s_stereo_rules_paths.empty())
+		{
+			Console.Error("-swthreads ranges and stereo traces can't be combined with -batch.");
+			return false;
+		}
+
+		Console.WriteLn(fmt::format("Replaying {} GS dumps.", s_batch_paths.size()));
+		s_batch_output_dir = std::move(dumpdir);
+		s_output_prefix.clear();
+		return true;
+	}
+	else if (!s_batch_summary_path.empty())
+	{
+		Console.Error("-summary requires -batch.");
+		return false;
+	}
+
 	if (params.filename.empty())
 	{
 		Console.Error("No dump filename provided.");
@@ -779,16 +1007,25 @@ bool GSRunner::ParseCommandLineArgs(int argc, char* argv[], VMBootParameters& pa
 		s_output_prefix = "";
 	}
 
+	if (!s_stereo_rules_paths.empty() && s_stereo_trace_path.empty())
+	{
+		s_stereo_trace_path = Path::Combine(Path::GetDirectory(params.filename),
+			fmt::format("{}.stereotrace", GetDumpTitle(params.filename)));
+	}
+	if (!s_stereo_trace_path.empty())
+	{
+		Console.WriteLn(fmt::format("Writing stereo trace to {}", s_stereo_trace_path));
+		s_settings_interface.SetStringValue("EmuCore/GS", "StereoTracePath", s_stereo_trace_path.c_str());
+	}
+
 	// set up the frame dump directory
 	if (!s_output_prefix.empty())
 	{
-		// strip off all extensions
-		std::string_view title(Path::GetFileTitle(params.filename));
-		if (StringUtil::EndsWithNoCase(title, ".gs"))
-			title = Path::GetFileTitle(title);
-
-		s_output_prefix = Path::Combine(s_output_prefix, StringUtil::StripWhitespace(title));
-		Console.WriteLn(fmt::format("Saving dumps as {}_frameN.png", s_output_prefix));
+		s_output_prefix = Path::Combine(s_output_prefix, GetDumpTitle(params.filename));
+		if (s_frame_hash)
+			Console.WriteLn(fmt::format("Writing frame hashes to {}.framehash", s_output_prefix));
+		else
+			Console.WriteLn(fmt::format("Saving dumps as {}_frameN.png", s_output_prefix));
 	}
 
 	return true;
@@ -846,6 +1083,491 @@ void GSRunner::DumpStats()
 	Console.WriteLn("============================================");
 }
 
+void GSRunner::DumpStereoRuleStats()
+{
+	if (s_stereo_rules_paths.empty())
+		return;
+
+	Error error;
+	std::vector<GSStereoTrace::Record> records;
+	if (!GSStereoTrace::ReadFile(s_stereo_trace_path.c_str(), &records, &error))
+	{
+		Console.ErrorFmt("Failed to read stereo trace {}: {}", s_stereo_trace_path, error.GetDescription());
+		return;
+	}
+
+	const auto decisions_string = [](u32 decisions) {
+		std::string ret;
+		for (u32 i = 0; i < GSStereoTrace::NUM_DECISIONS; i++)
+		{
+			if (decisions & (1u << i))
+				fmt::format_to(std::back_inserter(ret), "{}{}", ret.empty() ? "" : "|", GSStereoTrace::GetDecisionName(1u << i));
+		}
+		return ret.empty() ? std::string("Mono") : ret;
+	};
+
+	// The replay ran with the first rules file applied on top of everything else.
+	const Pcsx2Config::GSOptions& config_a = EmuConfig.GS;
+	const GSStereoTrace::Summary summary = GSStereoTrace::Summarize(records, config_a);
+	Console.WriteLn(fmt::format("======= STEREO RULE STATISTICS FOR {} DRAWS ({}) ========", summary.draws, s_stereo_rules_paths[0]));
+	for (u32 i = 0; i < GSStereoTrace::NUM_DECISIONS; i++)
+		Console.WriteLn(fmt::format("@STEREO@ {}: {}", GSStereoTrace::GetDecisionName(1u << i), summary.decisions[i]));
+	for (const GSStereoTrace::RuleHits& rh : summary.rules)
+	{
+		Console.WriteLn(fmt::format("@STEREORULE@ {} {}: {}", GSStereoDrawFilter::GetRuleGroupName(rh.rule.group),
+			GSStereoDrawFilter::GetOptionName(rh.rule.option), rh.hits));
+	}
+
+	if (s_stereo_rules_paths.size() > 1)
+	{
+		Pcsx2Config::GSOptions config_b = config_a;
+		INISettingsInterface si_ini(s_stereo_rules_paths[1]);
+		if (!si_ini.Load())
+		{
+			Console.ErrorFmt("Unable to load stereo rules from {}.", s_stereo_rules_paths[1]);
+			return;
+		}
+
+		SettingsLoadWrapper wrap(si_ini);
+		config_b.LoadSave(wrap);
+
+		const std::vector<GSStereoTrace::DiffEntry> diff = GSStereoTrace::Diff(records, config_a, config_b);
+		Console.WriteLn(fmt::format("======= {} DRAWS DIFFER WITH {} ========", diff.size(), s_stereo_rules_paths[1]));
+		for (const GSStereoTrace::DiffEntry& de : diff)
+		{
+			Console.WriteLn(fmt::format("@STEREODIFF@ Draw {} (frame {}): {} -> {}", de.draw, de.frame,
+				decisions_string(de.decisions_a), decisions_string(de.decisions_b)));
+		}
+	}
+
+	Console.WriteLn("============================================");
+}
+
+bool GSRunner::RunSWThreadScaling(const VMBootParameters& params)
+{
+	s_settings_interface.SetIntValue("EmuCore/GS", "Renderer", static_cast<int>(GSRendererType::SW));
+
+	std::vector<int> thread_counts;
+	for (int threads = s_swthreads_scaling_first; threads < s_swthreads_scaling_last; threads = threads ? (threads * 2) : 1)
+		thread_counts.push_back(threads);
+	thread_counts.push_back(s_swthreads_scaling_last);
+
+	struct Run
+	{
+		int threads;
+		u32 frames;
+		double seconds;
+	};
+	std::vector<Run> runs;
+
+	for (const int threads : thread_counts)
+	{
+		s_settings_interface.SetIntValue("EmuCore/GS", "SWExtraThreads", threads);
+		VMManager::ApplySettings();
+
+		if (VMManager::Initialize(params) != VMBootResult::StartupSuccess)
+			return false;
+
+		// Only time the replay itself, not loading the dump or creating the device.
+		s_presented_frames.store(0, std::memory_order_relaxed);
+		GSDumpReplayer::SetLoopCount(s_loop_count);
+		VMManager::SetState(VMState::Running);
+
+		Common::Timer timer;
+		while (VMManager::GetState() == VMState::Running)
+			VMManager::Execute();
+
+		const double seconds = timer.GetTimeSeconds();
+		const u32 frames = s_presented_frames.load(std::memory_order_relaxed);
+		VMManager::Shutdown(false);
+
+		runs.push_back({threads, frames, seconds});
+		Console.WriteLn(fmt::format("{} software threads: {} frames in {:.3f} seconds", threads, frames, seconds));
+	}
+
+	Console.WriteLn(fmt::format("======= SW THREAD SCALING FOR {} FRAMES ========", runs[0].frames));
+	for (const Run& run : runs)
+	{
+		Console.WriteLn(fmt::format("@SWSCALE@ Threads {}: {:.3f} s, {:.2f} fps, {:.2f}x", run.threads, run.seconds,
+			run.frames / run.seconds, runs[0].seconds / run.seconds));
+	}
+	Console.WriteLn("============================================");
+	return true;
+}
+
+std::string GSRunner::GetDumpTitle(const std::string_view path)
+{
+	// strip off all extensions
+	std::string_view title(Path::GetFileTitle(path));
+	if (StringUtil::EndsWithNoCase(title, ".gs"))
+		title = Path::GetFileTitle(title);
+
+	return std::string(StringUtil::StripWhitespace(title));
+}
+
+bool GSRunner::AddBatchDumps(const std::string& path)
+{
+	if (FileSystem::DirectoryExists(path.c_str()))
+	{
+		FileSystem::FindResultsArray files;
+		FileSystem::FindFiles(path.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_SORT_BY_NAME, &files);
+		for (const FILESYSTEM_FIND_DATA& fd : files)
+		{
+			if (VMManager::IsGSDumpFileName(fd.FileName))
+				s_batch_paths.push_back(fd.FileName);
+		}
+
+		return true;
+	}
+
+	const std::optional<std::string> list = FileSystem::ReadFileToString(path.c_str());
+	if (!list.has_value())
+	{
+		Console.ErrorFmt("Unable to read batch list {}.", path);
+		return false;
+	}
+
+	// one dump per line, relative to the list
+	for (const std::string_view line : StringUtil::SplitString(list.value(), '\n'))
+	{
+		const std::string_view entry = StringUtil::StripWhitespace(line);
+		if (entry.empty() || entry[0] == '#')
+			continue;
+
+		std::string dump_path = Path::IsAbsolute(entry) ? std::string(entry) : Path::Combine(Path::GetDirectory(path), entry);
+		if (!VMManager::IsGSDumpFileName(dump_path))
+		{
+			Console.ErrorFmt("{} in batch list is not a GS dump.", entry);
+			return false;
+		}
+
+		s_batch_paths.push_back(std::move(dump_path));
+	}
+
+	return true;
+}
+
+void GSRunner::UpdateBatchStats(const std::string& frame_hashes)
+{
+	const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+	if (s_batch_stats.frames > 0)
+	{
+		s_batch_stats.frame_times.push_back(
+			static_cast<float>(Common::Timer::ConvertValueToMilliseconds(now - s_batch_stats.last_present)));
+	}
+	s_batch_stats.last_present = now;
+	s_batch_stats.frames++;
+
+	// perfmon resets every 30 frames to zero
+	const double draws = g_perfmon.GetCounter(GSPerfMon::Draw);
+	s_batch_stats.draws += static_cast<u64>((draws < s_batch_stats.last_draws) ? draws : (draws - s_batch_stats.last_draws));
+	s_batch_stats.last_draws = draws;
+
+	// chain the hashes of every presented frame, so a difference in any of them changes the result,
+	// local memory is only included if it was asked for with -framehashmem. reading back every frame
+	// would skew the frame times, so this only reuses the hashes -framehash already computed
+	if (!frame_hashes.empty())
+		s_batch_stats.hash = XXH3_64bits_withSeed(frame_hashes.data(), frame_hashes.size(), s_batch_stats.hash);
+
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+bool GSRunner::OpenFrameHashLog(const std::string_view relative_prefix)
+{
+	s_frame_hash_state.reference.clear();
+	s_frame_hash_state.has_reference = false;
+	s_frame_hash_state.mismatches = 0;
+
+	if (!s_frame_hash_ref_dir.empty())
+	{
+		const std::string ref_path = Path::Combine(s_frame_hash_ref_dir, fmt::format("{}.framehash", relative_prefix));
+		const std::optional<std::string> ref = FileSystem::ReadFileToString(ref_path.c_str());
+		if (ref.has_value())
+		{
+			// "frame hashes...", keyed by frame so looping and skipped frames line up
+			for (const std::string_view line : StringUtil::SplitString(ref.value(), '\n'))
+			{
+				const std::string_view::size_type sep = line.find(' ');
+				if (line.empty() || line[0] == '#' || sep == std::string_view::npos)
+					continue;
+
+				if (const std::optional<u32> frame = StringUtil::FromChars<u32>(line.substr(0, sep)); frame.has_value())
+					s_frame_hash_state.reference[frame.value()] = StringUtil::StripWhitespace(line.substr(sep + 1));
+			}
+		}
+		else
+		{
+			Console.WarningFmt("No reference frame hashes in {}, saving every frame.", ref_path);
+		}
+
+		s_frame_hash_state.has_reference = true;
+	}
+
+	const std::string path = fmt::format("{}.framehash", s_output_prefix);
+	Error error;
+	s_frame_hash_state.log = FileSystem::OpenManagedCFile(path.c_str(), "wb", &error);
+	if (!s_frame_hash_state.log)
+	{
+		Console.ErrorFmt("Failed to open {}: {}", path, error.GetDescription());
+		return false;
+	}
+
+	std::fprintf(s_frame_hash_state.log.get(), "# frame width x height, XXH3 of the frame");
+	for (const auto& [offset, size] : s_frame_hash_regions)
+		std::fprintf(s_frame_hash_state.log.get(), ", local memory %x+%x", offset, size);
+	std::fputc('\n', s_frame_hash_state.log.get());
+
+	std::atomic_thread_fence(std::memory_order_release);
+	return true;
+}
+
+u32 GSRunner::CloseFrameHashLog()
+{
+	std::atomic_thread_fence(std::memory_order_acquire);
+	s_frame_hash_state.log.reset();
+	s_frame_hash_state.reference.clear();
+	s_frame_hash_state.pixels = {};
+
+	if (s_frame_hash_state.has_reference)
+		Console.WriteLn(fmt::format("@FRAMEHASH@ {} frames differ from the reference", s_frame_hash_state.mismatches));
+
+	return s_frame_hash_state.mismatches;
+}
+
+std::string GSRunner::GetFrameHashes(u32* width, u32* height)
+{
+	// same image the frame dump would have saved
+	const bool internal_resolution = (GSConfig.ScreenshotSize >= GSScreenshotSize::InternalResolution);
+	const bool aspect_correct = (GSConfig.ScreenshotSize != GSScreenshotSize::InternalResolutionUncorrected);
+
+	std::vector<u32>& pixels = s_frame_hash_state.pixels;
+	GSSaveSnapshotToMemory(internal_resolution ? 0 : g_gs_device->GetWindowWidth(),
+		internal_resolution ? 0 : g_gs_device->GetWindowHeight(), aspect_correct, true, width, height, &pixels);
+
+	std::string hashes = fmt::format("{}x{} {:016x}", *width, *height, GSXXH3_64bits(pixels.data(), pixels.size() * sizeof(u32)));
+	for (const auto& [offset, size] : s_frame_hash_regions)
+		fmt::format_to(std::back_inserter(hashes), " {:016x}", GSXXH3_64bits(g_gs_renderer->m_mem.vm8() + offset, size));
+
+	return hashes;
+}
+
+std::string GSRunner::HashFrame()
+{
+	if (!s_frame_hash_state.log)
+		return {};
+
+	u32 width, height;
+	std::string hashes = GetFrameHashes(&width, &height);
+	std::fprintf(s_frame_hash_state.log.get(), "%u %s\n", s_dump_frame_number, hashes.c_str());
+
+	if (!s_frame_hash_state.has_reference)
+		return hashes;
+
+	const auto it = s_frame_hash_state.reference.find(s_dump_frame_number);
+	if (it != s_frame_hash_state.reference.end() && it->second == hashes)
+		return hashes;
+
+	s_frame_hash_state.mismatches++;
+	if (width == 0 || height == 0)
+		return hashes;
+
+	RGBA8Image image;
+	image.SetPixels(width, height, std::move(s_frame_hash_state.pixels));
+
+	const std::string dump_path(fmt::format("{}_frame{:05}.png", s_output_prefix, s_dump_frame_number));
+	if (!image.SaveToFile(dump_path.c_str()))
+		Console.ErrorFmt("Failed to save {}", dump_path);
+
+	return hashes;
+}
+
+static std::string EscapeJSONString(const std::string_view str)
+{
+	std::string ret;
+	ret.reserve(str.size());
+	for (const char ch : str)
+	{
+		if (ch == '"' || ch == '\\')
+		{
+			ret.push_back('\\');
+			ret.push_back(ch);
+		}
+		else if (static_cast<unsigned char>(ch) < 0x20)
+		{
+			fmt::format_to(std::back_inserter(ret), "\\u{:04x}", static_cast<unsigned>(ch));
+		}
+		else
+		{
+			ret.push_back(ch);
+		}
+	}
+
+	return ret;
+}
+
+bool GSRunner::RunBatch()
+{
+	struct Result
+	{
+		std::string path;
+		std::string error;
+		u32 frames;
+		u64 draws;
+		u64 hash;
+		u32 frame_hash_mismatches;
+		double seconds;
+		double frame_ms_avg;
+		double frame_ms_p99;
+		double frame_ms_max;
+	};
+	std::vector<Result> results;
+	results.reserve(s_batch_paths.size());
+
+	// each dump precompiles the software renderer functions that the ones before it generated
+	GSCodeCache::SetShared(true);
+	s_batch_mode = true;
+
+	const bool dump_gs_data = s_settings_interface.GetBoolValue("EmuCore/GS", "DumpGSData", false);
+	const bool hw_dump_dir_set = !s_settings_interface.GetStringValue("EmuCore/GS", "HWDumpDirectory").empty();
+	const bool sw_dump_dir_set = !s_settings_interface.GetStringValue("EmuCore/GS", "SWDumpDirectory").empty();
+
+	u32 failed = 0;
+	for (size_t i = 0; i < s_batch_paths.size(); i++)
+	{
+		Result& result = results.emplace_back();
+		result.path = s_batch_paths[i];
+
+		const std::string title = GetDumpTitle(result.path);
+		Console.WriteLn(fmt::format("({}/{}) Replaying {}", i + 1, s_batch_paths.size(), title));
+
+		if (!s_batch_output_dir.empty())
+		{
+			const std::string dir = Path::Combine(s_batch_output_dir, title);
+			if (!FileSystem::DirectoryExists(dir.c_str()) && !FileSystem::CreateDirectoryPath(dir.c_str(), false))
+			{
+				result.error = fmt::format("Failed to create output directory {}", dir);
+				Console.Error(result.error);
+				failed++;
+				continue;
+			}
+
+			if (dump_gs_data)
+			{
+				if (!hw_dump_dir_set)
+					s_settings_interface.SetStringValue("EmuCore/GS", "HWDumpDirectory", dir.c_str());
+				if (!sw_dump_dir_set)
+					s_settings_interface.SetStringValue("EmuCore/GS", "SWDumpDirectory", dir.c_str());
+				VMManager::ApplySettings();
+			}
+			else
+			{
+				s_output_prefix = Path::Combine(dir, title);
+			}
+		}
+
+		if (s_frame_hash && !OpenFrameHashLog(Path::Combine(title, title)))
+		{
+			result.error = "Failed to open frame hash log";
+			failed++;
+			continue;
+		}
+
+		s_batch_stats = {};
+		s_dump_frame_number = 0;
+		s_loop_number = s_loop_count;
+		std::atomic_thread_fence(std::memory_order_release);
+
+		VMBootParameters params;
+		params.filename = result.path;
+
+		Error error;
+		Common::Timer timer;
+		if (VMManager::Initialize(params, &error) != VMBootResult::StartupSuccess)
+		{
+			result.error = error.GetDescription();
+			Console.ErrorFmt("Failed to start {}: {}", title, result.error);
+			if (s_frame_hash)
+				CloseFrameHashLog();
+			failed++;
+			continue;
+		}
+
+		GSDumpReplayer::SetLoopCount(s_loop_count);
+		VMManager::SetState(VMState::Running);
+		while (VMManager::GetState() == VMState::Running)
+			VMManager::Execute();
+		VMManager::Shutdown(false);
+
+		result.seconds = timer.GetTimeSeconds();
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (s_frame_hash)
+			result.frame_hash_mismatches = CloseFrameHashLog();
+
+		result.frames = s_batch_stats.frames;
+		result.draws = s_batch_stats.draws;
+		result.hash = s_batch_stats.hash;
+
+		std::vector<float>& frame_times = s_batch_stats.frame_times;
+		if (!frame_times.empty())
+		{
+			double sum = 0.0;
+			for (const float ms : frame_times)
+				sum += ms;
+
+			std::sort(frame_times.begin(), frame_times.end());
+			result.frame_ms_avg = sum / frame_times.size();
+			result.frame_ms_p99 = frame_times[(frame_times.size() - 1) * 99 / 100];
+			result.frame_ms_max = frame_times.back();
+		}
+
+		if (s_frame_hash)
+		{
+			Console.WriteLn(fmt::format("@BATCH@ {}: {} frames in {:.3f} s, {} draws, hash {:016x}", title, result.frames,
+				result.seconds, result.draws, result.hash));
+		}
+		else
+		{
+			Console.WriteLn(fmt::format("@BATCH@ {}: {} frames in {:.3f} s, {} draws", title, result.frames,
+				result.seconds, result.draws));
+		}
+	}
+
+	s_batch_mode = false;
+	GSCodeCache::SetShared(false);
+
+	Console.WriteLn(fmt::format("======= BATCH OF {} DUMPS, {} FAILED ========", results.size(), failed));
+
+	if (!s_batch_summary_path.empty())
+	{
+		std::string json;
+		fmt::format_to(std::back_inserter(json), "{{\n\t\"version\": \"{}\",\n\t\"renderer\": \"{}\",\n\t\"dumps\": [", GIT_REV,
+			Pcsx2Config::GSOptions::GetRendererName(EmuConfig.GS.Renderer));
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			const Result& result = results[i];
+			fmt::format_to(std::back_inserter(json),
+				"{}\n\t\t{{\"name\": \"{}\", \"path\": \"{}\", \"success\": {}, \"error\": \"{}\", \"frames\": {}, "
+				"\"seconds\": {:.3f}, \"frame_ms_avg\": {:.3f}, \"frame_ms_p99\": {:.3f}, \"frame_ms_max\": {:.3f}, "
+				"\"draws\": {}, \"hash\": {}, \"frame_hash_mismatches\": {}}}",
+				(i > 0) ? "," : "", EscapeJSONString(GetDumpTitle(result.path)), EscapeJSONString(result.path),
+				result.error.empty(), EscapeJSONString(result.error), result.frames, result.seconds, result.frame_ms_avg,
+				result.frame_ms_p99, result.frame_ms_max, result.draws,
+				s_frame_hash ? fmt::format("\"{:016x}\"", result.hash) : std::string("null"), result.frame_hash_mismatches);
+		}
+		json += "\n\t]\n}\n";
+
+		if (!FileSystem::WriteStringToFile(s_batch_summary_path.c_str(), json))
+		{
+			Console.ErrorFmt("Failed to write batch summary to {}.", s_batch_summary_path);
+			return false;
+		}
+
+		Console.WriteLn(fmt::format("Wrote batch summary to {}", s_batch_summary_path));
+	}
+
+	return (failed == 0);
+}
+
 #ifdef _WIN32
 // We can't handle unicode in filenames if we don't use wmain on Win32.
 #define main real_main
@@ -860,8 +1582,21 @@ static void CPUThreadMain(VMBootParameters* params, std::atomic<int>* ret)
 		// apply new settings (e.g. pick up renderer change)
 		VMManager::ApplySettings();
 		GSDumpReplayer::SetIsDumpRunner(true);
+		if (s_loop_count == 1)
+			GSDumpReplayer::SetLastFrame(s_dump_last_frame);
 
-		if (VMManager::Initialize(*params) == VMBootResult::StartupSuccess)
+		if (!s_batch_paths.empty())
+		{
+			if (GSRunner::RunBatch())
+				ret->store(EXIT_SUCCESS);
+		}
+		else if (s_swthreads_scaling_first >= 0)
+		{
+			if (GSRunner::RunSWThreadScaling(*params))
+				ret->store(EXIT_SUCCESS);
+		}
+		else if ((!s_frame_hash || GSRunner::OpenFrameHashLog(GSRunner::GetDumpTitle(params->filename))) &&
+				 VMManager::Initialize(*params) == VMBootResult::StartupSuccess)
 		{
 			// run until end
 			GSDumpReplayer::SetLoopCount(s_loop_count);
@@ -869,7 +1604,10 @@ static void CPUThreadMain(VMBootParameters* params, std::atomic<int>* ret)
 			while (VMManager::GetState() == VMState::Running)
 				VMManager::Execute();
 			VMManager::Shutdown(false);
+			if (s_frame_hash)
+				GSRunner::CloseFrameHashLog();
 			GSRunner::DumpStats();
+			GSRunner::DumpStereoRuleStats();
 			ret->store(EXIT_SUCCESS);
 		}
 	}
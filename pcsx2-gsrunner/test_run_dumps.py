@@ -1,5 +1,6 @@
 import argparse
 import glob
+import json
 import sys
 import os
 import subprocess
@@ -18,17 +19,8 @@ def get_gs_name(path):
     return None
 
 
-def run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, parallel, gspath):
+def get_runner_args(runner, renderer, upscale, renderhacks, parallel, framehash, refdir):
     args = [runner]
-    gsname = get_gs_name(gspath)
-
-    real_dumpdir = os.path.join(dumpdir, gsname).strip()
-    # Safe creation and skip if folder exists
-    try:
-        os.makedirs(real_dumpdir)
-    except FileExistsError:
-        # Folder already exists → skip this game
-        return
 
     if renderer is not None:
         args.extend(["-renderer", renderer])
@@ -39,9 +31,6 @@ def run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, paralle
     if renderhacks is not None:
         args.extend(["-renderhacks", renderhacks])
 
-    args.extend(["-dumpdir", real_dumpdir])
-    args.extend(["-logfile", os.path.join(real_dumpdir, "emulog.txt")])
-
     # loop a couple of times for those stubborn merge/interlace dumps that don't render anything
     # the first time around
     args.extend(["-loop", "2"])
@@ -50,8 +39,32 @@ def run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, paralle
     if parallel > 1:
         args.append("-noshadercache")
 
+    # hash frames instead of saving them, and only save the ones that changed from the reference run
+    if refdir is not None:
+        args.extend(["-framehashref", refdir])
+    elif framehash:
+        args.append("-framehash")
+
     # run surfaceless, we don't want tons of windows popping up
-    args.append("-surfaceless");
+    args.append("-surfaceless")
+    return args
+
+
+def run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir, gspath):
+    gsname = get_gs_name(gspath)
+
+    real_dumpdir = os.path.join(dumpdir, gsname).strip()
+    # Safe creation and skip if folder exists
+    try:
+        os.makedirs(real_dumpdir)
+    except FileExistsError:
+        # Folder already exists → skip this game
+        return
+
+    args = get_runner_args(runner, renderer, upscale, renderhacks, parallel, framehash,
+                           os.path.join(refdir, gsname) if refdir is not None else None)
+    args.extend(["-dumpdir", real_dumpdir])
+    args.extend(["-logfile", os.path.join(real_dumpdir, "emulog.txt")])
 
     # disable output console entirely
     environ = os.environ.copy()
@@ -73,7 +86,65 @@ def run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, paralle
     #print("Running '%s'" % (" ".join(args)))
     subprocess.run(args, env=environ, stdin=subprocess.DEVNULL, stderr=subprocess.DEVNULL, stdout=subprocess.DEVNULL, creationflags=creationflags)
 
-def run_regression_tests(runner, gsdir, dumpdir, renderer, upscale, renderhacks, parallel=1):
+def run_batch_shard(runner, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir, shard):
+    index, gamepaths = shard
+    list_path = os.path.join(dumpdir, "batch_%u.txt" % index)
+    summary_path = os.path.join(dumpdir, "summary_%u.json" % index)
+    with open(list_path, "w") as f:
+        f.write("\n".join(gamepaths) + "\n")
+
+    args = get_runner_args(runner, renderer, upscale, renderhacks, parallel, framehash, refdir)
+    args.extend(["-dumpdir", dumpdir])
+    args.extend(["-logfile", os.path.join(dumpdir, "emulog_%u.txt" % index)])
+    args.extend(["-batch", list_path])
+    args.extend(["-summary", summary_path])
+
+    environ = os.environ.copy()
+    environ["PCSX2_NOCONSOLE"] = "1"
+
+    subprocess.run(args, env=environ, stdin=subprocess.DEVNULL, stderr=subprocess.DEVNULL, stdout=subprocess.DEVNULL)
+    os.remove(list_path)
+
+    try:
+        with open(summary_path, "r") as f:
+            summary = json.load(f)
+        os.remove(summary_path)
+        return summary
+    except (OSError, ValueError):
+        # runner crashed, report every dump of the shard as failed
+        return {"dumps": [{"name": get_gs_name(path), "path": path, "success": False, "error": "Runner did not finish"} for path in gamepaths]}
+
+
+def run_batch_regression_tests(runner, gamepaths, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir):
+    # skip dumps that already have output, like the per-process mode
+    gamepaths = list(filter(lambda x: not os.path.exists(os.path.join(dumpdir, get_gs_name(x).strip())), gamepaths))
+    if not gamepaths:
+        return True
+
+    # each process replays a share of the dumps, so startup is only paid once per process
+    nshards = max(1, min(parallel, len(gamepaths)))
+    shards = [(i, gamepaths[i::nshards]) for i in range(nshards)]
+    print("Processing %u games in %u batches" % (len(gamepaths), nshards))
+
+    func = partial(run_batch_shard, runner, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir)
+    with multiprocessing.Pool(nshards) as pool:
+        summaries = pool.map(func, shards, chunksize=1)
+
+    summary = {"dumps": []}
+    for shard_summary in summaries:
+        summary.update({k: v for k, v in shard_summary.items() if k != "dumps"})
+        summary["dumps"].extend(shard_summary["dumps"])
+    summary["dumps"].sort(key=lambda x: x["name"])
+
+    with open(os.path.join(dumpdir, "summary.json"), "w") as f:
+        json.dump(summary, f, indent=1)
+
+    failed = sum(1 for dump in summary["dumps"] if not dump["success"])
+    print("Processed %u GS dumps, %u failed" % (len(summary["dumps"]), failed))
+    return True
+
+
+def run_regression_tests(runner, gsdir, dumpdir, renderer, upscale, renderhacks, parallel=1, batch=False, framehash=False, refdir=None):
     paths = glob.glob(gsdir + "/*.*", recursive=True)
     gamepaths = list(filter(lambda x: get_gs_name(x) is not None, paths))
 
@@ -84,12 +155,15 @@ def run_regression_tests(runner, gsdir, dumpdir, renderer, upscale, renderhacks,
 
     print("Found %u GS dumps" % len(gamepaths))
 
+    if batch:
+        return run_batch_regression_tests(runner, gamepaths, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir)
+
     if parallel <= 1:
         for game in gamepaths:
-            run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, parallel, game)
+            run_regression_test(runner, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir, game)
     else:
         print("Processing %u games on %u processors" % (len(gamepaths), parallel))
-        func = partial(run_regression_test, runner, dumpdir, renderer, upscale, renderhacks, parallel)
+        func = partial(run_regression_test, runner, dumpdir, renderer, upscale, renderhacks, parallel, framehash, refdir)
         pool = multiprocessing.Pool(parallel)
         completed = 0
         for _ in pool.imap_unordered(func, gamepaths, chunksize=1):
@@ -110,10 +184,13 @@ if __name__ == "__main__":
     parser.add_argument("-upscale", action="store", type=float, default=1, help="Upscaling multiplier to use")
     parser.add_argument("-renderhacks", action="store", required=False, type=str.strip, help="Enable HW Rendering hacks")
     parser.add_argument("-parallel", action="store", type=int, default=1, help="Number of processes to run")
+    parser.add_argument("-batch", action="store_true", help="Replay many dumps per process and write summary.json")
+    parser.add_argument("-framehash", action="store_true", help="Write frame hashes instead of images")
+    parser.add_argument("-refdir", action="store", required=False, type=str.strip, help="Dump directory of an earlier -framehash run, only frames that differ from it are saved")
 
     args = parser.parse_args()
 
-    if not run_regression_tests(args.runner, os.path.realpath(args.gsdir), os.path.realpath(args.dumpdir), args.renderer, args.upscale, args.renderhacks, args.parallel):
+    if not run_regression_tests(args.runner, os.path.realpath(args.gsdir), os.path.realpath(args.dumpdir), args.renderer, args.upscale, args.renderhacks, args.parallel, args.batch, args.framehash, os.path.realpath(args.refdir) if args.refdir else None):
         sys.exit(1)
     else:
         sys.exit(0)
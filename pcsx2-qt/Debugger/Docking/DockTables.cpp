@@ -5,6 +5,7 @@
 
 #include "Debugger/DebuggerEvents.h"
 #include "Debugger/DisassemblyView.h"
+#include "Debugger/HotBlockView.h"
 #include "Debugger/ModuleView.h"
 #include "Debugger/RegisterView.h"
 #include "Debugger/StackView.h"
@@ -42,6 +43,7 @@ const std::map<std::string, DockTables::DebuggerViewDescription> DockTables::DEB
 	DEBUGGER_VIEW(DisassemblyView, QT_TRANSLATE_NOOP("DebuggerView", "Disassembly"), TOP_RIGHT),
 	DEBUGGER_VIEW(FunctionTreeView, QT_TRANSLATE_NOOP("DebuggerView", "Functions"), TOP_LEFT),
 	DEBUGGER_VIEW(GlobalVariableTreeView, QT_TRANSLATE_NOOP("DebuggerView", "Globals"), BOTTOM_MIDDLE),
+	DEBUGGER_VIEW(HotBlockView, QT_TRANSLATE_NOOP("DebuggerView", "Hot Blocks"), BOTTOM_MIDDLE),
 	DEBUGGER_VIEW(LocalVariableTreeView, QT_TRANSLATE_NOOP("DebuggerView", "Locals"), BOTTOM_MIDDLE),
 	DEBUGGER_VIEW(MemorySearchView, QT_TRANSLATE_NOOP("DebuggerView", "Memory Search"), TOP_LEFT),
 	DEBUGGER_VIEW(MemoryView, QT_TRANSLATE_NOOP("DebuggerView", "Memory"), BOTTOM_MIDDLE),
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "HotBlockModel.h"
+
+#include "QtUtils.h"
+
+HotBlockModel::HotBlockModel(QObject* parent)
+	: QAbstractTableModel(parent)
+{
+}
+
+int HotBlockModel::rowCount(const QModelIndex&) const
+{
+	return static_cast<int>(entries().size());
+}
+
+int HotBlockModel::columnCount(const QModelIndex&) const
+{
+	return HotBlockModel::COLUMN_COUNT;
+}
+
+QVariant HotBlockModel::data(const QModelIndex& index, int role) const
+{
+	const size_t row = static_cast<size_t>(index.row());
+	if (row >= entries().size())
+		return QVariant();
+
+	const HotBlockProfiler::Entry& entry = entries()[row];
+
+	if (role == Qt::DisplayRole)
+	{
+		switch (index.column())
+		{
+			case HotBlockModel::HotBlockColumns::NAME:
+				return entry.name.empty() ? tr("(unknown)") : QString::fromStdString(entry.name);
+			case HotBlockModel::HotBlockColumns::ADDRESS:
+				return QtUtils::FilledQStringFromValue(entry.address, 16);
+			case HotBlockModel::HotBlockColumns::SAMPLES:
+				return QString::number(entry.samples);
+			case HotBlockModel::HotBlockColumns::PERCENT:
+			{
+				if (m_results.total_samples == 0)
+					return QString();
+				const double percent = static_cast<double>(entry.samples) * 100.0 / static_cast<double>(m_results.total_samples);
+				return QStringLiteral("%1%").arg(percent, 0, 'f', 2);
+			}
+			case HotBlockModel::HotBlockColumns::BLOCKS:
+				return QString::number(entry.blocks);
+		}
+	}
+	else if (role == Qt::UserRole)
+	{
+		switch (index.column())
+		{
+			case HotBlockModel::HotBlockColumns::NAME:
+				return QString::fromStdString(entry.name);
+			case HotBlockModel::HotBlockColumns::ADDRESS:
+				return entry.address;
+			case HotBlockModel::HotBlockColumns::SAMPLES:
+			case HotBlockModel::HotBlockColumns::PERCENT:
+				return static_cast<qulonglong>(entry.samples);
+			case HotBlockModel::HotBlockColumns::BLOCKS:
+				return entry.blocks;
+		}
+	}
+	return QVariant();
+}
+
+QVariant HotBlockModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
+	{
+		switch (section)
+		{
+			case HotBlockColumns::NAME:
+				//: Warning: short space limit. Abbreviate if needed. // Name of the guest function the samples belong to.
+				return tr("FUNCTION");
+			case HotBlockColumns::ADDRESS:
+				//: Warning: short space limit. Abbreviate if needed.
+				return tr("ADDRESS");
+			case HotBlockColumns::SAMPLES:
+				//: Warning: short space limit. Abbreviate if needed. // Number of times the profiler found the EE running this code.
+				return tr("SAMPLES");
+			case HotBlockColumns::PERCENT:
+				//: Warning: short space limit. Abbreviate if needed. // Share of all samples.
+				return tr("PERCENT");
+			case HotBlockColumns::BLOCKS:
+				//: Warning: short space limit. Abbreviate if needed. // Number of recompiled blocks.
+				return tr("BLOCKS");
+			default:
+				return QVariant();
+		}
+	}
+	return QVariant();
+}
+
+void HotBlockModel::setShowBlocks(bool show_blocks)
+{
+	beginResetModel();
+	m_show_blocks = show_blocks;
+	endResetModel();
+}
+
+void HotBlockModel::refreshData()
+{
+	beginResetModel();
+	m_results = HotBlockProfiler::GetResults();
+	endResetModel();
+}
+
+const std::vector<HotBlockProfiler::Entry>& HotBlockModel::entries() const
+{
+	return m_show_blocks ? m_results.blocks : m_results.functions;
+}
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include <QtCore/QAbstractTableModel>
+#include <QtWidgets/QHeaderView>
+
+#include "DebugTools/HotBlockProfiler.h"
+
+class HotBlockModel : public QAbstractTableModel
+{
+	Q_OBJECT
+
+public:
+	enum HotBlockColumns : int
+	{
+		NAME = 0,
+		ADDRESS,
+		SAMPLES,
+		PERCENT,
+		BLOCKS,
+		COLUMN_COUNT
+	};
+
+	static constexpr QHeaderView::ResizeMode HeaderResizeModes[HotBlockColumns::COLUMN_COUNT] =
+		{
+			QHeaderView::ResizeMode::Stretch,
+			QHeaderView::ResizeMode::ResizeToContents,
+			QHeaderView::ResizeMode::ResizeToContents,
+			QHeaderView::ResizeMode::ResizeToContents,
+			QHeaderView::ResizeMode::ResizeToContents,
+		};
+
+	explicit HotBlockModel(QObject* parent = nullptr);
+
+	int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+	int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+	QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+	const HotBlockProfiler::Results& results() const { return m_results; }
+
+	// Show individual blocks rather than the functions they belong to.
+	void setShowBlocks(bool show_blocks);
+	void refreshData();
+
+private:
+	const std::vector<HotBlockProfiler::Entry>& entries() const;
+
+	HotBlockProfiler::Results m_results;
+	bool m_show_blocks = false;
+};
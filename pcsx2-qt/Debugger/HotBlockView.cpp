@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "HotBlockView.h"
+
+#include "QtHost.h"
+#include "QtUtils.h"
+
+#include "common/Error.h"
+
+#include <QtGui/QClipboard>
+#include <QtWidgets/QFileDialog>
+#include <QtWidgets/QMenu>
+#include <QtWidgets/QMessageBox>
+
+HotBlockView::HotBlockView(const DebuggerViewParameters& parameters)
+	: DebuggerView(parameters, MONOSPACE_FONT | DISALLOW_MULTIPLE_INSTANCES)
+	, m_model(new HotBlockModel(this))
+	, m_refresh_timer(new QTimer(this))
+{
+	m_ui.setupUi(this);
+	m_ui.hotList->setModel(m_model);
+	m_ui.hotList->horizontalHeader()->setSectionsMovable(true);
+
+	m_ui.hotList->setContextMenuPolicy(Qt::CustomContextMenu);
+	connect(m_ui.hotList, &QTableView::customContextMenuRequested, this, &HotBlockView::openContextMenu);
+	connect(m_ui.hotList, &QTableView::doubleClicked, this, &HotBlockView::onDoubleClick);
+
+	m_ui.hotList->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeMode::ResizeToContents);
+	for (std::size_t i = 0; auto mode : HotBlockModel::HeaderResizeModes)
+	{
+		m_ui.hotList->horizontalHeader()->setSectionResizeMode(i, mode);
+		i++;
+	}
+
+	connect(m_ui.startStopButton, &QPushButton::clicked, this, &HotBlockView::onStartStopClicked);
+	connect(m_ui.resetButton, &QPushButton::clicked, this, &HotBlockView::onResetClicked);
+	connect(m_ui.saveButton, &QPushButton::clicked, this, &HotBlockView::onSaveCSVClicked);
+	connect(m_ui.groupBy, &QComboBox::currentIndexChanged, this, [this](int index) {
+		m_model->setShowBlocks(index == 1);
+	});
+
+	// Starting and stopping happen on the CPU thread, so poll rather than wait for them.
+	connect(m_refresh_timer, &QTimer::timeout, this, &HotBlockView::refresh);
+	m_refresh_timer->start(1000);
+
+	receiveEvent<DebuggerEvents::Refresh>([this](const DebuggerEvents::Refresh& event) -> bool {
+		m_model->refreshData();
+		updateStatus();
+		return true;
+	});
+}
+
+void HotBlockView::openContextMenu(QPoint pos)
+{
+	QMenu* menu = new QMenu(m_ui.hotList);
+	menu->setAttribute(Qt::WA_DeleteOnClose);
+
+	if (m_ui.hotList->selectionModel()->hasSelection())
+	{
+		QAction* copy = menu->addAction(tr("Copy"));
+		connect(copy, &QAction::triggered, [this]() {
+			const QItemSelectionModel* selection_model = m_ui.hotList->selectionModel();
+			if (!selection_model->hasSelection())
+				return;
+
+			QGuiApplication::clipboard()->setText(m_model->data(selection_model->currentIndex()).toString());
+		});
+
+		QAction* go_to_in_disassembly = menu->addAction(tr("Go to in Disassembly"));
+		connect(go_to_in_disassembly, &QAction::triggered, [this]() {
+			const QModelIndex index = m_ui.hotList->selectionModel()->currentIndex();
+			goToInDisassembler(m_model->data(m_model->index(index.row(), HotBlockModel::ADDRESS), Qt::UserRole).toUInt(), true);
+		});
+
+		menu->addSeparator();
+	}
+
+	QAction* copy_all_as_csv = menu->addAction(tr("Copy all as CSV"));
+	connect(copy_all_as_csv, &QAction::triggered, [this]() {
+		QGuiApplication::clipboard()->setText(QtUtils::AbstractItemModelToCSV(m_ui.hotList->model()));
+	});
+
+	menu->popup(m_ui.hotList->viewport()->mapToGlobal(pos));
+}
+
+void HotBlockView::onDoubleClick(const QModelIndex& index)
+{
+	goToInDisassembler(m_model->data(m_model->index(index.row(), HotBlockModel::ADDRESS), Qt::UserRole).toUInt(), true);
+}
+
+void HotBlockView::onStartStopClicked()
+{
+	if (HotBlockProfiler::IsRunning())
+	{
+		Host::RunOnCPUThread([] { HotBlockProfiler::Stop(); });
+		return;
+	}
+
+	// The profiler samples whichever thread starts it.
+	Host::RunOnCPUThread([] {
+		Error error;
+		if (!HotBlockProfiler::Start(HotBlockProfiler::DEFAULT_INTERVAL_MS, &error))
+			Host::ReportErrorAsync(TRANSLATE_SV("HotBlockView", "Hot Block Profiler"), error.GetDescription());
+	});
+}
+
+void HotBlockView::onResetClicked()
+{
+	HotBlockProfiler::Reset();
+	m_model->refreshData();
+	updateStatus();
+}
+
+void HotBlockView::onSaveCSVClicked()
+{
+	const QString path = QFileDialog::getSaveFileName(this, tr("Save Hot Blocks"), QString(), tr("CSV Files (*.csv)"));
+	if (path.isEmpty())
+		return;
+
+	Error error;
+	if (!HotBlockProfiler::WriteCSV(path.toStdString(), &error))
+		QMessageBox::critical(this, tr("Debugger"), QString::fromStdString(error.GetDescription()));
+}
+
+void HotBlockView::refresh()
+{
+	// Pick up the last batch of samples after stopping too.
+	const bool running = HotBlockProfiler::IsRunning();
+	if (running || m_was_running)
+		m_model->refreshData();
+
+	m_was_running = running;
+	updateStatus();
+}
+
+void HotBlockView::updateStatus()
+{
+	const bool running = HotBlockProfiler::IsRunning();
+	m_ui.startStopButton->setText(running ? tr("Stop") : tr("Start"));
+
+	const HotBlockProfiler::Results& results = m_model->results();
+	QString status = tr("%n sample(s)", nullptr, static_cast<int>(results.total_samples));
+	if (results.total_samples != results.attributed_samples)
+		status += tr(", %1 outside recompiled code").arg(results.total_samples - results.attributed_samples);
+	if (results.dropped_samples != 0)
+		status += tr(", %1 dropped").arg(results.dropped_samples);
+	m_ui.statusLabel->setText(status);
+}
@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "ui_HotBlockView.h"
+
+#include "DebuggerView.h"
+#include "HotBlockModel.h"
+
+#include <QtCore/QTimer>
+
+class HotBlockView final : public DebuggerView
+{
+	Q_OBJECT
+
+public:
+	HotBlockView(const DebuggerViewParameters& parameters);
+
+	void openContextMenu(QPoint pos);
+	void onDoubleClick(const QModelIndex& index);
+
+private:
+	void onStartStopClicked();
+	void onResetClicked();
+	void onSaveCSVClicked();
+	void refresh();
+	void updateStatus();
+
+	Ui::HotBlockView m_ui;
+
+	HotBlockModel* m_model;
+	QTimer* m_refresh_timer;
+	bool m_was_running = false;
+};
@@ -182,6 +182,10 @@ extern void cdvdWrite(u8 key, u8 rt);
 extern void cdvdGetDiscInfo(std::string* out_serial, std::string* out_elf_path, std::string* out_version, u32* out_crc,
 	CDVDDiscType* out_disc_type);
 extern u32 cdvdGetElfCRC(const std::string& path);
+
+// Like cdvdDetectImageDiskType() and cdvdGetDiscInfo() together, but reads the image directly
+// instead of going through the global CDVD source, so it can be used from several threads at once.
+extern bool cdvdGetImageInfo(const std::string& path, s32* out_disc_type, std::string* out_serial, u32* out_crc, Error* error);
 extern bool cdvdLoadElf(ElfObject* elfo, const std::string_view elfpath, bool isPSXElf, Error* error);
 extern bool cdvdLoadDiscElf(ElfObject* elfo, IsoReader& isor, const std::string_view elfpath, bool isPSXElf, Error* error);
 
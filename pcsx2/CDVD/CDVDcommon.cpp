@@ -69,10 +69,10 @@ static void CheckNullCDVD()
 //////////////////////////////////////////////////////////////////////////////////////////
 // Disk Type detection stuff (from cdvdGigaherz)
 //
-static int CheckDiskTypeFS(int baseType)
+static int CheckDiskTypeFS(int baseType, InputIsoFile* iso = nullptr)
 {
 	IsoReader isor;
-	if (isor.Open())
+	if (iso ? isor.Open(iso) : isor.Open())
 	{
 		std::vector<u8> data;
 		if (isor.ReadFile("SYSTEM.CNF", &data))
@@ -519,6 +519,21 @@ s32 DoCDVDgetBuffer(u8* buffer)
 	return ret;
 }
 
+s32 cdvdDetectImageDiskType(InputIsoFile& iso)
+{
+	// What FindDiskType() ends up with for the ISO source, which always has a single data track.
+	int type = CDVD_TYPE_DETCTDVDS;
+	if (iso.GetBlockCount() <= 452849)
+	{
+		// Same volume descriptor hack as FindDiskType(). Sector data starts 24 bytes in.
+		u8 buffer[CD_FRAMESIZE_RAW];
+		if (iso.ReadSync(buffer, 16) >= 0 && *(u16*)(buffer + 24 + 166) == *(u16*)(buffer + 24 + 171))
+			type = CDVD_TYPE_DETCTCD;
+	}
+
+	return CheckDiskTypeFS(type, &iso);
+}
+
 s32 DoCDVDdetectDiskType()
 {
 	CheckNullCDVD();
@@ -440,6 +440,48 @@ int ChdFileReader::ReadChunk(void* dst, s64 chunkID)
 	return hunk_size;
 }
 
+u32 ChdFileReader::OpenWorkerReaders(u32 count)
+{
+	for (u32 i = 0; i < count; i++)
+	{
+		Error error;
+		auto fp = FileSystem::OpenManagedSharedCFile(m_filename.c_str(), "rb", FileSystem::FileShareMode::DenyWrite, &error);
+		chd_file* chd = fp ? OpenCHD(m_filename, std::move(fp), &error, 0) : nullptr;
+		if (!chd)
+		{
+			Console.ErrorFmt("Failed to open CHD prefetch reader: {}", error.GetDescription());
+			CloseWorkerReaders();
+			return 0;
+		}
+
+		WorkerChdFiles.push_back(chd);
+	}
+
+	return count;
+}
+
+void ChdFileReader::CloseWorkerReaders()
+{
+	for (chd_file* chd : WorkerChdFiles)
+		chd_close(chd);
+	WorkerChdFiles.clear();
+}
+
+int ChdFileReader::ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker)
+{
+	if (chunkID < 0)
+		return -1;
+
+	chd_error error = chd_read(WorkerChdFiles[worker], chunkID, dst);
+	if (error != CHDERR_NONE)
+	{
+		Console.Error("CDVD: chd_read returned error: %s", chd_error_string(error));
+		return 0;
+	}
+
+	return hunk_size;
+}
+
 void ChdFileReader::Close2()
 {
 	if (ChdFile)
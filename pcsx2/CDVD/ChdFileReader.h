@@ -25,10 +25,18 @@ public:
 	void Close2(void) override;
 	uint GetBlockCount(void) const override;
 
+protected:
+	bool UsesChunkCache() const override { return true; }
+	u32 OpenWorkerReaders(u32 count) override;
+	void CloseWorkerReaders() override;
+	int ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker) override;
+
 private:
 	bool ParseTOC(u64* out_frame_count);
 
 	chd_file* ChdFile = nullptr;
+	// libchdr keeps the hunk cache and decompressors in chd_file, so each prefetch worker opens its own.
+	std::vector<chd_file*> WorkerChdFiles;
 	u64 file_size = 0;
 	u32 hunk_size = 0;
 };
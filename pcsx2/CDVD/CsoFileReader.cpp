@@ -148,12 +148,13 @@ bool CsoFileReader::InitializeBuffers(Error* error)
 	// We might read a bit of alignment too, so be prepared.
 	if (m_frameSize + (1 << m_indexShift) < CSO_READ_BUFFER_SIZE)
 	{
-		m_readBuffer = std::make_unique<u8[]>(CSO_READ_BUFFER_SIZE);
+		m_readBufferSize = CSO_READ_BUFFER_SIZE;
 	}
 	else
 	{
-		m_readBuffer = std::make_unique<u8[]>(m_frameSize + (1 << m_indexShift));
+		m_readBufferSize = m_frameSize + (1 << m_indexShift);
 	}
+	m_readBuffer = std::make_unique<u8[]>(m_readBufferSize);
 
 	const u32 indexSize = numFrames + 1;
 	m_index = std::make_unique<u32[]>(indexSize);
@@ -191,6 +192,7 @@ void CsoFileReader::Close2()
 		inflateEnd(&m_z_stream);
 
 	m_readBuffer.reset();
+	m_readBufferSize = 0;
 	m_index.reset();
 }
 
@@ -220,8 +222,64 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 	if (chunkID < 0)
 		return -1;
 
-	const u32 frame = chunkID;
+	return ReadFrame(dst, static_cast<u32>(chunkID), m_src, m_readBuffer.get(), &m_z_stream);
+}
+
+u32 CsoFileReader::OpenWorkerReaders(u32 count)
+{
+	m_workerContexts.resize(count);
+	for (u32 i = 0; i < count; i++)
+	{
+		WorkerContext& ctx = m_workerContexts[i];
+
+		// Precached images are read straight from memory, otherwise each worker needs its own file position.
+		if (!m_file_cache)
+		{
+			ctx.src = FileSystem::OpenCFile(m_filename.c_str(), "rb");
+			if (!ctx.src)
+				break;
+			ctx.readBuffer = std::make_unique<u8[]>(m_readBufferSize);
+		}
 
+		if (!m_uselz4)
+		{
+			if (inflateInit2(&ctx.zstream, -15) != Z_OK)
+				break;
+			ctx.zstream_initialized = true;
+		}
+
+		if (i + 1 == count)
+			return count;
+	}
+
+	Console.Error("Failed to create CSO prefetch readers.");
+	CloseWorkerReaders();
+	return 0;
+}
+
+void CsoFileReader::CloseWorkerReaders()
+{
+	for (WorkerContext& ctx : m_workerContexts)
+	{
+		if (ctx.src)
+			std::fclose(ctx.src);
+		if (ctx.zstream_initialized)
+			inflateEnd(&ctx.zstream);
+	}
+	m_workerContexts.clear();
+}
+
+int CsoFileReader::ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker)
+{
+	if (chunkID < 0)
+		return -1;
+
+	WorkerContext& ctx = m_workerContexts[worker];
+	return ReadFrame(dst, static_cast<u32>(chunkID), ctx.src, ctx.readBuffer.get(), &ctx.zstream);
+}
+
+int CsoFileReader::ReadFrame(void* dst, u32 frame, std::FILE* src, u8* readBuffer, z_stream* zs)
+{
 	// Grab the index data for the frame we're about to read.
 	const bool compressed = (m_index[frame + 0] & 0x80000000) == 0;
 	const u32 index0 = m_index[frame + 0] & 0x7FFFFFFF;
@@ -244,19 +302,18 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 		}
 
 		// Just read directly, easy.
-		if (FileSystem::FSeek64(m_src, frameRawPos, SEEK_SET) != 0)
+		if (FileSystem::FSeek64(src, frameRawPos, SEEK_SET) != 0)
 		{
 			Console.Error("Unable to seek to uncompressed CSO data.");
 			return 0;
 		}
-		return fread(dst, 1, m_frameSize, m_src);
+		return fread(dst, 1, m_frameSize, src);
 	}
 	else
 	{
 		// This might be less bytes than frameRawSize in case of padding on the last frame.
 		// This is because the index positions must be aligned.
 		u32 readRawBytes;
-		u8* readBuffer;
 		if (m_file_cache)
 		{
 			if (frameRawPos >= m_file_cache_size)
@@ -267,13 +324,12 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 		}
 		else
 		{
-			if (FileSystem::FSeek64(m_src, frameRawPos, SEEK_SET) != 0)
+			if (FileSystem::FSeek64(src, frameRawPos, SEEK_SET) != 0)
 			{
 				Console.Error("Unable to seek to compressed CSO data.");
 				return 0;
 			}
-			readBuffer = m_readBuffer.get();
-			readRawBytes = fread(m_readBuffer.get(), 1, frameRawSize, m_src);
+			readRawBytes = fread(readBuffer, 1, frameRawSize, src);
 		}
 
 		bool success = false;
@@ -290,20 +346,20 @@ int CsoFileReader::ReadChunk(void* dst, s64 chunkID)
 		}
 		else
 		{
-			m_z_stream.next_in = readBuffer;
-			m_z_stream.avail_in = readRawBytes;
-			m_z_stream.next_out = static_cast<Bytef*>(dst);
-			m_z_stream.avail_out = m_frameSize;
+			zs->next_in = readBuffer;
+			zs->avail_in = readRawBytes;
+			zs->next_out = static_cast<Bytef*>(dst);
+			zs->avail_out = m_frameSize;
 
-			const int status = inflate(&m_z_stream, Z_FINISH);
-			success = (status == Z_STREAM_END && m_z_stream.total_out == m_frameSize);
+			const int status = inflate(zs, Z_FINISH);
+			success = (status == Z_STREAM_END && zs->total_out == m_frameSize);
 		}
 
 		if (!success)
 			Console.Error(fmt::format("Unable to decompress CSO frame using {}", (m_uselz4)? "lz4":"zlib"));
 		
 		if (!m_uselz4)
-			inflateReset(&m_z_stream);
+			inflateReset(zs);
 
 		return success ? m_frameSize : 0;
 	}
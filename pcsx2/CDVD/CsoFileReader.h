@@ -27,19 +27,33 @@ public:
 
 	u32 GetBlockCount() const override;
 
+protected:
+	bool UsesChunkCache() const override { return true; }
+	u32 OpenWorkerReaders(u32 count) override;
+	void CloseWorkerReaders() override;
+	int ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker) override;
+
 private:
+	/// File handle and decompression state owned by a single prefetch worker.
+	struct WorkerContext
+	{
+		std::FILE* src = nullptr;
+		std::unique_ptr<u8[]> readBuffer;
+		z_stream zstream = {};
+		bool zstream_initialized = false;
+	};
+
 	static bool ValidateHeader(const CsoHeader& hdr, Error* error);
 	bool ReadFileHeader(Error* error);
 	bool InitializeBuffers(Error* error);
-	int ReadFromFrame(u8* dest, u64 pos, int maxBytes);
-	bool DecompressFrame(Bytef* dst, u32 frame, u32 readBufferSize);
-	bool DecompressFrame(u32 frame, u32 readBufferSize);
+	int ReadFrame(void* dst, u32 frame, std::FILE* src, u8* readBuffer, z_stream* zs);
 
 	u32 m_frameSize = 0;
 	u8 m_frameShift = 0;
 	u8 m_indexShift = 0;
 	bool m_uselz4 = false; // flag to enable LZ4 decompression (ZSO files)
 	std::unique_ptr<u8[]> m_readBuffer;
+	u32 m_readBufferSize = 0;
 
 	std::unique_ptr<u32[]> m_index;
 	u64 m_totalSize = 0;
@@ -48,4 +62,6 @@ private:
 	std::unique_ptr<u8[]> m_file_cache;
 	size_t m_file_cache_size = 0;
 	z_stream m_z_stream = {};
+	// Sized once in OpenWorkerReaders, z_stream can't be moved after init.
+	std::vector<WorkerContext> m_workerContexts;
 };
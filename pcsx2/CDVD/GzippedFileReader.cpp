@@ -240,6 +240,46 @@ int GzippedFileReader::ReadChunk(void* dst, s64 chunkID)
 	return extract(m_src, m_index, file_offset, static_cast<unsigned char*>(dst), read_len, &m_z_state);
 }
 
+u32 GzippedFileReader::OpenWorkerReaders(u32 count)
+{
+	m_workerContexts.resize(count);
+	for (WorkerContext& ctx : m_workerContexts)
+	{
+		ctx.src = FileSystem::OpenCFile(m_filename.c_str(), "rb");
+		if (!ctx.src)
+		{
+			Console.Error("Failed to open gzip prefetch reader.");
+			CloseWorkerReaders();
+			return 0;
+		}
+	}
+
+	return count;
+}
+
+void GzippedFileReader::CloseWorkerReaders()
+{
+	for (WorkerContext& ctx : m_workerContexts)
+	{
+		if (ctx.z_state.isValid)
+			inflateEnd(&ctx.z_state.strm);
+		if (ctx.src)
+			std::fclose(ctx.src);
+	}
+	m_workerContexts.clear();
+}
+
+int GzippedFileReader::ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker)
+{
+	if (chunkID < 0)
+		return -1;
+
+	WorkerContext& ctx = m_workerContexts[worker];
+	const s64 file_offset = chunkID * m_index->span;
+	const u32 read_len = static_cast<u32>(std::min<s64>(m_index->uncompressed_size - file_offset, m_index->span));
+	return extract(ctx.src, m_index, file_offset, static_cast<unsigned char*>(dst), read_len, &ctx.z_state);
+}
+
 u32 GzippedFileReader::GetBlockCount() const
 {
 	return (m_index->uncompressed_size + (m_blocksize - 1)) / m_blocksize;
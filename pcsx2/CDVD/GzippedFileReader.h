@@ -23,7 +23,20 @@ public:
 
 	u32 GetBlockCount() const override;
 
+protected:
+	bool UsesChunkCache() const override { return true; }
+	u32 OpenWorkerReaders(u32 count) override;
+	void CloseWorkerReaders() override;
+	int ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker) override;
+
 private:
+	/// File handle and inflate state owned by a single prefetch worker, the index is shared.
+	struct WorkerContext
+	{
+		std::FILE* src = nullptr;
+		zstate z_state = {};
+	};
+
 	static constexpr int GZFILE_SPAN_DEFAULT = (1048576 * 4); /* distance between direct access points when creating a new index */
 	static constexpr int GZFILE_READ_CHUNK_SIZE = (256 * 1024); /* zlib extraction chunks size (at 0-based boundaries) */
 	static constexpr int GZFILE_CACHE_SIZE_MB = 200; /* cache size for extracted data. must be at least GZFILE_READ_CHUNK_SIZE (in MB)*/
@@ -36,4 +49,6 @@ private:
 	std::FILE* m_src = nullptr;
 
 	zstate m_z_state = {};
+
+	std::vector<WorkerContext> m_workerContexts;
 };
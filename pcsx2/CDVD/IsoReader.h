@@ -11,6 +11,7 @@
 #include <vector>
 
 class Error;
+class InputIsoFile;
 
 class IsoReader
 {
@@ -140,10 +141,12 @@ public:
 
 	const ISOPrimaryVolumeDescriptor& GetPVD() const { return m_pvd; }
 
-	// TODO: Eventually we'll want to pass a handle to the currently-open file here.
-	// ... once I have the energy to make CDVD not depend on a global object.
+	// Reads through the global CDVD source.
 	bool Open(Error* error = nullptr);
 
+	// Reads from an image which is already open, without touching the global CDVD source.
+	bool Open(InputIsoFile* iso, Error* error = nullptr);
+
 	std::vector<std::string> GetFilesInDirectory(const std::string_view path, Error* error = nullptr);
 
 	std::optional<ISODirectoryEntry> LocateFile(const std::string_view path, Error* error);
@@ -163,4 +166,5 @@ private:
 		u32 directory_record_lba, u32 directory_record_size, Error* error);
 
 	ISOPrimaryVolumeDescriptor m_pvd = {};
+	InputIsoFile* m_iso = nullptr;
 };
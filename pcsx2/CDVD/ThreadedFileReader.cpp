@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "ThreadedFileReader.h"
+#include "Config.h"
 #include "Host.h"
 
 #include "common/Error.h"
@@ -17,6 +18,9 @@
 // If buffers are smaller than that, we can't keep up with linear reads
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
 
+// Number of back to back requests before we consider access sequential and start prefetching
+static constexpr u32 SEQUENTIAL_THRESHOLD = 2;
+
 ThreadedFileReader::ThreadedFileReader()
 {
 	m_readThread = std::thread([](ThreadedFileReader* r){ r->Loop(); }, this);
@@ -24,6 +28,7 @@ ThreadedFileReader::ThreadedFileReader()
 
 ThreadedFileReader::~ThreadedFileReader()
 {
+	StopWorkersAndClearCache();
 	m_quit = true;
 	(void)std::lock_guard<std::mutex>{m_mtx};
 	m_condition.notify_one();
@@ -120,7 +125,7 @@ void ThreadedFileReader::Loop()
 					}
 					else
 					{
-						int amt = ReadChunk(static_cast<char*>(buf->ptr) + bufsize, chunk.chunkID);
+						int amt = ReadChunkCached(static_cast<char*>(buf->ptr) + bufsize, chunk);
 						if (amt <= 0)
 							break;
 						buf->size.store(bufsize + amt, std::memory_order_release);
@@ -170,7 +175,7 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 		}
 		buf.size.store(0, std::memory_order_relaxed);
 	}
-	int size = ReadChunk(buf.ptr, block.chunkID);
+	int size = ReadChunkCached(buf.ptr, block);
 	if (size > 0)
 	{
 		buf.offset = block.offset;
@@ -208,7 +213,7 @@ bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 		}
 		else
 		{
-			int amt = ReadChunk(write, chunk.chunkID);
+			int amt = ReadChunkCached(write, chunk);
 			if (amt < static_cast<int>(chunk.length))
 				return false;
 			write += chunk.length;
@@ -220,6 +225,216 @@ bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 	return true;
 }
 
+bool ThreadedFileReader::UsesChunkCache() const
+{
+	return false;
+}
+
+u32 ThreadedFileReader::OpenWorkerReaders(u32 count)
+{
+	return 0;
+}
+
+void ThreadedFileReader::CloseWorkerReaders()
+{
+}
+
+int ThreadedFileReader::ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker)
+{
+	return -1;
+}
+
+int ThreadedFileReader::ReadChunkCached(void* dst, const Chunk& chunk)
+{
+	if (m_cacheCapacity == 0)
+		return ReadChunk(dst, chunk.chunkID);
+
+	std::unique_lock<std::mutex> lock(m_cacheMtx);
+	auto it = m_cacheMap.find(chunk.chunkID);
+	if (it != m_cacheMap.end())
+	{
+		CachedChunk& cc = *it->second;
+		m_cache.splice(m_cache.begin(), m_cache, it->second);
+		if (cc.pending)
+		{
+			cc.waiters++;
+			m_cacheCondition.wait(lock, [&cc]() { return !cc.pending; });
+			cc.waiters--;
+		}
+
+		if (cc.size > 0)
+		{
+			std::memcpy(dst, cc.data.get(), cc.size);
+			return static_cast<int>(cc.size);
+		}
+
+		// The worker couldn't read it, try again ourselves
+	}
+
+	lock.unlock();
+	const int size = ReadChunk(dst, chunk.chunkID);
+	if (size <= 0)
+		return size;
+
+	lock.lock();
+	it = m_cacheMap.find(chunk.chunkID);
+	CachedChunk& cc = (it != m_cacheMap.end()) ? *it->second : InsertChunk(chunk.chunkID, static_cast<u32>(size));
+	if (!cc.pending && cc.cap >= static_cast<u32>(size))
+	{
+		std::memcpy(cc.data.get(), dst, size);
+		cc.size = static_cast<u32>(size);
+	}
+
+	return size;
+}
+
+void ThreadedFileReader::UpdatePrefetch(u64 offset, u32 size)
+{
+	if (m_cacheCapacity == 0 || m_prefetchChunks == 0 || size == 0)
+		return;
+
+	std::unique_lock<std::mutex> lock(m_cacheMtx);
+	if (offset == m_lastRequestEnd)
+		m_sequentialRequests++;
+	else
+		m_sequentialRequests = 0;
+	m_lastRequestEnd = offset + size;
+
+	if (m_sequentialRequests < SEQUENTIAL_THRESHOLD || m_workersUnsupported)
+		return;
+
+	if (m_workers.empty() && !StartWorkers(lock))
+		return;
+
+	// Don't let prefetching push out more than half of the cache
+	offset += size;
+	size_t queued_bytes = 0;
+	bool queued = false;
+	for (u32 i = 0; i < m_prefetchChunks; i++)
+	{
+		const Chunk next = ChunkForOffset(offset);
+		if (next.chunkID < 0 || queued_bytes + next.length > m_cacheCapacity / 2)
+			break;
+
+		offset = next.offset + next.length;
+		queued_bytes += next.length;
+		if (m_cacheMap.find(next.chunkID) != m_cacheMap.end())
+			continue;
+
+		InsertChunk(next.chunkID, next.length).pending = true;
+		m_prefetchQueue.push_back(next.chunkID);
+		queued = true;
+	}
+
+	if (queued)
+		m_cacheCondition.notify_all();
+}
+
+ThreadedFileReader::CachedChunk& ThreadedFileReader::InsertChunk(s64 chunkID, u32 size)
+{
+	m_cacheSize += size;
+	EvictChunks();
+
+	CachedChunk& cc = m_cache.emplace_front();
+	cc.chunkID = chunkID;
+	cc.data = std::make_unique_for_overwrite<u8[]>(size);
+	cc.cap = size;
+	cc.size = 0;
+	cc.pending = false;
+	cc.waiters = 0;
+	m_cacheMap.emplace(chunkID, m_cache.begin());
+	return cc;
+}
+
+void ThreadedFileReader::EvictChunks()
+{
+	auto it = m_cache.end();
+	while (m_cacheSize > m_cacheCapacity && it != m_cache.begin())
+	{
+		--it;
+		if (it->pending || it->waiters > 0)
+			continue;
+
+		m_cacheSize -= it->cap;
+		m_cacheMap.erase(it->chunkID);
+		it = m_cache.erase(it);
+	}
+}
+
+void ThreadedFileReader::WorkerLoop(u32 worker)
+{
+	Threading::SetNameOfCurrentThread("ISO Prefetch");
+
+	std::unique_lock<std::mutex> lock(m_cacheMtx);
+	for (;;)
+	{
+		m_cacheCondition.wait(lock, [this]() { return m_workersQuit || !m_prefetchQueue.empty(); });
+		if (m_workersQuit)
+			return;
+
+		const s64 chunkID = m_prefetchQueue.front();
+		m_prefetchQueue.pop_front();
+
+		// Pending chunks are never evicted, so this stays valid while we're unlocked
+		CachedChunk& cc = *m_cacheMap.find(chunkID)->second;
+		lock.unlock();
+		const int size = ReadChunkOnWorker(cc.data.get(), chunkID, worker);
+		lock.lock();
+
+		cc.size = (size > 0) ? std::min(static_cast<u32>(size), cc.cap) : 0;
+		cc.pending = false;
+		m_cacheCondition.notify_all();
+	}
+}
+
+bool ThreadedFileReader::StartWorkers(std::unique_lock<std::mutex>& lock)
+{
+	// Opening a CHD reads and checks its header again, don't make the read thread wait for that
+	// Readers are only opened and closed from the thread making requests, so nobody else can get here
+	lock.unlock();
+	const u32 count = OpenWorkerReaders(m_maxWorkers);
+	lock.lock();
+
+	if (count == 0)
+	{
+		m_workersUnsupported = true;
+		return false;
+	}
+
+	m_workersQuit = false;
+	m_workers.reserve(count);
+	for (u32 i = 0; i < count; i++)
+		m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+
+	return true;
+}
+
+void ThreadedFileReader::StopWorkersAndClearCache()
+{
+	std::unique_lock<std::mutex> lock(m_cacheMtx);
+	if (!m_workers.empty())
+	{
+		m_workersQuit = true;
+		m_cacheCondition.notify_all();
+		lock.unlock();
+
+		for (std::thread& thread : m_workers)
+			thread.join();
+		m_workers.clear();
+		CloseWorkerReaders();
+
+		lock.lock();
+	}
+
+	m_prefetchQueue.clear();
+	m_cacheMap.clear();
+	m_cache.clear();
+	m_cacheSize = 0;
+	m_lastRequestEnd = 0;
+	m_sequentialRequests = 0;
+	m_workersUnsupported = false;
+}
+
 bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, const std::lock_guard<std::mutex>&)
 {
 	// Run through twice so that if m_buffer[1] contains the first half and m_buffer[0] contains the second half it still works
@@ -254,6 +469,7 @@ bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, co
 bool ThreadedFileReader::Precache(ProgressCallback* progress, Error* error)
 {
 	CancelAndWaitUntilStopped();
+	StopWorkersAndClearCache();
 	progress->SetStatusText(SmallString::from_format(TRANSLATE_FS("CDVD", "Precaching {}..."), Path::GetFileName(m_filename)).c_str());
 	return Precache2(progress, error);
 }
@@ -286,6 +502,13 @@ bool ThreadedFileReader::CheckAvailableMemoryForPrecaching(u64 required_size, Er
 bool ThreadedFileReader::Open(std::string filename, Error* error)
 {
 	CancelAndWaitUntilStopped();
+	StopWorkersAndClearCache();
+
+	const bool cache = UsesChunkCache();
+	m_cacheCapacity = cache ? static_cast<size_t>(std::max(EmuConfig.CdvdChunkCacheSize, 0)) * _1mb : 0;
+	m_maxWorkers = cache ? static_cast<u32>(std::max(EmuConfig.CdvdDecompressThreads, 0)) : 0;
+	m_prefetchChunks = m_maxWorkers ? static_cast<u32>(std::max(EmuConfig.CdvdPrefetchChunks, 0)) : 0;
+
 	return Open2(std::move(filename), error);
 }
 
@@ -294,6 +517,7 @@ int ThreadedFileReader::ReadSync(void* pBuffer, u32 sector, u32 count)
 	u32 blocksize = InternalBlockSize();
 	u64 offset = (u64)sector * (u64)blocksize + m_dataoffset;
 	u32 size = count * blocksize;
+	UpdatePrefetch(offset, size);
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
 		if (TryCachedRead(pBuffer, offset, size, l))
@@ -348,6 +572,7 @@ void ThreadedFileReader::BeginRead(void* pBuffer, u32 sector, u32 count)
 	s32 blocksize = InternalBlockSize();
 	u64 offset = (u64)sector * (u64)blocksize + m_dataoffset;
 	u32 size = count * blocksize;
+	UpdatePrefetch(offset, size);
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
 		if (TryCachedRead(pBuffer, offset, size, l))
@@ -393,6 +618,7 @@ void ThreadedFileReader::CancelRead(void)
 void ThreadedFileReader::Close(void)
 {
 	CancelAndWaitUntilStopped();
+	StopWorkersAndClearCache();
 	for (auto& buf : m_buffer)
 		buf.size.store(0, std::memory_order_relaxed);
 	Close2();
@@ -9,12 +9,19 @@
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 class Error;
 class ProgressCallback;
 
 /// A file reader for use with compressed formats
 /// Calls decompression code on a separate thread to make a synchronous decompression API async
+/// Decompressed chunks are kept in an LRU cache, and sequential reads are prefetched by a pool of workers
+/// for formats that can decompress chunks independently
 class ThreadedFileReader
 {
 	ThreadedFileReader(ThreadedFileReader&&) = delete;
@@ -50,6 +57,19 @@ protected:
 	/// Checks system memory, to ensure that precaching would not exceed a reasonable amount.
 	bool CheckAvailableMemoryForPrecaching(u64 required_size, Error* error);
 
+	/// Formats where decompressing a chunk is expensive return true to get the chunk cache and prefetch workers
+	/// Uncompressed formats return false (the default), the OS file cache already does a better job for them
+	virtual bool UsesChunkCache() const;
+	/// Prepare decompression state for up to `count` prefetch workers, returns the number prepared
+	/// Called without any locks held, while the read thread may be in ReadChunk, so it must not touch its state
+	/// Formats that can't decompress chunks independently of each other return 0 (the default)
+	virtual u32 OpenWorkerReaders(u32 count);
+	/// Release the state from OpenWorkerReaders
+	virtual void CloseWorkerReaders();
+	/// Synchronously read the given block into `dst` using the state of `worker`
+	/// Called concurrently with ReadChunk and with other workers, so it must not touch their state
+	virtual int ReadChunkOnWorker(void* dst, s64 chunkID, u32 worker);
+
 	ThreadedFileReader();
 
 private:
@@ -101,6 +121,55 @@ private:
 	bool Decompress(void* ptr, u64 offset, u32 size);
 	/// Cancel any inflight read and wait until the thread is no longer doing anything
 	void CancelAndWaitUntilStopped(void);
+
+	struct CachedChunk
+	{
+		s64 chunkID;
+		std::unique_ptr<u8[]> data;
+		u32 cap;
+		/// Bytes of decompressed data, 0 if the worker failed to read the chunk
+		u32 size;
+		/// True until a worker has filled in `data`
+		bool pending;
+		/// Threads waiting for a pending chunk, it can't be evicted while nonzero
+		u32 waiters;
+	};
+	using ChunkList = std::list<CachedChunk>;
+
+	/// Most recently used first
+	ChunkList m_cache;
+	std::unordered_map<s64, ChunkList::iterator> m_cacheMap;
+	size_t m_cacheSize = 0;
+	size_t m_cacheCapacity = 0;
+	/// Guards the cache, prefetch queue and worker state
+	/// Lock order: `m_mtx` before `m_cacheMtx`
+	std::mutex m_cacheMtx;
+	/// Signalled when work is queued, a chunk finishes, or the workers should exit
+	std::condition_variable m_cacheCondition;
+	std::deque<s64> m_prefetchQueue;
+	std::vector<std::thread> m_workers;
+	u32 m_maxWorkers = 0;
+	u32 m_prefetchChunks = 0;
+	bool m_workersQuit = false;
+	/// True once the format has reported it can't use workers
+	bool m_workersUnsupported = false;
+	/// Sequential access detection
+	u64 m_lastRequestEnd = 0;
+	u32 m_sequentialRequests = 0;
+
+	/// Read a chunk through the cache, waiting for it if a worker is decompressing it
+	int ReadChunkCached(void* dst, const Chunk& chunk);
+	/// Record a request and queue the chunks after it for the workers if requests look sequential
+	void UpdatePrefetch(u64 offset, u32 size);
+	/// Add a chunk to the cache, evicting the least recently used ones to make room
+	CachedChunk& InsertChunk(s64 chunkID, u32 size);
+	void EvictChunks();
+	/// Main loop of prefetch workers
+	void WorkerLoop(u32 worker);
+	/// Opens the worker readers with `lock` released, then starts the workers
+	bool StartWorkers(std::unique_lock<std::mutex>& lock);
+	/// Stop the prefetch workers and empty the cache
+	void StopWorkersAndClearCache();
 	/// Attempt to read from the cache
 	/// Adjusts pointer, offset, and size if successful
 	/// Returns true if no additional reads are necessary
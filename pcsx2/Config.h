@@ -1271,6 +1271,12 @@ struct Pcsx2Config
 		std::string HWDumpDirectory;
 		std::string SWDumpDirectory;
 
+		// Name of the GameDB stereo rule set to apply, empty to ignore the GameDB stereo section.
+		std::string StereoProfile = "default";
+
+		// HW renderer writes a GSStereoTrace of every draw's stereo decision here when set.
+		std::string StereoTracePath;
+
 		GSOptions();
 
 		void LoadSave(SettingsWrapper& wrap);
@@ -1473,7 +1479,9 @@ struct Pcsx2Config
 			WaitLoop : 1, // enables constant loop detection and fast-forwarding
 			vuFlagHack : 1, // microVU specific flag hack
 			vuThread : 1, // Enable Threaded VU1
-			vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+			vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+			vuThreadPrecompile : 1, // Compile VU1 programs while the VU thread is idle (MTVU only)
+			ipuDecodeAhead : 1; // Decode IDEC macroblocks ahead on a separate thread
 		BITFIELD_END
 
 		s8 EECycleRate; // EE cycle rate selector (1.0, 1.5, 2.0)
@@ -1677,6 +1685,10 @@ struct Pcsx2Config
 		SavestateCompressionMethod CompressionType = SavestateCompressionMethod::Zstandard;
 		SavestateCompressionLevel CompressionRatio = SavestateCompressionLevel::Medium;
 
+		bool RewindEnable = false;
+		u32 RewindFrequency = 10; // frames between snapshots
+		u32 RewindBufferSize = 512; // MB
+
 		bool operator==(const SavestateOptions& right) const;
 		bool operator!=(const SavestateOptions& right) const;
 	};
@@ -1736,6 +1748,11 @@ struct Pcsx2Config
 	McdOptions Mcd[8];
 	std::string GzipIsoIndexTemplate; // for quick-access index with gzipped ISO
 
+	// Compressed image (CHD/CSO/gzip) decompression
+	int CdvdDecompressThreads; // prefetch workers, 0 disables prefetching
+	int CdvdChunkCacheSize; // decompressed chunk cache in MB, 0 disables the cache
+	int CdvdPrefetchChunks; // chunks decompressed ahead of sequential reads
+
 	int PINESlot;
 
 	int RtcYear;
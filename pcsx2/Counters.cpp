@@ -18,6 +18,7 @@
 #include "SIO/Sio.h"
 #include "SPU2/spu2.h"
 #include "Recording/InputRecording.h"
+#include "Rewind.h"
 #include "VMManager.h"
 #include "VUmicro.h"
 
@@ -538,7 +539,8 @@ static __fi void VSyncStart(u32 sCycle)
 
 	// Bail out before the next frame starts if we're paused, or the CPU has changed.
 	// Need to re-check this, because we might've paused during the sleep time.
-	if (VMManager::Internal::IsExecutionInterrupted())
+	// Rewind also needs to capture or load outside of execution.
+	if (VMManager::Internal::IsExecutionInterrupted() || Rewind::HasPendingWork())
 		Cpu->ExitExecution();
 }
 
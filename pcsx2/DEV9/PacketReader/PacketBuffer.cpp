@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "PacketBuffer.h"
+
+#include <mutex>
+#include <vector>
+
+namespace PacketReader::PacketBufferPool
+{
+	namespace
+	{
+		struct FreeList
+		{
+			std::mutex mutex;
+			std::vector<u8*> buffers;
+
+			~FreeList()
+			{
+				for (u8* buffer : buffers)
+					delete[] buffer;
+			}
+		};
+	} // namespace
+
+	// Packets are built on the receive thread and freed on either thread,
+	// so the list is shared rather than per thread.
+	static FreeList& GetFreeList()
+	{
+		static FreeList list;
+		return list;
+	}
+
+	u8* Allocate(int size)
+	{
+		if (size > BUFFER_SIZE)
+			return new u8[size];
+
+		FreeList& list = GetFreeList();
+		{
+			std::lock_guard lock(list.mutex);
+			if (!list.buffers.empty())
+			{
+				u8* buffer = list.buffers.back();
+				list.buffers.pop_back();
+				return buffer;
+			}
+		}
+
+		return new u8[BUFFER_SIZE];
+	}
+
+	void Release(u8* buffer, int size)
+	{
+		if (buffer == nullptr)
+			return;
+
+		if (size <= BUFFER_SIZE)
+		{
+			FreeList& list = GetFreeList();
+			std::lock_guard lock(list.mutex);
+			if (list.buffers.size() < MAX_FREE_BUFFERS)
+			{
+				list.buffers.push_back(buffer);
+				return;
+			}
+		}
+
+		delete[] buffer;
+	}
+
+	size_t GetFreeCount()
+	{
+		FreeList& list = GetFreeList();
+		std::lock_guard lock(list.mutex);
+		return list.buffers.size();
+	}
+} // namespace PacketReader::PacketBufferPool
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include <memory>
+
+#include "common/Pcsx2Defs.h"
+
+namespace PacketReader
+{
+	// Only the payload bytes are pooled, they are the one per packet allocation that scales with packet size.
+	// NetPacket already lives on the stack of whoever moves it between the adapter and SMAP,
+	// while IP_Packet and the other header objects are a few dozen bytes each and left to the heap.
+	namespace PacketBufferPool
+	{
+		// Large enough for any ethernet frame we build.
+		static constexpr int BUFFER_SIZE = 2048;
+		// Buffers held onto when released, beyond this they go back to the heap.
+		static constexpr size_t MAX_FREE_BUFFERS = 512;
+
+		// Buffers up to BUFFER_SIZE are recycled, larger ones use the heap.
+		u8* Allocate(int size);
+		void Release(u8* buffer, int size);
+
+		size_t GetFreeCount();
+	} // namespace PacketBufferPool
+
+	struct PacketBufferDeleter
+	{
+		int size = 0;
+
+		void operator()(u8* buffer) const
+		{
+			PacketBufferPool::Release(buffer, size);
+		}
+	};
+
+	using PacketBuffer = std::unique_ptr<u8[], PacketBufferDeleter>;
+
+	inline PacketBuffer MakePacketBuffer(int size)
+	{
+		return PacketBuffer(PacketBufferPool::Allocate(size), PacketBufferDeleter{size});
+	}
+} // namespace PacketReader
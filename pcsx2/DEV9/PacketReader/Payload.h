@@ -9,6 +9,8 @@
 #include "common/Assertions.h"
 #include "common/Pcsx2Defs.h"
 
+#include "PacketBuffer.h"
+
 namespace PacketReader
 {
 	class Payload
@@ -21,10 +23,11 @@ namespace PacketReader
 	};
 
 	//Data owned by class
+	//Buffer comes from PacketBufferPool and is not zeroed
 	class PayloadData : public Payload
 	{
 	public:
-		std::unique_ptr<u8[]> data;
+		PacketBuffer data;
 
 	private:
 		int length;
@@ -34,14 +37,14 @@ namespace PacketReader
 			: length{len}
 		{
 			if (len != 0)
-				data = std::make_unique<u8[]>(len);
+				data = MakePacketBuffer(len);
 		}
 		PayloadData(const PayloadData& original)
 			: length{original.length}
 		{
 			if (length != 0)
 			{
-				data = std::make_unique<u8[]>(length);
+				data = MakePacketBuffer(length);
 				memcpy(data.get(), original.data.get(), length);
 			}
 		}
@@ -49,6 +52,12 @@ namespace PacketReader
 		{
 			return length;
 		}
+		//Drops trailing bytes, for when data was sized before knowing how much would be written
+		void Shrink(int len)
+		{
+			pxAssert(len <= length);
+			length = len;
+		}
 		virtual void WriteBytes(u8* buffer, int* offset)
 		{
 			if (length == 0)
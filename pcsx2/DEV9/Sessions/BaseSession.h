@@ -7,11 +7,22 @@
 #include <functional>
 #include <optional>
 #include <vector>
+#ifdef _WIN32
+#include <winsock2.h>
+#elif defined(__POSIX__)
+#define INVALID_SOCKET -1
+#endif
 
 namespace Sessions
 {
 	class BaseSession; //Forward declare
 
+#ifdef _WIN32
+	typedef SOCKET SessionSocket;
+#elif defined(__POSIX__)
+	typedef int SessionSocket;
+#endif
+
 	typedef std::function<void(BaseSession*)> ConnectionClosedEventHandler;
 
 	struct ConnectionKey
@@ -53,6 +64,10 @@ namespace Sessions
 		virtual bool Send(PacketReader::IP::IP_Payload* payload) = 0;
 		virtual void Reset() = 0;
 
+		// Socket Recv() reads from, lets SessionReactor skip sessions with nothing to read
+		// Sessions returning INVALID_SOCKET are serviced on every pass
+		virtual SessionSocket GetPollSocket() { return INVALID_SOCKET; }
+
 		virtual ~BaseSession() {}
 
 	protected:
@@ -0,0 +1,233 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include <algorithm>
+
+#include "common/Console.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+#endif
+
+#include "SessionReactor.h"
+
+namespace Sessions
+{
+	SessionReactor::SessionReactor()
+		: lastSweep(std::chrono::steady_clock::now())
+	{
+#ifdef __linux__
+		epollFd = epoll_create1(EPOLL_CLOEXEC);
+		if (epollFd < 0)
+			Console.Error("DEV9: Socket: epoll_create1 failed, polling all sessions. Error: %d", errno);
+#endif
+	}
+
+	void SessionReactor::Add(BaseSession* session)
+	{
+		std::lock_guard lock(sentry);
+		auto [it, added] = sessions.try_emplace(session);
+		if (!added)
+			return;
+
+		unwatched.push_back(session);
+		MarkDirty(session, it->second);
+		Queue(session, it->second);
+	}
+
+	void SessionReactor::Remove(BaseSession* session)
+	{
+		std::lock_guard lock(sentry);
+		auto it = sessions.find(session);
+		if (it == sessions.end())
+			return;
+
+#ifdef __linux__
+		if (it->second.socket != INVALID_SOCKET)
+			Unwatch(it->second.socket, session);
+#endif
+		std::erase(unwatched, session);
+		std::erase(dirty, session);
+		std::erase(ready, session);
+		sessions.erase(it);
+	}
+
+	void SessionReactor::Wake(BaseSession* session)
+	{
+		std::lock_guard lock(sentry);
+		auto it = sessions.find(session);
+		if (it == sessions.end())
+			return;
+
+		MarkDirty(session, it->second);
+		Queue(session, it->second);
+	}
+
+	void SessionReactor::WakeAll()
+	{
+		std::lock_guard lock(sentry);
+		for (auto& [session, entry] : sessions)
+		{
+			MarkDirty(session, entry);
+			Queue(session, entry);
+		}
+	}
+
+	void SessionReactor::Poll()
+	{
+		std::lock_guard lock(sentry);
+
+		for (BaseSession* session : dirty)
+		{
+			Entry& entry = sessions[session];
+			entry.dirty = false;
+			UpdateSocket(session, entry);
+		}
+		dirty.clear();
+
+		const auto now = std::chrono::steady_clock::now();
+		if (now - lastSweep >= SWEEP_INTERVAL)
+		{
+			lastSweep = now;
+			for (auto& [session, entry] : sessions)
+			{
+				MarkDirty(session, entry);
+				Queue(session, entry);
+			}
+			return;
+		}
+
+#ifdef __linux__
+		if (epollFd >= 0)
+		{
+			constexpr int maxEvents = 64;
+			epoll_event events[maxEvents];
+			int count;
+			do
+			{
+				// edge triggered, an interrupted wait would lose these until the next sweep
+				while ((count = epoll_wait(epollFd, events, maxEvents, 0)) < 0 && errno == EINTR)
+					;
+				for (int i = 0; i < count; i++)
+				{
+					BaseSession* session = static_cast<BaseSession*>(events[i].data.ptr);
+					auto it = sessions.find(session);
+					if (it != sessions.end())
+						Queue(session, it->second);
+				}
+			} while (count == maxEvents);
+
+			for (BaseSession* session : unwatched)
+				Queue(session, sessions[session]);
+			return;
+		}
+#endif
+
+		for (auto& [session, entry] : sessions)
+			Queue(session, entry);
+	}
+
+	BaseSession* SessionReactor::Next()
+	{
+		std::lock_guard lock(sentry);
+		if (ready.empty())
+			return nullptr;
+
+		BaseSession* session = ready.front();
+		ready.pop_front();
+		sessions[session].queued = false;
+		return session;
+	}
+
+	void SessionReactor::Queue(BaseSession* session, Entry& entry)
+	{
+		if (entry.queued)
+			return;
+
+		entry.queued = true;
+		ready.push_back(session);
+	}
+
+	void SessionReactor::MarkDirty(BaseSession* session, Entry& entry)
+	{
+		if (entry.dirty)
+			return;
+
+		entry.dirty = true;
+		dirty.push_back(session);
+	}
+
+	void SessionReactor::UpdateSocket(BaseSession* session, Entry& entry)
+	{
+#ifdef __linux__
+		if (epollFd < 0)
+			return;
+
+		const SessionSocket socket = session->GetPollSocket();
+		if (socket == entry.socket)
+			return;
+
+		if (entry.socket != INVALID_SOCKET)
+		{
+			Unwatch(entry.socket, session);
+			unwatched.push_back(session);
+		}
+
+		entry.socket = INVALID_SOCKET;
+		if (socket != INVALID_SOCKET && Watch(socket, session))
+		{
+			entry.socket = socket;
+			std::erase(unwatched, session);
+		}
+#endif
+	}
+
+#ifdef __linux__
+	bool SessionReactor::Watch(SessionSocket socket, BaseSession* session)
+	{
+		/*
+		 * Edge triggered, so sessions which can't consume their data yet (e.g. TCP waiting for
+		 * the PS2 to ACK) aren't reported on every pass. Such sessions get woken via Wake()
+		 * when the PS2 sends to them, and sessions which received something are re-queued
+		 * by the caller until they run dry.
+		 * EPOLLOUT signals a non-blocking TCP connect completing.
+		 */
+		epoll_event event{};
+		event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+		event.data.ptr = session;
+
+		// A stale registration remains if the socket was closed and reused
+		// before its previous session was removed, take it over
+		if (epoll_ctl(epollFd, EPOLL_CTL_ADD, socket, &event) != 0 &&
+			(errno != EEXIST || epoll_ctl(epollFd, EPOLL_CTL_MOD, socket, &event) != 0))
+		{
+			Console.Error("DEV9: Socket: Failed to watch socket. Error: %d", errno);
+			return false;
+		}
+
+		socketOwners[socket] = session;
+		return true;
+	}
+
+	void SessionReactor::Unwatch(SessionSocket socket, BaseSession* session)
+	{
+		auto it = socketOwners.find(socket);
+		if (it == socketOwners.end() || it->second != session)
+			return;
+
+		// Fails if the socket was already closed, which also unregisters it
+		epoll_ctl(epollFd, EPOLL_CTL_DEL, socket, nullptr);
+		socketOwners.erase(it);
+	}
+#endif
+
+	SessionReactor::~SessionReactor()
+	{
+#ifdef __linux__
+		if (epollFd >= 0)
+			::close(epollFd);
+#endif
+	}
+} // namespace Sessions
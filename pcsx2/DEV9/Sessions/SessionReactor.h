@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "BaseSession.h"
+
+namespace Sessions
+{
+	/*
+	 * Tracks which sessions have work, so the receive thread only calls Recv()
+	 * on those, instead of polling every socket on every pass.
+	 * A session is ready when its socket (see BaseSession::GetPollSocket) is
+	 * signalled, or when it has been woken after being handed work.
+	 * On Linux, sockets are watched with an edge triggered epoll set. Elsewhere,
+	 * every session is treated as ready on each pass.
+	 */
+	class SessionReactor
+	{
+	public:
+		// All sessions are serviced at least this often, for idle timeouts
+		static constexpr std::chrono::milliseconds SWEEP_INTERVAL{1000};
+
+	private:
+		struct Entry
+		{
+			SessionSocket socket = INVALID_SOCKET;
+			bool queued = false;
+			bool dirty = false;
+		};
+
+		std::mutex sentry;
+		std::unordered_map<BaseSession*, Entry> sessions;
+		// Sessions to service, in order
+		std::deque<BaseSession*> ready;
+		// Sessions whose socket may have changed since last checked
+		std::vector<BaseSession*> dirty;
+		// Sessions without a socket to watch, serviced every pass
+		std::vector<BaseSession*> unwatched;
+		std::chrono::steady_clock::time_point lastSweep;
+
+#ifdef __linux__
+		int epollFd = -1;
+		// Which session a socket is registered for, sockets can be closed
+		// and reused before the old session is removed
+		std::unordered_map<int, BaseSession*> socketOwners;
+#endif
+
+	public:
+		SessionReactor();
+		~SessionReactor();
+
+		// Can be called from any thread
+		void Add(BaseSession* session);
+		void Remove(BaseSession* session);
+		// Call after giving a session work outside of its socket, e.g. Send()
+		void Wake(BaseSession* session);
+		void WakeAll();
+
+		// Receive thread only
+		// Queues sessions which became ready, does not block
+		void Poll();
+		// Pops the next session to service, nullptr if none are left
+		BaseSession* Next();
+
+	private:
+		void Queue(BaseSession* session, Entry& entry);
+		void MarkDirty(BaseSession* session, Entry& entry);
+		void UpdateSocket(BaseSession* session, Entry& entry);
+#ifdef __linux__
+		bool Watch(SessionSocket socket, BaseSession* session);
+		void Unwatch(SessionSocket socket, BaseSession* session);
+#endif
+	};
+} // namespace Sessions
@@ -152,6 +152,11 @@ namespace Sessions
 		RaiseEventConnectionClosed();
 	}
 
+	SessionSocket TCP_Session::GetPollSocket()
+	{
+		return client;
+	}
+
 	TCP_Session::~TCP_Session()
 	{
 		CloseSocket();
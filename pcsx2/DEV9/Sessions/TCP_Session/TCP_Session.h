@@ -80,6 +80,7 @@ namespace Sessions
 		virtual std::optional<ReceivedPayload> Recv();
 		virtual bool Send(PacketReader::IP::IP_Payload* payload);
 		virtual void Reset();
+		virtual SessionSocket GetPollSocket();
 
 		virtual ~TCP_Session();
 
@@ -32,15 +32,27 @@ namespace Sessions
 			{
 				fd_set writeSet;
 				fd_set exceptSet;
+				int res;
 
-				FD_ZERO(&writeSet);
-				FD_ZERO(&exceptSet);
+				// select() leaves the sets undefined when interrupted by a signal, so retry from scratch
+				do
+				{
+					FD_ZERO(&writeSet);
+					FD_ZERO(&exceptSet);
+
+					FD_SET(client, &writeSet);
+					FD_SET(client, &exceptSet);
 
-				FD_SET(client, &writeSet);
-				FD_SET(client, &exceptSet);
+					timeval nowait{0};
+					res = select(client + 1, nullptr, &writeSet, &exceptSet, &nowait);
+#ifdef _WIN32
+				} while (false);
+#elif defined(__POSIX__)
+				} while (res == SOCKET_ERROR && errno == EINTR);
+#endif
 
-				timeval nowait{0};
-				select(client + 1, nullptr, &writeSet, &exceptSet, &nowait);
+				if (res == SOCKET_ERROR)
+					return std::nullopt;
 
 				if (FD_ISSET(client, &writeSet))
 					return ConnectTCPComplete(true);
@@ -84,7 +96,7 @@ namespace Sessions
 
 		if (maxSize > 0)
 		{
-			std::unique_ptr<u8[]> buffer;
+			std::unique_ptr<PayloadData> recivedData;
 			int err = 0;
 			int recived;
 
@@ -101,8 +113,9 @@ namespace Sessions
 				if (available > static_cast<uint>(maxSize))
 					Console.WriteLn("DEV9: TCP: Got a lot of data: %lu using: %d", available, maxSize);
 
-				buffer = std::make_unique<u8[]>(maxSize);
-				recived = recv(client, reinterpret_cast<char*>(buffer.get()), maxSize, 0);
+				// Receive straight into the payload, it's shrunk to fit below
+				recivedData = std::make_unique<PayloadData>(maxSize);
+				recived = recv(client, reinterpret_cast<char*>(recivedData->data.get()), maxSize, 0);
 				if (recived == -1)
 #ifdef _WIN32
 					err = WSAGetLastError();
@@ -165,10 +178,9 @@ namespace Sessions
 				}
 				DevCon.WriteLn("DEV9: TCP: [SRV] Sending %d bytes", recived);
 
-				PayloadData* recivedData = new PayloadData(recived);
-				memcpy(recivedData->data.get(), buffer.get(), recived);
+				recivedData->Shrink(recived);
 
-				std::unique_ptr<TCP_Packet> iRet = CreateBasePacket(recivedData);
+				std::unique_ptr<TCP_Packet> iRet = CreateBasePacket(recivedData.release());
 				IncrementMyNumber(static_cast<u32>(recived));
 
 				iRet->SetACK(true);
@@ -95,13 +95,21 @@ namespace Sessions::UDP_Common
 		fd_set sReady;
 		fd_set sExcept;
 
-		// not const Linux
-		timeval nowait{};
-		FD_ZERO(&sReady);
-		FD_ZERO(&sExcept);
-		FD_SET(client, &sReady);
-		FD_SET(client, &sExcept);
-		ret = select(client + 1, &sReady, nullptr, &sExcept, &nowait);
+		// select() leaves the sets undefined when interrupted by a signal, so retry from scratch
+		do
+		{
+			// not const Linux
+			timeval nowait{};
+			FD_ZERO(&sReady);
+			FD_ZERO(&sExcept);
+			FD_SET(client, &sReady);
+			FD_SET(client, &sExcept);
+			ret = select(client + 1, &sReady, nullptr, &sExcept, &nowait);
+#ifdef _WIN32
+		} while (false);
+#elif defined(__POSIX__)
+		} while (ret == SOCKET_ERROR && errno == EINTR);
+#endif
 
 		if (ret == SOCKET_ERROR)
 		{
@@ -135,8 +143,7 @@ namespace Sessions::UDP_Common
 		else if (FD_ISSET(client, &sReady))
 		{
 			unsigned long available = 0;
-			PayloadData* recived = nullptr;
-			std::unique_ptr<u8[]> buffer;
+			std::unique_ptr<PayloadData> recived;
 			sockaddr_in endpoint{};
 
 			// FIONREAD returns total size of all available messages
@@ -148,14 +155,15 @@ namespace Sessions::UDP_Common
 #endif
 			if (ret != SOCKET_ERROR)
 			{
-				buffer = std::make_unique<u8[]>(available);
+				// Receive straight into the payload, it's shrunk to fit below
+				recived = std::make_unique<PayloadData>(static_cast<int>(available));
 
 #ifdef _WIN32
 				int fromlen = sizeof(endpoint);
 #elif defined(__POSIX__)
 				socklen_t fromlen = sizeof(endpoint);
 #endif
-				ret = recvfrom(client, reinterpret_cast<char*>(buffer.get()), available, 0, reinterpret_cast<sockaddr*>(&endpoint), &fromlen);
+				ret = recvfrom(client, reinterpret_cast<char*>(recived->data.get()), available, 0, reinterpret_cast<sockaddr*>(&endpoint), &fromlen);
 			}
 
 			if (ret == SOCKET_ERROR)
@@ -179,10 +187,9 @@ namespace Sessions::UDP_Common
 #endif
 			}
 
-			recived = new PayloadData(ret);
-			memcpy(recived->data.get(), buffer.get(), ret);
+			recived->Shrink(ret);
 
-			std::unique_ptr<UDP_Packet> iRet = std::make_unique<UDP_Packet>(recived);
+			std::unique_ptr<UDP_Packet> iRet = std::make_unique<UDP_Packet>(recived.release());
 			iRet->destinationPort = port;
 			iRet->sourcePort = ntohs(endpoint.sin_port);
 
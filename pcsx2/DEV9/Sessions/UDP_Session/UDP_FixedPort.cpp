@@ -148,6 +148,11 @@ namespace Sessions
 			connectionsCopy[i]->Reset();
 	}
 
+	SessionSocket UDP_FixedPort::GetPollSocket()
+	{
+		return client;
+	}
+
 	UDP_Session* UDP_FixedPort::NewClientSession(ConnectionKey parNewKey, bool parIsBrodcast, bool parIsMulticast)
 	{
 		// Lock the whole function so we can't race between the open check and creating the session
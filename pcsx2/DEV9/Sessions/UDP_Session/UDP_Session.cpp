@@ -251,6 +251,13 @@ namespace Sessions
 		RaiseEventConnectionClosed();
 	}
 
+	SessionSocket UDP_Session::GetPollSocket()
+	{
+		// Fixed port sessions share their parent's socket, which is polled
+		// via the parent, but still need servicing for the idle timeout
+		return isFixedPort ? INVALID_SOCKET : client;
+	}
+
 	UDP_Session::~UDP_Session()
 	{
 		open.store(false);
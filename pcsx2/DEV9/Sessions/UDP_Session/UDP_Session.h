@@ -50,6 +50,7 @@ namespace Sessions
 		virtual bool WillRecive(PacketReader::IP::IP_Address parDestIP);
 		virtual bool Send(PacketReader::IP::IP_Payload* payload);
 		virtual void Reset();
+		virtual SessionSocket GetPollSocket();
 
 		virtual ~UDP_Session();
 	};
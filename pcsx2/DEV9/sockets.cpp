@@ -218,19 +218,19 @@ bool SocketAdapter::recv(NetPacket* pkt)
 	if (!vRecBuffer.Dequeue(&bFrame))
 	{
 		std::lock_guard deletelock(deleteSendSentry);
-		std::vector<ConnectionKey> keys = connections.GetKeys();
-		for (size_t i = 0; i < keys.size(); i++)
-		{
-			const ConnectionKey key = keys[i];
-
-			BaseSession* session;
-			if (!connections.TryGetValue(key, &session))
-				continue;
+		reactor.Poll();
 
+		BaseSession* session;
+		while ((session = reactor.Next()) != nullptr)
+		{
 			std::optional<ReceivedPayload> pl = session->Recv();
 
 			if (pl.has_value())
 			{
+				// Sockets are watched edge triggered, so keep servicing
+				// the session until it has nothing left
+				reactor.Wake(session);
+
 				IP_Packet* ipPkt = new IP_Packet(pl->payload.release());
 				ipPkt->destinationIP = session->sourceIP;
 				ipPkt->sourceIP = pl->sourceIP;
@@ -346,6 +346,7 @@ void SocketAdapter::reset()
 
 		session->Reset();
 	}
+	reactor.WakeAll();
 }
 
 void SocketAdapter::reloadSettings()
@@ -416,7 +417,9 @@ bool SocketAdapter::SendICMP(ConnectionKey Key, IP_Packet* ipPkt)
 	if (existingSession != nullptr)
 	{
 		s = static_cast<ICMP_Session*>(existingSession);
-		return s->Send(ipPkt->GetPayload(), ipPkt);
+		const bool ret = s->Send(ipPkt->GetPayload(), ipPkt);
+		reactor.Wake(s);
+		return ret;
 	}
 
 	DevCon.WriteLn("DEV9: Socket: Creating New ICMP Connection");
@@ -426,7 +429,10 @@ bool SocketAdapter::SendICMP(ConnectionKey Key, IP_Packet* ipPkt)
 	s->destIP = ipPkt->destinationIP;
 	s->sourceIP = dhcpServer.ps2IP;
 	connections.Add(Key, s);
-	return s->Send(ipPkt->GetPayload(), ipPkt);
+	reactor.Add(s);
+	const bool ret = s->Send(ipPkt->GetPayload(), ipPkt);
+	reactor.Wake(s);
+	return ret;
 }
 
 bool SocketAdapter::SendIGMP(ConnectionKey Key, IP_Packet* ipPkt)
@@ -457,7 +463,10 @@ bool SocketAdapter::SendTCP(ConnectionKey Key, IP_Packet* ipPkt)
 		s->destIP = ipPkt->destinationIP;
 		s->sourceIP = dhcpServer.ps2IP;
 		connections.Add(Key, s);
-		return s->Send(ipPkt->GetPayload());
+		reactor.Add(s);
+		const bool ret = s->Send(ipPkt->GetPayload());
+		reactor.Wake(s);
+		return ret;
 	}
 }
 
@@ -501,8 +510,10 @@ bool SocketAdapter::SendUDP(ConnectionKey Key, IP_Packet* ipPkt)
 
 			connections.Add(fKey, fPort);
 			fixedUDPPorts.Add(udp.sourcePort, fPort);
+			reactor.Add(fPort);
 
 			fPort->Init();
+			reactor.Wake(fPort);
 		}
 
 		Console.WriteLn("DEV9: Socket: Creating New UDP Connection from fixed port %d to %d", udp.sourcePort, udp.destinationPort);
@@ -522,7 +533,10 @@ bool SocketAdapter::SendUDP(ConnectionKey Key, IP_Packet* ipPkt)
 		s->destIP = ipPkt->destinationIP;
 		s->sourceIP = dhcpServer.ps2IP;
 		connections.Add(Key, s);
-		return s->Send(ipPkt->GetPayload());
+		reactor.Add(s);
+		const bool ret = s->Send(ipPkt->GetPayload());
+		reactor.Wake(s);
+		return ret;
 	}
 }
 
@@ -531,7 +545,11 @@ int SocketAdapter::SendFromConnection(ConnectionKey Key, IP_Packet* ipPkt)
 	BaseSession* s = nullptr;
 	connections.TryGetValue(Key, &s);
 	if (s != nullptr)
-		return s->Send(ipPkt->GetPayload()) ? 1 : 0;
+	{
+		const bool ret = s->Send(ipPkt->GetPayload());
+		reactor.Wake(s);
+		return ret ? 1 : 0;
+	}
 	else
 		return -1;
 }
@@ -541,6 +559,7 @@ void SocketAdapter::HandleConnectionClosed(BaseSession* sender)
 	const ConnectionKey key = sender->key;
 	if (!connections.Remove(key))
 		return;
+	reactor.Remove(sender);
 
 	// Defer deleting the connection untill we have left the calling session's callstack
 	if (std::this_thread::get_id() == sendThreadId)
@@ -574,6 +593,7 @@ void SocketAdapter::HandleFixedPortClosed(BaseSession* sender)
 	if (!connections.Remove(key))
 		return;
 	fixedUDPPorts.Remove(key.ps2Port);
+	reactor.Remove(sender);
 
 	// Defer deleting the connection untill we have left the calling session's callstack
 	if (std::this_thread::get_id() == sendThreadId)
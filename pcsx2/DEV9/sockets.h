@@ -10,6 +10,7 @@
 #include "PacketReader/IP/IP_Packet.h"
 #include "PacketReader/EthernetFrame.h"
 #include "Sessions/BaseSession.h"
+#include "Sessions/SessionReactor.h"
 #include "SimpleQueue.h"
 #include "ThreadSafeMap.h"
 
@@ -26,6 +27,8 @@ class SocketAdapter : public NetAdapter
 
 	ThreadSafeMap<Sessions::ConnectionKey, Sessions::BaseSession*> connections;
 	ThreadSafeMap<u16, Sessions::BaseSession*> fixedUDPPorts;
+	//Which connections the recv thread needs to service
+	Sessions::SessionReactor reactor;
 
 	std::thread::id sendThreadId;
 	std::vector<Sessions::BaseSession*> deleteQueueSendThread;
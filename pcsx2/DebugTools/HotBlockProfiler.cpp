@@ -0,0 +1,429 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "HotBlockProfiler.h"
+
+#include "Config.h"
+#include "DebugTools/SymbolGuardian.h"
+#include "VMManager.h"
+#include "x86/BaseblockEx.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include "common/RedtapeWindows.h"
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <pthread.h>
+#else
+#include <pthread.h>
+#include <signal.h>
+#include <ucontext.h>
+#endif
+
+namespace HotBlockProfiler
+{
+	struct BlockSamples
+	{
+		u32 size;
+		u64 samples;
+	};
+
+	static bool OpenTargetThread(Error* error);
+	static void CloseTargetThread();
+	static void CaptureSample();
+	static void PushSample(uptr pc);
+	static void SamplerThreadEntryPoint(u32 interval_ms);
+	static std::string EscapeCSV(const std::string_view str);
+
+	// Samples are queued until the CPU thread gets around to processing them.
+	static constexpr u32 QUEUE_SIZE = 8192;
+	static constexpr u32 PROCESS_THRESHOLD = QUEUE_SIZE / 4;
+	static constexpr u32 PROCESS_INTERVAL_MS = 250;
+
+	// Single producer (the sampler, or the signal handler on the CPU thread), single consumer (the CPU thread).
+	static std::array<uptr, QUEUE_SIZE> s_queue;
+	static std::atomic<u32> s_queue_head{0};
+	static std::atomic<u32> s_queue_tail{0};
+	static std::atomic<u64> s_dropped_samples{0};
+	static std::vector<uptr> s_process_buffer;
+
+	static std::thread s_sampler_thread;
+	static std::atomic_bool s_running{false};
+
+	static std::mutex s_results_mutex;
+	static std::unordered_map<u32, BlockSamples> s_block_samples;
+	static u64 s_total_samples = 0;
+	static u64 s_attributed_samples = 0;
+
+#if defined(_WIN32)
+	static HANDLE s_target_thread = nullptr;
+#elif defined(__APPLE__)
+	static mach_port_t s_target_thread = MACH_PORT_NULL;
+#else
+	static pthread_t s_target_thread;
+	static bool s_signal_handler_installed = false;
+#endif
+} // namespace HotBlockProfiler
+
+std::atomic_bool HotBlockProfiler::Internal::s_process_pending{false};
+
+#if defined(_WIN32)
+
+bool HotBlockProfiler::OpenTargetThread(Error* error)
+{
+	s_target_thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE, GetCurrentThreadId());
+	if (!s_target_thread)
+	{
+		Error::SetWin32(error, "OpenThread() failed: ", GetLastError());
+		return false;
+	}
+
+	return true;
+}
+
+void HotBlockProfiler::CloseTargetThread()
+{
+	CloseHandle(s_target_thread);
+	s_target_thread = nullptr;
+}
+
+void HotBlockProfiler::CaptureSample()
+{
+	if (SuspendThread(s_target_thread) == static_cast<DWORD>(-1))
+		return;
+
+	CONTEXT context = {};
+	context.ContextFlags = CONTEXT_CONTROL;
+	if (GetThreadContext(s_target_thread, &context))
+	{
+#ifdef _M_X86
+		PushSample(static_cast<uptr>(context.Rip));
+#else
+		PushSample(static_cast<uptr>(context.Pc));
+#endif
+	}
+
+	ResumeThread(s_target_thread);
+}
+
+#elif defined(__APPLE__)
+
+bool HotBlockProfiler::OpenTargetThread(Error* error)
+{
+	s_target_thread = pthread_mach_thread_np(pthread_self());
+	return true;
+}
+
+void HotBlockProfiler::CloseTargetThread()
+{
+	s_target_thread = MACH_PORT_NULL;
+}
+
+void HotBlockProfiler::CaptureSample()
+{
+	if (thread_suspend(s_target_thread) != KERN_SUCCESS)
+		return;
+
+#ifdef _M_X86
+	x86_thread_state64_t state;
+	mach_msg_type_number_t count = x86_THREAD_STATE64_COUNT;
+	if (thread_get_state(s_target_thread, x86_THREAD_STATE64, reinterpret_cast<thread_state_t>(&state), &count) == KERN_SUCCESS)
+		PushSample(static_cast<uptr>(state.__rip));
+#else
+	arm_thread_state64_t state;
+	mach_msg_type_number_t count = ARM_THREAD_STATE64_COUNT;
+	if (thread_get_state(s_target_thread, ARM_THREAD_STATE64, reinterpret_cast<thread_state_t>(&state), &count) == KERN_SUCCESS)
+		PushSample(static_cast<uptr>(arm_thread_state64_get_pc(state)));
+#endif
+
+	thread_resume(s_target_thread);
+}
+
+#else
+
+static void HotBlockProfilerSignalHandler(int sig, siginfo_t* info, void* ctx)
+{
+#if defined(__linux__)
+#if defined(_M_X86)
+	const uptr pc = static_cast<uptr>(static_cast<ucontext_t*>(ctx)->uc_mcontext.gregs[REG_RIP]);
+#elif defined(_M_ARM64)
+	const uptr pc = static_cast<uptr>(static_cast<ucontext_t*>(ctx)->uc_mcontext.pc);
+#endif
+#elif defined(__FreeBSD__)
+#if defined(_M_X86)
+	const uptr pc = static_cast<uptr>(static_cast<ucontext_t*>(ctx)->uc_mcontext.mc_rip);
+#elif defined(_M_ARM64)
+	const uptr pc = static_cast<uptr>(static_cast<ucontext_t*>(ctx)->uc_mcontext.mc_gpregs.gp_elr);
+#endif
+#endif
+
+	HotBlockProfiler::PushSample(pc);
+}
+
+bool HotBlockProfiler::OpenTargetThread(Error* error)
+{
+	// Never uninstalled, a signal which is still in flight after stopping would otherwise kill the process.
+	if (!s_signal_handler_installed)
+	{
+		struct sigaction sa = {};
+		sigemptyset(&sa.sa_mask);
+		sa.sa_flags = SA_SIGINFO | SA_RESTART;
+		sa.sa_sigaction = HotBlockProfilerSignalHandler;
+		if (sigaction(SIGPROF, &sa, nullptr) != 0)
+		{
+			Error::SetErrno(error, "sigaction() for SIGPROF failed: ", errno);
+			return false;
+		}
+
+		s_signal_handler_installed = true;
+	}
+
+	s_target_thread = pthread_self();
+	return true;
+}
+
+void HotBlockProfiler::CloseTargetThread()
+{
+}
+
+void HotBlockProfiler::CaptureSample()
+{
+	// The handler runs on the CPU thread itself, and pushes the interrupted PC.
+	pthread_kill(s_target_thread, SIGPROF);
+}
+
+#endif
+
+void HotBlockProfiler::PushSample(uptr pc)
+{
+	const u32 head = s_queue_head.load(std::memory_order_relaxed);
+	if ((head - s_queue_tail.load(std::memory_order_acquire)) >= QUEUE_SIZE)
+	{
+		s_dropped_samples.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	s_queue[head % QUEUE_SIZE] = pc;
+	s_queue_head.store(head + 1, std::memory_order_release);
+}
+
+void HotBlockProfiler::SamplerThreadEntryPoint(u32 interval_ms)
+{
+	Threading::SetNameOfCurrentThread("Hot Block Profiler");
+
+	Common::Timer last_request;
+	while (s_running.load(std::memory_order_acquire))
+	{
+		Threading::Sleep(static_cast<int>(interval_ms));
+
+		// Don't count time spent paused.
+		if (VMManager::GetState() == VMState::Running)
+			CaptureSample();
+
+		// Processing costs a pass over every block, so batch samples up rather than asking for every one.
+		const u32 pending = s_queue_head.load(std::memory_order_relaxed) - s_queue_tail.load(std::memory_order_relaxed);
+		if (pending >= PROCESS_THRESHOLD || (pending > 0 && last_request.GetTimeMilliseconds() >= PROCESS_INTERVAL_MS))
+		{
+			Internal::s_process_pending.store(true, std::memory_order_relaxed);
+			last_request.Reset();
+		}
+	}
+
+	// Let whatever is left over get picked up.
+	Internal::s_process_pending.store(true, std::memory_order_relaxed);
+}
+
+bool HotBlockProfiler::Start(u32 interval_ms, Error* error)
+{
+	// Only the x86 recompiler hands its blocks over for attribution.
+#ifdef _M_X86
+	const bool has_recompiler = CHECK_EEREC;
+#else
+	const bool has_recompiler = false;
+#endif
+	if (!has_recompiler)
+	{
+		Error::SetString(error, "The hot block profiler requires the EE recompiler.");
+		return false;
+	}
+
+	Stop();
+
+	if (!OpenTargetThread(error))
+		return false;
+
+	interval_ms = std::max(interval_ms, 1u);
+	s_running.store(true, std::memory_order_release);
+	s_sampler_thread = std::thread(SamplerThreadEntryPoint, interval_ms);
+
+	Console.WriteLnFmt("Hot block profiler started, sampling every {} ms.", interval_ms);
+	return true;
+}
+
+void HotBlockProfiler::Stop()
+{
+	if (!s_running.load(std::memory_order_acquire))
+		return;
+
+	s_running.store(false, std::memory_order_release);
+	s_sampler_thread.join();
+	CloseTargetThread();
+
+	Console.WriteLn("Hot block profiler stopped.");
+}
+
+bool HotBlockProfiler::IsRunning()
+{
+	return s_running.load(std::memory_order_acquire);
+}
+
+void HotBlockProfiler::Reset()
+{
+	std::unique_lock lock(s_results_mutex);
+	s_block_samples.clear();
+	s_total_samples = 0;
+	s_attributed_samples = 0;
+	s_dropped_samples.store(0, std::memory_order_relaxed);
+}
+
+void HotBlockProfiler::ProcessSamples(std::span<const BASEBLOCKEX> blocks)
+{
+	Internal::s_process_pending.store(false, std::memory_order_relaxed);
+
+	const u32 head = s_queue_head.load(std::memory_order_acquire);
+	u32 tail = s_queue_tail.load(std::memory_order_relaxed);
+	if (head == tail)
+		return;
+
+	s_process_buffer.clear();
+	for (; tail != head; tail++)
+		s_process_buffer.push_back(s_queue[tail % QUEUE_SIZE]);
+	s_queue_tail.store(tail, std::memory_order_release);
+
+	// Blocks are ordered by guest PC, so sort the samples instead and search them for each block's code.
+	std::sort(s_process_buffer.begin(), s_process_buffer.end());
+	const uptr lowest = s_process_buffer.front();
+	const uptr highest = s_process_buffer.back();
+
+	std::unique_lock lock(s_results_mutex);
+	for (const BASEBLOCKEX& block : blocks)
+	{
+		if (block.x86size == 0 || block.fnptr > highest || (block.fnptr + block.x86size) <= lowest)
+			continue;
+
+		const auto begin = std::lower_bound(s_process_buffer.begin(), s_process_buffer.end(), block.fnptr);
+		const auto end = std::lower_bound(begin, s_process_buffer.end(), block.fnptr + block.x86size);
+		if (begin == end)
+			continue;
+
+		BlockSamples& counts = s_block_samples[block.startpc];
+		counts.size = block.size;
+		counts.samples += static_cast<u64>(end - begin);
+		s_attributed_samples += static_cast<u64>(end - begin);
+	}
+
+	s_total_samples += s_process_buffer.size();
+}
+
+HotBlockProfiler::Results HotBlockProfiler::GetResults()
+{
+	Results results;
+	{
+		std::unique_lock lock(s_results_mutex);
+		results.total_samples = s_total_samples;
+		results.attributed_samples = s_attributed_samples;
+		results.blocks.reserve(s_block_samples.size());
+		for (const auto& [address, counts] : s_block_samples)
+			results.blocks.push_back(Entry{address, counts.size, {}, counts.samples, 1});
+	}
+	results.dropped_samples = s_dropped_samples.load(std::memory_order_relaxed);
+
+	// The symbol database has its own lock, so look functions up after letting go of ours.
+	std::unordered_map<u32, size_t> function_indices;
+	for (Entry& block : results.blocks)
+	{
+		const FunctionInfo function = R5900SymbolGuardian.FunctionOverlappingAddress(block.address);
+		if (!function.address.valid())
+		{
+			// Not part of any known function, so it stands on its own.
+			results.functions.push_back(Entry{block.address, block.size * 4, {}, block.samples, 1});
+			continue;
+		}
+
+		block.name = function.name;
+
+		const auto [it, inserted] = function_indices.try_emplace(function.address.value, results.functions.size());
+		if (inserted)
+			results.functions.push_back(Entry{function.address.value, function.size, function.name, 0, 0});
+
+		Entry& entry = results.functions[it->second];
+		entry.samples += block.samples;
+		entry.blocks++;
+	}
+
+	const auto hottest_first = [](const Entry& lhs, const Entry& rhs) {
+		return (lhs.samples != rhs.samples) ? (lhs.samples > rhs.samples) : (lhs.address < rhs.address);
+	};
+	std::sort(results.functions.begin(), results.functions.end(), hottest_first);
+	std::sort(results.blocks.begin(), results.blocks.end(), hottest_first);
+
+	return results;
+}
+
+std::string HotBlockProfiler::EscapeCSV(const std::string_view str)
+{
+	std::string ret;
+	ret.reserve(str.size() + 2);
+	ret.push_back('"');
+	for (const char ch : str)
+	{
+		if (ch == '"')
+			ret.push_back('"');
+		ret.push_back(ch);
+	}
+	ret.push_back('"');
+	return ret;
+}
+
+bool HotBlockProfiler::WriteCSV(const std::string& path, Error* error)
+{
+	const Results results = GetResults();
+
+	auto fp = FileSystem::OpenManagedCFile(path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	// One row per block, with the function it belongs to, so it can be grouped either way.
+	std::string csv = "Block,Instructions,Samples,Percent,Function\n";
+	const double scale = results.total_samples ? (100.0 / static_cast<double>(results.total_samples)) : 0.0;
+	for (const Entry& block : results.blocks)
+	{
+		fmt::format_to(std::back_inserter(csv), "{:08X},{},{},{:.3f},{}\n", block.address, block.size, block.samples,
+			static_cast<double>(block.samples) * scale, EscapeCSV(block.name));
+	}
+
+	fmt::format_to(std::back_inserter(csv), "Outside recompiled code,,{},{:.3f},\n",
+		results.total_samples - results.attributed_samples,
+		static_cast<double>(results.total_samples - results.attributed_samples) * scale);
+
+	if (std::fwrite(csv.data(), csv.size(), 1, fp.get()) != 1 || std::fflush(fp.get()) != 0)
+	{
+		Error::SetErrno(error, "fwrite() failed: ", errno);
+		return false;
+	}
+
+	return true;
+}
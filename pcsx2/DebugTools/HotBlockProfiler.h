@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <atomic>
+#include <span>
+#include <string>
+#include <vector>
+
+class Error;
+struct BASEBLOCKEX;
+
+// Statistical profiler for the EE recompiler. A timer thread periodically
+// samples the host instruction pointer of the CPU thread, and the samples are
+// attributed to the recompiled block which contains them. Blocks are then
+// grouped by the guest function they belong to using the symbol database.
+namespace HotBlockProfiler
+{
+	static constexpr u32 DEFAULT_INTERVAL_MS = 1;
+
+	struct Entry
+	{
+		u32 address;
+		u32 size; // In instructions for blocks, bytes for functions.
+		std::string name;
+		u64 samples;
+		u32 blocks;
+	};
+
+	struct Results
+	{
+		u64 total_samples = 0;
+		u64 attributed_samples = 0; // Samples which landed in a recompiled block.
+		u64 dropped_samples = 0;
+		std::vector<Entry> functions; // Sorted by sample count, highest first.
+		std::vector<Entry> blocks;
+	};
+
+	// Starts sampling the calling thread, which must be the CPU thread.
+	bool Start(u32 interval_ms, Error* error);
+	void Stop();
+	bool IsRunning();
+
+	// Throws away all samples collected so far.
+	void Reset();
+
+	Results GetResults();
+	bool WriteCSV(const std::string& path, Error* error);
+
+	namespace Internal
+	{
+		extern std::atomic_bool s_process_pending;
+	}
+
+	// Checked by the recompiler at event tests, so it can process samples while no blocks are being compiled.
+	static __fi bool HasPendingSamples() { return Internal::s_process_pending.load(std::memory_order_relaxed); }
+
+	// Attributes pending samples to blocks. Must be called on the CPU thread, before the
+	// recompiler reuses any of its code buffer.
+	void ProcessSamples(std::span<const BASEBLOCKEX> blocks);
+} // namespace HotBlockProfiler
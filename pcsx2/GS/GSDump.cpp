@@ -286,6 +286,9 @@ namespace
 
 		CXzProps props;
 		XzProps_Init(&props);
+
+		// independent blocks let the replayer seek without decoding the whole dump
+		props.blockSize = 16 * _1mb;
 		const SRes res = Xz_Encode(&dos.vt, &mis.vt, &props, nullptr);
 		if (res != SZ_OK)
 		{
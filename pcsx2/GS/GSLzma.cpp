@@ -73,14 +73,14 @@ bool GSDumpFile::GetPreviewImageFromDump(const char* filename, u32* width, u32*
 bool GSDumpFile::ReadFile(Error* error)
 {
 	u32 ss;
-	if (Read(&m_crc, sizeof(m_crc)) != sizeof(m_crc) || Read(&ss, sizeof(ss)) != sizeof(ss))
+	if (ReadStream(&m_crc, sizeof(m_crc)) != sizeof(m_crc) || ReadStream(&ss, sizeof(ss)) != sizeof(ss))
 	{
 		Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read header."));
 		return false;
 	}
 
 	m_state_data.resize(ss);
-	if (Read(m_state_data.data(), ss) != ss)
+	if (ReadStream(m_state_data.data(), ss) != ss)
 	{
 		Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read state data."));
 		return false;
@@ -114,7 +114,7 @@ bool GSDumpFile::ReadFile(Error* error)
 
 		// Read the real state data
 		m_state_data.resize(header.state_size);
-		if (Read(m_state_data.data(), header.state_size) != header.state_size)
+		if (ReadStream(m_state_data.data(), header.state_size) != header.state_size)
 		{
 			Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read real state data"));
 			return false;
@@ -122,112 +122,156 @@ bool GSDumpFile::ReadFile(Error* error)
 	}
 
 	m_regs_data.resize(8192);
-	if (Read(m_regs_data.data(), m_regs_data.size()) != m_regs_data.size())
+	if (ReadStream(m_regs_data.data(), m_regs_data.size()) != m_regs_data.size())
 	{
 		Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read regs data."));
 		return false;
 	}
 
-	// read all the packet data in
-	// TODO: make this suck less by getting the full/extracted size and preallocating
-	for (;;)
+	m_frame_offsets.clear();
+	m_frame_offsets.push_back(m_stream_pos);
+	m_frame = 0;
+	m_frame_count = 0;
+	m_end_of_dump = false;
+	return true;
+}
+
+size_t GSDumpFile::ReadStream(void* ptr, size_t size)
+{
+	const size_t read = Read(ptr, size);
+	m_stream_pos += read;
+	return read;
+}
+
+bool GSDumpFile::ReadPacket(GSData* packet, Error* error)
+{
+	return NextPacket(packet, true, error);
+}
+
+bool GSDumpFile::NextPacket(GSData* packet, bool read_data, Error* error)
+{
+	if (m_end_of_dump)
+		return false;
+
+	*packet = {};
+	packet->path = GSTransferPath::Dummy;
+
+	u8 id;
+	if (ReadStream(&id, sizeof(id)) != sizeof(id))
 	{
-		const size_t packet_data_size = m_packet_data.size();
-		m_packet_data.resize(std::max<size_t>(packet_data_size * 2, 8 * _1mb));
+		if (!IsEof())
+		{
+			Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read byte."));
+			return false;
+		}
 
-		const size_t read_size = m_packet_data.size() - packet_data_size;
-		const size_t read = Read(m_packet_data.data() + packet_data_size, read_size);
-		if (read != read_size)
+		m_end_of_dump = true;
+		m_frame_count = m_frame;
+		return false;
+	}
+
+	packet->id = static_cast<GSType>(id);
+
+	switch (packet->id)
+	{
+		case GSType::Transfer:
 		{
-			if (!IsEof())
+			u8 path;
+			u32 length;
+			if (ReadStream(&path, sizeof(path)) != sizeof(path) || ReadStream(&length, sizeof(length)) != sizeof(length))
 			{
-				Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read packet."));
+				Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read word."));
 				return false;
 			}
 
-			m_packet_data.resize(packet_data_size + read);
-			m_packet_data.shrink_to_fit();
-			break;
+			packet->path = static_cast<GSTransferPath>(path);
+			packet->length = length;
 		}
+		break;
+		case GSType::VSync:
+			packet->length = 1;
+			break;
+		case GSType::ReadFIFO2:
+			packet->length = 4;
+			break;
+		case GSType::Registers:
+			packet->length = 8192;
+			break;
+		default:
+			Error::SetStringFmt(error,
+				TRANSLATE_FS("GSDumpFile", "Unknown packet type {}"), static_cast<u32>(packet->id));
+			return false;
 	}
 
-	u8* data = m_packet_data.data();
-	size_t remaining = m_packet_data.size();
-
-#define GET_BYTE(dst) \
-	do \
-	{ \
-		if (remaining < sizeof(u8)) \
-		{ \
-			Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read byte.")); \
-			return false; \
-		} \
-		std::memcpy(dst, data, sizeof(u8)); \
-		data++; \
-		remaining--; \
-	} while (0)
-#define GET_WORD(dst) \
-	do \
-	{ \
-		if (remaining < sizeof(u32)) \
-		{ \
-			Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read word.")); \
-			return false; \
-		} \
-		std::memcpy(dst, data, sizeof(u32)); \
-		data += sizeof(u32); \
-		remaining -= sizeof(u32); \
-	} while (0)
-
-	while (remaining > 0)
-	{
-		GSData packet = {};
-		packet.path = GSTransferPath::Dummy;
-		GET_BYTE(&packet.id);
-
-		switch (packet.id)
+	if (packet->length > 0)
+	{
+		size_t read;
+		if (read_data)
 		{
-			case GSType::Transfer:
-				GET_BYTE(&packet.path);
-				GET_WORD(&packet.length);
-				break;
-			case GSType::VSync:
-				packet.length = 1;
-				break;
-			case GSType::ReadFIFO2:
-				packet.length = 4;
-				break;
-			case GSType::Registers:
-				packet.length = 8192;
-				break;
-			default:
-				Error::SetStringFmt(error,
-					TRANSLATE_FS("GSDumpFile", "Unknown packet type {}"), static_cast<u32>(packet.id));
-				return false;
+			if (m_packet_data.size() < packet->length)
+				m_packet_data.resize(Common::AlignUpPow2(packet->length, _128kb));
+
+			read = ReadStream(m_packet_data.data(), packet->length);
+			packet->data = m_packet_data.data();
+		}
+		else
+		{
+			read = Seek(m_stream_pos + packet->length) ? packet->length : 0;
+			m_stream_pos += read;
 		}
 
-		if (packet.length > 0)
+		if (read != packet->length)
 		{
-			if (remaining < packet.length)
+			if (!IsEof())
 			{
-				// There's apparently some "bad" dumps out there that are missing bytes on the end..
-				// The "safest" option here is to discard the last packet, since that has less risk
-				// of leaving the GS in the middle of a command.
-				Console.Error("(GSDump) Dropping last packet of %u bytes (we only have %u bytes)",
-					static_cast<u32>(packet.length), static_cast<u32>(remaining));
-				break;
+				Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to read packet."));
+				return false;
 			}
 
-			packet.data = data;
-			data += packet.length;
-			remaining -= packet.length;
+			// There's apparently some "bad" dumps out there that are missing bytes on the end..
+			// The "safest" option here is to discard the last packet, since that has less risk
+			// of leaving the GS in the middle of a command.
+			Console.Error("(GSDump) Dropping last packet of %u bytes (we only have %u bytes)",
+				static_cast<u32>(packet->length), static_cast<u32>(read));
+			m_end_of_dump = true;
+			m_frame_count = m_frame;
+			return false;
 		}
+	}
+
+	if (packet->id == GSType::VSync)
+	{
+		m_frame++;
+		if (m_frame == m_frame_offsets.size())
+			m_frame_offsets.push_back(m_stream_pos);
+	}
+
+	return true;
+}
 
-		m_dump_packets.push_back(std::move(packet));
+bool GSDumpFile::SeekToFrame(u32 frame, Error* error)
+{
+	const u32 known_frame = std::min<u32>(frame, static_cast<u32>(m_frame_offsets.size() - 1));
+	if (!Seek(m_frame_offsets[known_frame]))
+	{
+		Error::SetString(error, TRANSLATE_STR("GSDumpFile", "Failed to seek in dump."));
+		return false;
 	}
 
-#undef GET_WORD
-#undef GET_BYTE
+	m_stream_pos = m_frame_offsets[known_frame];
+	m_frame = known_frame;
+	m_end_of_dump = false;
+
+	GSData packet;
+	while (m_frame < frame)
+	{
+		if (!NextPacket(&packet, false, error))
+		{
+			if (m_end_of_dump)
+				Error::SetStringFmt(error, TRANSLATE_FS("GSDumpFile", "Dump only has {} frames."), m_frame_count);
+			return false;
+		}
+	}
 
 	return true;
 }
@@ -256,9 +300,11 @@ namespace
 		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
 		bool IsEof() override;
 		size_t Read(void* ptr, size_t size) override;
+		bool Seek(u64 offset) override;
 
 	private:
 		static constexpr size_t kInputBufSize = static_cast<size_t>(1) << 18;
+		static constexpr size_t kOutputBufSize = 4 * _1mb;
 
 		struct Block
 		{
@@ -269,18 +315,23 @@ namespace
 			CXzStreamFlags stream_flags;
 		};
 
-		bool DecompressNextBlock();
-
+		void StartBlock(size_t index);
+		bool DecompressNextChunk();
 
 		std::vector<Block> m_blocks;
 		size_t m_stream_size = 0;
 
+		// Blocks are decoded a window at a time, so memory use doesn't depend on the block size.
 		DynamicHeapArray<u8, 64> m_block_buffer;
 		size_t m_block_index = 0;
+		size_t m_block_decoded = 0;
 		size_t m_block_size = 0;
 		size_t m_block_pos = 0;
 
 		DynamicHeapArray<u8, 64> m_block_read_buffer;
+		size_t m_block_read_offset = 0;
+		size_t m_block_read_size = 0;
+		size_t m_block_read_pos = 0;
 		alignas(__cachelinesize) CXzUnpacker m_unpacker = {};
 	};
 
@@ -389,60 +440,89 @@ namespace
 
 		DevCon.WriteLnFmt("XZ stream is {} bytes across {} blocks", m_stream_size, m_blocks.size());
 		XzUnpacker_Construct(&m_unpacker, &g_Alloc);
+		m_block_buffer.resize(kOutputBufSize);
+		m_block_read_buffer.resize(kInputBufSize);
+		StartBlock(0);
 		return true;
 	}
 
-	bool GSDumpLzma::DecompressNextBlock()
+	void GSDumpLzma::StartBlock(size_t index)
 	{
-		if (m_block_index == m_blocks.size())
-			return false;
+		m_block_index = index;
+		m_block_decoded = 0;
+		m_block_size = 0;
+		m_block_pos = 0;
+		m_block_read_offset = 0;
+		m_block_read_size = 0;
+		m_block_read_pos = 0;
 
-		const Block& block = m_blocks[m_block_index];
+		if (index == m_blocks.size())
+			return;
 
-		if (block.compressed_size > m_block_read_buffer.size())
-			m_block_read_buffer.resize(Common::AlignUpPow2(block.compressed_size, _128kb));
+		XzUnpacker_Init(&m_unpacker);
+		m_unpacker.streamFlags = m_blocks[index].stream_flags;
+		XzUnpacker_PrepareToRandomBlockDecoding(&m_unpacker);
+	}
 
-		if (FileSystem::FSeek64(m_fp.get(), static_cast<s64>(block.file_offset), SEEK_SET) != 0 ||
-			std::fread(m_block_read_buffer.data(), block.compressed_size, 1, m_fp.get()) != 1)
+	bool GSDumpLzma::DecompressNextChunk()
+	{
+		while (m_block_index < m_blocks.size())
 		{
-			Console.ErrorFmt("Failed to read {} bytes from offset {}", block.file_offset, block.compressed_size);
-			return false;
-		}
+			const Block& block = m_blocks[m_block_index];
 
-		if (block.uncompressed_size > m_block_buffer.size())
-			m_block_buffer.resize(Common::AlignUpPow2(block.uncompressed_size, _128kb));
+			if (m_block_decoded == block.uncompressed_size)
+			{
+				StartBlock(m_block_index + 1);
+				continue;
+			}
 
-		XzUnpacker_Init(&m_unpacker);
-		m_unpacker.streamFlags = block.stream_flags;
-		XzUnpacker_PrepareToRandomBlockDecoding(&m_unpacker);
-		XzUnpacker_SetOutBuf(&m_unpacker, m_block_buffer.data(), block.uncompressed_size);
-		SizeT out_uncompressed_size = block.uncompressed_size;
-		SizeT out_compressed_size = block.compressed_size;
-
-		ECoderStatus status;
-		const SRes res = XzUnpacker_Code(&m_unpacker, nullptr, &out_uncompressed_size,
-			m_block_read_buffer.data(), &out_compressed_size, true, CODER_FINISH_END, &status);
-		if (res != SZ_OK || status != CODER_STATUS_FINISHED_WITH_MARK) [[unlikely]]
-		{
-			Console.ErrorFmt("XzUnpacker_Code() failed: {} (status {})", res, static_cast<unsigned>(status));
-			return false;
-		}
+			if (m_block_read_pos == m_block_read_size)
+			{
+				const size_t size = std::min(kInputBufSize, block.compressed_size - m_block_read_offset);
+				if (size == 0 || FileSystem::FSeek64(m_fp.get(), static_cast<s64>(block.file_offset + m_block_read_offset), SEEK_SET) != 0 ||
+					std::fread(m_block_read_buffer.data(), size, 1, m_fp.get()) != 1)
+				{
+					Console.ErrorFmt("Failed to read {} bytes from offset {}", size, block.file_offset + m_block_read_offset);
+					return false;
+				}
 
-		if (out_compressed_size != block.compressed_size || out_uncompressed_size != block.uncompressed_size)
-		{
-			Console.WarningFmt("Decompress size mismatch: {}/{} vs {}/{}", out_compressed_size, out_uncompressed_size,
-				block.compressed_size, block.uncompressed_size);
+				m_block_read_offset += size;
+				m_block_read_size = size;
+				m_block_read_pos = 0;
+			}
+
+			SizeT out_size = std::min(kOutputBufSize, block.uncompressed_size - m_block_decoded);
+			SizeT in_size = m_block_read_size - m_block_read_pos;
+
+			ECoderStatus status;
+			const SRes res = XzUnpacker_Code(&m_unpacker, m_block_buffer.data(), &out_size,
+				&m_block_read_buffer[m_block_read_pos], &in_size, m_block_read_offset == block.compressed_size,
+				CODER_FINISH_ANY, &status);
+			if (res != SZ_OK || (out_size == 0 && in_size == 0 && status != CODER_STATUS_NEEDS_MORE_INPUT)) [[unlikely]]
+			{
+				Console.ErrorFmt("XzUnpacker_Code() failed: {} (status {})", res, static_cast<unsigned>(status));
+				return false;
+			}
+
+			m_block_read_pos += in_size;
+
+			if (out_size > 0)
+			{
+				m_block_decoded += out_size;
+				m_block_size = out_size;
+				m_block_pos = 0;
+				return true;
+			}
 		}
 
-		m_block_size = out_uncompressed_size;
-		m_block_pos = 0;
-		m_block_index++;
-		return true;
+		return false;
 	}
 
 	bool GSDumpLzma::IsEof()
 	{
-		return (m_block_pos == m_block_size && m_block_index == m_blocks.size());
+		return (m_block_pos == m_block_size &&
+				(m_block_index == m_blocks.size() ||
+					(m_block_index == m_blocks.size() - 1 && m_block_decoded == m_blocks.back().uncompressed_size)));
 	}
 
 	size_t GSDumpLzma::Read(void* ptr, size_t size)
@@ -451,7 +531,7 @@ namespace
 		size_t remain = size;
 		while (remain > 0)
 		{
-			if (m_block_size == m_block_pos && !DecompressNextBlock()) [[unlikely]]
+			if (m_block_size == m_block_pos && !DecompressNextChunk()) [[unlikely]]
 				break;
 
 			const size_t avail = (m_block_size - m_block_pos);
@@ -466,6 +546,33 @@ namespace
 		return size - remain;
 	}
 
+	bool GSDumpLzma::Seek(u64 offset)
+	{
+		if (offset >= m_stream_size)
+		{
+			StartBlock(m_blocks.size());
+			return (offset == m_stream_size);
+		}
+
+		const auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), offset,
+			[](u64 value, const Block& block) { return value < block.stream_offset; });
+		const size_t index = static_cast<size_t>(it - m_blocks.begin()) - 1;
+		const size_t block_offset = static_cast<size_t>(offset - m_blocks[index].stream_offset);
+
+		// only go back to the start of the block if the offset is behind the current window
+		if (index != m_block_index || block_offset < m_block_decoded - m_block_size)
+			StartBlock(index);
+
+		while (block_offset >= m_block_decoded)
+		{
+			if (!DecompressNextChunk())
+				return false;
+		}
+
+		m_block_pos = block_offset - (m_block_decoded - m_block_size);
+		return true;
+	}
+
 	/******************************************************************/
 
 	class GSDumpDecompressZst final : public GSDumpFile
@@ -480,6 +587,7 @@ namespace
 
 		size_t m_avail = 0;
 		size_t m_start = 0;
+		u64 m_pos = 0;
 
 		bool Decompress();
 
@@ -490,6 +598,7 @@ namespace
 		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
 		bool IsEof() override;
 		size_t Read(void* ptr, size_t size) override;
+		bool Seek(u64 offset) override;
 	};
 
 	GSDumpDecompressZst::GSDumpDecompressZst() = default;
@@ -575,9 +684,43 @@ namespace
 			off += l;
 		}
 
+		m_pos += off;
 		return off;
 	}
 
+	bool GSDumpDecompressZst::Seek(u64 offset)
+	{
+		// frames can't be decoded independently, so going backwards means starting over
+		if (offset < m_pos)
+		{
+			if (FileSystem::FSeek64(m_fp.get(), 0, SEEK_SET) != 0)
+				return false;
+
+			ZSTD_DCtx_reset(m_strm, ZSTD_reset_session_only);
+			m_inbuf.pos = 0;
+			m_inbuf.size = 0;
+			m_avail = 0;
+			m_start = 0;
+			m_pos = 0;
+		}
+
+		while (m_pos < offset && !IsEof())
+		{
+			if (m_avail == 0)
+			{
+				if (!Decompress()) [[unlikely]]
+					return false;
+			}
+
+			const size_t l = static_cast<size_t>(std::min<u64>(offset - m_pos, m_avail));
+			m_avail -= l;
+			m_start += l;
+			m_pos += l;
+		}
+
+		return (m_pos == offset);
+	}
+
 	/******************************************************************/
 
 	class GSDumpRaw final : public GSDumpFile
@@ -589,6 +732,7 @@ namespace
 		bool Open(FileSystem::ManagedCFilePtr fp, Error* error) override;
 		bool IsEof() override;
 		size_t Read(void* ptr, size_t size) override;
+		bool Seek(u64 offset) override;
 	};
 
 	GSDumpRaw::GSDumpRaw() = default;
@@ -616,6 +760,20 @@ namespace
 
 		return ret;
 	}
+
+	bool GSDumpRaw::Seek(u64 offset)
+	{
+		const s64 size = FileSystem::FSize64(m_fp.get());
+		if (size < 0 || FileSystem::FSeek64(m_fp.get(), std::min(static_cast<s64>(offset), size), SEEK_SET) != 0)
+			return false;
+
+		if (static_cast<s64>(offset) < size)
+			return true;
+
+		// leave the file at eof like a short read would
+		u8 dummy;
+		return (std::fread(&dummy, 1, 1, m_fp.get()) == 0 && static_cast<s64>(offset) == size);
+	}
 } // namespace
 
 /******************************************************************/
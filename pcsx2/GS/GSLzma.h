@@ -281,7 +281,6 @@ public:
 	};
 
 	using ByteArray = std::vector<u8>;
-	using GSDataArray = std::vector<GSData>;
 
 	virtual ~GSDumpFile();
 
@@ -293,10 +292,27 @@ public:
 
 	__fi const ByteArray& GetRegsData() const { return m_regs_data; }
 	__fi const ByteArray& GetStateData() const { return m_state_data; }
-	__fi const GSDataArray& GetPackets() const { return m_dump_packets; }
 
+	/// Frame of the next packet, counted in vsyncs from the start of the dump.
+	__fi u32 GetFrameNumber() const { return m_frame; }
+
+	/// Number of frames in the dump, or 0 if the end hasn't been reached yet.
+	__fi u32 GetFrameCount() const { return m_frame_count; }
+
+	/// Returns true once ReadPacket() has run off the end of the dump.
+	__fi bool IsEndOfDump() const { return m_end_of_dump; }
+
+	/// Reads the header, state and registers. Packets are decoded on demand by ReadPacket().
 	bool ReadFile(Error* error);
 
+	/// Reads the next packet, its data stays valid until the next call. Returns false at the end
+	/// of the dump, or with error set if the dump is damaged.
+	bool ReadPacket(GSData* packet, Error* error);
+
+	/// Moves to the first packet of frame. Frames which have been read before are a single seek,
+	/// later ones are found by skipping over packets.
+	bool SeekToFrame(u32 frame, Error* error);
+
 protected:
 	GSDumpFile();
 
@@ -304,10 +320,16 @@ protected:
 	virtual bool IsEof() = 0;
 	virtual size_t Read(void* ptr, size_t size) = 0;
 
+	/// Moves to an offset in the decompressed stream.
+	virtual bool Seek(u64 offset) = 0;
+
 protected:
 	FileSystem::ManagedCFilePtr m_fp;
 
 private:
+	size_t ReadStream(void* ptr, size_t size);
+	bool NextPacket(GSData* packet, bool read_data, Error* error);
+
 	std::string m_serial;
 	u32 m_crc = 0;
 
@@ -315,7 +337,13 @@ private:
 	std::vector<u8> m_state_data;
 	std::vector<u8> m_packet_data;
 
-	GSDataArray m_dump_packets;
+	u64 m_stream_pos = 0;
+
+	// stream offset of the first packet of each frame seen so far
+	std::vector<u64> m_frame_offsets;
+	u32 m_frame = 0;
+	u32 m_frame_count = 0;
+	bool m_end_of_dump = false;
 };
 
 // Initializes CRC tables used by LZMA SDK.
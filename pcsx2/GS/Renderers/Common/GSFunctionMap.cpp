@@ -2,13 +2,29 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "GS/Renderers/Common/GSFunctionMap.h"
+#include "GS/MultiISA.h"
+#include "Config.h"
 #include "Memory.h"
+#include "ShaderCacheVersion.h"
+#include "VMManager.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 
 namespace GSCodeReserve
 {
 	static u8* s_memory_base;
 	static u8* s_memory_end;
 	static u8* s_memory_ptr;
+	static std::mutex s_mutex;
 }
 
 void GSCodeReserve::ResetMemory()
@@ -23,6 +39,11 @@ size_t GSCodeReserve::GetMemoryUsed()
 	return s_memory_ptr - s_memory_base;
 }
 
+size_t GSCodeReserve::GetMemorySize()
+{
+	return s_memory_end - s_memory_base;
+}
+
 u8* GSCodeReserve::ReserveMemory(size_t size)
 {
 	pxAssert((s_memory_ptr + size) <= s_memory_end);
@@ -34,3 +55,179 @@ void GSCodeReserve::CommitMemory(size_t size)
 	pxAssert((s_memory_ptr + size) <= s_memory_end);
 	s_memory_ptr += size;
 }
+
+std::mutex& GSCodeReserve::GetMutex()
+{
+	return s_mutex;
+}
+
+namespace GSCodeCache
+{
+	struct FileHeader
+	{
+		u32 magic;
+		u32 version;
+		u32 setup_prim_count;
+		u32 draw_scanline_count;
+	};
+
+	static constexpr u32 FILE_MAGIC = 0x4A575350; // PSWJ
+
+	static const char* GetISAName();
+
+	static bool s_shared = false;
+	static Keys s_shared_keys;
+}
+
+const char* GSCodeCache::GetISAName()
+{
+#if defined(_M_X86)
+	switch (g_cpu.vectorISA)
+	{
+		case ProcessorFeatures::VectorISA::AVX2:
+			return "avx2";
+		case ProcessorFeatures::VectorISA::AVX:
+			return "avx";
+		default:
+			return "sse4";
+	}
+#elif defined(_M_ARM64)
+	return "arm64";
+#endif
+}
+
+std::string GSCodeCache::GetPath()
+{
+	std::string serial = VMManager::GetDiscSerial();
+	if (serial.empty() || EmuFolders::Cache.empty())
+		return {};
+
+	Path::SanitizeFileName(&serial);
+	return Path::Combine(EmuFolders::Cache, fmt::format("sw_jit_{}_{}.bin", serial, GetISAName()));
+}
+
+bool GSCodeCache::Load(const std::string& path, Keys* keys)
+{
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(path.c_str());
+	if (!data.has_value())
+		return false;
+
+	FileHeader header;
+	if (data->size() < sizeof(header))
+	{
+		Console.Warning(fmt::format("SW JIT cache '{}' is truncated, ignoring.", Path::GetFileName(path)));
+		return false;
+	}
+
+	std::memcpy(&header, data->data(), sizeof(header));
+	if (header.magic != FILE_MAGIC || header.version != SW_JIT_CACHE_VERSION ||
+		data->size() != sizeof(header) + (static_cast<size_t>(header.setup_prim_count) + header.draw_scanline_count) * sizeof(u64))
+	{
+		Console.Warning(fmt::format("SW JIT cache '{}' is out of date, ignoring.", Path::GetFileName(path)));
+		return false;
+	}
+
+	const u8* ptr = data->data() + sizeof(header);
+	keys->setup_prim.resize(header.setup_prim_count);
+	std::memcpy(keys->setup_prim.data(), ptr, header.setup_prim_count * sizeof(u64));
+	ptr += header.setup_prim_count * sizeof(u64);
+	keys->draw_scanline.resize(header.draw_scanline_count);
+	std::memcpy(keys->draw_scanline.data(), ptr, header.draw_scanline_count * sizeof(u64));
+	return true;
+}
+
+bool GSCodeCache::Save(const std::string& path, const Keys& keys)
+{
+	// Written under a temporary name so a partial file never replaces a good one.
+	const std::string temp_path = path + ".tmp";
+	Error error;
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(temp_path.c_str(), "wb", &error);
+	if (!fp)
+	{
+		Console.Error(fmt::format("Failed to open SW JIT cache for writing: {}", error.GetDescription()));
+		return false;
+	}
+
+	const FileHeader header = {FILE_MAGIC, SW_JIT_CACHE_VERSION, static_cast<u32>(keys.setup_prim.size()),
+		static_cast<u32>(keys.draw_scanline.size())};
+	const bool written = std::fwrite(&header, sizeof(header), 1, fp.get()) == 1 &&
+						 std::fwrite(keys.setup_prim.data(), sizeof(u64), keys.setup_prim.size(), fp.get()) == keys.setup_prim.size() &&
+						 std::fwrite(keys.draw_scanline.data(), sizeof(u64), keys.draw_scanline.size(), fp.get()) == keys.draw_scanline.size() &&
+						 std::fflush(fp.get()) == 0;
+	fp.reset();
+	if (!written)
+	{
+		Console.Error(fmt::format("Failed to write SW JIT cache: {}", std::strerror(errno)));
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return false;
+	}
+
+	if (!FileSystem::RenamePath(temp_path.c_str(), path.c_str(), &error))
+	{
+		Console.Error(fmt::format("Failed to replace SW JIT cache: {}", error.GetDescription()));
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool GSCodeCache::Merge(std::vector<u64>& cached, const std::vector<u64>& active, size_t max_keys)
+{
+	std::vector<u64> sorted_active(active);
+	std::sort(sorted_active.begin(), sorted_active.end());
+
+	const auto is_active = [&sorted_active](u64 key) {
+		return std::binary_search(sorted_active.begin(), sorted_active.end(), key);
+	};
+
+	// keys that were already cached keep their relative order, so the ones used in every session
+	// stay at the front and are precompiled first
+
+	std::vector<u64> merged;
+	merged.reserve(cached.size() + active.size());
+
+	for (const u64 key : cached)
+	{
+		if (is_active(key))
+			merged.push_back(key);
+	}
+
+	std::vector<u64> sorted_cached(cached);
+	std::sort(sorted_cached.begin(), sorted_cached.end());
+	for (const u64 key : active)
+	{
+		if (!std::binary_search(sorted_cached.begin(), sorted_cached.end(), key))
+			merged.push_back(key);
+	}
+
+	for (const u64 key : cached)
+	{
+		if (!is_active(key))
+			merged.push_back(key);
+	}
+
+	if (merged.size() > max_keys)
+		merged.resize(max_keys);
+
+	const bool changed = (merged != cached);
+	cached = std::move(merged);
+	return changed;
+}
+
+void GSCodeCache::SetShared(bool enabled)
+{
+	s_shared = enabled;
+	if (!enabled)
+		s_shared_keys = {};
+}
+
+bool GSCodeCache::IsShared()
+{
+	return s_shared;
+}
+
+GSCodeCache::Keys& GSCodeCache::GetSharedKeys()
+{
+	return s_shared_keys;
+}
@@ -9,6 +9,9 @@
 #include "common/HostSys.h"
 
 #include <cinttypes>
+#include <mutex>
+#include <string>
+#include <vector>
 
 template <class KEY, class VALUE>
 class GSFunctionMap
@@ -67,6 +70,16 @@ public:
 		return m_active->f;
 	}
 
+	/// Returns every key that has been looked up since the map was created.
+	std::vector<KEY> GetActiveKeys() const
+	{
+		std::vector<KEY> keys;
+		keys.reserve(m_map_active.size());
+		for (const auto& i : m_map_active)
+			keys.push_back(i.first);
+		return keys;
+	}
+
 	void UpdateStats(u64 frame, u64 ticks, int actual, int total, int prims)
 	{
 		if (m_active)
@@ -142,9 +155,51 @@ namespace GSCodeReserve
 	void ResetMemory();
 
 	size_t GetMemoryUsed();
+	size_t GetMemorySize();
 
 	u8* ReserveMemory(size_t size);
 	void CommitMemory(size_t size);
+
+	/// Held while generating code, so functions can be compiled off the GS thread.
+	std::mutex& GetMutex();
+}
+
+// --------------------------------------------------------------------------------------
+//  GSCodeCache
+// --------------------------------------------------------------------------------------
+// Remembers which selectors a game used, so they can be compiled ahead of time on the
+// next boot. Only the keys are stored, the generated code refers to host addresses.
+//
+namespace GSCodeCache
+{
+	/// Most recently used first.
+	struct Keys
+	{
+		std::vector<u64> setup_prim;
+		std::vector<u64> draw_scanline;
+	};
+
+	/// Games with lots of effects use a few hundred scanline functions, anything past these is stale.
+	static constexpr size_t MAX_SETUP_PRIM_KEYS = 256;
+	static constexpr size_t MAX_DRAW_SCANLINE_KEYS = 2048;
+
+	/// Returns the cache file for the running game and CPU, or an empty string if there's no game.
+	std::string GetPath();
+
+	bool Load(const std::string& path, Keys* keys);
+	bool Save(const std::string& path, const Keys& keys);
+
+	/// Moves the keys used this session to the front of the cached list, then drops the oldest ones
+	/// past max_keys. Returns true if the list changed.
+	bool Merge(std::vector<u64>& cached, const std::vector<u64>& active, size_t max_keys);
+
+	/// Keeps the selectors in memory for the lifetime of the process instead of in per-game files,
+	/// so each renderer instance precompiles everything earlier instances used. For batch replays.
+	void SetShared(bool enabled);
+	bool IsShared();
+
+	/// Selectors recorded by earlier renderer instances while shared.
+	Keys& GetSharedKeys();
 }
 
 template <class CG, class KEY, class VALUE>
@@ -170,39 +225,56 @@ public:
 
 	VALUE GetDefaultFunction(KEY key)
 	{
-		VALUE ret = nullptr;
+		std::lock_guard<std::mutex> lock(GSCodeReserve::GetMutex());
 
 		auto i = m_cgmap.find(key);
 
 		if (i != m_cgmap.end())
-		{
-			ret = i->second;
-		}
-		else
-		{
-			HostSys::BeginCodeWrite();
+			return i->second;
+
+		return Generate(key);
+	}
 
-			u8* code_ptr = GSCodeReserve::ReserveMemory(MAX_SIZE);
-			CG cg(key, code_ptr, MAX_SIZE);
-			cg.Generate();
-			pxAssert(cg.GetSize() < MAX_SIZE);
+	/// Generates the function for key ahead of its first use. Returns false if the code space is running low.
+	bool Precompile(KEY key)
+	{
+		std::lock_guard<std::mutex> lock(GSCodeReserve::GetMutex());
+
+		// leave plenty of room for whatever this session uses that the cache didn't know about
+		if (GSCodeReserve::GetMemoryUsed() + MAX_SIZE > GSCodeReserve::GetMemorySize() / 2)
+			return false;
+
+		if (m_cgmap.find(key) == m_cgmap.end())
+			Generate(key);
+
+		return true;
+	}
+
+private:
+	VALUE Generate(KEY key)
+	{
+		HostSys::BeginCodeWrite();
+
+		u8* code_ptr = GSCodeReserve::ReserveMemory(MAX_SIZE);
+		CG cg(key, code_ptr, MAX_SIZE);
+		cg.Generate();
+		pxAssert(cg.GetSize() < MAX_SIZE);
 
 #if 0
-			fprintf(stderr, "%s Location:%p Size:%zu Key:%llx\n", m_name.c_str(), code_ptr, cg.getSize(), (u64)key);
-			GSScanlineSelector sel(key);
-			sel.Print();
+		fprintf(stderr, "%s Location:%p Size:%zu Key:%llx\n", m_name.c_str(), code_ptr, cg.getSize(), (u64)key);
+		GSScanlineSelector sel(key);
+		sel.Print();
 #endif
 
-			const u32 size = static_cast<u32>(cg.GetSize());
-			GSCodeReserve::CommitMemory(size);
+		const u32 size = static_cast<u32>(cg.GetSize());
+		GSCodeReserve::CommitMemory(size);
 
-			HostSys::EndCodeWrite();
-			HostSys::FlushInstructionCache(code_ptr, static_cast<u32>(size));
+		HostSys::EndCodeWrite();
+		HostSys::FlushInstructionCache(code_ptr, static_cast<u32>(size));
 
-			ret = (VALUE)cg.GetCode();
+		VALUE ret = (VALUE)cg.GetCode();
 
-			m_cgmap[key] = ret;
-		}
+		m_cgmap[key] = ret;
 
 		return ret;
 	}
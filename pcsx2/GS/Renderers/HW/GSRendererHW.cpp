@@ -9,6 +9,7 @@
 #include "Host.h"
 #include "common/Console.h"
 #include "common/BitUtils.h"
+#include "common/Error.h"
 #include "common/StringUtil.h"
 #include <bit>
 
@@ -20,6 +21,8 @@ GSRendererHW::GSRendererHW()
 	MULTI_ISA_SELECT(GSRendererHWPopulateFunctions)(*this);
 	m_mipmap = GSConfig.HWMipmap;
 	SetTCOffset();
+	m_stereo_filter.Compile(GSConfig);
+	UpdateStereoTrace();
 
 	pxAssert(!g_texture_cache);
 	g_texture_cache = std::make_unique<GSTextureCache>();
@@ -40,6 +43,19 @@ void GSRendererHW::SetTCOffset()
 	m_userhacks_tcoffset = m_userhacks_tcoffset_x < 0.0f || m_userhacks_tcoffset_y < 0.0f;
 }
 
+void GSRendererHW::UpdateStereoTrace()
+{
+	m_stereo_trace.Close();
+	if (GSConfig.StereoTracePath.empty())
+		return;
+
+	Error error;
+	if (m_stereo_trace.Open(GSConfig.StereoTracePath, &error))
+		Console.WriteLnFmt("GS: Writing stereo trace to {}", GSConfig.StereoTracePath);
+	else
+		Console.ErrorFmt("GS: Failed to open stereo trace {}: {}", GSConfig.StereoTracePath, error.GetDescription());
+}
+
 GSRendererHW::~GSRendererHW()
 {
 	g_texture_cache.reset();
@@ -92,6 +108,9 @@ void GSRendererHW::UpdateSettings(const Pcsx2Config::GSOptions& old_config)
 	GSRenderer::UpdateSettings(old_config);
 	m_mipmap = GSConfig.HWMipmap;
 	SetTCOffset();
+	m_stereo_filter.Compile(GSConfig);
+	if (GSConfig.StereoTracePath != old_config.StereoTracePath)
+		UpdateStereoTrace();
 }
 
 void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame)
@@ -8292,45 +8311,19 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
         const bool alpha_test = m_cached_ctx.TEST.ATE;
         const bool uv_varies = !(m_vt.m_eq.s && m_vt.m_eq.t);
         const bool color_varies = !m_vt.m_eq.rgba;
-        const bool fog_enabled = PRIM->FGE;
-        const bool date_enabled = m_cached_ctx.TEST.DATE;
-        const bool datm_enabled = m_cached_ctx.TEST.DATM;
-        const bool afail_zb_only = m_cached_ctx.TEST.AFAIL == AFAIL_ZB_ONLY;
         const bool afail_not_keep = m_cached_ctx.TEST.AFAIL != AFAIL_KEEP;
-        const bool z_write = !m_cached_ctx.ZBUF.ZMSK;
-        const bool z_test = m_cached_ctx.TEST.ZTE;
         const bool fbmask_any = m_cached_ctx.FRAME.FBMSK != 0;
-        const bool fbmask_full = m_cached_ctx.FRAME.FBMSK == 0x00FFFFFF;
-        const bool tex_is_fb = m_conf.ps.tex_is_fb;
         const bool channel_shuffle = m_channel_shuffle;
         const bool texture_shuffle = m_texture_shuffle;
         const bool full_screen_shuffle = m_full_screen_shuffle;
         const bool shader_shuffle = m_conf.ps.shuffle;
-        const bool shuffle_across = m_conf.ps.shuffle_across;
-        const bool shuffle_same = m_conf.ps.shuffle_same;
-        const bool channel_fetch = m_conf.ps.channel != 0;
-        const bool channel_fetch_fb = m_conf.ps.channel_fb;
         const bool colclip = m_conf.ps.colclip || m_conf.ps.colclip_hw;
-        const bool blend_mix = m_conf.ps.blend_mix != 0;
-        const bool pabe = m_conf.ps.pabe;
-        const bool dither = m_conf.ps.dither != 0;
         const bool no_color_output = m_conf.ps.no_color || m_conf.ps.no_color1;
-        const bool hle_shuffle = m_conf.ps.urban_chaos_hle || m_conf.ps.tales_of_abyss_hle;
-        const bool tcoffset_hack = m_conf.ps.tcoffsethack;
         const bool prim_point = m_vt.m_primclass == GS_POINT_CLASS;
         const bool prim_line = m_vt.m_primclass == GS_LINE_CLASS;
-        const bool flat_shading = m_conf.ps.iip == 0;
-        const bool aa1 = PRIM->AA1;
         const bool z_test_off = !m_cached_ctx.TEST.ZTE;
         const bool z_write_off = m_cached_ctx.ZBUF.ZMSK;
-        const bool z_test_never = m_cached_ctx.TEST.ZTST == ZTST_NEVER;
         const bool z_test_always = m_cached_ctx.TEST.ZTST == ZTST_ALWAYS;
-        const bool alpha_test_off = !alpha_test;
-        const bool alpha_test_always = alpha_test && m_cached_ctx.TEST.ATST == ATST_ALWAYS;
-        const bool alpha_test_never = alpha_test && m_cached_ctx.TEST.ATST == ATST_NEVER;
-		const bool tfx_modulate = m_cached_ctx.TEX0.TFX == TFX_MODULATE;
-		const bool tfx_highlight = m_cached_ctx.TEX0.TFX == TFX_HIGHLIGHT;
-		const bool tfx_highlight2 = m_cached_ctx.TEX0.TFX == TFX_HIGHLIGHT2;
 		const bool stencil_mask = alpha_test && afail_not_keep;
 		const bool rt_sprite_no_depth = tex_is_rt && m_vt.m_primclass == GS_SPRITE_CLASS && texture_mapping && z_test_off;
 		const bool rt_sprite_alpha_blend = tex_is_rt && m_vt.m_primclass == GS_SPRITE_CLASS && texture_mapping && alpha_blend;
@@ -8377,7 +8370,6 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
 			std::abs(draw_size.x - tex_size.x) <= 2 && std::abs(draw_size.y - tex_size.y) <= 2;
 		const bool fmv_no_shuffle = !(channel_shuffle || texture_shuffle || full_screen_shuffle || shader_shuffle);
 		const bool fmv_no_mipmap = !mipmap_active;
-		const bool fmv_linear_sampling = linear_sampling;
 		const bool fmv_ee_upload = HasEEUpload(draw_rect);
 		const bool fmv_display_match = matches_display(0, m_regs->DISP[0].DISPFB) || matches_display(1, m_regs->DISP[1].DISPFB);
 //		const bool fmv_recent_ee_upload = HasRecentEEUpload(draw_rect, 5);
@@ -8392,8 +8384,6 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
 		const bool feedback_loop_tex_is_rt = tex_is_rt;
 		const bool feedback_loop_source_from_target = source_from_target;
 		const bool feedback_loop_in_target_draw = in_target_draw;
-		const bool feedback_loop_using_temp_z = using_temp_z;
-		const bool feedback_loop_overlap_draw_range = draw_uses_target_tex;
 		const bool feedback_loop_any_raw = feedback_loop_shader || feedback_loop_draw_uses_target ||
 			(feedback_loop_source_from_target && feedback_loop_tex_is_rt) || feedback_loop_in_target_draw;
 		const bool feedback_loop_any = GSConfig.StereoFeedbackLoopSourceFromTargetOnly ?
@@ -8416,17 +8406,6 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
 
 		const bool ui_advanced_detect = ui_safe_detect || (m_cached_ctx.TEST.ZTST != ZTST_GEQUAL && m_cached_ctx.TEST.ZTST != ZTST_GREATER);
 
-		bool ui_fix = true;
-		if (GSConfig.StereoUiSafeDetect) ui_fix &= ui_safe_detect;
-		if (GSConfig.StereoUiAdvancedDetect) ui_fix &= ui_advanced_detect;
-
-        if (GSConfig.StereoRejectZTestAlways) ui_fix &= m_cached_ctx.TEST.ZTST == ZTST_ALWAYS;
-        if (GSConfig.StereoRequireZVaries) ui_fix &= m_vt.m_eq.z;
-        if (GSConfig.StereoRejectFixedQ) ui_fix &= m_vt.m_eq.q;
-        if (GSConfig.StereoStencilRequireZTestGequal) ui_fix &= m_cached_ctx.TEST.ZTST != ZTST_GEQUAL && m_cached_ctx.TEST.ZTST != ZTST_GREATER;
-        if (GSConfig.StereoRejectUiLike) ui_fix &= ui_experimantal1;
-        if (GSConfig.StereoUiBackgroundDepth) ui_fix &= ui_experimantal2;
-
         // important fix for every game
         // TODO breaks MGS3 intro movie, cutscene blur, radar background
         const bool first_fix = m_vt.m_primclass == GS_SPRITE_CLASS &&
@@ -8456,364 +8435,99 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
                                 && fmv_process_texture && !fmv_no_depth_test && fmv_no_fb_mask && fmv_no_shuffle
                                 && fmv_no_mipmap && !fmv_ee_upload;
 
-        const bool master_fix_enabled = GSConfig.StereoMasterFix && (GSConfig.StereoMasterFix1 && first_fix
-                                  || GSConfig.StereoMasterFix2 && second_fix
-                                  || GSConfig.StereoMasterFix3 && third_fix
-                                  || GSConfig.StereoMasterFix4 && fourth_fix
-                                  || GSConfig.StereoMasterFix5 && fifth_fix
-                                  || GSConfig.StereoMasterFix6 && sixth_fix);
-
-        const bool master_fix_override = GSConfig.StereoMasterFix && (GSConfig.StereoMasterFix9 && movies_fix_override);
-
-        bool disable_stereo_pass = GSConfig.StereoMasterFixTest;
-//         (PRIM->FST && m_vt.m_max.p.z <= 0.0f);
-        if (GSConfig.StereoMasterFixTest)
-        {
-	        bool fullscreen_sprite = tex_is_rt || m_conf.drawarea.eq(fullscreen_rect) && m_conf.ps.blend_mix != 0;
-            const bool sprite_blit = (m_vt.m_primclass == GS_SPRITE_CLASS && m_index.tail == 2 && PRIM->TME &&
-                draw_size_valid && tex_size_valid && std::abs(draw_size.x - tex_size.x) <= 1 && std::abs(draw_size.y - tex_size.y) <= 1);
-
-            const bool constant_color = m_vt.m_eq.rgba == 0xFFFF;
-			const bool stereo_single_pass = !m_conf.ps.IsFeedbackLoop() && !m_conf.require_one_barrier && !m_conf.require_full_barrier;
-
-            const bool non_positive_z = m_vt.m_max.p.z <= 0.0f;
-            const bool small_z_range = m_vt.m_max.p.z > 0.0f && z_range <= 0.01f && fullscreen_sprite;
-
-            if (GSConfig.StereoRejectNonPositiveZ) disable_stereo_pass &= non_positive_z;
-            if (GSConfig.StereoRejectSmallZRange) disable_stereo_pass &= small_z_range;
-
-            if (GSConfig.StereoRejectFst) disable_stereo_pass &= PRIM->FST; // universal fix;
-            if (GSConfig.StereoUniversalRequireRtaSourceCorrection) disable_stereo_pass &= m_conf.ps.rta_source_correction; // universal GTA 3 fix
-            if (GSConfig.StereoUniversalRequireRtaCorrection) disable_stereo_pass &= m_conf.ps.rta_correction; // NFS reflections, Tekken 4 shadows fix
-            if (GSConfig.StereoUniversalRejectAdjt) disable_stereo_pass &= !m_conf.ps.adjt; // GT4 MGS3 fix, merge to always true
-            if (GSConfig.StereoUniversalRequireTfx) disable_stereo_pass &= m_conf.ps.tfx != 0; // Bully fix
-
-            if (GSConfig.StereoUniversalRejectBlendMix) disable_stereo_pass &= (m_conf.ps.blend_mix == 0); // Default UI fix
-
-            if (GSConfig.StereoRejectRtaCorrection) disable_stereo_pass &= !m_conf.ps.rta_correction; // Fixes a lot of games
-            if (GSConfig.StereoUniversalRejectBlendB) disable_stereo_pass &= (m_conf.ps.blend_b == 0); // Fixes smoke in GOW
-
-            if (GSConfig.StereoUniversalRejectIip) disable_stereo_pass &= !m_conf.ps.iip; // SOC, Tekken 5 fix
-            if (GSConfig.StereoUniversalRejectAutomaticLod) disable_stereo_pass &= !m_conf.ps.automatic_lod;// SOC fixes
-            if (GSConfig.StereoUniversalRequireNoColor1) disable_stereo_pass &= m_conf.ps.no_color1;
-
-            if (GSConfig.StereoUniversalRequireWms) disable_stereo_pass &= (m_conf.ps.wms != 0);  // MGS 2 fixes
-            if (GSConfig.StereoUniversalRequireWmt) disable_stereo_pass &= (m_conf.ps.wmt != 0);
-            if (GSConfig.StereoUniversalRequireLtf) disable_stereo_pass &= m_conf.ps.ltf;
-
-            if (GSConfig.StereoUniversalRequireShuffle) disable_stereo_pass &= m_conf.ps.shuffle; // Gun, MGS 3 fix
-            if (GSConfig.StereoUniversalRejectTcc) disable_stereo_pass &= !m_conf.ps.tcc; // Tekken 4 fix
-
-            if (GSConfig.StereoUniversalRejectTfx) disable_stereo_pass &= (m_conf.ps.tfx == 0);
-            if (GSConfig.StereoUniversalRequireAem) disable_stereo_pass &= m_conf.ps.aem;
-            if (GSConfig.StereoUniversalRequireBlendB) disable_stereo_pass &= (m_conf.ps.blend_b != 0);
-
-            if (GSConfig.StereoUniversalRejectProcessBa) disable_stereo_pass &= (m_conf.ps.process_ba == 0);
-            if (GSConfig.StereoUniversalRejectProcessRg) disable_stereo_pass &= (m_conf.ps.process_rg == 0);
-            if (GSConfig.StereoUniversalRejectShuffleAcross) disable_stereo_pass &= !m_conf.ps.shuffle_across;
-            if (GSConfig.StereoUniversalRequireTextureShuffle) disable_stereo_pass &= m_texture_shuffle;
-
-            if (GSConfig.StereoUniversalRejectRtaSourceCorrection) disable_stereo_pass &= !m_conf.ps.rta_source_correction;
-            if (GSConfig.StereoUniversalRejectColclipHw) disable_stereo_pass &= !m_conf.ps.colclip_hw;
-            if (GSConfig.StereoUniversalRejectColclip) disable_stereo_pass &= !m_conf.ps.colclip;
-            if (GSConfig.StereoUniversalRejectPabe) disable_stereo_pass &= !m_conf.ps.pabe;
-            if (GSConfig.StereoUniversalRejectFbMask) disable_stereo_pass &= !m_conf.ps.fbmask;
-            if (GSConfig.StereoUniversalRejectTexIsFb) disable_stereo_pass &= !m_conf.ps.tex_is_fb;
-            if (GSConfig.StereoUniversalRejectNoColor) disable_stereo_pass &= !m_conf.ps.no_color;
-            if (GSConfig.StereoUniversalRejectNoColor1) disable_stereo_pass &= !m_conf.ps.no_color1; // can be useful
-            if (GSConfig.StereoUniversalRejectAemFmt) disable_stereo_pass &= (m_conf.ps.aem_fmt == 0);
-            if (GSConfig.StereoUniversalRejectPalFmt) disable_stereo_pass &= (m_conf.ps.pal_fmt == 0);
-            if (GSConfig.StereoUniversalRejectDstFmt) disable_stereo_pass &= (m_conf.ps.dst_fmt == 0);
-            if (GSConfig.StereoUniversalRejectDepthFmt) disable_stereo_pass &= (m_conf.ps.depth_fmt == 0);
-            if (GSConfig.StereoUniversalRejectAem) disable_stereo_pass &= !m_conf.ps.aem;
-            if (GSConfig.StereoUniversalRejectFba) disable_stereo_pass &= !m_conf.ps.fba;
-            if (GSConfig.StereoUniversalRejectFog) disable_stereo_pass &= !m_conf.ps.fog;
-            if (GSConfig.StereoUniversalRejectDate) disable_stereo_pass &= (m_conf.ps.date == 0);
-            if (GSConfig.StereoUniversalRejectAtst) disable_stereo_pass &= (m_conf.ps.atst == 0);
-            if (GSConfig.StereoUniversalRejectAfail) disable_stereo_pass &= (m_conf.ps.afail == 0);
-            if (GSConfig.StereoUniversalRejectFst) disable_stereo_pass &= !m_conf.ps.fst;
-            if (GSConfig.StereoUniversalRejectWms) disable_stereo_pass &= (m_conf.ps.wms == 0);
-            if (GSConfig.StereoUniversalRejectWmt) disable_stereo_pass &= (m_conf.ps.wmt == 0);
-            if (GSConfig.StereoUniversalRejectAdjs) disable_stereo_pass &= !m_conf.ps.adjs;
-            if (GSConfig.StereoUniversalRejectLtf) disable_stereo_pass &= !m_conf.ps.ltf;
-            if (GSConfig.StereoUniversalRejectShuffle) disable_stereo_pass &= !m_conf.ps.shuffle;
-            if (GSConfig.StereoUniversalRejectShuffleSame) disable_stereo_pass &= !m_conf.ps.shuffle_same;
-            if (GSConfig.StereoUniversalRejectReal16Src) disable_stereo_pass &= !m_conf.ps.real16src;
-            if (GSConfig.StereoUniversalRejectWriteRg) disable_stereo_pass &= !m_conf.ps.write_rg;
-            if (GSConfig.StereoUniversalRejectBlendA) disable_stereo_pass &= (m_conf.ps.blend_a == 0);
-            if (GSConfig.StereoUniversalRejectBlendC) disable_stereo_pass &= (m_conf.ps.blend_c == 0);
-            if (GSConfig.StereoUniversalRejectBlendD) disable_stereo_pass &= (m_conf.ps.blend_d == 0);
-            if (GSConfig.StereoUniversalRejectFixedOneA) disable_stereo_pass &= !m_conf.ps.fixed_one_a;
-            if (GSConfig.StereoUniversalRejectBlendHw) disable_stereo_pass &= (m_conf.ps.blend_hw == 0);
-            if (GSConfig.StereoUniversalRejectAMasked) disable_stereo_pass &= !m_conf.ps.a_masked;
-            if (GSConfig.StereoUniversalRejectRoundInv) disable_stereo_pass &= !m_conf.ps.round_inv;
-            if (GSConfig.StereoUniversalRejectChannel) disable_stereo_pass &= (m_conf.ps.channel == 0);
-            if (GSConfig.StereoUniversalRejectChannelFb) disable_stereo_pass &= !m_conf.ps.channel_fb;
-            if (GSConfig.StereoUniversalRejectDither) disable_stereo_pass &= (m_conf.ps.dither == 0);
-            if (GSConfig.StereoUniversalRejectDitherAdjust) disable_stereo_pass &= !m_conf.ps.dither_adjust;
-            if (GSConfig.StereoUniversalRejectZClamp) disable_stereo_pass &= !m_conf.ps.zclamp;
-            if (GSConfig.StereoUniversalRejectZFloor) disable_stereo_pass &= !m_conf.ps.zfloor;
-            if (GSConfig.StereoUniversalRejectTCOffsetHack) disable_stereo_pass &= !m_conf.ps.tcoffsethack;
-            if (GSConfig.StereoUniversalRejectUrbanChaosHle) disable_stereo_pass &= !m_conf.ps.urban_chaos_hle;
-            if (GSConfig.StereoUniversalRejectTalesOfAbyssHle) disable_stereo_pass &= !m_conf.ps.tales_of_abyss_hle;
-            if (GSConfig.StereoUniversalRejectManualLod) disable_stereo_pass &= !m_conf.ps.manual_lod;
-            if (GSConfig.StereoUniversalRejectPointSampler) disable_stereo_pass &= !m_conf.ps.point_sampler;
-            if (GSConfig.StereoUniversalRejectRegionRect) disable_stereo_pass &= !m_conf.ps.region_rect;
-            if (GSConfig.StereoUniversalRejectScanmask) disable_stereo_pass &= (m_conf.ps.scanmsk == 0);
-            if (GSConfig.StereoUniversalRequireColclipHw) disable_stereo_pass &= m_conf.ps.colclip_hw;
-            if (GSConfig.StereoUniversalRequireColclip) disable_stereo_pass &= m_conf.ps.colclip;
-            if (GSConfig.StereoUniversalRequireBlendMix) disable_stereo_pass &= (m_conf.ps.blend_mix != 0);
-            if (GSConfig.StereoUniversalRequirePabe) disable_stereo_pass &= m_conf.ps.pabe;
-            if (GSConfig.StereoUniversalRequireFbMask) disable_stereo_pass &= m_conf.ps.fbmask;
-            if (GSConfig.StereoUniversalRequireTexIsFb) disable_stereo_pass &= m_conf.ps.tex_is_fb;
-            if (GSConfig.StereoUniversalRequireNoColor) disable_stereo_pass &= m_conf.ps.no_color;
-            if (GSConfig.StereoUniversalRequireAemFmt) disable_stereo_pass &= (m_conf.ps.aem_fmt != 0);
-            if (GSConfig.StereoUniversalRequirePalFmt) disable_stereo_pass &= (m_conf.ps.pal_fmt != 0);
-            if (GSConfig.StereoUniversalRequireDstFmt) disable_stereo_pass &= (m_conf.ps.dst_fmt != 0);
-            if (GSConfig.StereoUniversalRequireDepthFmt) disable_stereo_pass &= (m_conf.ps.depth_fmt != 0);
-            if (GSConfig.StereoUniversalRequireFba) disable_stereo_pass &= m_conf.ps.fba;
-            if (GSConfig.StereoUniversalRequireFog) disable_stereo_pass &= m_conf.ps.fog;
-            if (GSConfig.StereoUniversalRequireIip) disable_stereo_pass &= m_conf.ps.iip;
-            if (GSConfig.StereoUniversalRequireDate) disable_stereo_pass &= (m_conf.ps.date != 0);
-            if (GSConfig.StereoUniversalRequireAtst) disable_stereo_pass &= (m_conf.ps.atst != 0);
-            if (GSConfig.StereoUniversalRequireAfail) disable_stereo_pass &= (m_conf.ps.afail != 0);
-            if (GSConfig.StereoUniversalRequireFst) disable_stereo_pass &= m_conf.ps.fst;
-            if (GSConfig.StereoUniversalRequireTcc) disable_stereo_pass &= m_conf.ps.tcc;
-            if (GSConfig.StereoUniversalRequireAdjs) disable_stereo_pass &= m_conf.ps.adjs;
-            if (GSConfig.StereoUniversalRequireAdjt) disable_stereo_pass &= m_conf.ps.adjt;
-            if (GSConfig.StereoUniversalRequireShuffleSame) disable_stereo_pass &= m_conf.ps.shuffle_same;
-            if (GSConfig.StereoUniversalRequireReal16Src) disable_stereo_pass &= m_conf.ps.real16src;
-            if (GSConfig.StereoUniversalRequireProcessBa) disable_stereo_pass &= (m_conf.ps.process_ba != 0);
-            if (GSConfig.StereoUniversalRequireProcessRg) disable_stereo_pass &= (m_conf.ps.process_rg != 0);
-            if (GSConfig.StereoUniversalRequireShuffleAcross) disable_stereo_pass &= m_conf.ps.shuffle_across;
-            if (GSConfig.StereoUniversalRequireWriteRg) disable_stereo_pass &= m_conf.ps.write_rg;
-            if (GSConfig.StereoUniversalRequireBlendA) disable_stereo_pass &= (m_conf.ps.blend_a != 0);
-            if (GSConfig.StereoUniversalRequireBlendC) disable_stereo_pass &= (m_conf.ps.blend_c != 0);
-            if (GSConfig.StereoUniversalRequireBlendD) disable_stereo_pass &= (m_conf.ps.blend_d != 0);
-            if (GSConfig.StereoUniversalRequireFixedOneA) disable_stereo_pass &= m_conf.ps.fixed_one_a;
-            if (GSConfig.StereoUniversalRequireBlendHw) disable_stereo_pass &= (m_conf.ps.blend_hw != 0);
-            if (GSConfig.StereoUniversalRequireAMasked) disable_stereo_pass &= m_conf.ps.a_masked;
-            if (GSConfig.StereoUniversalRequireRoundInv) disable_stereo_pass &= m_conf.ps.round_inv;
-            if (GSConfig.StereoUniversalRequireChannel) disable_stereo_pass &= (m_conf.ps.channel != 0);
-            if (GSConfig.StereoUniversalRequireChannelFb) disable_stereo_pass &= m_conf.ps.channel_fb;
-            if (GSConfig.StereoUniversalRequireDither) disable_stereo_pass &= (m_conf.ps.dither != 0);
-            if (GSConfig.StereoUniversalRequireDitherAdjust) disable_stereo_pass &= m_conf.ps.dither_adjust;
-            if (GSConfig.StereoUniversalRequireZClamp) disable_stereo_pass &= m_conf.ps.zclamp;
-            if (GSConfig.StereoUniversalRequireZFloor) disable_stereo_pass &= m_conf.ps.zfloor;
-            if (GSConfig.StereoUniversalRequireTCOffsetHack) disable_stereo_pass &= m_conf.ps.tcoffsethack;
-            if (GSConfig.StereoUniversalRequireUrbanChaosHle) disable_stereo_pass &= m_conf.ps.urban_chaos_hle;
-            if (GSConfig.StereoUniversalRequireTalesOfAbyssHle) disable_stereo_pass &= m_conf.ps.tales_of_abyss_hle;
-            if (GSConfig.StereoUniversalRequireAutomaticLod) disable_stereo_pass &= m_conf.ps.automatic_lod;
-            if (GSConfig.StereoUniversalRequireManualLod) disable_stereo_pass &= m_conf.ps.manual_lod;
-            if (GSConfig.StereoUniversalRequirePointSampler) disable_stereo_pass &= m_conf.ps.point_sampler;
-            if (GSConfig.StereoUniversalRequireRegionRect) disable_stereo_pass &= m_conf.ps.region_rect;
-            if (GSConfig.StereoUniversalRequireScanmask) disable_stereo_pass &= (m_conf.ps.scanmsk != 0);
-            if (GSConfig.StereoUniversalRequireAlphaBlend) disable_stereo_pass &= PRIM->ABE;
-            if (GSConfig.StereoUniversalRequireAlphaTest) disable_stereo_pass &= m_cached_ctx.TEST.ATE;
-            if (GSConfig.StereoUniversalRequireDatm) disable_stereo_pass &= m_cached_ctx.TEST.DATM;
-            if (GSConfig.StereoUniversalRequireZTest) disable_stereo_pass &= m_cached_ctx.TEST.ZTE;
-            if (GSConfig.StereoUniversalRequireZWrite) disable_stereo_pass &= !m_cached_ctx.ZBUF.ZMSK;
-            if (GSConfig.StereoUniversalRequireZTestAlways) disable_stereo_pass &= (m_cached_ctx.TEST.ZTST == ZTST_ALWAYS);
-            if (GSConfig.StereoUniversalRequireZTestNever) disable_stereo_pass &= (m_cached_ctx.TEST.ZTST == ZTST_NEVER);
-            if (GSConfig.StereoUniversalRequireAa1) disable_stereo_pass &= PRIM->AA1;
-            if (GSConfig.StereoUniversalRequireChannelShuffle) disable_stereo_pass &= m_channel_shuffle;
-            if (GSConfig.StereoUniversalRequireFullscreenShuffle) disable_stereo_pass &= m_full_screen_shuffle;
-            if (GSConfig.StereoUniversalRequirePoints) disable_stereo_pass &= (m_vt.m_primclass == GS_POINT_CLASS);
-            if (GSConfig.StereoUniversalRequireLines) disable_stereo_pass &= (m_vt.m_primclass == GS_LINE_CLASS);
-            if (GSConfig.StereoUniversalRequireTriangles) disable_stereo_pass &= (m_vt.m_primclass == GS_TRIANGLE_CLASS);
-            if (GSConfig.StereoUniversalRequireSprites) disable_stereo_pass &= (m_cached_ctx.TEST.ZTST == ZTST_ALWAYS && m_vt.m_eq.z);
-            if (GSConfig.StereoUniversalRequireFixedQ) disable_stereo_pass &= m_cached_ctx.TEX0.TFX == TFX_DECAL;
-            if (GSConfig.StereoUniversalRequireFixedZ) disable_stereo_pass &= m_cached_ctx.TEX0.TFX != TFX_DECAL;
-            if (GSConfig.StereoUniversalRequireConstantColor) disable_stereo_pass &= !(m_cached_ctx.TEX0.TFX == TFX_DECAL && !m_conf.ps.region_rect);
-
-            if (GSConfig.StereoFixStencilShadows) disable_stereo_pass &= m_vt.m_eq.q && !m_vt.m_eq.z && depth_active;
-            if (GSConfig.StereoRejectScalingDraw) disable_stereo_pass &= scaling_draw;
-            if (GSConfig.StereoRejectSbsInput) disable_stereo_pass &= sbs_input;
-            if (GSConfig.StereoRejectTabInput) disable_stereo_pass &= tab_input;
-            if (GSConfig.StereoRejectNonPositiveZ) disable_stereo_pass &= non_positive_z;
-            if (GSConfig.StereoRejectSmallZRange) disable_stereo_pass &= small_z_range;
-            if (GSConfig.StereoRejectSpriteBlit) disable_stereo_pass &= sprite_blit;
-            if (GSConfig.StereoRejectConstantColor) disable_stereo_pass &= constant_color;
-
-            if (GSConfig.StereoRejectFeedbackLoop) disable_stereo_pass &= m_conf.ps.IsFeedbackLoop();
-            if (GSConfig.StereoRejectSpriteNoGaps) disable_stereo_pass &= m_primitive_covers_without_gaps == NoGapsType::SpriteNoGaps ||
-                                       GSConfig.StereoRejectRegionRect && m_conf.ps.region_rect;
-
-            if (GSConfig.StereoRejectFullscreenScissor) disable_stereo_pass &= !m_conf.scissor.eq(fullscreen_rect);
-            if (GSConfig.StereoRejectFullscreenDraw) disable_stereo_pass &= draw_rect.eq(fullscreen_rect);
-            if (GSConfig.StereoRejectFullCover) disable_stereo_pass &= m_primitive_covers_without_gaps == NoGapsType::FullCover;
-            if (GSConfig.StereoRejectScanmask) disable_stereo_pass &= m_conf.ps.scanmsk != 0;
-
-            if (GSConfig.StereoUiSafeDetect) disable_stereo_pass &= ui_safe_detect;
-            if (GSConfig.StereoUiAdvancedDetect) disable_stereo_pass &= ui_advanced_detect;
-            if (GSConfig.StereoRejectZTestAlways) disable_stereo_pass &= m_cached_ctx.TEST.ZTST == ZTST_ALWAYS;
-            if (GSConfig.StereoRequireZVaries) disable_stereo_pass &= m_vt.m_eq.z;
-            if (GSConfig.StereoRejectFixedQ) disable_stereo_pass &= m_vt.m_eq.q;
-            if (GSConfig.StereoStencilRequireZTestGequal) disable_stereo_pass &= m_cached_ctx.TEST.ZTST != ZTST_GEQUAL && m_cached_ctx.TEST.ZTST != ZTST_GREATER;
-            if (GSConfig.StereoRejectUiLike) disable_stereo_pass &= ui_experimantal1;
-            if (GSConfig.StereoUiBackgroundDepth) disable_stereo_pass &= ui_experimantal2;
-
-            if (GSConfig.StereoRequirePerspectiveUV) disable_stereo_pass &= !perspective_uv;
-            if (GSConfig.StereoRequireDepthActive) disable_stereo_pass &= !depth_active;
-            if (GSConfig.StereoRejectSprites) disable_stereo_pass &= m_vt.m_primclass == GS_SPRITE_CLASS;
-            if (GSConfig.StereoRequireTextureMapping) disable_stereo_pass &= !texture_mapping;
-            if (GSConfig.StereoRequireAlphaBlend) disable_stereo_pass &= !alpha_blend;
-            if (GSConfig.StereoRequireAlphaTest) disable_stereo_pass &= !alpha_test;
-            if (GSConfig.StereoRequireUvVaries) disable_stereo_pass &= !uv_varies;
-            if (GSConfig.StereoRequireColorVaries) disable_stereo_pass &= !color_varies;
-            if (GSConfig.StereoRequireFog) disable_stereo_pass &= !fog_enabled;
-            if (GSConfig.StereoStencilRequireDate) disable_stereo_pass &= !date_enabled;
-            if (GSConfig.StereoStencilRequireDatm) disable_stereo_pass &= !datm_enabled;
-            if (GSConfig.StereoStencilRequireAte) disable_stereo_pass &= !alpha_test;
-            if (GSConfig.StereoStencilRequireAfailZbOnly) disable_stereo_pass &= !afail_zb_only;
-            if (GSConfig.StereoStencilRequireAfailNotKeep) disable_stereo_pass &= !afail_not_keep;
-            if (GSConfig.StereoStencilRequireZWrite) disable_stereo_pass &= !z_write;
-            if (GSConfig.StereoStencilRequireZTest) disable_stereo_pass &= !z_test;
-            if (GSConfig.StereoStencilRequireFbMask) disable_stereo_pass &= !fbmask_any;
-            if (GSConfig.StereoStencilRequireFbMaskFull) disable_stereo_pass &= !fbmask_full;
-            if (GSConfig.StereoStencilRequireTexIsFb) disable_stereo_pass &= !tex_is_fb;
-            if (GSConfig.StereoRejectTexIsFb) disable_stereo_pass &= tex_is_fb;
-            if (GSConfig.StereoRejectChannelShuffle) disable_stereo_pass &= channel_shuffle;
-            if (GSConfig.StereoRejectTextureShuffle) disable_stereo_pass &= texture_shuffle;
-            if (GSConfig.StereoRejectFullscreenShuffle) disable_stereo_pass &= full_screen_shuffle;
-            if (GSConfig.StereoRejectShaderShuffle) disable_stereo_pass &= shader_shuffle;
-            if (GSConfig.StereoRejectShuffleAcross) disable_stereo_pass &= shuffle_across;
-            if (GSConfig.StereoRejectShuffleSame) disable_stereo_pass &= shuffle_same;
-            if (GSConfig.StereoRejectChannelFetch) disable_stereo_pass &= channel_fetch;
-            if (GSConfig.StereoRejectChannelFetchFb) disable_stereo_pass &= channel_fetch_fb;
-            if (GSConfig.StereoRejectColclip) disable_stereo_pass &= colclip;
-            if (GSConfig.StereoRejectBlendMix) disable_stereo_pass &= blend_mix;
-            if (GSConfig.StereoRejectPabe) disable_stereo_pass &= pabe;
-            if (GSConfig.StereoRejectDither) disable_stereo_pass &= dither;
-            if (GSConfig.StereoRejectNoColorOutput) disable_stereo_pass &= no_color_output;
-            if (GSConfig.StereoRejectHleShuffle) disable_stereo_pass &= hle_shuffle;
-            if (GSConfig.StereoRejectTCOffsetHack) disable_stereo_pass &= tcoffset_hack;
-            if (GSConfig.StereoRejectPoints) disable_stereo_pass &= prim_point;
-            if (GSConfig.StereoRejectLines) disable_stereo_pass &= prim_line;
-            if (GSConfig.StereoRejectFlatShading) disable_stereo_pass &= flat_shading;
-            if (GSConfig.StereoRejectAa1) disable_stereo_pass &= aa1;
-            if (GSConfig.StereoRejectNoZTest) disable_stereo_pass &= z_test_off;
-            if (GSConfig.StereoRejectNoZWrite) disable_stereo_pass &= z_write_off;
-            if (GSConfig.StereoRejectZTestNever) disable_stereo_pass &= z_test_never;
-            if (GSConfig.StereoRejectAlphaTestOff) disable_stereo_pass &= alpha_test_off;
-            if (GSConfig.StereoRejectAlphaTestAlways) disable_stereo_pass &= alpha_test_always;
-            if (GSConfig.StereoRejectAlphaTestNever) disable_stereo_pass &= alpha_test_never;
-            if (GSConfig.StereoRejectTfxModulate) disable_stereo_pass &= tfx_modulate;
-			if (GSConfig.StereoRejectTfxHighlight) disable_stereo_pass &= tfx_highlight;
-			if (GSConfig.StereoRejectTfxHighlight2) disable_stereo_pass &= tfx_highlight2;
-			if (GSConfig.StereoRejectSmallDrawArea) disable_stereo_pass &= small_draw_area;
-			if (GSConfig.StereoRejectWideDrawBand) disable_stereo_pass &= wide_draw_band;
-			if (GSConfig.StereoRejectTopDrawBand) disable_stereo_pass &= top_draw_band;
-			if (GSConfig.StereoRejectRtSpriteNoDepth) disable_stereo_pass &= rt_sprite_no_depth;
-			if (GSConfig.StereoRejectRtSpriteAlphaBlend) disable_stereo_pass &= rt_sprite_alpha_blend;
-			if (GSConfig.StereoRequireProcessTexture) disable_stereo_pass &= !process_texture;
-			if (GSConfig.StereoRejectProcessTexture) disable_stereo_pass &= process_texture;
-			if (GSConfig.StereoRequireSourceFromTarget) disable_stereo_pass &= !source_from_target;
-			if (GSConfig.StereoRejectSourceFromTarget) disable_stereo_pass &= source_from_target;
-//			if (GSConfig.StereoRequireDrawUsesTarget) disable_stereo_pass &= !draw_uses_target_tex;
-//			if (GSConfig.StereoRejectDrawUsesTarget) disable_stereo_pass &= draw_uses_target_tex;
-			if (GSConfig.StereoRequireTexIsRt) disable_stereo_pass &= !tex_is_rt;
-			if (GSConfig.StereoRejectTexIsRt) disable_stereo_pass &= tex_is_rt;
-			if (GSConfig.StereoRequireInTargetDraw) disable_stereo_pass &= !in_target_draw;
-			if (GSConfig.StereoRejectInTargetDraw) disable_stereo_pass &= in_target_draw;
-			if (GSConfig.StereoRequireTempZ) disable_stereo_pass &= !using_temp_z;
-			if (GSConfig.StereoRejectTempZ) disable_stereo_pass &= using_temp_z;
-			if (GSConfig.StereoRequireOneBarrier) disable_stereo_pass &= !one_barrier;
-			if (GSConfig.StereoRejectOneBarrier) disable_stereo_pass &= one_barrier;
-			if (GSConfig.StereoRequireFullBarrier) disable_stereo_pass &= !full_barrier;
-			if (GSConfig.StereoRejectFullBarrier) disable_stereo_pass &= full_barrier;
-			if (GSConfig.StereoRequireSinglePass) disable_stereo_pass &= !stereo_single_pass;
-			if (GSConfig.StereoRejectSinglePass) disable_stereo_pass &= stereo_single_pass;
-			if (GSConfig.StereoRequireFullscreenDrawArea) disable_stereo_pass &= !fullscreen_draw_area;
-			if (GSConfig.StereoRejectFullscreenDrawArea) disable_stereo_pass &= fullscreen_draw_area;
-			if (GSConfig.StereoRequireFullscreenSprite) disable_stereo_pass &= !fullscreen_sprite;
-			if (GSConfig.StereoRejectFullscreenSprite) disable_stereo_pass &= fullscreen_sprite;
-			if (GSConfig.StereoRequireTexturedSprite) disable_stereo_pass &= !textured_sprite;
-			if (GSConfig.StereoRejectTexturedSprite) disable_stereo_pass &= textured_sprite;
-			if (GSConfig.StereoRequireRtOutput) disable_stereo_pass &= !rt_output;
-			if (GSConfig.StereoRejectRtOutput) disable_stereo_pass &= rt_output;
-			if (GSConfig.StereoRequireDepthOutput) disable_stereo_pass &= !depth_output;
-			if (GSConfig.StereoRejectDepthOutput) disable_stereo_pass &= depth_output;
-			if (GSConfig.StereoRequireDepthRead) disable_stereo_pass &= !depth_read;
-			if (GSConfig.StereoRejectDepthRead) disable_stereo_pass &= depth_read;
-			if (GSConfig.StereoRequireDepthWrite) disable_stereo_pass &= !depth_write;
-			if (GSConfig.StereoRejectDepthWrite) disable_stereo_pass &= depth_write;
-			if (GSConfig.StereoRequirePalettedTexture) disable_stereo_pass &= !paletted_texture;
-			if (GSConfig.StereoRejectPalettedTexture) disable_stereo_pass &= paletted_texture;
-			if (GSConfig.StereoRequireDepthTexture) disable_stereo_pass &= !depth_texture;
-			if (GSConfig.StereoRejectDepthTexture) disable_stereo_pass &= depth_texture;
-			if (GSConfig.StereoRequireMipmap) disable_stereo_pass &= !mipmap_active;
-			if (GSConfig.StereoRejectMipmap) disable_stereo_pass &= mipmap_active;
-			if (GSConfig.StereoRequireLinearSampling) disable_stereo_pass &= !linear_sampling;
-			if (GSConfig.StereoRejectLinearSampling) disable_stereo_pass &= linear_sampling;
-			if (GSConfig.StereoRequireFmvActive) disable_stereo_pass &= !fmv_active;
-			if (GSConfig.StereoRejectFmvActive) disable_stereo_pass &= fmv_active;
-			if (GSConfig.StereoRequireFmvHeuristic) disable_stereo_pass &= !fmv_heuristic;
-			if (GSConfig.StereoRejectFmvHeuristic) disable_stereo_pass &= fmv_heuristic;
-			if (GSConfig.StereoRequireFmvSprite) disable_stereo_pass &= !fmv_sprite;
-			if (GSConfig.StereoRejectFmvSprite) disable_stereo_pass &= fmv_sprite;
-			if (GSConfig.StereoRequireFmvSingleSprite) disable_stereo_pass &= !fmv_single_sprite;
-			if (GSConfig.StereoRejectFmvSingleSprite) disable_stereo_pass &= fmv_single_sprite;
-			if (GSConfig.StereoRequireFmvTextureMapping) disable_stereo_pass &= !fmv_texture_mapping;
-			if (GSConfig.StereoRejectFmvTextureMapping) disable_stereo_pass &= fmv_texture_mapping;
-			if (GSConfig.StereoRequireFmvProcessTexture) disable_stereo_pass &= !fmv_process_texture;
-			if (GSConfig.StereoRejectFmvProcessTexture) disable_stereo_pass &= fmv_process_texture;
-			if (GSConfig.StereoRequireFmvFullscreenDrawArea) disable_stereo_pass &= !fmv_fullscreen_draw_area;
-			if (GSConfig.StereoRejectFmvFullscreenDrawArea) disable_stereo_pass &= fmv_fullscreen_draw_area;
-			if (GSConfig.StereoRequireFmvFullscreenScissor) disable_stereo_pass &= !fmv_fullscreen_scissor;
-			if (GSConfig.StereoRejectFmvFullscreenScissor) disable_stereo_pass &= fmv_fullscreen_scissor;
-			if (GSConfig.StereoRequireFmvNoAlphaBlend) disable_stereo_pass &= !fmv_no_alpha_blend;
-			if (GSConfig.StereoRejectFmvNoAlphaBlend) disable_stereo_pass &= fmv_no_alpha_blend;
-			if (GSConfig.StereoRequireFmvNoAlphaTest) disable_stereo_pass &= !fmv_no_alpha_test;
-			if (GSConfig.StereoRejectFmvNoAlphaTest) disable_stereo_pass &= fmv_no_alpha_test;
-			if (GSConfig.StereoRequireFmvNoDepthTest) disable_stereo_pass &= !fmv_no_depth_test;
-			if (GSConfig.StereoRejectFmvNoDepthTest) disable_stereo_pass &= fmv_no_depth_test;
-			if (GSConfig.StereoRequireFmvNoDepthWrite) disable_stereo_pass &= !fmv_no_depth_write;
-			if (GSConfig.StereoRejectFmvNoDepthWrite) disable_stereo_pass &= fmv_no_depth_write;
-			if (GSConfig.StereoRequireFmvNoDepthOutput) disable_stereo_pass &= !fmv_no_depth_output;
-			if (GSConfig.StereoRejectFmvNoDepthOutput) disable_stereo_pass &= fmv_no_depth_output;
-			if (GSConfig.StereoRequireFmvNoDepthRead) disable_stereo_pass &= !fmv_no_depth_read;
-			if (GSConfig.StereoRejectFmvNoDepthRead) disable_stereo_pass &= fmv_no_depth_read;
-			if (GSConfig.StereoRequireFmvNoFbMask) disable_stereo_pass &= !fmv_no_fb_mask;
-			if (GSConfig.StereoRejectFmvNoFbMask) disable_stereo_pass &= fmv_no_fb_mask;
-			if (GSConfig.StereoRequireFmvColorOutput) disable_stereo_pass &= !fmv_color_output;
-			if (GSConfig.StereoRejectFmvColorOutput) disable_stereo_pass &= fmv_color_output;
-			if (GSConfig.StereoRequireFmvSourceNotFromTarget) disable_stereo_pass &= !fmv_source_not_from_target;
-			if (GSConfig.StereoRejectFmvSourceNotFromTarget) disable_stereo_pass &= fmv_source_not_from_target;
-			if (GSConfig.StereoRequireFmvDrawMatchesTex) disable_stereo_pass &= !fmv_draw_matches_tex;
-			if (GSConfig.StereoRejectFmvDrawMatchesTex) disable_stereo_pass &= fmv_draw_matches_tex;
-			if (GSConfig.StereoRequireFmvNoShuffle) disable_stereo_pass &= !fmv_no_shuffle;
-			if (GSConfig.StereoRejectFmvNoShuffle) disable_stereo_pass &= fmv_no_shuffle;
-			if (GSConfig.StereoRequireFmvNoMipmap) disable_stereo_pass &= !fmv_no_mipmap;
-			if (GSConfig.StereoRejectFmvNoMipmap) disable_stereo_pass &= fmv_no_mipmap;
-			if (GSConfig.StereoRequireFmvLinearSampling) disable_stereo_pass &= !fmv_linear_sampling;
-			if (GSConfig.StereoRejectFmvLinearSampling) disable_stereo_pass &= fmv_linear_sampling;
-			if (GSConfig.StereoRequireFmvEeUpload) disable_stereo_pass &= !fmv_ee_upload;
-			if (GSConfig.StereoRejectFmvEeUpload) disable_stereo_pass &= fmv_ee_upload;
-			if (GSConfig.StereoRequireFmvDisplayMatch) disable_stereo_pass &= !fmv_display_match;
-			if (GSConfig.StereoRejectFmvDisplayMatch) disable_stereo_pass &= fmv_display_match;
-//			if (GSConfig.StereoRequireFmvRecentEeUpload) disable_stereo_pass &= !fmv_recent_ee_upload;
-//			if (GSConfig.StereoRejectFmvRecentEeUpload) disable_stereo_pass &= fmv_recent_ee_upload;
-			if (GSConfig.StereoRequireFmvRecentTransferDraw) disable_stereo_pass &= !fmv_recent_transfer_draw;
-			if (GSConfig.StereoRejectFmvRecentTransferDraw) disable_stereo_pass &= fmv_recent_transfer_draw;
-			if (GSConfig.StereoRequireFeedbackLoopAny) disable_stereo_pass &= !feedback_loop_any;
-			if (GSConfig.StereoRejectFeedbackLoopAny) disable_stereo_pass &= feedback_loop_any;
-			if (GSConfig.StereoRequireFeedbackLoopShader) disable_stereo_pass &= !feedback_loop_shader;
-			if (GSConfig.StereoRejectFeedbackLoopShader) disable_stereo_pass &= feedback_loop_shader;
-			if (GSConfig.StereoRequireFeedbackLoopDrawUsesTarget) disable_stereo_pass &= !feedback_loop_draw_uses_target;
-			if (GSConfig.StereoRejectFeedbackLoopDrawUsesTarget) disable_stereo_pass &= feedback_loop_draw_uses_target;
-			if (GSConfig.StereoRequireFeedbackLoopTexIsRt) disable_stereo_pass &= !feedback_loop_tex_is_rt;
-			if (GSConfig.StereoRejectFeedbackLoopTexIsRt) disable_stereo_pass &= feedback_loop_tex_is_rt;
-			if (GSConfig.StereoRequireFeedbackLoopSourceFromTarget) disable_stereo_pass &= !feedback_loop_source_from_target;
-			if (GSConfig.StereoRejectFeedbackLoopSourceFromTarget) disable_stereo_pass &= feedback_loop_source_from_target;
-			if (GSConfig.StereoRequireFeedbackLoopInTargetDraw) disable_stereo_pass &= !feedback_loop_in_target_draw;
-			if (GSConfig.StereoRejectFeedbackLoopInTargetDraw) disable_stereo_pass &= feedback_loop_in_target_draw;
-			if (GSConfig.StereoRequireFeedbackLoopTempZ) disable_stereo_pass &= !feedback_loop_using_temp_z;
-			if (GSConfig.StereoRejectFeedbackLoopTempZ) disable_stereo_pass &= feedback_loop_using_temp_z;
-			if (GSConfig.StereoRequireFeedbackLoopOverlapDrawRange) disable_stereo_pass &= !feedback_loop_overlap_draw_range;
-			if (GSConfig.StereoRejectFeedbackLoopOverlapDrawRange) disable_stereo_pass &= feedback_loop_overlap_draw_range;
-			if (GSConfig.StereoFeedbackLoopDisableStereo && feedback_loop_any) disable_stereo_pass = true;
-		}
+		const bool sprite_blit = (m_vt.m_primclass == GS_SPRITE_CLASS && m_index.tail == 2 && PRIM->TME &&
+			draw_size_valid && tex_size_valid && std::abs(draw_size.x - tex_size.x) <= 1 && std::abs(draw_size.y - tex_size.y) <= 1);
+		const bool constant_color = m_vt.m_eq.rgba == 0xFFFF;
+		const bool non_positive_z = m_vt.m_max.p.z <= 0.0f;
+		const bool small_z_range = m_vt.m_max.p.z > 0.0f && z_range <= 0.01f && fullscreen_sprite;
+		const bool sprite_no_gaps = m_primitive_covers_without_gaps == NoGapsType::SpriteNoGaps;
+
+		// Pack everything the stereo options can test into one word, the filter compiled from
+		// the current settings then classifies the draw with a few masked compares. Nothing reads
+		// the word when stereo is off, so don't pay for it on every draw.
+		const bool stereo_mode_enabled = GSConfig.StereoMode != GSStereoMode::Off;
+		GSStereoFeatureWord features;
+		if (stereo_mode_enabled)
+		{
+			features.SetRegisters(*PRIM, m_cached_ctx.TEST, m_cached_ctx.FRAME, m_cached_ctx.ZBUF, m_cached_ctx.TEX0);
+			features.SetDrawConfig(m_conf);
+			features.Set(GSStereoFeature::PrimPoint, prim_point);
+			features.Set(GSStereoFeature::PrimLine, prim_line);
+			features.Set(GSStereoFeature::PrimTriangle, m_vt.m_primclass == GS_TRIANGLE_CLASS);
+			features.Set(GSStereoFeature::PrimSprite, m_vt.m_primclass == GS_SPRITE_CLASS);
+			features.Set(GSStereoFeature::SingleSprite, fmv_single_sprite);
+			features.Set(GSStereoFeature::ZEqual, m_vt.m_eq.z);
+			features.Set(GSStereoFeature::QEqual, m_vt.m_eq.q);
+			features.Set(GSStereoFeature::STEqual, !uv_varies);
+			features.Set(GSStereoFeature::RGBAEqualAny, !color_varies);
+			features.Set(GSStereoFeature::PerspectiveUV, perspective_uv);
+			features.Set(GSStereoFeature::StencilShadow, m_vt.m_eq.q && !m_vt.m_eq.z && depth_active);
+			features.Set(GSStereoFeature::ZTestAlwaysZEqual, z_test_always && m_vt.m_eq.z);
+			features.Set(GSStereoFeature::DecalNoRegionRect, m_cached_ctx.TEX0.TFX == TFX_DECAL && !m_conf.ps.region_rect);
+			features.Set(GSStereoFeature::TextureShuffle, texture_shuffle);
+			features.Set(GSStereoFeature::ChannelShuffle, channel_shuffle);
+			features.Set(GSStereoFeature::FullScreenShuffle, full_screen_shuffle);
+			features.Set(GSStereoFeature::NoShuffle, fmv_no_shuffle);
+			features.Set(GSStereoFeature::ProcessTexture, process_texture);
+			features.Set(GSStereoFeature::SourceFromTarget, source_from_target);
+			features.Set(GSStereoFeature::TexIsRt, tex_is_rt);
+			features.Set(GSStereoFeature::DrawUsesTarget, draw_uses_target_tex);
+			features.Set(GSStereoFeature::InTargetDraw, in_target_draw);
+			features.Set(GSStereoFeature::TempZ, using_temp_z);
+			features.Set(GSStereoFeature::OneBarrier, one_barrier);
+			features.Set(GSStereoFeature::FullBarrier, full_barrier);
+			features.Set(GSStereoFeature::SinglePass, stereo_single_pass);
+			features.Set(GSStereoFeature::RtOutput, rt_output);
+			features.Set(GSStereoFeature::DepthOutput, depth_output);
+			features.Set(GSStereoFeature::DepthRead, depth_read);
+			features.Set(GSStereoFeature::DepthWrite, depth_write);
+			features.Set(GSStereoFeature::PalettedTexture, paletted_texture);
+			features.Set(GSStereoFeature::DepthTexture, depth_texture);
+			features.Set(GSStereoFeature::Mipmap, mipmap_active);
+			features.Set(GSStereoFeature::LinearSampling, linear_sampling);
+			features.Set(GSStereoFeature::FeedbackLoopAnyRaw, feedback_loop_any_raw);
+			features.Set(GSStereoFeature::FullscreenDraw, draw_rect.eq(fullscreen_rect));
+			features.Set(GSStereoFeature::FullscreenDrawArea, fullscreen_draw_area);
+			features.Set(GSStereoFeature::FullscreenScissor, fullscreen_scissor);
+			features.Set(GSStereoFeature::FullscreenSprite, fullscreen_sprite);
+			features.Set(GSStereoFeature::FullCover, m_primitive_covers_without_gaps == NoGapsType::FullCover);
+			features.Set(GSStereoFeature::SpriteNoGaps, sprite_no_gaps);
+			features.Set(GSStereoFeature::SpriteNoGapsOrRegionRect, sprite_no_gaps || m_conf.ps.region_rect);
+			features.Set(GSStereoFeature::SmallDrawArea, small_draw_area);
+			features.Set(GSStereoFeature::WideDrawBand, wide_draw_band);
+			features.Set(GSStereoFeature::TopDrawBand, top_draw_band);
+			features.Set(GSStereoFeature::NonPositiveZ, non_positive_z);
+			features.Set(GSStereoFeature::SmallZRange, small_z_range);
+			features.Set(GSStereoFeature::ScalingDraw, scaling_draw);
+			features.Set(GSStereoFeature::SbsInput, sbs_input);
+			features.Set(GSStereoFeature::TabInput, tab_input);
+			features.Set(GSStereoFeature::SpriteBlit, sprite_blit);
+			features.Set(GSStereoFeature::ConstantColor, constant_color);
+			features.Set(GSStereoFeature::TexturedSprite, textured_sprite);
+			features.Set(GSStereoFeature::RtSpriteNoDepth, rt_sprite_no_depth);
+			features.Set(GSStereoFeature::RtSpriteAlphaBlend, rt_sprite_alpha_blend);
+			features.Set(GSStereoFeature::FmvActive, fmv_active);
+			features.Set(GSStereoFeature::FmvHeuristic, fmv_heuristic);
+			features.Set(GSStereoFeature::FmvDrawMatchesTex, fmv_draw_matches_tex);
+			features.Set(GSStereoFeature::FmvEeUpload, fmv_ee_upload);
+			features.Set(GSStereoFeature::FmvDisplayMatch, fmv_display_match);
+			features.Set(GSStereoFeature::FmvRecentTransferDraw, fmv_recent_transfer_draw);
+			features.Set(GSStereoFeature::UiSafeDetect, ui_safe_detect);
+			features.Set(GSStereoFeature::UiAdvancedDetect, ui_advanced_detect);
+			features.Set(GSStereoFeature::UiLike, ui_experimantal1);
+			features.Set(GSStereoFeature::UiBackgroundDepth, ui_experimantal2);
+			features.Set(GSStereoFeature::MasterFix1, first_fix);
+			features.Set(GSStereoFeature::MasterFix2, second_fix);
+			features.Set(GSStereoFeature::MasterFix3, third_fix);
+			features.Set(GSStereoFeature::MasterFix4, fourth_fix);
+			features.Set(GSStereoFeature::MasterFix5, fifth_fix);
+			features.Set(GSStereoFeature::MasterFix6, sixth_fix);
+			features.Set(GSStereoFeature::MoviesFixOverride, movies_fix_override);
+		}
+
+		const bool master_fix_enabled = stereo_mode_enabled && m_stereo_filter.MasterFixEnabled(features);
+		const bool master_fix_override = stereo_mode_enabled && m_stereo_filter.MasterFixOverride(features);
+		const bool disable_stereo_pass = stereo_mode_enabled && m_stereo_filter.DisableStereoPass(features);
 
 //	    const bool is_fmv_framebuffer = (m_vt.m_primclass == GS_SPRITE_CLASS &&
 //            (m_vertex.next == 2) && m_process_texture && !PRIM->ABE &&
@@ -8846,151 +8560,6 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
 //        if (GSConfig.StereoUniversalRequireFixedZ) disable_stereo_pass &= m_cached_ctx.TEX0.TFX != TFX_DECAL;
 //        if (GSConfig.StereoUniversalRequireConstantColor) disable_stereo_pass &= !(m_cached_ctx.TEX0.TFX == TFX_DECAL && !m_conf.ps.region_rect);
 
-        bool double_image_fix = false;
-		if (GSConfig.StereoEnableOptions)
-		{
-            if (GSConfig.StereoUniversalRejectBlendMix) double_image_fix |= (m_conf.ps.blend_mix == 0); // Default UI fix
-
-            if (GSConfig.StereoRejectRtaCorrection) double_image_fix |= !m_conf.ps.rta_correction; // Fixes a lot of games
-            if (GSConfig.StereoUniversalRejectBlendB) double_image_fix |= (m_conf.ps.blend_b == 0); // Fixes smoke in GOW
-
-            if (GSConfig.StereoUniversalRejectIip) double_image_fix |= !m_conf.ps.iip; // SOC, Tekken 5 fix
-            if (GSConfig.StereoUniversalRejectAutomaticLod) double_image_fix |= !m_conf.ps.automatic_lod;// SOC fixes
-            if (GSConfig.StereoUniversalRequireNoColor1) double_image_fix |= m_conf.ps.no_color1;
-
-            if (GSConfig.StereoUniversalRequireWms) double_image_fix |= (m_conf.ps.wms != 0);  // MGS 2 fixes
-            if (GSConfig.StereoUniversalRequireWmt) double_image_fix |= (m_conf.ps.wmt != 0);
-            if (GSConfig.StereoUniversalRequireLtf) double_image_fix |= m_conf.ps.ltf;
-
-            if (GSConfig.StereoUniversalRequireShuffle) double_image_fix |= m_conf.ps.shuffle; // Gun, MGS 3 fix
-            if (GSConfig.StereoUniversalRejectTcc) double_image_fix |= !m_conf.ps.tcc; // Tekken 4 fix
-
-            if (GSConfig.StereoUniversalRejectTfx) double_image_fix |= (m_conf.ps.tfx == 0);
-            if (GSConfig.StereoUniversalRequireAem) double_image_fix |= m_conf.ps.aem;
-            if (GSConfig.StereoUniversalRequireBlendB) double_image_fix |= (m_conf.ps.blend_b != 0);
-
-            if (GSConfig.StereoUniversalRejectProcessBa) double_image_fix |= (m_conf.ps.process_ba == 0);
-            if (GSConfig.StereoUniversalRejectProcessRg) double_image_fix |= (m_conf.ps.process_rg == 0);
-            if (GSConfig.StereoUniversalRejectShuffleAcross) double_image_fix |= !m_conf.ps.shuffle_across;
-            if (GSConfig.StereoUniversalRequireTextureShuffle) double_image_fix |= m_texture_shuffle;
-
-            if (GSConfig.StereoUniversalRejectRtaSourceCorrection) double_image_fix |= !m_conf.ps.rta_source_correction;
-            if (GSConfig.StereoUniversalRejectColclipHw) double_image_fix |= !m_conf.ps.colclip_hw;
-            if (GSConfig.StereoUniversalRejectColclip) double_image_fix |= !m_conf.ps.colclip;
-            if (GSConfig.StereoUniversalRejectPabe) double_image_fix |= !m_conf.ps.pabe;
-            if (GSConfig.StereoUniversalRejectFbMask) double_image_fix |= !m_conf.ps.fbmask;
-            if (GSConfig.StereoUniversalRejectTexIsFb) double_image_fix |= !m_conf.ps.tex_is_fb;
-            if (GSConfig.StereoUniversalRejectNoColor) double_image_fix |= !m_conf.ps.no_color;
-            if (GSConfig.StereoUniversalRejectNoColor1) double_image_fix |= !m_conf.ps.no_color1; // can be useful
-            if (GSConfig.StereoUniversalRejectAemFmt) double_image_fix |= (m_conf.ps.aem_fmt == 0);
-            if (GSConfig.StereoUniversalRejectPalFmt) double_image_fix |= (m_conf.ps.pal_fmt == 0);
-            if (GSConfig.StereoUniversalRejectDstFmt) double_image_fix |= (m_conf.ps.dst_fmt == 0);
-            if (GSConfig.StereoUniversalRejectDepthFmt) double_image_fix |= (m_conf.ps.depth_fmt == 0);
-            if (GSConfig.StereoUniversalRejectAem) double_image_fix |= !m_conf.ps.aem;
-            if (GSConfig.StereoUniversalRejectFba) double_image_fix |= !m_conf.ps.fba;
-            if (GSConfig.StereoUniversalRejectFog) double_image_fix |= !m_conf.ps.fog;
-            if (GSConfig.StereoUniversalRejectDate) double_image_fix |= (m_conf.ps.date == 0);
-            if (GSConfig.StereoUniversalRejectAtst) double_image_fix |= (m_conf.ps.atst == 0);
-            if (GSConfig.StereoUniversalRejectAfail) double_image_fix |= (m_conf.ps.afail == 0);
-            if (GSConfig.StereoUniversalRejectFst) double_image_fix |= !m_conf.ps.fst;
-            if (GSConfig.StereoUniversalRejectWms) double_image_fix |= (m_conf.ps.wms == 0);
-            if (GSConfig.StereoUniversalRejectWmt) double_image_fix |= (m_conf.ps.wmt == 0);
-            if (GSConfig.StereoUniversalRejectAdjs) double_image_fix |= !m_conf.ps.adjs;
-            if (GSConfig.StereoUniversalRejectLtf) double_image_fix |= !m_conf.ps.ltf;
-            if (GSConfig.StereoUniversalRejectShuffle) double_image_fix |= !m_conf.ps.shuffle;
-            if (GSConfig.StereoUniversalRejectShuffleSame) double_image_fix |= !m_conf.ps.shuffle_same;
-            if (GSConfig.StereoUniversalRejectReal16Src) double_image_fix |= !m_conf.ps.real16src;
-            if (GSConfig.StereoUniversalRejectWriteRg) double_image_fix |= !m_conf.ps.write_rg;
-            if (GSConfig.StereoUniversalRejectBlendA) double_image_fix |= (m_conf.ps.blend_a == 0);
-            if (GSConfig.StereoUniversalRejectBlendC) double_image_fix |= (m_conf.ps.blend_c == 0);
-            if (GSConfig.StereoUniversalRejectBlendD) double_image_fix |= (m_conf.ps.blend_d == 0);
-            if (GSConfig.StereoUniversalRejectFixedOneA) double_image_fix |= !m_conf.ps.fixed_one_a;
-            if (GSConfig.StereoUniversalRejectBlendHw) double_image_fix |= (m_conf.ps.blend_hw == 0);
-            if (GSConfig.StereoUniversalRejectAMasked) double_image_fix |= !m_conf.ps.a_masked;
-            if (GSConfig.StereoUniversalRejectRoundInv) double_image_fix |= !m_conf.ps.round_inv;
-            if (GSConfig.StereoUniversalRejectChannel) double_image_fix |= (m_conf.ps.channel == 0);
-            if (GSConfig.StereoUniversalRejectChannelFb) double_image_fix |= !m_conf.ps.channel_fb;
-            if (GSConfig.StereoUniversalRejectDither) double_image_fix |= (m_conf.ps.dither == 0);
-            if (GSConfig.StereoUniversalRejectDitherAdjust) double_image_fix |= !m_conf.ps.dither_adjust;
-            if (GSConfig.StereoUniversalRejectZClamp) double_image_fix |= !m_conf.ps.zclamp;
-            if (GSConfig.StereoUniversalRejectZFloor) double_image_fix |= !m_conf.ps.zfloor;
-            if (GSConfig.StereoUniversalRejectTCOffsetHack) double_image_fix |= !m_conf.ps.tcoffsethack;
-            if (GSConfig.StereoUniversalRejectUrbanChaosHle) double_image_fix |= !m_conf.ps.urban_chaos_hle;
-            if (GSConfig.StereoUniversalRejectTalesOfAbyssHle) double_image_fix |= !m_conf.ps.tales_of_abyss_hle;
-            if (GSConfig.StereoUniversalRejectManualLod) double_image_fix |= !m_conf.ps.manual_lod;
-            if (GSConfig.StereoUniversalRejectPointSampler) double_image_fix |= !m_conf.ps.point_sampler;
-            if (GSConfig.StereoUniversalRejectRegionRect) double_image_fix |= !m_conf.ps.region_rect;
-            if (GSConfig.StereoUniversalRejectScanmask) double_image_fix |= (m_conf.ps.scanmsk == 0);
-            if (GSConfig.StereoUniversalRequireColclipHw) double_image_fix |= m_conf.ps.colclip_hw;
-            if (GSConfig.StereoUniversalRequireColclip) double_image_fix |= m_conf.ps.colclip;
-            if (GSConfig.StereoUniversalRequireBlendMix) double_image_fix |= (m_conf.ps.blend_mix != 0);
-            if (GSConfig.StereoUniversalRequirePabe) double_image_fix |= m_conf.ps.pabe;
-            if (GSConfig.StereoUniversalRequireFbMask) double_image_fix |= m_conf.ps.fbmask;
-            if (GSConfig.StereoUniversalRequireTexIsFb) double_image_fix |= m_conf.ps.tex_is_fb;
-            if (GSConfig.StereoUniversalRequireNoColor) double_image_fix |= m_conf.ps.no_color;
-            if (GSConfig.StereoUniversalRequireAemFmt) double_image_fix |= (m_conf.ps.aem_fmt != 0);
-            if (GSConfig.StereoUniversalRequirePalFmt) double_image_fix |= (m_conf.ps.pal_fmt != 0);
-            if (GSConfig.StereoUniversalRequireDstFmt) double_image_fix |= (m_conf.ps.dst_fmt != 0);
-            if (GSConfig.StereoUniversalRequireDepthFmt) double_image_fix |= (m_conf.ps.depth_fmt != 0);
-            if (GSConfig.StereoUniversalRequireFba) double_image_fix |= m_conf.ps.fba;
-            if (GSConfig.StereoUniversalRequireFog) double_image_fix |= m_conf.ps.fog;
-            if (GSConfig.StereoUniversalRequireIip) double_image_fix |= m_conf.ps.iip;
-            if (GSConfig.StereoUniversalRequireDate) double_image_fix |= (m_conf.ps.date != 0);
-            if (GSConfig.StereoUniversalRequireAtst) double_image_fix |= (m_conf.ps.atst != 0);
-            if (GSConfig.StereoUniversalRequireAfail) double_image_fix |= (m_conf.ps.afail != 0);
-            if (GSConfig.StereoUniversalRequireFst) double_image_fix |= m_conf.ps.fst;
-            if (GSConfig.StereoUniversalRequireTcc) double_image_fix |= m_conf.ps.tcc;
-            if (GSConfig.StereoUniversalRequireAdjs) double_image_fix |= m_conf.ps.adjs;
-            if (GSConfig.StereoUniversalRequireAdjt) double_image_fix |= m_conf.ps.adjt;
-            if (GSConfig.StereoUniversalRequireShuffleSame) double_image_fix |= m_conf.ps.shuffle_same;
-            if (GSConfig.StereoUniversalRequireReal16Src) double_image_fix |= m_conf.ps.real16src;
-            if (GSConfig.StereoUniversalRequireProcessBa) double_image_fix |= (m_conf.ps.process_ba != 0);
-            if (GSConfig.StereoUniversalRequireProcessRg) double_image_fix |= (m_conf.ps.process_rg != 0);
-            if (GSConfig.StereoUniversalRequireShuffleAcross) double_image_fix |= m_conf.ps.shuffle_across;
-            if (GSConfig.StereoUniversalRequireWriteRg) double_image_fix |= m_conf.ps.write_rg;
-            if (GSConfig.StereoUniversalRequireBlendA) double_image_fix |= (m_conf.ps.blend_a != 0);
-            if (GSConfig.StereoUniversalRequireBlendC) double_image_fix |= (m_conf.ps.blend_c != 0);
-            if (GSConfig.StereoUniversalRequireBlendD) double_image_fix |= (m_conf.ps.blend_d != 0);
-            if (GSConfig.StereoUniversalRequireFixedOneA) double_image_fix |= m_conf.ps.fixed_one_a;
-            if (GSConfig.StereoUniversalRequireBlendHw) double_image_fix |= (m_conf.ps.blend_hw != 0);
-            if (GSConfig.StereoUniversalRequireAMasked) double_image_fix |= m_conf.ps.a_masked;
-            if (GSConfig.StereoUniversalRequireRoundInv) double_image_fix |= m_conf.ps.round_inv;
-            if (GSConfig.StereoUniversalRequireChannel) double_image_fix |= (m_conf.ps.channel != 0);
-            if (GSConfig.StereoUniversalRequireChannelFb) double_image_fix |= m_conf.ps.channel_fb;
-            if (GSConfig.StereoUniversalRequireDither) double_image_fix |= (m_conf.ps.dither != 0);
-            if (GSConfig.StereoUniversalRequireDitherAdjust) double_image_fix |= m_conf.ps.dither_adjust;
-            if (GSConfig.StereoUniversalRequireZClamp) double_image_fix |= m_conf.ps.zclamp;
-            if (GSConfig.StereoUniversalRequireZFloor) double_image_fix |= m_conf.ps.zfloor;
-            if (GSConfig.StereoUniversalRequireTCOffsetHack) double_image_fix |= m_conf.ps.tcoffsethack;
-            if (GSConfig.StereoUniversalRequireUrbanChaosHle) double_image_fix |= m_conf.ps.urban_chaos_hle;
-            if (GSConfig.StereoUniversalRequireTalesOfAbyssHle) double_image_fix |= m_conf.ps.tales_of_abyss_hle;
-            if (GSConfig.StereoUniversalRequireAutomaticLod) double_image_fix |= m_conf.ps.automatic_lod;
-            if (GSConfig.StereoUniversalRequireManualLod) double_image_fix |= m_conf.ps.manual_lod;
-            if (GSConfig.StereoUniversalRequirePointSampler) double_image_fix |= m_conf.ps.point_sampler;
-            if (GSConfig.StereoUniversalRequireRegionRect) double_image_fix |= m_conf.ps.region_rect;
-            if (GSConfig.StereoUniversalRequireScanmask) double_image_fix |= (m_conf.ps.scanmsk != 0);
-            if (GSConfig.StereoUniversalRequireAlphaBlend) double_image_fix |= PRIM->ABE;
-            if (GSConfig.StereoUniversalRequireAlphaTest) double_image_fix |= m_cached_ctx.TEST.ATE;
-            if (GSConfig.StereoUniversalRequireDatm) double_image_fix |= m_cached_ctx.TEST.DATM;
-            if (GSConfig.StereoUniversalRequireZTest) double_image_fix |= m_cached_ctx.TEST.ZTE;
-            if (GSConfig.StereoUniversalRequireZWrite) double_image_fix |= !m_cached_ctx.ZBUF.ZMSK;
-            if (GSConfig.StereoUniversalRequireZTestAlways) double_image_fix |= (m_cached_ctx.TEST.ZTST == ZTST_ALWAYS);
-            if (GSConfig.StereoUniversalRequireZTestNever) double_image_fix |= (m_cached_ctx.TEST.ZTST == ZTST_NEVER);
-            if (GSConfig.StereoUniversalRequireAa1) double_image_fix |= PRIM->AA1;
-            if (GSConfig.StereoUniversalRequireChannelShuffle) double_image_fix |= m_channel_shuffle;
-            if (GSConfig.StereoUniversalRequireFullscreenShuffle) double_image_fix |= m_full_screen_shuffle;
-            if (GSConfig.StereoUniversalRequirePoints) double_image_fix |= (m_vt.m_primclass == GS_POINT_CLASS);
-            if (GSConfig.StereoUniversalRequireLines) double_image_fix |= (m_vt.m_primclass == GS_LINE_CLASS);
-            if (GSConfig.StereoUniversalRequireTriangles) double_image_fix |= (m_vt.m_primclass == GS_TRIANGLE_CLASS);
-            if (GSConfig.StereoUniversalRequireSprites) double_image_fix |= (m_cached_ctx.TEST.ZTST == ZTST_ALWAYS && m_vt.m_eq.z);
-//            double_image_fix |= (m_cached_ctx.TEST.ZTST == ZTST_ALWAYS || m_vt.m_eq.z) && !m_vt.m_eq.q;
-
-            disable_stereo_pass &= double_image_fix;
-
-//            disable_stereo_pass |= (m_cached_ctx.TEST.ZTST == ZTST_ALWAYS && GSConfig.StereoRequireZVaries && m_vt.m_eq.z);
-
-		}
-
 //		disable_stereo_pass |= GSConfig.StereoFixStencilShadows && m_vt.m_eq.q && !m_vt.m_eq.z && depth_active ||
 //                            GSConfig.StereoRejectScalingDraw && scaling_draw ||
 //                            GSConfig.StereoRejectSbsInput && sbs_input ||
@@ -9012,10 +8581,25 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
 //            return;
 //        }
 
-		const bool stereo_enabled = GSConfig.StereoMode != GSStereoMode::Off
+		const bool stereo_enabled = stereo_mode_enabled
 		&& (!master_fix_enabled && !stereo_display_target_not_matched && !mono_postfx && !disable_stereo_pass || master_fix_override);
 //		 || GSConfig.StereoRejectTfxDecal && m_cached_ctx.TEX0.TFX == TFX_DECAL && !m_conf.ps.region_rect);
 
+		const bool ui_detect = stereo_enabled && m_stereo_filter.UiDetect(features);
+
+		// Record what was actually decided for the draw, not what the filter alone would say.
+		if (stereo_mode_enabled && m_stereo_trace.IsOpen())
+		{
+			u32 decisions = 0;
+			decisions |= stereo_enabled ? GSStereoTrace::DecisionStereo : 0;
+			decisions |= disable_stereo_pass ? GSStereoTrace::DecisionDisableStereoPass : 0;
+			decisions |= master_fix_enabled ? GSStereoTrace::DecisionMasterFix : 0;
+			decisions |= master_fix_override ? GSStereoTrace::DecisionMasterFixOverride : 0;
+			decisions |= ui_detect ? GSStereoTrace::DecisionUiDetect : 0;
+			decisions |= (stereo_display_target_not_matched || mono_postfx) ? GSStereoTrace::DecisionRendererMono : 0;
+			m_stereo_trace.Write({static_cast<u32>(s_n), static_cast<u32>(g_perfmon.GetFrame()), decisions, 0, features});
+		}
+
 		bool sbs_remap_active = false;
 		bool sbs_remap_axis_vertical = GSConfig.StereoMode == GSStereoMode::TopAndBottom;
 		if (GSConfig.StereoSbsRemapDetectTabInput && tab_input)
@@ -9047,14 +8631,6 @@ __ri void GSRendererHW::DrawPrims(GSTextureCache::Target* rt, GSTextureCache::Ta
 		if (stereo_enabled)
 		{
 
-            const bool ui_detect = GSConfig.StereoUiSafeDetect && ui_safe_detect ||
-                             GSConfig.StereoUiAdvancedDetect && ui_advanced_detect ||
-                             GSConfig.StereoRejectZTestAlways && m_cached_ctx.TEST.ZTST == ZTST_ALWAYS ||
-                             GSConfig.StereoRequireZVaries && m_vt.m_eq.z ||
-                             GSConfig.StereoRejectFixedQ && m_vt.m_eq.q ||
-                             GSConfig.StereoStencilRequireZTestGequal && m_cached_ctx.TEST.ZTST != ZTST_GEQUAL && m_cached_ctx.TEST.ZTST != ZTST_GREATER ||
-                             GSConfig.StereoRejectUiLike && ui_experimantal1 ||
-                             GSConfig.StereoUiBackgroundDepth && ui_experimantal2;
 
             const bool mono_object = false;
 //                             (GSConfig.StereoRequirePerspectiveUV && !perspective_uv) ||
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "GSTextureCache.h"
+#include "GSStereoFilter.h"
+#include "GSStereoTrace.h"
 #include "GS/Renderers/Common/GSFunctionMap.h"
 #include "GS/Renderers/Common/GSRenderer.h"
 #include "GS/Renderers/SW/GSTextureCacheSW.h"
@@ -113,6 +115,7 @@ private:
 	void EmulateATST(float& AREF, GSHWDrawConfig::PSSelector& ps, bool pass_2);
 
 	void SetTCOffset();
+	void UpdateStereoTrace();
 	bool NextDrawColClip() const;
 	bool IsPossibleChannelShuffle() const;
 	bool IsPageCopy() const;
@@ -195,6 +198,9 @@ private:
 	float m_userhacks_tcoffset_x = 0.0f;
 	float m_userhacks_tcoffset_y = 0.0f;
 
+	GSStereoDrawFilter m_stereo_filter;
+	GSStereoTrace::Writer m_stereo_trace;
+
 	GSVector2i m_lod = {}; // Min & Max level of detail
 
 	GSHWDrawConfig m_conf = {};
@@ -0,0 +1,1091 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "GS/Renderers/HW/GSStereoFilter.h"
+#include "GS/Renderers/Common/GSDevice.h"
+
+#include <utility>
+
+namespace
+{
+	struct StereoRule
+	{
+		bool Pcsx2Config::GSOptions::*option;
+		GSStereoFeature feature;
+		bool expected;
+	};
+} // namespace
+
+// Options ANDed together by the StereoMasterFixTest chain. The draw stays mono when every
+// enabled option sees its feature in the expected state.
+static constexpr StereoRule s_rule_chain[] = {
+	{&Pcsx2Config::GSOptions::StereoRejectNonPositiveZ, GSStereoFeature::NonPositiveZ, true},
+	{&Pcsx2Config::GSOptions::StereoRejectSmallZRange, GSStereoFeature::SmallZRange, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFst, GSStereoFeature::PrimFst, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireRtaSourceCorrection, GSStereoFeature::PsRtaSourceCorrection, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireRtaCorrection, GSStereoFeature::PsRtaCorrection, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAdjt, GSStereoFeature::PsAdjt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTfx, GSStereoFeature::PsTfx, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendMix, GSStereoFeature::PsBlendMix, false},
+	{&Pcsx2Config::GSOptions::StereoRejectRtaCorrection, GSStereoFeature::PsRtaCorrection, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendB, GSStereoFeature::PsBlendB, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectIip, GSStereoFeature::PsIip, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAutomaticLod, GSStereoFeature::PsAutomaticLod, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireNoColor1, GSStereoFeature::PsNoColor1, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireWms, GSStereoFeature::PsWms, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireWmt, GSStereoFeature::PsWmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireLtf, GSStereoFeature::PsLtf, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireShuffle, GSStereoFeature::PsShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTcc, GSStereoFeature::PsTcc, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTfx, GSStereoFeature::PsTfx, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAem, GSStereoFeature::PsAem, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendB, GSStereoFeature::PsBlendB, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectProcessBa, GSStereoFeature::PsProcessBa, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectProcessRg, GSStereoFeature::PsProcessRg, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectShuffleAcross, GSStereoFeature::PsShuffleAcross, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTextureShuffle, GSStereoFeature::TextureShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectRtaSourceCorrection, GSStereoFeature::PsRtaSourceCorrection, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectColclipHw, GSStereoFeature::PsColclipHw, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectColclip, GSStereoFeature::PsColclip, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectPabe, GSStereoFeature::PsPabe, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFbMask, GSStereoFeature::PsFbmask, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTexIsFb, GSStereoFeature::PsTexIsFb, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectNoColor, GSStereoFeature::PsNoColor, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectNoColor1, GSStereoFeature::PsNoColor1, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAemFmt, GSStereoFeature::PsAemFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectPalFmt, GSStereoFeature::PsPalFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDstFmt, GSStereoFeature::PsDstFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDepthFmt, GSStereoFeature::PsDepthFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAem, GSStereoFeature::PsAem, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFba, GSStereoFeature::PsFba, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFog, GSStereoFeature::PsFog, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDate, GSStereoFeature::PsDate, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAtst, GSStereoFeature::PsAtst, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAfail, GSStereoFeature::PsAfail, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFst, GSStereoFeature::PsFst, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectWms, GSStereoFeature::PsWms, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectWmt, GSStereoFeature::PsWmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAdjs, GSStereoFeature::PsAdjs, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectLtf, GSStereoFeature::PsLtf, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectShuffle, GSStereoFeature::PsShuffle, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectShuffleSame, GSStereoFeature::PsShuffleSame, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectReal16Src, GSStereoFeature::PsReal16Src, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectWriteRg, GSStereoFeature::PsWriteRg, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendA, GSStereoFeature::PsBlendA, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendC, GSStereoFeature::PsBlendC, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendD, GSStereoFeature::PsBlendD, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFixedOneA, GSStereoFeature::PsFixedOneA, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendHw, GSStereoFeature::PsBlendHw, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAMasked, GSStereoFeature::PsAMasked, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectRoundInv, GSStereoFeature::PsRoundInv, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectChannel, GSStereoFeature::PsChannel, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectChannelFb, GSStereoFeature::PsChannelFb, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDither, GSStereoFeature::PsDither, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDitherAdjust, GSStereoFeature::PsDitherAdjust, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectZClamp, GSStereoFeature::PsZClamp, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectZFloor, GSStereoFeature::PsZFloor, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTCOffsetHack, GSStereoFeature::PsTCOffsetHack, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectUrbanChaosHle, GSStereoFeature::PsUrbanChaosHle, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTalesOfAbyssHle, GSStereoFeature::PsTalesOfAbyssHle, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectManualLod, GSStereoFeature::PsManualLod, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectPointSampler, GSStereoFeature::PsPointSampler, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectRegionRect, GSStereoFeature::PsRegionRect, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectScanmask, GSStereoFeature::PsScanmask, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireColclipHw, GSStereoFeature::PsColclipHw, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireColclip, GSStereoFeature::PsColclip, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendMix, GSStereoFeature::PsBlendMix, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePabe, GSStereoFeature::PsPabe, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFbMask, GSStereoFeature::PsFbmask, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTexIsFb, GSStereoFeature::PsTexIsFb, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireNoColor, GSStereoFeature::PsNoColor, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAemFmt, GSStereoFeature::PsAemFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePalFmt, GSStereoFeature::PsPalFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDstFmt, GSStereoFeature::PsDstFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDepthFmt, GSStereoFeature::PsDepthFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFba, GSStereoFeature::PsFba, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFog, GSStereoFeature::PsFog, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireIip, GSStereoFeature::PsIip, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDate, GSStereoFeature::PsDate, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAtst, GSStereoFeature::PsAtst, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAfail, GSStereoFeature::PsAfail, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFst, GSStereoFeature::PsFst, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTcc, GSStereoFeature::PsTcc, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAdjs, GSStereoFeature::PsAdjs, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAdjt, GSStereoFeature::PsAdjt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireShuffleSame, GSStereoFeature::PsShuffleSame, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireReal16Src, GSStereoFeature::PsReal16Src, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireProcessBa, GSStereoFeature::PsProcessBa, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireProcessRg, GSStereoFeature::PsProcessRg, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireShuffleAcross, GSStereoFeature::PsShuffleAcross, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireWriteRg, GSStereoFeature::PsWriteRg, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendA, GSStereoFeature::PsBlendA, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendC, GSStereoFeature::PsBlendC, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendD, GSStereoFeature::PsBlendD, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFixedOneA, GSStereoFeature::PsFixedOneA, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendHw, GSStereoFeature::PsBlendHw, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAMasked, GSStereoFeature::PsAMasked, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireRoundInv, GSStereoFeature::PsRoundInv, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireChannel, GSStereoFeature::PsChannel, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireChannelFb, GSStereoFeature::PsChannelFb, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDither, GSStereoFeature::PsDither, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDitherAdjust, GSStereoFeature::PsDitherAdjust, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZClamp, GSStereoFeature::PsZClamp, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZFloor, GSStereoFeature::PsZFloor, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTCOffsetHack, GSStereoFeature::PsTCOffsetHack, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireUrbanChaosHle, GSStereoFeature::PsUrbanChaosHle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTalesOfAbyssHle, GSStereoFeature::PsTalesOfAbyssHle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAutomaticLod, GSStereoFeature::PsAutomaticLod, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireManualLod, GSStereoFeature::PsManualLod, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePointSampler, GSStereoFeature::PsPointSampler, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireRegionRect, GSStereoFeature::PsRegionRect, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireScanmask, GSStereoFeature::PsScanmask, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAlphaBlend, GSStereoFeature::PrimAbe, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAlphaTest, GSStereoFeature::AlphaTest, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDatm, GSStereoFeature::DestAlphaMode, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZTest, GSStereoFeature::ZTest, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZWrite, GSStereoFeature::ZMask, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZTestAlways, GSStereoFeature::ZTestAlways, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZTestNever, GSStereoFeature::ZTestNever, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAa1, GSStereoFeature::PrimAa1, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireChannelShuffle, GSStereoFeature::ChannelShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFullscreenShuffle, GSStereoFeature::FullScreenShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePoints, GSStereoFeature::PrimPoint, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireLines, GSStereoFeature::PrimLine, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTriangles, GSStereoFeature::PrimTriangle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireSprites, GSStereoFeature::ZTestAlwaysZEqual, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFixedQ, GSStereoFeature::TfxDecal, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFixedZ, GSStereoFeature::TfxDecal, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireConstantColor, GSStereoFeature::DecalNoRegionRect, false},
+	{&Pcsx2Config::GSOptions::StereoFixStencilShadows, GSStereoFeature::StencilShadow, true},
+	{&Pcsx2Config::GSOptions::StereoRejectScalingDraw, GSStereoFeature::ScalingDraw, true},
+	{&Pcsx2Config::GSOptions::StereoRejectSbsInput, GSStereoFeature::SbsInput, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTabInput, GSStereoFeature::TabInput, true},
+	{&Pcsx2Config::GSOptions::StereoRejectSpriteBlit, GSStereoFeature::SpriteBlit, true},
+	{&Pcsx2Config::GSOptions::StereoRejectConstantColor, GSStereoFeature::ConstantColor, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoop, GSStereoFeature::PsFeedbackLoop, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFullscreenScissor, GSStereoFeature::FullscreenScissor, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFullscreenDraw, GSStereoFeature::FullscreenDraw, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFullCover, GSStereoFeature::FullCover, true},
+	{&Pcsx2Config::GSOptions::StereoRejectScanmask, GSStereoFeature::PsScanmask, true},
+	{&Pcsx2Config::GSOptions::StereoUiSafeDetect, GSStereoFeature::UiSafeDetect, true},
+	{&Pcsx2Config::GSOptions::StereoUiAdvancedDetect, GSStereoFeature::UiAdvancedDetect, true},
+	{&Pcsx2Config::GSOptions::StereoRejectZTestAlways, GSStereoFeature::ZTestAlways, true},
+	{&Pcsx2Config::GSOptions::StereoRequireZVaries, GSStereoFeature::ZEqual, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFixedQ, GSStereoFeature::QEqual, true},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireZTestGequal, GSStereoFeature::ZTestGreater, false},
+	{&Pcsx2Config::GSOptions::StereoRejectUiLike, GSStereoFeature::UiLike, true},
+	{&Pcsx2Config::GSOptions::StereoUiBackgroundDepth, GSStereoFeature::UiBackgroundDepth, true},
+	{&Pcsx2Config::GSOptions::StereoRequirePerspectiveUV, GSStereoFeature::PerspectiveUV, false},
+	{&Pcsx2Config::GSOptions::StereoRequireDepthActive, GSStereoFeature::DepthActive, false},
+	{&Pcsx2Config::GSOptions::StereoRejectSprites, GSStereoFeature::PrimSprite, true},
+	{&Pcsx2Config::GSOptions::StereoRequireTextureMapping, GSStereoFeature::PrimTme, false},
+	{&Pcsx2Config::GSOptions::StereoRequireAlphaBlend, GSStereoFeature::PrimAbe, false},
+	{&Pcsx2Config::GSOptions::StereoRequireAlphaTest, GSStereoFeature::AlphaTest, false},
+	{&Pcsx2Config::GSOptions::StereoRequireUvVaries, GSStereoFeature::STEqual, true},
+	{&Pcsx2Config::GSOptions::StereoRequireColorVaries, GSStereoFeature::RGBAEqualAny, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFog, GSStereoFeature::PrimFge, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireDate, GSStereoFeature::DestAlphaTest, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireDatm, GSStereoFeature::DestAlphaMode, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireAte, GSStereoFeature::AlphaTest, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireAfailZbOnly, GSStereoFeature::AfailZbOnly, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireAfailNotKeep, GSStereoFeature::AfailNotKeep, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireZWrite, GSStereoFeature::ZMask, true},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireZTest, GSStereoFeature::ZTest, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireFbMask, GSStereoFeature::FbMask, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireFbMaskFull, GSStereoFeature::FbMaskFull, false},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireTexIsFb, GSStereoFeature::PsTexIsFb, false},
+	{&Pcsx2Config::GSOptions::StereoRejectTexIsFb, GSStereoFeature::PsTexIsFb, true},
+	{&Pcsx2Config::GSOptions::StereoRejectChannelShuffle, GSStereoFeature::ChannelShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTextureShuffle, GSStereoFeature::TextureShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFullscreenShuffle, GSStereoFeature::FullScreenShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoRejectShaderShuffle, GSStereoFeature::PsShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoRejectShuffleAcross, GSStereoFeature::PsShuffleAcross, true},
+	{&Pcsx2Config::GSOptions::StereoRejectShuffleSame, GSStereoFeature::PsShuffleSame, true},
+	{&Pcsx2Config::GSOptions::StereoRejectChannelFetch, GSStereoFeature::PsChannel, true},
+	{&Pcsx2Config::GSOptions::StereoRejectChannelFetchFb, GSStereoFeature::PsChannelFb, true},
+	{&Pcsx2Config::GSOptions::StereoRejectColclip, GSStereoFeature::ColclipAny, true},
+	{&Pcsx2Config::GSOptions::StereoRejectBlendMix, GSStereoFeature::PsBlendMix, true},
+	{&Pcsx2Config::GSOptions::StereoRejectPabe, GSStereoFeature::PsPabe, true},
+	{&Pcsx2Config::GSOptions::StereoRejectDither, GSStereoFeature::PsDither, true},
+	{&Pcsx2Config::GSOptions::StereoRejectNoColorOutput, GSStereoFeature::NoColorOutput, true},
+	{&Pcsx2Config::GSOptions::StereoRejectHleShuffle, GSStereoFeature::HleShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTCOffsetHack, GSStereoFeature::PsTCOffsetHack, true},
+	{&Pcsx2Config::GSOptions::StereoRejectPoints, GSStereoFeature::PrimPoint, true},
+	{&Pcsx2Config::GSOptions::StereoRejectLines, GSStereoFeature::PrimLine, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFlatShading, GSStereoFeature::PsIip, false},
+	{&Pcsx2Config::GSOptions::StereoRejectAa1, GSStereoFeature::PrimAa1, true},
+	{&Pcsx2Config::GSOptions::StereoRejectNoZTest, GSStereoFeature::ZTest, false},
+	{&Pcsx2Config::GSOptions::StereoRejectNoZWrite, GSStereoFeature::ZMask, true},
+	{&Pcsx2Config::GSOptions::StereoRejectZTestNever, GSStereoFeature::ZTestNever, true},
+	{&Pcsx2Config::GSOptions::StereoRejectAlphaTestOff, GSStereoFeature::AlphaTest, false},
+	{&Pcsx2Config::GSOptions::StereoRejectAlphaTestAlways, GSStereoFeature::AlphaTestAlways, true},
+	{&Pcsx2Config::GSOptions::StereoRejectAlphaTestNever, GSStereoFeature::AlphaTestNever, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTfxModulate, GSStereoFeature::TfxModulate, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTfxHighlight, GSStereoFeature::TfxHighlight, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTfxHighlight2, GSStereoFeature::TfxHighlight2, true},
+	{&Pcsx2Config::GSOptions::StereoRejectSmallDrawArea, GSStereoFeature::SmallDrawArea, true},
+	{&Pcsx2Config::GSOptions::StereoRejectWideDrawBand, GSStereoFeature::WideDrawBand, true},
+	{&Pcsx2Config::GSOptions::StereoRejectTopDrawBand, GSStereoFeature::TopDrawBand, true},
+	{&Pcsx2Config::GSOptions::StereoRejectRtSpriteNoDepth, GSStereoFeature::RtSpriteNoDepth, true},
+	{&Pcsx2Config::GSOptions::StereoRejectRtSpriteAlphaBlend, GSStereoFeature::RtSpriteAlphaBlend, true},
+	{&Pcsx2Config::GSOptions::StereoRequireProcessTexture, GSStereoFeature::ProcessTexture, false},
+	{&Pcsx2Config::GSOptions::StereoRejectProcessTexture, GSStereoFeature::ProcessTexture, true},
+	{&Pcsx2Config::GSOptions::StereoRequireSourceFromTarget, GSStereoFeature::SourceFromTarget, false},
+	{&Pcsx2Config::GSOptions::StereoRejectSourceFromTarget, GSStereoFeature::SourceFromTarget, true},
+	{&Pcsx2Config::GSOptions::StereoRequireTexIsRt, GSStereoFeature::TexIsRt, false},
+	{&Pcsx2Config::GSOptions::StereoRejectTexIsRt, GSStereoFeature::TexIsRt, true},
+	{&Pcsx2Config::GSOptions::StereoRequireInTargetDraw, GSStereoFeature::InTargetDraw, false},
+	{&Pcsx2Config::GSOptions::StereoRejectInTargetDraw, GSStereoFeature::InTargetDraw, true},
+	{&Pcsx2Config::GSOptions::StereoRequireTempZ, GSStereoFeature::TempZ, false},
+	{&Pcsx2Config::GSOptions::StereoRejectTempZ, GSStereoFeature::TempZ, true},
+	{&Pcsx2Config::GSOptions::StereoRequireOneBarrier, GSStereoFeature::OneBarrier, false},
+	{&Pcsx2Config::GSOptions::StereoRejectOneBarrier, GSStereoFeature::OneBarrier, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFullBarrier, GSStereoFeature::FullBarrier, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFullBarrier, GSStereoFeature::FullBarrier, true},
+	{&Pcsx2Config::GSOptions::StereoRequireSinglePass, GSStereoFeature::SinglePass, false},
+	{&Pcsx2Config::GSOptions::StereoRejectSinglePass, GSStereoFeature::SinglePass, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFullscreenDrawArea, GSStereoFeature::FullscreenDrawArea, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFullscreenDrawArea, GSStereoFeature::FullscreenDrawArea, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFullscreenSprite, GSStereoFeature::FullscreenSprite, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFullscreenSprite, GSStereoFeature::FullscreenSprite, true},
+	{&Pcsx2Config::GSOptions::StereoRequireTexturedSprite, GSStereoFeature::TexturedSprite, false},
+	{&Pcsx2Config::GSOptions::StereoRejectTexturedSprite, GSStereoFeature::TexturedSprite, true},
+	{&Pcsx2Config::GSOptions::StereoRequireRtOutput, GSStereoFeature::RtOutput, false},
+	{&Pcsx2Config::GSOptions::StereoRejectRtOutput, GSStereoFeature::RtOutput, true},
+	{&Pcsx2Config::GSOptions::StereoRequireDepthOutput, GSStereoFeature::DepthOutput, false},
+	{&Pcsx2Config::GSOptions::StereoRejectDepthOutput, GSStereoFeature::DepthOutput, true},
+	{&Pcsx2Config::GSOptions::StereoRequireDepthRead, GSStereoFeature::DepthRead, false},
+	{&Pcsx2Config::GSOptions::StereoRejectDepthRead, GSStereoFeature::DepthRead, true},
+	{&Pcsx2Config::GSOptions::StereoRequireDepthWrite, GSStereoFeature::DepthWrite, false},
+	{&Pcsx2Config::GSOptions::StereoRejectDepthWrite, GSStereoFeature::DepthWrite, true},
+	{&Pcsx2Config::GSOptions::StereoRequirePalettedTexture, GSStereoFeature::PalettedTexture, false},
+	{&Pcsx2Config::GSOptions::StereoRejectPalettedTexture, GSStereoFeature::PalettedTexture, true},
+	{&Pcsx2Config::GSOptions::StereoRequireDepthTexture, GSStereoFeature::DepthTexture, false},
+	{&Pcsx2Config::GSOptions::StereoRejectDepthTexture, GSStereoFeature::DepthTexture, true},
+	{&Pcsx2Config::GSOptions::StereoRequireMipmap, GSStereoFeature::Mipmap, false},
+	{&Pcsx2Config::GSOptions::StereoRejectMipmap, GSStereoFeature::Mipmap, true},
+	{&Pcsx2Config::GSOptions::StereoRequireLinearSampling, GSStereoFeature::LinearSampling, false},
+	{&Pcsx2Config::GSOptions::StereoRejectLinearSampling, GSStereoFeature::LinearSampling, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvActive, GSStereoFeature::FmvActive, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvActive, GSStereoFeature::FmvActive, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvHeuristic, GSStereoFeature::FmvHeuristic, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvHeuristic, GSStereoFeature::FmvHeuristic, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvSprite, GSStereoFeature::PrimSprite, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvSprite, GSStereoFeature::PrimSprite, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvSingleSprite, GSStereoFeature::SingleSprite, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvSingleSprite, GSStereoFeature::SingleSprite, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvTextureMapping, GSStereoFeature::PrimTme, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvTextureMapping, GSStereoFeature::PrimTme, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvProcessTexture, GSStereoFeature::ProcessTexture, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvProcessTexture, GSStereoFeature::ProcessTexture, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvFullscreenDrawArea, GSStereoFeature::FullscreenDrawArea, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvFullscreenDrawArea, GSStereoFeature::FullscreenDrawArea, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvFullscreenScissor, GSStereoFeature::FullscreenScissor, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvFullscreenScissor, GSStereoFeature::FullscreenScissor, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoAlphaBlend, GSStereoFeature::PrimAbe, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoAlphaBlend, GSStereoFeature::PrimAbe, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoAlphaTest, GSStereoFeature::AlphaTest, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoAlphaTest, GSStereoFeature::AlphaTest, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthTest, GSStereoFeature::ZTest, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthTest, GSStereoFeature::ZTest, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthWrite, GSStereoFeature::ZMask, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthWrite, GSStereoFeature::ZMask, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthOutput, GSStereoFeature::DepthOutput, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthOutput, GSStereoFeature::DepthOutput, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthRead, GSStereoFeature::DepthRead, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthRead, GSStereoFeature::DepthRead, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoFbMask, GSStereoFeature::FbMask, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoFbMask, GSStereoFeature::FbMask, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvColorOutput, GSStereoFeature::NoColorOutput, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvColorOutput, GSStereoFeature::NoColorOutput, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvSourceNotFromTarget, GSStereoFeature::SourceFromTarget, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvSourceNotFromTarget, GSStereoFeature::SourceFromTarget, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvDrawMatchesTex, GSStereoFeature::FmvDrawMatchesTex, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvDrawMatchesTex, GSStereoFeature::FmvDrawMatchesTex, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoShuffle, GSStereoFeature::NoShuffle, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoShuffle, GSStereoFeature::NoShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvNoMipmap, GSStereoFeature::Mipmap, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvNoMipmap, GSStereoFeature::Mipmap, false},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvLinearSampling, GSStereoFeature::LinearSampling, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvLinearSampling, GSStereoFeature::LinearSampling, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvEeUpload, GSStereoFeature::FmvEeUpload, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvEeUpload, GSStereoFeature::FmvEeUpload, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvDisplayMatch, GSStereoFeature::FmvDisplayMatch, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvDisplayMatch, GSStereoFeature::FmvDisplayMatch, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFmvRecentTransferDraw, GSStereoFeature::FmvRecentTransferDraw, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFmvRecentTransferDraw, GSStereoFeature::FmvRecentTransferDraw, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopShader, GSStereoFeature::PsFeedbackLoop, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopShader, GSStereoFeature::PsFeedbackLoop, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopDrawUsesTarget, GSStereoFeature::DrawUsesTarget, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopDrawUsesTarget, GSStereoFeature::DrawUsesTarget, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopTexIsRt, GSStereoFeature::TexIsRt, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopTexIsRt, GSStereoFeature::TexIsRt, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopSourceFromTarget, GSStereoFeature::SourceFromTarget, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopSourceFromTarget, GSStereoFeature::SourceFromTarget, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopInTargetDraw, GSStereoFeature::InTargetDraw, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopInTargetDraw, GSStereoFeature::InTargetDraw, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopTempZ, GSStereoFeature::TempZ, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopTempZ, GSStereoFeature::TempZ, true},
+	{&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopOverlapDrawRange, GSStereoFeature::DrawUsesTarget, false},
+	{&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopOverlapDrawRange, GSStereoFeature::DrawUsesTarget, true},
+};
+
+// Options ORed together by StereoEnableOptions. At least one of them has to match for the
+// rule chain to take effect.
+static constexpr StereoRule s_double_image_rules[] = {
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendMix, GSStereoFeature::PsBlendMix, false},
+	{&Pcsx2Config::GSOptions::StereoRejectRtaCorrection, GSStereoFeature::PsRtaCorrection, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendB, GSStereoFeature::PsBlendB, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectIip, GSStereoFeature::PsIip, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAutomaticLod, GSStereoFeature::PsAutomaticLod, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireNoColor1, GSStereoFeature::PsNoColor1, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireWms, GSStereoFeature::PsWms, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireWmt, GSStereoFeature::PsWmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireLtf, GSStereoFeature::PsLtf, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireShuffle, GSStereoFeature::PsShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTcc, GSStereoFeature::PsTcc, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTfx, GSStereoFeature::PsTfx, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAem, GSStereoFeature::PsAem, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendB, GSStereoFeature::PsBlendB, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectProcessBa, GSStereoFeature::PsProcessBa, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectProcessRg, GSStereoFeature::PsProcessRg, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectShuffleAcross, GSStereoFeature::PsShuffleAcross, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTextureShuffle, GSStereoFeature::TextureShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectRtaSourceCorrection, GSStereoFeature::PsRtaSourceCorrection, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectColclipHw, GSStereoFeature::PsColclipHw, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectColclip, GSStereoFeature::PsColclip, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectPabe, GSStereoFeature::PsPabe, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFbMask, GSStereoFeature::PsFbmask, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTexIsFb, GSStereoFeature::PsTexIsFb, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectNoColor, GSStereoFeature::PsNoColor, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectNoColor1, GSStereoFeature::PsNoColor1, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAemFmt, GSStereoFeature::PsAemFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectPalFmt, GSStereoFeature::PsPalFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDstFmt, GSStereoFeature::PsDstFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDepthFmt, GSStereoFeature::PsDepthFmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAem, GSStereoFeature::PsAem, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFba, GSStereoFeature::PsFba, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFog, GSStereoFeature::PsFog, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDate, GSStereoFeature::PsDate, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAtst, GSStereoFeature::PsAtst, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAfail, GSStereoFeature::PsAfail, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFst, GSStereoFeature::PsFst, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectWms, GSStereoFeature::PsWms, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectWmt, GSStereoFeature::PsWmt, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAdjs, GSStereoFeature::PsAdjs, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectLtf, GSStereoFeature::PsLtf, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectShuffle, GSStereoFeature::PsShuffle, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectShuffleSame, GSStereoFeature::PsShuffleSame, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectReal16Src, GSStereoFeature::PsReal16Src, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectWriteRg, GSStereoFeature::PsWriteRg, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendA, GSStereoFeature::PsBlendA, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendC, GSStereoFeature::PsBlendC, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendD, GSStereoFeature::PsBlendD, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectFixedOneA, GSStereoFeature::PsFixedOneA, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectBlendHw, GSStereoFeature::PsBlendHw, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectAMasked, GSStereoFeature::PsAMasked, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectRoundInv, GSStereoFeature::PsRoundInv, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectChannel, GSStereoFeature::PsChannel, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectChannelFb, GSStereoFeature::PsChannelFb, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDither, GSStereoFeature::PsDither, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectDitherAdjust, GSStereoFeature::PsDitherAdjust, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectZClamp, GSStereoFeature::PsZClamp, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectZFloor, GSStereoFeature::PsZFloor, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTCOffsetHack, GSStereoFeature::PsTCOffsetHack, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectUrbanChaosHle, GSStereoFeature::PsUrbanChaosHle, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectTalesOfAbyssHle, GSStereoFeature::PsTalesOfAbyssHle, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectManualLod, GSStereoFeature::PsManualLod, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectPointSampler, GSStereoFeature::PsPointSampler, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectRegionRect, GSStereoFeature::PsRegionRect, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRejectScanmask, GSStereoFeature::PsScanmask, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireColclipHw, GSStereoFeature::PsColclipHw, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireColclip, GSStereoFeature::PsColclip, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendMix, GSStereoFeature::PsBlendMix, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePabe, GSStereoFeature::PsPabe, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFbMask, GSStereoFeature::PsFbmask, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTexIsFb, GSStereoFeature::PsTexIsFb, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireNoColor, GSStereoFeature::PsNoColor, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAemFmt, GSStereoFeature::PsAemFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePalFmt, GSStereoFeature::PsPalFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDstFmt, GSStereoFeature::PsDstFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDepthFmt, GSStereoFeature::PsDepthFmt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFba, GSStereoFeature::PsFba, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFog, GSStereoFeature::PsFog, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireIip, GSStereoFeature::PsIip, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDate, GSStereoFeature::PsDate, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAtst, GSStereoFeature::PsAtst, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAfail, GSStereoFeature::PsAfail, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFst, GSStereoFeature::PsFst, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTcc, GSStereoFeature::PsTcc, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAdjs, GSStereoFeature::PsAdjs, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAdjt, GSStereoFeature::PsAdjt, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireShuffleSame, GSStereoFeature::PsShuffleSame, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireReal16Src, GSStereoFeature::PsReal16Src, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireProcessBa, GSStereoFeature::PsProcessBa, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireProcessRg, GSStereoFeature::PsProcessRg, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireShuffleAcross, GSStereoFeature::PsShuffleAcross, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireWriteRg, GSStereoFeature::PsWriteRg, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendA, GSStereoFeature::PsBlendA, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendC, GSStereoFeature::PsBlendC, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendD, GSStereoFeature::PsBlendD, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFixedOneA, GSStereoFeature::PsFixedOneA, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireBlendHw, GSStereoFeature::PsBlendHw, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAMasked, GSStereoFeature::PsAMasked, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireRoundInv, GSStereoFeature::PsRoundInv, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireChannel, GSStereoFeature::PsChannel, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireChannelFb, GSStereoFeature::PsChannelFb, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDither, GSStereoFeature::PsDither, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDitherAdjust, GSStereoFeature::PsDitherAdjust, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZClamp, GSStereoFeature::PsZClamp, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZFloor, GSStereoFeature::PsZFloor, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTCOffsetHack, GSStereoFeature::PsTCOffsetHack, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireUrbanChaosHle, GSStereoFeature::PsUrbanChaosHle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTalesOfAbyssHle, GSStereoFeature::PsTalesOfAbyssHle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAutomaticLod, GSStereoFeature::PsAutomaticLod, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireManualLod, GSStereoFeature::PsManualLod, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePointSampler, GSStereoFeature::PsPointSampler, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireRegionRect, GSStereoFeature::PsRegionRect, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireScanmask, GSStereoFeature::PsScanmask, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAlphaBlend, GSStereoFeature::PrimAbe, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAlphaTest, GSStereoFeature::AlphaTest, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireDatm, GSStereoFeature::DestAlphaMode, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZTest, GSStereoFeature::ZTest, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZWrite, GSStereoFeature::ZMask, false},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZTestAlways, GSStereoFeature::ZTestAlways, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireZTestNever, GSStereoFeature::ZTestNever, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireAa1, GSStereoFeature::PrimAa1, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireChannelShuffle, GSStereoFeature::ChannelShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireFullscreenShuffle, GSStereoFeature::FullScreenShuffle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequirePoints, GSStereoFeature::PrimPoint, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireLines, GSStereoFeature::PrimLine, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireTriangles, GSStereoFeature::PrimTriangle, true},
+	{&Pcsx2Config::GSOptions::StereoUniversalRequireSprites, GSStereoFeature::ZTestAlwaysZEqual, true},
+};
+
+static constexpr StereoRule s_master_fix_rules[] = {
+	{&Pcsx2Config::GSOptions::StereoMasterFix1, GSStereoFeature::MasterFix1, true},
+	{&Pcsx2Config::GSOptions::StereoMasterFix2, GSStereoFeature::MasterFix2, true},
+	{&Pcsx2Config::GSOptions::StereoMasterFix3, GSStereoFeature::MasterFix3, true},
+	{&Pcsx2Config::GSOptions::StereoMasterFix4, GSStereoFeature::MasterFix4, true},
+	{&Pcsx2Config::GSOptions::StereoMasterFix5, GSStereoFeature::MasterFix5, true},
+	{&Pcsx2Config::GSOptions::StereoMasterFix6, GSStereoFeature::MasterFix6, true},
+};
+
+static constexpr StereoRule s_ui_detect_rules[] = {
+	{&Pcsx2Config::GSOptions::StereoUiSafeDetect, GSStereoFeature::UiSafeDetect, true},
+	{&Pcsx2Config::GSOptions::StereoUiAdvancedDetect, GSStereoFeature::UiAdvancedDetect, true},
+	{&Pcsx2Config::GSOptions::StereoRejectZTestAlways, GSStereoFeature::ZTestAlways, true},
+	{&Pcsx2Config::GSOptions::StereoRequireZVaries, GSStereoFeature::ZEqual, true},
+	{&Pcsx2Config::GSOptions::StereoRejectFixedQ, GSStereoFeature::QEqual, true},
+	{&Pcsx2Config::GSOptions::StereoStencilRequireZTestGequal, GSStereoFeature::ZTestGreater, false},
+	{&Pcsx2Config::GSOptions::StereoRejectUiLike, GSStereoFeature::UiLike, true},
+	{&Pcsx2Config::GSOptions::StereoUiBackgroundDepth, GSStereoFeature::UiBackgroundDepth, true},
+};
+
+// Settings keys of every boolean stereo option, used to resolve GameDB stereo rule sets.
+#define STEREO_OPTION(name) {#name, &Pcsx2Config::GSOptions::name}
+static constexpr std::pair<const char*, GSStereoDrawFilter::Option> s_option_names[] = {
+	STEREO_OPTION(StereoSwapEyes),
+	STEREO_OPTION(StereoFlipRendering),
+	STEREO_OPTION(StereoInstencedRenderer),
+	STEREO_OPTION(StereoRejectNonPositiveZ),
+	STEREO_OPTION(StereoRejectSmallZRange),
+	STEREO_OPTION(StereoRejectSpriteBlit),
+	STEREO_OPTION(StereoRejectConstantColor),
+	STEREO_OPTION(StereoRejectScalingDraw),
+	STEREO_OPTION(StereoRejectSbsInput),
+	STEREO_OPTION(StereoRejectTabInput),
+	STEREO_OPTION(StereoMasterFix),
+	STEREO_OPTION(StereoMasterFixTest),
+	STEREO_OPTION(StereoMasterFix1),
+	STEREO_OPTION(StereoMasterFix2),
+	STEREO_OPTION(StereoMasterFix3),
+	STEREO_OPTION(StereoMasterFix4),
+	STEREO_OPTION(StereoMasterFix5),
+	STEREO_OPTION(StereoMasterFix6),
+	STEREO_OPTION(StereoMasterFix7),
+	STEREO_OPTION(StereoMasterFix8),
+	STEREO_OPTION(StereoMasterFix9),
+	STEREO_OPTION(StereoMasterFix10),
+	STEREO_OPTION(StereoRequireDisplayBuffer1),
+	STEREO_OPTION(StereoRequireDisplayBuffer2),
+	STEREO_OPTION(StereoRequirePerspectiveUV),
+	STEREO_OPTION(StereoRequireZVaries),
+	STEREO_OPTION(StereoRequireDepthActive),
+	STEREO_OPTION(StereoRejectSprites),
+	STEREO_OPTION(StereoRejectUiLike),
+	STEREO_OPTION(StereoRequireTextureMapping),
+	STEREO_OPTION(StereoRequireAlphaBlend),
+	STEREO_OPTION(StereoRequireAlphaTest),
+	STEREO_OPTION(StereoRequireUvVaries),
+	STEREO_OPTION(StereoRequireColorVaries),
+	STEREO_OPTION(StereoRequireFog),
+	STEREO_OPTION(StereoStencilRequireDate),
+	STEREO_OPTION(StereoStencilRequireDatm),
+	STEREO_OPTION(StereoStencilRequireAte),
+	STEREO_OPTION(StereoStencilRequireAfailZbOnly),
+	STEREO_OPTION(StereoStencilRequireAfailNotKeep),
+	STEREO_OPTION(StereoStencilRequireZWrite),
+	STEREO_OPTION(StereoStencilRequireZTest),
+	STEREO_OPTION(StereoStencilRequireZTestGequal),
+	STEREO_OPTION(StereoStencilRequireFbMask),
+	STEREO_OPTION(StereoStencilRequireFbMaskFull),
+	STEREO_OPTION(StereoStencilRequireTexIsFb),
+	STEREO_OPTION(StereoRejectFullscreenDraw),
+	STEREO_OPTION(StereoRejectFullscreenScissor),
+	STEREO_OPTION(StereoRejectFullCover),
+	STEREO_OPTION(StereoRejectSpriteNoGaps),
+	STEREO_OPTION(StereoRejectTexIsFb),
+	STEREO_OPTION(StereoRejectChannelShuffle),
+	STEREO_OPTION(StereoRejectTextureShuffle),
+	STEREO_OPTION(StereoRejectFullscreenShuffle),
+	STEREO_OPTION(StereoRejectShaderShuffle),
+	STEREO_OPTION(StereoRejectShuffleAcross),
+	STEREO_OPTION(StereoRejectShuffleSame),
+	STEREO_OPTION(StereoRejectChannelFetch),
+	STEREO_OPTION(StereoRejectChannelFetchFb),
+	STEREO_OPTION(StereoRejectFeedbackLoop),
+	STEREO_OPTION(StereoRejectColclip),
+	STEREO_OPTION(StereoRejectRtaCorrection),
+	STEREO_OPTION(StereoUniversalRejectRtaSourceCorrection),
+	STEREO_OPTION(StereoUniversalRejectColclipHw),
+	STEREO_OPTION(StereoUniversalRejectColclip),
+	STEREO_OPTION(StereoUniversalRejectBlendMix),
+	STEREO_OPTION(StereoUniversalRejectPabe),
+	STEREO_OPTION(StereoUniversalRejectFbMask),
+	STEREO_OPTION(StereoUniversalRejectTexIsFb),
+	STEREO_OPTION(StereoUniversalRejectNoColor),
+	STEREO_OPTION(StereoUniversalRejectNoColor1),
+	STEREO_OPTION(StereoUniversalRejectAemFmt),
+	STEREO_OPTION(StereoUniversalRejectPalFmt),
+	STEREO_OPTION(StereoUniversalRejectDstFmt),
+	STEREO_OPTION(StereoUniversalRejectDepthFmt),
+	STEREO_OPTION(StereoUniversalRejectAem),
+	STEREO_OPTION(StereoUniversalRejectFba),
+	STEREO_OPTION(StereoUniversalRejectFog),
+	STEREO_OPTION(StereoUniversalRejectIip),
+	STEREO_OPTION(StereoUniversalRejectDate),
+	STEREO_OPTION(StereoUniversalRejectAtst),
+	STEREO_OPTION(StereoUniversalRejectAfail),
+	STEREO_OPTION(StereoUniversalRejectFst),
+	STEREO_OPTION(StereoUniversalRejectTfx),
+	STEREO_OPTION(StereoUniversalRejectTcc),
+	STEREO_OPTION(StereoUniversalRejectWms),
+	STEREO_OPTION(StereoUniversalRejectWmt),
+	STEREO_OPTION(StereoUniversalRejectAdjs),
+	STEREO_OPTION(StereoUniversalRejectAdjt),
+	STEREO_OPTION(StereoUniversalRejectLtf),
+	STEREO_OPTION(StereoUniversalRejectShuffle),
+	STEREO_OPTION(StereoUniversalRejectShuffleSame),
+	STEREO_OPTION(StereoUniversalRejectReal16Src),
+	STEREO_OPTION(StereoUniversalRejectProcessBa),
+	STEREO_OPTION(StereoUniversalRejectProcessRg),
+	STEREO_OPTION(StereoUniversalRejectShuffleAcross),
+	STEREO_OPTION(StereoUniversalRejectWriteRg),
+	STEREO_OPTION(StereoUniversalRejectBlendA),
+	STEREO_OPTION(StereoUniversalRejectBlendB),
+	STEREO_OPTION(StereoUniversalRejectBlendC),
+	STEREO_OPTION(StereoUniversalRejectBlendD),
+	STEREO_OPTION(StereoUniversalRejectFixedOneA),
+	STEREO_OPTION(StereoUniversalRejectBlendHw),
+	STEREO_OPTION(StereoUniversalRejectAMasked),
+	STEREO_OPTION(StereoUniversalRejectRoundInv),
+	STEREO_OPTION(StereoUniversalRejectChannel),
+	STEREO_OPTION(StereoUniversalRejectChannelFb),
+	STEREO_OPTION(StereoUniversalRejectDither),
+	STEREO_OPTION(StereoUniversalRejectDitherAdjust),
+	STEREO_OPTION(StereoUniversalRejectZClamp),
+	STEREO_OPTION(StereoUniversalRejectZFloor),
+	STEREO_OPTION(StereoUniversalRejectTCOffsetHack),
+	STEREO_OPTION(StereoUniversalRejectUrbanChaosHle),
+	STEREO_OPTION(StereoUniversalRejectTalesOfAbyssHle),
+	STEREO_OPTION(StereoUniversalRejectAutomaticLod),
+	STEREO_OPTION(StereoUniversalRejectManualLod),
+	STEREO_OPTION(StereoUniversalRejectPointSampler),
+	STEREO_OPTION(StereoUniversalRejectRegionRect),
+	STEREO_OPTION(StereoUniversalRejectScanmask),
+	STEREO_OPTION(StereoUniversalRequireRtaCorrection),
+	STEREO_OPTION(StereoUniversalRequireRtaSourceCorrection),
+	STEREO_OPTION(StereoUniversalRequireColclipHw),
+	STEREO_OPTION(StereoUniversalRequireColclip),
+	STEREO_OPTION(StereoUniversalRequireBlendMix),
+	STEREO_OPTION(StereoUniversalRequirePabe),
+	STEREO_OPTION(StereoUniversalRequireFbMask),
+	STEREO_OPTION(StereoUniversalRequireTexIsFb),
+	STEREO_OPTION(StereoUniversalRequireNoColor),
+	STEREO_OPTION(StereoUniversalRequireNoColor1),
+	STEREO_OPTION(StereoUniversalRequireAemFmt),
+	STEREO_OPTION(StereoUniversalRequirePalFmt),
+	STEREO_OPTION(StereoUniversalRequireDstFmt),
+	STEREO_OPTION(StereoUniversalRequireDepthFmt),
+	STEREO_OPTION(StereoUniversalRequireAem),
+	STEREO_OPTION(StereoUniversalRequireFba),
+	STEREO_OPTION(StereoUniversalRequireFog),
+	STEREO_OPTION(StereoUniversalRequireIip),
+	STEREO_OPTION(StereoUniversalRequireDate),
+	STEREO_OPTION(StereoUniversalRequireAtst),
+	STEREO_OPTION(StereoUniversalRequireAfail),
+	STEREO_OPTION(StereoUniversalRequireFst),
+	STEREO_OPTION(StereoUniversalRequireTfx),
+	STEREO_OPTION(StereoUniversalRequireTcc),
+	STEREO_OPTION(StereoUniversalRequireWms),
+	STEREO_OPTION(StereoUniversalRequireWmt),
+	STEREO_OPTION(StereoUniversalRequireAdjs),
+	STEREO_OPTION(StereoUniversalRequireAdjt),
+	STEREO_OPTION(StereoUniversalRequireLtf),
+	STEREO_OPTION(StereoUniversalRequireShuffle),
+	STEREO_OPTION(StereoUniversalRequireShuffleSame),
+	STEREO_OPTION(StereoUniversalRequireReal16Src),
+	STEREO_OPTION(StereoUniversalRequireProcessBa),
+	STEREO_OPTION(StereoUniversalRequireProcessRg),
+	STEREO_OPTION(StereoUniversalRequireShuffleAcross),
+	STEREO_OPTION(StereoUniversalRequireWriteRg),
+	STEREO_OPTION(StereoUniversalRequireBlendA),
+	STEREO_OPTION(StereoUniversalRequireBlendB),
+	STEREO_OPTION(StereoUniversalRequireBlendC),
+	STEREO_OPTION(StereoUniversalRequireBlendD),
+	STEREO_OPTION(StereoUniversalRequireFixedOneA),
+	STEREO_OPTION(StereoUniversalRequireBlendHw),
+	STEREO_OPTION(StereoUniversalRequireAMasked),
+	STEREO_OPTION(StereoUniversalRequireRoundInv),
+	STEREO_OPTION(StereoUniversalRequireChannel),
+	STEREO_OPTION(StereoUniversalRequireChannelFb),
+	STEREO_OPTION(StereoUniversalRequireDither),
+	STEREO_OPTION(StereoUniversalRequireDitherAdjust),
+	STEREO_OPTION(StereoUniversalRequireZClamp),
+	STEREO_OPTION(StereoUniversalRequireZFloor),
+	STEREO_OPTION(StereoUniversalRequireTCOffsetHack),
+	STEREO_OPTION(StereoUniversalRequireUrbanChaosHle),
+	STEREO_OPTION(StereoUniversalRequireTalesOfAbyssHle),
+	STEREO_OPTION(StereoUniversalRequireAutomaticLod),
+	STEREO_OPTION(StereoUniversalRequireManualLod),
+	STEREO_OPTION(StereoUniversalRequirePointSampler),
+	STEREO_OPTION(StereoUniversalRequireRegionRect),
+	STEREO_OPTION(StereoUniversalRequireScanmask),
+	STEREO_OPTION(StereoUniversalRequireAlphaBlend),
+	STEREO_OPTION(StereoUniversalRequireAlphaTest),
+	STEREO_OPTION(StereoUniversalRequireDatm),
+	STEREO_OPTION(StereoUniversalRequireZTest),
+	STEREO_OPTION(StereoUniversalRequireZWrite),
+	STEREO_OPTION(StereoUniversalRequireZTestAlways),
+	STEREO_OPTION(StereoUniversalRequireZTestNever),
+	STEREO_OPTION(StereoUniversalRequireAa1),
+	STEREO_OPTION(StereoUniversalRequireChannelShuffle),
+	STEREO_OPTION(StereoUniversalRequireTextureShuffle),
+	STEREO_OPTION(StereoUniversalRequireFullscreenShuffle),
+	STEREO_OPTION(StereoUniversalRequirePoints),
+	STEREO_OPTION(StereoUniversalRequireLines),
+	STEREO_OPTION(StereoUniversalRequireTriangles),
+	STEREO_OPTION(StereoUniversalRequireSprites),
+	STEREO_OPTION(StereoUniversalRequireFixedQ),
+	STEREO_OPTION(StereoUniversalRequireFixedZ),
+	STEREO_OPTION(StereoUniversalRequireConstantColor),
+	STEREO_OPTION(StereoRejectBlendMix),
+	STEREO_OPTION(StereoRejectPabe),
+	STEREO_OPTION(StereoRejectDither),
+	STEREO_OPTION(StereoRejectScanmask),
+	STEREO_OPTION(StereoRejectRegionRect),
+	STEREO_OPTION(StereoRejectNoColorOutput),
+	STEREO_OPTION(StereoRejectHleShuffle),
+	STEREO_OPTION(StereoRejectTCOffsetHack),
+	STEREO_OPTION(StereoRejectPoints),
+	STEREO_OPTION(StereoRejectLines),
+	STEREO_OPTION(StereoRejectFlatShading),
+	STEREO_OPTION(StereoRejectFst),
+	STEREO_OPTION(StereoEnableOptions),
+	STEREO_OPTION(StereoRemoveFixedSt),
+	STEREO_OPTION(StereoFixStencilShadows),
+	STEREO_OPTION(StereoRejectFixedQ),
+	STEREO_OPTION(StereoRejectAa1),
+	STEREO_OPTION(StereoRejectNoZTest),
+	STEREO_OPTION(StereoRejectNoZWrite),
+	STEREO_OPTION(StereoRejectZTestAlways),
+	STEREO_OPTION(StereoUiSafeDetect),
+	STEREO_OPTION(StereoUiAdvancedDetect),
+	STEREO_OPTION(StereoUiBackgroundDepth),
+	STEREO_OPTION(StereoRejectZTestNever),
+	STEREO_OPTION(StereoRejectAlphaTestOff),
+	STEREO_OPTION(StereoRejectAlphaTestAlways),
+	STEREO_OPTION(StereoRejectAlphaTestNever),
+	STEREO_OPTION(StereoRejectTfxModulate),
+	STEREO_OPTION(StereoRejectTfxDecal),
+	STEREO_OPTION(StereoRejectTfxHighlight),
+	STEREO_OPTION(StereoRejectTfxHighlight2),
+	STEREO_OPTION(StereoRejectSmallDrawArea),
+	STEREO_OPTION(StereoRejectWideDrawBand),
+	STEREO_OPTION(StereoRejectTopDrawBand),
+	STEREO_OPTION(StereoRejectRtSpriteNoDepth),
+	STEREO_OPTION(StereoRejectRtSpriteAlphaBlend),
+	STEREO_OPTION(StereoRequireProcessTexture),
+	STEREO_OPTION(StereoRejectProcessTexture),
+	STEREO_OPTION(StereoRequireSourceFromTarget),
+	STEREO_OPTION(StereoRejectSourceFromTarget),
+	STEREO_OPTION(StereoRequireDrawUsesTarget),
+	STEREO_OPTION(StereoRejectDrawUsesTarget),
+	STEREO_OPTION(StereoRequireTexIsRt),
+	STEREO_OPTION(StereoRejectTexIsRt),
+	STEREO_OPTION(StereoRequireInTargetDraw),
+	STEREO_OPTION(StereoRejectInTargetDraw),
+	STEREO_OPTION(StereoRequireTempZ),
+	STEREO_OPTION(StereoRejectTempZ),
+	STEREO_OPTION(StereoRequireOneBarrier),
+	STEREO_OPTION(StereoRejectOneBarrier),
+	STEREO_OPTION(StereoRequireFullBarrier),
+	STEREO_OPTION(StereoRejectFullBarrier),
+	STEREO_OPTION(StereoRequireSinglePass),
+	STEREO_OPTION(StereoRejectSinglePass),
+	STEREO_OPTION(StereoRequireFullscreenDrawArea),
+	STEREO_OPTION(StereoRejectFullscreenDrawArea),
+	STEREO_OPTION(StereoRequireFullscreenSprite),
+	STEREO_OPTION(StereoRejectFullscreenSprite),
+	STEREO_OPTION(StereoRequireTexturedSprite),
+	STEREO_OPTION(StereoRejectTexturedSprite),
+	STEREO_OPTION(StereoRequireRtOutput),
+	STEREO_OPTION(StereoRejectRtOutput),
+	STEREO_OPTION(StereoRequireDepthOutput),
+	STEREO_OPTION(StereoRejectDepthOutput),
+	STEREO_OPTION(StereoRequireDepthRead),
+	STEREO_OPTION(StereoRejectDepthRead),
+	STEREO_OPTION(StereoRequireDepthWrite),
+	STEREO_OPTION(StereoRejectDepthWrite),
+	STEREO_OPTION(StereoRequirePalettedTexture),
+	STEREO_OPTION(StereoRejectPalettedTexture),
+	STEREO_OPTION(StereoRequireDepthTexture),
+	STEREO_OPTION(StereoRejectDepthTexture),
+	STEREO_OPTION(StereoRequireMipmap),
+	STEREO_OPTION(StereoRejectMipmap),
+	STEREO_OPTION(StereoRequireLinearSampling),
+	STEREO_OPTION(StereoRejectLinearSampling),
+	STEREO_OPTION(StereoRequireFmvActive),
+	STEREO_OPTION(StereoRejectFmvActive),
+	STEREO_OPTION(StereoRequireFmvHeuristic),
+	STEREO_OPTION(StereoRejectFmvHeuristic),
+	STEREO_OPTION(StereoRequireFmvSprite),
+	STEREO_OPTION(StereoRejectFmvSprite),
+	STEREO_OPTION(StereoRequireFmvSingleSprite),
+	STEREO_OPTION(StereoRejectFmvSingleSprite),
+	STEREO_OPTION(StereoRequireFmvTextureMapping),
+	STEREO_OPTION(StereoRejectFmvTextureMapping),
+	STEREO_OPTION(StereoRequireFmvProcessTexture),
+	STEREO_OPTION(StereoRejectFmvProcessTexture),
+	STEREO_OPTION(StereoRequireFmvFullscreenDrawArea),
+	STEREO_OPTION(StereoRejectFmvFullscreenDrawArea),
+	STEREO_OPTION(StereoRequireFmvFullscreenScissor),
+	STEREO_OPTION(StereoRejectFmvFullscreenScissor),
+	STEREO_OPTION(StereoRequireFmvNoAlphaBlend),
+	STEREO_OPTION(StereoRejectFmvNoAlphaBlend),
+	STEREO_OPTION(StereoRequireFmvNoAlphaTest),
+	STEREO_OPTION(StereoRejectFmvNoAlphaTest),
+	STEREO_OPTION(StereoRequireFmvNoDepthTest),
+	STEREO_OPTION(StereoRejectFmvNoDepthTest),
+	STEREO_OPTION(StereoRequireFmvNoDepthWrite),
+	STEREO_OPTION(StereoRejectFmvNoDepthWrite),
+	STEREO_OPTION(StereoRequireFmvNoDepthOutput),
+	STEREO_OPTION(StereoRejectFmvNoDepthOutput),
+	STEREO_OPTION(StereoRequireFmvNoDepthRead),
+	STEREO_OPTION(StereoRejectFmvNoDepthRead),
+	STEREO_OPTION(StereoRequireFmvNoFbMask),
+	STEREO_OPTION(StereoRejectFmvNoFbMask),
+	STEREO_OPTION(StereoRequireFmvColorOutput),
+	STEREO_OPTION(StereoRejectFmvColorOutput),
+	STEREO_OPTION(StereoRequireFmvSourceNotFromTarget),
+	STEREO_OPTION(StereoRejectFmvSourceNotFromTarget),
+	STEREO_OPTION(StereoRequireFmvDrawMatchesTex),
+	STEREO_OPTION(StereoRejectFmvDrawMatchesTex),
+	STEREO_OPTION(StereoRequireFmvNoShuffle),
+	STEREO_OPTION(StereoRejectFmvNoShuffle),
+	STEREO_OPTION(StereoRequireFmvNoMipmap),
+	STEREO_OPTION(StereoRejectFmvNoMipmap),
+	STEREO_OPTION(StereoRequireFmvLinearSampling),
+	STEREO_OPTION(StereoRejectFmvLinearSampling),
+	STEREO_OPTION(StereoRequireFmvEeUpload),
+	STEREO_OPTION(StereoRejectFmvEeUpload),
+	STEREO_OPTION(StereoRequireFmvDisplayMatch),
+	STEREO_OPTION(StereoRejectFmvDisplayMatch),
+	STEREO_OPTION(StereoRequireFmvRecentEeUpload),
+	STEREO_OPTION(StereoRejectFmvRecentEeUpload),
+	STEREO_OPTION(StereoRequireFmvRecentTransferDraw),
+	STEREO_OPTION(StereoRejectFmvRecentTransferDraw),
+	STEREO_OPTION(StereoRequireFeedbackLoopAny),
+	STEREO_OPTION(StereoRejectFeedbackLoopAny),
+	STEREO_OPTION(StereoRequireFeedbackLoopShader),
+	STEREO_OPTION(StereoRejectFeedbackLoopShader),
+	STEREO_OPTION(StereoRequireFeedbackLoopDrawUsesTarget),
+	STEREO_OPTION(StereoRejectFeedbackLoopDrawUsesTarget),
+	STEREO_OPTION(StereoRequireFeedbackLoopTexIsRt),
+	STEREO_OPTION(StereoRejectFeedbackLoopTexIsRt),
+	STEREO_OPTION(StereoRequireFeedbackLoopSourceFromTarget),
+	STEREO_OPTION(StereoRejectFeedbackLoopSourceFromTarget),
+	STEREO_OPTION(StereoRequireFeedbackLoopInTargetDraw),
+	STEREO_OPTION(StereoRejectFeedbackLoopInTargetDraw),
+	STEREO_OPTION(StereoRequireFeedbackLoopTempZ),
+	STEREO_OPTION(StereoRejectFeedbackLoopTempZ),
+	STEREO_OPTION(StereoRequireFeedbackLoopOverlapDrawRange),
+	STEREO_OPTION(StereoRejectFeedbackLoopOverlapDrawRange),
+	STEREO_OPTION(StereoFeedbackLoopDisableStereo),
+	STEREO_OPTION(StereoFeedbackLoopClampToDominantEye),
+	STEREO_OPTION(StereoFeedbackLoopSourceFromTargetOnly),
+	STEREO_OPTION(StereoSbsRemapEnable),
+	STEREO_OPTION(StereoSbsRemapDetectSourceFromTarget),
+	STEREO_OPTION(StereoSbsRemapDetectFeedbackLoop),
+	STEREO_OPTION(StereoSbsRemapDetectDisplayMatch),
+	STEREO_OPTION(StereoSbsRemapDetectFullscreenTexture),
+	STEREO_OPTION(StereoSbsRemapDetectSbsInput),
+	STEREO_OPTION(StereoSbsRemapDetectTabInput),
+	STEREO_OPTION(StereoSbsRemapRequireTextureMapping),
+	STEREO_OPTION(StereoSbsRemapRequireProcessTexture),
+	STEREO_OPTION(StereoSbsRemapMono),
+	STEREO_OPTION(StereoInstancedShaderScissor),
+	STEREO_OPTION(StereoInstancedShaderDrawArea),
+};
+#undef STEREO_OPTION
+
+void GSStereoDrawFilter::AllOf::Add(GSStereoFeature feature, bool expected)
+{
+	const u32 index = static_cast<u32>(feature);
+	const u64 bit = 1ULL << (index % 64);
+	u64& mask_bits = mask.bits[index / 64];
+	u64& value_bits = value.bits[index / 64];
+
+	// Requiring both states of the same feature can never match.
+	if ((mask_bits & bit) && ((value_bits & bit) != 0) != expected)
+		never = true;
+
+	mask_bits |= bit;
+	if (expected)
+		value_bits |= bit;
+}
+
+void GSStereoDrawFilter::AnyOf::Add(GSStereoFeature feature, bool expected)
+{
+	const u32 index = static_cast<u32>(feature);
+	const u64 bit = 1ULL << (index % 64);
+	u64& mask_bits = mask.bits[index / 64];
+	u64& invert_bits = invert.bits[index / 64];
+
+	// Accepting both states of the same feature always matches.
+	if ((mask_bits & bit) && ((invert_bits & bit) == 0) != expected)
+		always = true;
+
+	mask_bits |= bit;
+	if (!expected)
+		invert_bits |= bit;
+}
+
+std::vector<GSStereoDrawFilter::Rule> GSStereoDrawFilter::GetRules(const Pcsx2Config::GSOptions& config)
+{
+	std::vector<Rule> rules;
+	const auto add_rules = [&config, &rules](RuleGroup group, const auto& table) {
+		for (const StereoRule& rule : table)
+		{
+			if (config.*rule.option)
+				rules.push_back({group, rule.option, rule.feature, rule.expected});
+		}
+	};
+
+	const GSStereoFeature feedback_loop_any = config.StereoFeedbackLoopSourceFromTargetOnly ?
+	                                              GSStereoFeature::SourceFromTarget :
+	                                              GSStereoFeature::FeedbackLoopAnyRaw;
+
+	add_rules(RuleGroup::RuleChain, s_rule_chain);
+	if (config.StereoRejectSpriteNoGaps)
+	{
+		rules.push_back({RuleGroup::RuleChain, &Pcsx2Config::GSOptions::StereoRejectSpriteNoGaps,
+			config.StereoRejectRegionRect ? GSStereoFeature::SpriteNoGapsOrRegionRect : GSStereoFeature::SpriteNoGaps, true});
+	}
+	if (config.StereoRequireFeedbackLoopAny)
+		rules.push_back({RuleGroup::RuleChain, &Pcsx2Config::GSOptions::StereoRequireFeedbackLoopAny, feedback_loop_any, false});
+	if (config.StereoRejectFeedbackLoopAny)
+		rules.push_back({RuleGroup::RuleChain, &Pcsx2Config::GSOptions::StereoRejectFeedbackLoopAny, feedback_loop_any, true});
+	if (config.StereoFeedbackLoopDisableStereo)
+		rules.push_back({RuleGroup::ForceMono, &Pcsx2Config::GSOptions::StereoFeedbackLoopDisableStereo, feedback_loop_any, true});
+
+	add_rules(RuleGroup::DoubleImage, s_double_image_rules);
+
+	if (config.StereoMasterFix)
+	{
+		add_rules(RuleGroup::MasterFix, s_master_fix_rules);
+		if (config.StereoMasterFix9)
+		{
+			rules.push_back({RuleGroup::MasterFixOverride, &Pcsx2Config::GSOptions::StereoMasterFix9,
+				GSStereoFeature::MoviesFixOverride, true});
+		}
+	}
+
+	add_rules(RuleGroup::UiDetect, s_ui_detect_rules);
+	return rules;
+}
+
+void GSStereoDrawFilter::Compile(const Pcsx2Config::GSOptions& config)
+{
+	*this = GSStereoDrawFilter();
+
+	m_rule_chain_enabled = config.StereoMasterFixTest;
+	m_double_image_enabled = config.StereoEnableOptions;
+
+	for (const Rule& rule : GetRules(config))
+	{
+		switch (rule.group)
+		{
+			case RuleGroup::RuleChain:
+				m_rule_chain.Add(rule.feature, rule.expected);
+				break;
+			case RuleGroup::ForceMono:
+				m_force_mono.Add(rule.feature, rule.expected);
+				break;
+			case RuleGroup::DoubleImage:
+				m_double_image.Add(rule.feature, rule.expected);
+				break;
+			case RuleGroup::MasterFix:
+				m_master_fix.Add(rule.feature, rule.expected);
+				break;
+			case RuleGroup::MasterFixOverride:
+				m_master_fix_override.Add(rule.feature, rule.expected);
+				break;
+			case RuleGroup::UiDetect:
+				m_ui_detect.Add(rule.feature, rule.expected);
+				break;
+		}
+	}
+}
+
+void GSStereoFeatureWord::SetRegisters(const GIFRegPRIM& prim, const GIFRegTEST& test, const GIFRegFRAME& frame,
+	const GIFRegZBUF& zbuf, const GIFRegTEX0& tex0)
+{
+	Set(GSStereoFeature::PrimFst, prim.FST);
+	Set(GSStereoFeature::PrimTme, prim.TME);
+	Set(GSStereoFeature::PrimAbe, prim.ABE);
+	Set(GSStereoFeature::PrimFge, prim.FGE);
+	Set(GSStereoFeature::PrimAa1, prim.AA1);
+
+	Set(GSStereoFeature::AlphaTest, test.ATE);
+	Set(GSStereoFeature::AlphaTestAlways, test.ATE && test.ATST == ATST_ALWAYS);
+	Set(GSStereoFeature::AlphaTestNever, test.ATE && test.ATST == ATST_NEVER);
+	Set(GSStereoFeature::DestAlphaTest, test.DATE);
+	Set(GSStereoFeature::DestAlphaMode, test.DATM);
+	Set(GSStereoFeature::AfailZbOnly, test.AFAIL == AFAIL_ZB_ONLY);
+	Set(GSStereoFeature::AfailNotKeep, test.AFAIL != AFAIL_KEEP);
+	Set(GSStereoFeature::ZTest, test.ZTE);
+	Set(GSStereoFeature::ZMask, zbuf.ZMSK);
+	Set(GSStereoFeature::ZTestAlways, test.ZTST == ZTST_ALWAYS);
+	Set(GSStereoFeature::ZTestNever, test.ZTST == ZTST_NEVER);
+	Set(GSStereoFeature::ZTestGreater, test.ZTST == ZTST_GEQUAL || test.ZTST == ZTST_GREATER);
+	Set(GSStereoFeature::DepthActive, test.ZTE && !zbuf.ZMSK);
+	Set(GSStereoFeature::FbMask, frame.FBMSK != 0);
+	Set(GSStereoFeature::FbMaskFull, frame.FBMSK == 0x00FFFFFF);
+	Set(GSStereoFeature::TfxModulate, tex0.TFX == TFX_MODULATE);
+	Set(GSStereoFeature::TfxDecal, tex0.TFX == TFX_DECAL);
+	Set(GSStereoFeature::TfxHighlight, tex0.TFX == TFX_HIGHLIGHT);
+	Set(GSStereoFeature::TfxHighlight2, tex0.TFX == TFX_HIGHLIGHT2);
+}
+
+void GSStereoFeatureWord::SetDrawConfig(const GSHWDrawConfig& config)
+{
+	const GSHWDrawConfig::PSSelector& ps = config.ps;
+	Set(GSStereoFeature::PsRtaSourceCorrection, ps.rta_source_correction);
+	Set(GSStereoFeature::PsRtaCorrection, ps.rta_correction);
+	Set(GSStereoFeature::PsAdjs, ps.adjs);
+	Set(GSStereoFeature::PsAdjt, ps.adjt);
+	Set(GSStereoFeature::PsTfx, ps.tfx != 0);
+	Set(GSStereoFeature::PsBlendMix, ps.blend_mix != 0);
+	Set(GSStereoFeature::PsBlendA, ps.blend_a != 0);
+	Set(GSStereoFeature::PsBlendB, ps.blend_b != 0);
+	Set(GSStereoFeature::PsBlendC, ps.blend_c != 0);
+	Set(GSStereoFeature::PsBlendD, ps.blend_d != 0);
+	Set(GSStereoFeature::PsBlendHw, ps.blend_hw != 0);
+	Set(GSStereoFeature::PsIip, ps.iip);
+	Set(GSStereoFeature::PsAutomaticLod, ps.automatic_lod);
+	Set(GSStereoFeature::PsManualLod, ps.manual_lod);
+	Set(GSStereoFeature::PsNoColor, ps.no_color);
+	Set(GSStereoFeature::PsNoColor1, ps.no_color1);
+	Set(GSStereoFeature::PsWms, ps.wms != 0);
+	Set(GSStereoFeature::PsWmt, ps.wmt != 0);
+	Set(GSStereoFeature::PsLtf, ps.ltf);
+	Set(GSStereoFeature::PsShuffle, ps.shuffle);
+	Set(GSStereoFeature::PsShuffleSame, ps.shuffle_same);
+	Set(GSStereoFeature::PsShuffleAcross, ps.shuffle_across);
+	Set(GSStereoFeature::PsTcc, ps.tcc);
+	Set(GSStereoFeature::PsAem, ps.aem);
+	Set(GSStereoFeature::PsAemFmt, ps.aem_fmt != 0);
+	Set(GSStereoFeature::PsPalFmt, ps.pal_fmt != 0);
+	Set(GSStereoFeature::PsDstFmt, ps.dst_fmt != 0);
+	Set(GSStereoFeature::PsDepthFmt, ps.depth_fmt != 0);
+	Set(GSStereoFeature::PsProcessBa, ps.process_ba != 0);
+	Set(GSStereoFeature::PsProcessRg, ps.process_rg != 0);
+	Set(GSStereoFeature::PsColclipHw, ps.colclip_hw);
+	Set(GSStereoFeature::PsColclip, ps.colclip);
+	Set(GSStereoFeature::PsPabe, ps.pabe);
+	Set(GSStereoFeature::PsFbmask, ps.fbmask);
+	Set(GSStereoFeature::PsTexIsFb, ps.tex_is_fb);
+	Set(GSStereoFeature::PsFba, ps.fba);
+	Set(GSStereoFeature::PsFog, ps.fog);
+	Set(GSStereoFeature::PsDate, ps.date != 0);
+	Set(GSStereoFeature::PsAtst, ps.atst != 0);
+	Set(GSStereoFeature::PsAfail, ps.afail != 0);
+	Set(GSStereoFeature::PsFst, ps.fst);
+	Set(GSStereoFeature::PsReal16Src, ps.real16src);
+	Set(GSStereoFeature::PsWriteRg, ps.write_rg);
+	Set(GSStereoFeature::PsFixedOneA, ps.fixed_one_a);
+	Set(GSStereoFeature::PsAMasked, ps.a_masked);
+	Set(GSStereoFeature::PsRoundInv, ps.round_inv);
+	Set(GSStereoFeature::PsChannel, ps.channel != 0);
+	Set(GSStereoFeature::PsChannelFb, ps.channel_fb);
+	Set(GSStereoFeature::PsDither, ps.dither != 0);
+	Set(GSStereoFeature::PsDitherAdjust, ps.dither_adjust);
+	Set(GSStereoFeature::PsZClamp, ps.zclamp);
+	Set(GSStereoFeature::PsZFloor, ps.zfloor);
+	Set(GSStereoFeature::PsTCOffsetHack, ps.tcoffsethack);
+	Set(GSStereoFeature::PsUrbanChaosHle, ps.urban_chaos_hle);
+	Set(GSStereoFeature::PsTalesOfAbyssHle, ps.tales_of_abyss_hle);
+	Set(GSStereoFeature::PsPointSampler, ps.point_sampler);
+	Set(GSStereoFeature::PsRegionRect, ps.region_rect);
+	Set(GSStereoFeature::PsScanmask, ps.scanmsk != 0);
+	Set(GSStereoFeature::PsFeedbackLoop, ps.IsFeedbackLoop());
+
+	Set(GSStereoFeature::ColclipAny, ps.colclip || ps.colclip_hw);
+	Set(GSStereoFeature::NoColorOutput, ps.no_color || ps.no_color1);
+	Set(GSStereoFeature::HleShuffle, ps.urban_chaos_hle || ps.tales_of_abyss_hle);
+}
+
+GSStereoDrawFilter::Option GSStereoDrawFilter::FindOption(const std::string_view name)
+{
+	for (const auto& [option_name, option] : s_option_names)
+	{
+		if (name == option_name)
+			return option;
+	}
+
+	return nullptr;
+}
+
+const char* GSStereoDrawFilter::GetOptionName(Option option)
+{
+	for (const auto& [option_name, opt] : s_option_names)
+	{
+		if (opt == option)
+			return option_name;
+	}
+
+	return "";
+}
+
+const char* GSStereoDrawFilter::GetRuleGroupName(RuleGroup group)
+{
+	switch (group)
+	{
+		case RuleGroup::RuleChain:
+			return "RuleChain";
+		case RuleGroup::ForceMono:
+			return "ForceMono";
+		case RuleGroup::DoubleImage:
+			return "DoubleImage";
+		case RuleGroup::MasterFix:
+			return "MasterFix";
+		case RuleGroup::MasterFixOverride:
+			return "MasterFixOverride";
+		case RuleGroup::UiDetect:
+			return "UiDetect";
+		default:
+			return "";
+	}
+}
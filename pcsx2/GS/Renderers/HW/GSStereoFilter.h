@@ -0,0 +1,334 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "Config.h"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+struct GSHWDrawConfig;
+union GIFRegFRAME;
+union GIFRegPRIM;
+union GIFRegTEST;
+union GIFRegTEX0;
+union GIFRegZBUF;
+
+/// Per-draw properties tested by the stereo draw classification options.
+/// Each feature occupies a single bit of GSStereoFeatureWord.
+enum class GSStereoFeature : u8
+{
+	// Primitive and vertex trace.
+	PrimFst,
+	PrimTme,
+	PrimAbe,
+	PrimFge,
+	PrimAa1,
+	PrimPoint,
+	PrimLine,
+	PrimTriangle,
+	PrimSprite,
+	SingleSprite,
+	ZEqual,
+	QEqual,
+	STEqual,
+	RGBAEqualAny,
+	PerspectiveUV,
+	StencilShadow,
+
+	// Context registers.
+	AlphaTest,
+	AlphaTestAlways,
+	AlphaTestNever,
+	DestAlphaTest,
+	DestAlphaMode,
+	AfailZbOnly,
+	AfailNotKeep,
+	ZTest,
+	ZMask,
+	ZTestAlways,
+	ZTestNever,
+	ZTestGreater,
+	ZTestAlwaysZEqual,
+	DepthActive,
+	FbMask,
+	FbMaskFull,
+	TfxModulate,
+	TfxDecal,
+	TfxHighlight,
+	TfxHighlight2,
+	DecalNoRegionRect,
+
+	// Pixel shader selector.
+	PsRtaSourceCorrection,
+	PsRtaCorrection,
+	PsAdjs,
+	PsAdjt,
+	PsTfx,
+	PsBlendMix,
+	PsBlendA,
+	PsBlendB,
+	PsBlendC,
+	PsBlendD,
+	PsBlendHw,
+	PsIip,
+	PsAutomaticLod,
+	PsManualLod,
+	PsNoColor,
+	PsNoColor1,
+	PsWms,
+	PsWmt,
+	PsLtf,
+	PsShuffle,
+	PsShuffleSame,
+	PsShuffleAcross,
+	PsTcc,
+	PsAem,
+	PsAemFmt,
+	PsPalFmt,
+	PsDstFmt,
+	PsDepthFmt,
+	PsProcessBa,
+	PsProcessRg,
+	PsColclipHw,
+	PsColclip,
+	PsPabe,
+	PsFbmask,
+	PsTexIsFb,
+	PsFba,
+	PsFog,
+	PsDate,
+	PsAtst,
+	PsAfail,
+	PsFst,
+	PsReal16Src,
+	PsWriteRg,
+	PsFixedOneA,
+	PsAMasked,
+	PsRoundInv,
+	PsChannel,
+	PsChannelFb,
+	PsDither,
+	PsDitherAdjust,
+	PsZClamp,
+	PsZFloor,
+	PsTCOffsetHack,
+	PsUrbanChaosHle,
+	PsTalesOfAbyssHle,
+	PsPointSampler,
+	PsRegionRect,
+	PsScanmask,
+	PsFeedbackLoop,
+	ColclipAny,
+	NoColorOutput,
+	HleShuffle,
+
+	// Renderer and texture cache state.
+	TextureShuffle,
+	ChannelShuffle,
+	FullScreenShuffle,
+	NoShuffle,
+	ProcessTexture,
+	SourceFromTarget,
+	TexIsRt,
+	DrawUsesTarget,
+	InTargetDraw,
+	TempZ,
+	OneBarrier,
+	FullBarrier,
+	SinglePass,
+	RtOutput,
+	DepthOutput,
+	DepthRead,
+	DepthWrite,
+	PalettedTexture,
+	DepthTexture,
+	Mipmap,
+	LinearSampling,
+	FeedbackLoopAnyRaw,
+
+	// Draw geometry.
+	FullscreenDraw,
+	FullscreenDrawArea,
+	FullscreenScissor,
+	FullscreenSprite,
+	FullCover,
+	SpriteNoGaps,
+	SpriteNoGapsOrRegionRect,
+	SmallDrawArea,
+	WideDrawBand,
+	TopDrawBand,
+	NonPositiveZ,
+	SmallZRange,
+	ScalingDraw,
+	SbsInput,
+	TabInput,
+	SpriteBlit,
+	ConstantColor,
+	TexturedSprite,
+	RtSpriteNoDepth,
+	RtSpriteAlphaBlend,
+
+	// FMV detection.
+	FmvActive,
+	FmvHeuristic,
+	FmvDrawMatchesTex,
+	FmvEeUpload,
+	FmvDisplayMatch,
+	FmvRecentTransferDraw,
+
+	// UI detection.
+	UiSafeDetect,
+	UiAdvancedDetect,
+	UiLike,
+	UiBackgroundDepth,
+
+	// Master fixes.
+	MasterFix1,
+	MasterFix2,
+	MasterFix3,
+	MasterFix4,
+	MasterFix5,
+	MasterFix6,
+	MoviesFixOverride,
+
+	Count
+};
+
+/// Packed feature bits for a single draw.
+struct GSStereoFeatureWord
+{
+	static constexpr u32 NUM_WORDS = (static_cast<u32>(GSStereoFeature::Count) + 63) / 64;
+
+	std::array<u64, NUM_WORDS> bits = {};
+
+	__fi void Set(GSStereoFeature feature, bool value)
+	{
+		const u32 index = static_cast<u32>(feature);
+		bits[index / 64] |= static_cast<u64>(value) << (index % 64);
+	}
+
+	__fi bool Get(GSStereoFeature feature) const
+	{
+		const u32 index = static_cast<u32>(feature);
+		return ((bits[index / 64] >> (index % 64)) & 1) != 0;
+	}
+
+	/// Sets the Prim* and context register features which only depend on the draw's registers.
+	void SetRegisters(const GIFRegPRIM& prim, const GIFRegTEST& test, const GIFRegFRAME& frame,
+		const GIFRegZBUF& zbuf, const GIFRegTEX0& tex0);
+
+	/// Sets the Ps* features, and the ones derived from them, from the selected pixel shader.
+	void SetDrawConfig(const GSHWDrawConfig& config);
+};
+
+/// The stereo Require/Reject options, compiled into masks over GSStereoFeatureWord.
+/// Compile() is called whenever the GS settings change, so the per-draw decision
+/// is a handful of AND/compare operations instead of a walk over every option.
+class GSStereoDrawFilter
+{
+public:
+	/// Pointer to one of the boolean Stereo* members of GSOptions.
+	using Option = bool Pcsx2Config::GSOptions::*;
+
+	/// Which of the compiled tests a rule contributes to.
+	enum class RuleGroup : u8
+	{
+		RuleChain,
+		ForceMono,
+		DoubleImage,
+		MasterFix,
+		MasterFixOverride,
+		UiDetect,
+	};
+
+	/// A single enabled option and the feature state it tests for.
+	struct Rule
+	{
+		RuleGroup group;
+		Option option;
+		GSStereoFeature feature;
+		bool expected;
+	};
+
+	/// Looks up a boolean stereo option by its settings key, e.g. "StereoMasterFixTest".
+	/// Returns nullptr if the name does not refer to a boolean stereo option.
+	static Option FindOption(const std::string_view name);
+
+	/// Returns the settings key for a boolean stereo option.
+	static const char* GetOptionName(Option option);
+
+	static const char* GetRuleGroupName(RuleGroup group);
+
+	/// Lists the rules enabled by config, which is what Compile() builds its masks from.
+	static std::vector<Rule> GetRules(const Pcsx2Config::GSOptions& config);
+
+	void Compile(const Pcsx2Config::GSOptions& config);
+
+	/// Returns true when the StereoMasterFixTest rule chain wants the draw rendered mono.
+	__fi bool DisableStereoPass(const GSStereoFeatureWord& features) const
+	{
+		if (!m_rule_chain_enabled)
+			return false;
+
+		const bool disable = m_rule_chain.Matches(features) || m_force_mono.Matches(features);
+		return disable && (!m_double_image_enabled || m_double_image.Matches(features));
+	}
+
+	/// Returns true when one of the enabled StereoMasterFix1-6 heuristics matched.
+	__fi bool MasterFixEnabled(const GSStereoFeatureWord& features) const { return m_master_fix.Matches(features); }
+
+	/// Returns true when StereoMasterFix9 forces stereo on for an FMV draw.
+	__fi bool MasterFixOverride(const GSStereoFeatureWord& features) const { return m_master_fix_override.Matches(features); }
+
+	/// Returns true when the draw should be pushed to UI depth.
+	__fi bool UiDetect(const GSStereoFeatureWord& features) const { return m_ui_detect.Matches(features); }
+
+private:
+	/// Matches when every masked feature has its expected value.
+	struct AllOf
+	{
+		GSStereoFeatureWord mask;
+		GSStereoFeatureWord value;
+		bool never = false;
+
+		void Add(GSStereoFeature feature, bool expected);
+
+		__fi bool Matches(const GSStereoFeatureWord& features) const
+		{
+			u64 diff = 0;
+			for (u32 i = 0; i < GSStereoFeatureWord::NUM_WORDS; i++)
+				diff |= (features.bits[i] & mask.bits[i]) ^ value.bits[i];
+			return !never && diff == 0;
+		}
+	};
+
+	/// Matches when at least one masked feature has its expected value.
+	struct AnyOf
+	{
+		GSStereoFeatureWord mask;
+		GSStereoFeatureWord invert;
+		bool always = false;
+
+		void Add(GSStereoFeature feature, bool expected);
+
+		__fi bool Matches(const GSStereoFeatureWord& features) const
+		{
+			u64 hit = 0;
+			for (u32 i = 0; i < GSStereoFeatureWord::NUM_WORDS; i++)
+				hit |= (features.bits[i] ^ invert.bits[i]) & mask.bits[i];
+			return always || hit != 0;
+		}
+	};
+
+	AllOf m_rule_chain;
+	AnyOf m_force_mono;
+	AnyOf m_double_image;
+	AnyOf m_master_fix;
+	AnyOf m_master_fix_override;
+	AnyOf m_ui_detect;
+	bool m_rule_chain_enabled = false;
+	bool m_double_image_enabled = false;
+};
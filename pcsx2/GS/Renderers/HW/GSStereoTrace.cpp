@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "GS/Renderers/HW/GSStereoTrace.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+
+#include "fmt/format.h"
+
+#include <cerrno>
+#include <cstring>
+
+namespace
+{
+	struct TraceHeader
+	{
+		u32 magic;
+		u32 version;
+		u32 feature_count;
+		u32 record_size;
+	};
+} // namespace
+
+static constexpr u32 TRACE_MAGIC = 0x52545350; // PSTR
+static constexpr u32 TRACE_VERSION = 2;
+static constexpr u32 WRITE_BUFFER_RECORDS = 4096;
+
+static TraceHeader GetExpectedHeader()
+{
+	return {TRACE_MAGIC, TRACE_VERSION, static_cast<u32>(GSStereoFeature::Count), sizeof(GSStereoTrace::Record)};
+}
+
+u32 GSStereoTrace::Evaluate(const GSStereoDrawFilter& filter, const Record& record)
+{
+	// Same as GSRendererHW::DrawPrims(), with the renderer's own inputs taken from the record.
+	const bool renderer_mono = (record.decisions & DecisionRendererMono) != 0;
+	const bool disable_stereo_pass = filter.DisableStereoPass(record.features);
+	const bool master_fix = filter.MasterFixEnabled(record.features);
+	const bool master_fix_override = filter.MasterFixOverride(record.features);
+	const bool stereo = (!master_fix && !renderer_mono && !disable_stereo_pass) || master_fix_override;
+
+	u32 decisions = 0;
+	decisions |= stereo ? DecisionStereo : 0;
+	decisions |= disable_stereo_pass ? DecisionDisableStereoPass : 0;
+	decisions |= master_fix ? DecisionMasterFix : 0;
+	decisions |= master_fix_override ? DecisionMasterFixOverride : 0;
+	decisions |= (stereo && filter.UiDetect(record.features)) ? DecisionUiDetect : 0;
+	decisions |= renderer_mono ? DecisionRendererMono : 0;
+	return decisions;
+}
+
+const char* GSStereoTrace::GetDecisionName(u32 bit)
+{
+	switch (bit)
+	{
+		case DecisionStereo:
+			return "Stereo";
+		case DecisionDisableStereoPass:
+			return "DisableStereoPass";
+		case DecisionMasterFix:
+			return "MasterFix";
+		case DecisionMasterFixOverride:
+			return "MasterFixOverride";
+		case DecisionUiDetect:
+			return "UiDetect";
+		case DecisionRendererMono:
+			return "RendererMono";
+		default:
+			return "";
+	}
+}
+
+bool GSStereoTrace::ReadFile(const char* path, std::vector<Record>* records, Error* error)
+{
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(path, "rb", error);
+	if (!fp)
+		return false;
+
+	TraceHeader header;
+	const TraceHeader expected = GetExpectedHeader();
+	if (std::fread(&header, sizeof(header), 1, fp.get()) != 1 || header.magic != TRACE_MAGIC)
+	{
+		Error::SetStringView(error, "File is not a stereo trace.");
+		return false;
+	}
+	if (std::memcmp(&header, &expected, sizeof(header)) != 0)
+	{
+		Error::SetString(error, fmt::format("Trace was written with version {} and {} features, expected version {} and {}.",
+									header.version, header.feature_count, expected.version, expected.feature_count));
+		return false;
+	}
+
+	const s64 size = FileSystem::FSize64(fp.get());
+	if (size < static_cast<s64>(sizeof(header)))
+	{
+		Error::SetStringView(error, "Failed to get trace size.");
+		return false;
+	}
+
+	const size_t count = static_cast<size_t>(size - sizeof(header)) / sizeof(Record);
+	records->resize(count);
+	if (count > 0 && std::fread(records->data(), sizeof(Record), count, fp.get()) != count)
+	{
+		Error::SetErrno(error, "fread() failed: ", errno);
+		records->clear();
+		return false;
+	}
+
+	return true;
+}
+
+GSStereoTrace::Writer::Writer() = default;
+
+GSStereoTrace::Writer::~Writer()
+{
+	Close();
+}
+
+bool GSStereoTrace::Writer::Open(const std::string& path, Error* error)
+{
+	Close();
+
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	const TraceHeader header = GetExpectedHeader();
+	if (std::fwrite(&header, sizeof(header), 1, fp.get()) != 1)
+	{
+		Error::SetErrno(error, "fwrite() failed: ", errno);
+		return false;
+	}
+
+	m_fp = std::move(fp);
+	m_buffer.reserve(WRITE_BUFFER_RECORDS);
+	return true;
+}
+
+void GSStereoTrace::Writer::Close()
+{
+	if (!m_fp)
+		return;
+
+	Flush();
+	m_fp.reset();
+	m_buffer = {};
+}
+
+void GSStereoTrace::Writer::Write(const Record& record)
+{
+	m_buffer.push_back(record);
+	if (m_buffer.size() == WRITE_BUFFER_RECORDS)
+		Flush();
+}
+
+void GSStereoTrace::Writer::Flush()
+{
+	if (!m_buffer.empty() && std::fwrite(m_buffer.data(), sizeof(Record), m_buffer.size(), m_fp.get()) != m_buffer.size())
+	{
+		Console.Error("GS: Failed to write stereo trace, closing it.");
+		m_fp.reset();
+	}
+
+	m_buffer.clear();
+}
+
+GSStereoTrace::Summary GSStereoTrace::Summarize(const std::vector<Record>& records, const Pcsx2Config::GSOptions& config)
+{
+	GSStereoDrawFilter filter;
+	filter.Compile(config);
+
+	Summary summary;
+	for (const GSStereoDrawFilter::Rule& rule : GSStereoDrawFilter::GetRules(config))
+		summary.rules.push_back({rule, 0});
+
+	for (const Record& record : records)
+	{
+		for (u32 i = 0; i < NUM_DECISIONS; i++)
+			summary.decisions[i] += (record.decisions >> i) & 1;
+
+		for (RuleHits& rh : summary.rules)
+			rh.hits += (record.features.Get(rh.rule.feature) == rh.rule.expected);
+	}
+
+	summary.draws = records.size();
+	return summary;
+}
+
+std::vector<GSStereoTrace::DiffEntry> GSStereoTrace::Diff(const std::vector<Record>& records,
+	const Pcsx2Config::GSOptions& config_a, const Pcsx2Config::GSOptions& config_b)
+{
+	GSStereoDrawFilter filter_a, filter_b;
+	filter_a.Compile(config_a);
+	filter_b.Compile(config_b);
+
+	std::vector<DiffEntry> diff;
+	for (const Record& record : records)
+	{
+		const u32 decisions_a = Evaluate(filter_a, record);
+		const u32 decisions_b = Evaluate(filter_b, record);
+		if (decisions_a != decisions_b)
+			diff.push_back({record.draw, record.frame, decisions_a, decisions_b});
+	}
+
+	return diff;
+}
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "GS/Renderers/HW/GSStereoFilter.h"
+
+#include "common/FileSystem.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+class Error;
+
+/// Compact binary log of the stereo decision made for each HW draw, so the stereo
+/// rules can be re-evaluated offline against any configuration.
+namespace GSStereoTrace
+{
+	/// Bits of Record::decisions.
+	enum Decision : u32
+	{
+		DecisionStereo = (1u << 0),
+		DecisionDisableStereoPass = (1u << 1),
+		DecisionMasterFix = (1u << 2),
+		DecisionMasterFixOverride = (1u << 3),
+		DecisionUiDetect = (1u << 4),
+
+		// The renderer kept the draw mono for a reason the rules don't cover, such as it not being
+		// the display target. A master fix override still wins over it.
+		DecisionRendererMono = (1u << 5),
+		NUM_DECISIONS = 6,
+	};
+
+	struct Record
+	{
+		u32 draw;
+		u32 frame;
+		u32 decisions;
+		u32 pad;
+		GSStereoFeatureWord features;
+	};
+
+	/// Re-evaluates a traced draw with another filter. DecisionRendererMono is carried over from the
+	/// record, so with the filter the trace was written with this gives back the recorded decisions.
+	u32 Evaluate(const GSStereoDrawFilter& filter, const Record& record);
+
+	const char* GetDecisionName(u32 bit);
+
+	/// Reads a trace written by Writer. Fails if it was written with a different feature layout.
+	bool ReadFile(const char* path, std::vector<Record>* records, Error* error);
+
+	class Writer
+	{
+	public:
+		Writer();
+		~Writer();
+
+		__fi bool IsOpen() const { return static_cast<bool>(m_fp); }
+
+		bool Open(const std::string& path, Error* error);
+		void Close();
+
+		void Write(const Record& record);
+
+	private:
+		void Flush();
+
+		FileSystem::ManagedCFilePtr m_fp;
+		std::vector<Record> m_buffer;
+	};
+
+	struct RuleHits
+	{
+		GSStereoDrawFilter::Rule rule;
+		u64 hits;
+	};
+
+	struct Summary
+	{
+		u64 draws = 0;
+		std::array<u64, NUM_DECISIONS> decisions = {};
+
+		/// Number of draws in which each enabled rule saw its feature in the expected state.
+		std::vector<RuleHits> rules;
+	};
+
+	Summary Summarize(const std::vector<Record>& records, const Pcsx2Config::GSOptions& config);
+
+	struct DiffEntry
+	{
+		u32 draw;
+		u32 frame;
+		u32 decisions_a;
+		u32 decisions_b;
+	};
+
+	/// Returns the draws whose decisions differ between the two configurations.
+	std::vector<DiffEntry> Diff(const std::vector<Record>& records, const Pcsx2Config::GSOptions& config_a,
+		const Pcsx2Config::GSOptions& config_b);
+} // namespace GSStereoTrace
@@ -7,7 +7,9 @@
 #include "GS/Renderers/SW/GSRasterizer.h"
 
 #include "common/Console.h"
+#include "common/Threading.h"
 
+#include <algorithm>
 #include <fstream>
 
 // Comment to disable all dynamic code generation.
@@ -30,14 +32,85 @@ GSDrawScanline::GSDrawScanline()
 	, m_ds_map("GSDrawScanline")
 {
 	GSCodeReserve::ResetMemory();
+
+#ifdef ENABLE_JIT_RASTERIZER
+	if (GSCodeCache::IsShared())
+	{
+		m_cache_keys = GSCodeCache::GetSharedKeys();
+		if (!m_cache_keys.setup_prim.empty() || !m_cache_keys.draw_scanline.empty())
+			m_precompile_thread = std::thread(&GSDrawScanline::PrecompileThread, this);
+	}
+	else if (!GSConfig.DisableShaderCache)
+	{
+		m_cache_path = GSCodeCache::GetPath();
+		if (!m_cache_path.empty() && GSCodeCache::Load(m_cache_path, &m_cache_keys))
+			m_precompile_thread = std::thread(&GSDrawScanline::PrecompileThread, this);
+	}
+#endif
 }
 
 GSDrawScanline::~GSDrawScanline()
 {
+	StopPrecompile();
+	SaveCodeCache();
+
 	if (const size_t used = GSCodeReserve::GetMemoryUsed(); used > 0)
 		DevCon.WriteLn("SW JIT generated %zu bytes of code", used);
 }
 
+void GSDrawScanline::PrecompileThread()
+{
+	Threading::SetNameOfCurrentThread("GS-SW-JIT");
+
+	// setup functions are few and shared by many scanline functions, so they go first
+
+	size_t count = 0;
+
+	for (const u64 key : m_cache_keys.setup_prim)
+	{
+		if (m_precompile_cancel.load(std::memory_order_relaxed) || !m_sp_map.Precompile(key))
+			return;
+
+		count++;
+	}
+
+	for (const u64 key : m_cache_keys.draw_scanline)
+	{
+		if (m_precompile_cancel.load(std::memory_order_relaxed) || !m_ds_map.Precompile(key))
+			return;
+
+		count++;
+	}
+
+	DevCon.WriteLn("SW JIT precompiled %zu functions", count);
+}
+
+void GSDrawScanline::StopPrecompile()
+{
+	if (!m_precompile_thread.joinable())
+		return;
+
+	m_precompile_cancel.store(true, std::memory_order_relaxed);
+	m_precompile_thread.join();
+}
+
+void GSDrawScanline::SaveCodeCache()
+{
+	if (m_cache_path.empty() && !GSCodeCache::IsShared())
+		return;
+
+	// keep the selectors from earlier sessions, a game rarely uses all of them in one sitting,
+	// but let the ones that haven't been used for a while fall off the end
+
+	const bool sp_changed = GSCodeCache::Merge(m_cache_keys.setup_prim, m_sp_map.GetActiveKeys(), GSCodeCache::MAX_SETUP_PRIM_KEYS);
+	const bool ds_changed = GSCodeCache::Merge(m_cache_keys.draw_scanline, m_ds_map.GetActiveKeys(), GSCodeCache::MAX_DRAW_SCANLINE_KEYS);
+
+	if (GSCodeCache::IsShared())
+		GSCodeCache::GetSharedKeys() = std::move(m_cache_keys);
+	else if (sp_changed || ds_changed)
+		GSCodeCache::Save(m_cache_path, m_cache_keys);
+}
+
 bool GSDrawScanline::ShouldUseCDrawScanline(u64 key)
 {
 	static std::map<u64, bool> s_use_c_draw_scanline;
@@ -115,6 +188,9 @@ void GSDrawScanline::BeginDraw(const GSRasterizerData& data, GSScanlineLocalData
 void GSDrawScanline::ResetCodeCache()
 {
 	Console.Warning("GS Software JIT cache overflow, resetting.");
+	StopPrecompile();
+
+	std::lock_guard<std::mutex> lock(GSCodeReserve::GetMutex());
 	m_sp_map.Clear();
 	m_ds_map.Clear();
 	GSCodeReserve::ResetMemory();
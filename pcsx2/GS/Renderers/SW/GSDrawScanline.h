@@ -5,6 +5,9 @@
 
 #include "GS/GSState.h"
 
+#include <atomic>
+#include <thread>
+
 #ifdef _M_X86
 #include "GS/Renderers/SW/GSSetupPrimCodeGenerator.all.h"
 #include "GS/Renderers/SW/GSDrawScanlineCodeGenerator.all.h"
@@ -55,6 +58,17 @@ private:
 	GSCodeGeneratorFunctionMap<GSSetupPrimCodeGenerator, u64, SetupPrimPtr> m_sp_map;
 	GSCodeGeneratorFunctionMap<GSDrawScanlineCodeGenerator, u64, DrawScanlinePtr> m_ds_map;
 
+	/// Selectors recorded for this game by earlier sessions, or by earlier renderers when the cache
+	/// is shared, compiled on m_precompile_thread.
+	std::string m_cache_path;
+	GSCodeCache::Keys m_cache_keys;
+	std::thread m_precompile_thread;
+	std::atomic<bool> m_precompile_cancel{false};
+
+	void PrecompileThread();
+	void StopPrecompile();
+	void SaveCodeCache();
+
 	static void CSetupPrim(const GSVertexSW* vertex, const u16* index, const GSVertexSW& dscan, GSScanlineLocalData& local);
 	static void CDrawScanline(int pixels, int left, int top, const GSVertexSW& scan, GSScanlineLocalData& local);
 	static void CDrawEdge(int pixels, int left, int top, const GSVertexSW& scan, GSScanlineLocalData& local);
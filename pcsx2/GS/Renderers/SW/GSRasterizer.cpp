@@ -125,7 +125,16 @@ int GSRasterizer::GetPixels(bool reset)
 
 void GSRasterizer::Draw(GSRasterizerData& data)
 {
-	if ((data.vertex && data.vertex_count == 0) || (data.index && data.index_count == 0))
+	Draw(data, data.scissor, data.index, data.index_count);
+}
+
+void GSRasterizer::Draw(GSRasterizerData& data, const GSVector4i& clip, const u16* index, int index_count)
+{
+	if ((data.vertex && data.vertex_count == 0) || (index && index_count == 0))
+		return;
+
+	const GSVector4i scissor = data.scissor.rintersect(clip);
+	if (scissor.rempty())
 		return;
 
 	m_pixels.actual = 0;
@@ -143,17 +152,25 @@ void GSRasterizer::Draw(GSRasterizerData& data)
 	const GSVertexSW* vertex = data.vertex;
 	const GSVertexSW* vertex_end = data.vertex + data.vertex_count;
 
-	const u16* index = data.index;
-	const u16* index_end = data.index + data.index_count;
+	const u16* index_end = index + index_count;
 
 	static constexpr u16 tmp_index[] = {0, 1, 2};
 
-	bool scissor_test = !data.bbox.eq(data.bbox.rintersect(data.scissor));
+	bool scissor_test = !data.bbox.eq(data.bbox.rintersect(scissor));
 
-	m_scissor = data.scissor;
-	m_fscissor_x = GSVector4(data.scissor).xzxz();
-	m_fscissor_y = GSVector4(data.scissor).ywyw();
+	m_scissor = scissor;
+	m_fscissor_x = GSVector4(scissor).xzxz();
+	m_fscissor_y = GSVector4(scissor).ywyw();
 	m_scanmsk_value = data.scanmsk_value;
+	m_draw_scissor = scissor;
+
+	m_stereo = (data.stereo_vm != nullptr);
+	if (m_stereo)
+	{
+		m_stereo_global = data.global;
+		m_stereo_global.vm = data.stereo_vm;
+		m_stereo_params = data.stereo_params;
+	}
 
 	switch (data.primclass)
 	{
@@ -161,11 +178,11 @@ void GSRasterizer::Draw(GSRasterizerData& data)
 
 			if (scissor_test)
 			{
-				DrawPoint<true>(vertex, data.vertex_count, index, data.index_count);
+				DrawPoint<true>(vertex, data.vertex_count, index, index_count);
 			}
 			else
 			{
-				DrawPoint<false>(vertex, data.vertex_count, index, data.index_count);
+				DrawPoint<false>(vertex, data.vertex_count, index, index_count);
 			}
 
 			break;
@@ -260,6 +277,12 @@ void GSRasterizer::DrawPoint(const GSVertexSW* vertex, int vertex_count, const u
 		{
 			const GSVertexSW& v = vertex[*index];
 
+			if (m_stereo)
+			{
+				DrawStereoPoint(vertex, index, v);
+				continue;
+			}
+
 			GSVector4i p(v.p + GSVector4(0.5f));
 
 			if (!scissor_test || (m_scissor.left <= p.x && p.x < m_scissor.right && m_scissor.top <= p.y && p.y < m_scissor.bottom))
@@ -281,6 +304,12 @@ void GSRasterizer::DrawPoint(const GSVertexSW* vertex, int vertex_count, const u
 		{
 			const GSVertexSW& v = vertex[0];
 
+			if (m_stereo)
+			{
+				DrawStereoPoint(vertex, tmp_index, v);
+				continue;
+			}
+
 			GSVector4i p(v.p + GSVector4(0.5f));
 
 			if (!scissor_test || (m_scissor.left <= p.x && p.x < m_scissor.right && m_scissor.top <= p.y && p.y < m_scissor.bottom))
@@ -296,6 +325,55 @@ void GSRasterizer::DrawPoint(const GSVertexSW* vertex, int vertex_count, const u
 	}
 }
 
+void GSRasterizer::SetStereoOffset(double z)
+{
+	// Same offset as the HW vertex shader, but taken once per primitive and snapped to whole pixels,
+	// so both eyes can replay the spans and gradients of a single setup.
+	const float depth = std::min(20.0f, static_cast<float>(z) * m_stereo_params.z + m_stereo_params.w);
+
+	m_stereo_dx[0] = static_cast<int>(std::lround(m_stereo_params.x * depth));
+	m_stereo_dx[1] = static_cast<int>(std::lround(m_stereo_params.y * depth));
+
+	const int dx_min = std::min(m_stereo_dx[0], m_stereo_dx[1]);
+	const int dx_max = std::max(m_stereo_dx[0], m_stereo_dx[1]);
+
+	m_scissor = m_draw_scissor - GSVector4i(dx_max, 0, dx_min, 0);
+	m_fscissor_x = GSVector4(m_scissor).xzxz();
+}
+
+void GSRasterizer::DrawStereoPoint(const GSVertexSW* vertex, const u16* index, const GSVertexSW& v)
+{
+	const GSVector4i p(v.p + GSVector4(0.5f));
+
+	if (p.y < m_draw_scissor.top || p.y >= m_draw_scissor.bottom || !IsOneOfMyScanlines(p.y))
+		return;
+
+	SetStereoOffset(v.p.F64[1]);
+
+	const GSScanlineGlobalData* global = m_local.gd;
+	bool setup = true;
+
+	for (int eye = 0; eye < 2; eye++)
+	{
+		const int x = p.x + m_stereo_dx[eye];
+
+		if (m_draw_scissor.left <= x && x < m_draw_scissor.right)
+		{
+			if (setup)
+			{
+				m_setup_prim(vertex, index, GSVertexSW::zero(), m_local);
+				setup = false;
+			}
+
+			m_local.gd = eye ? &m_stereo_global : global;
+
+			DrawScanline(1, x, p.y, v);
+		}
+	}
+
+	m_local.gd = global;
+}
+
 // Note: this should only be used for the edge drawing functions.
 __forceinline static GSVertexSW ClampVertex(GSVertexSW v, int zpsm)
 {
@@ -655,6 +733,9 @@ void GSRasterizer::DrawLine(const GSVertexSW* vertex, const u16* index)
 
 	GSVertexSW dv = v1 - v0;
 
+	if (m_stereo)
+		SetStereoOffset((v0.p.F64[1] + v1.p.F64[1]) * 0.5);
+
 	DrawEdgeLine(v0, v1, dv, HasEdge());
 
 	Flush(vertex, index, GSVertexSW::zero(), HasEdge());
@@ -680,6 +761,9 @@ void GSRasterizer::DrawTriangle(const GSVertexSW* vertex, const u16* index)
 {
 	m_primcount++;
 
+	if (m_stereo)
+		SetStereoOffset((vertex[index[0]].p.F64[1] + vertex[index[1]].p.F64[1] + vertex[index[2]].p.F64[1]) * (1.0 / 3.0));
+
 	GSVertexSW2 edge;
 	GSVertexSW2 dedge;
 	GSVertexSW2 dscan;
@@ -884,6 +968,9 @@ void GSRasterizer::DrawTriangle(const GSVertexSW* vertex, const u16* index)
 {
 	m_primcount++;
 
+	if (m_stereo)
+		SetStereoOffset((vertex[index[0]].p.F64[1] + vertex[index[1]].p.F64[1] + vertex[index[2]].p.F64[1]) * (1.0 / 3.0));
+
 	GSVertexSW edge;
 	GSVertexSW dedge;
 	GSVertexSW dscan;
@@ -1099,12 +1186,37 @@ void GSRasterizer::DrawSprite(const GSVertexSW* vertex, const u16* index)
 	v[1].p = v0.p.blend32(v1.p, mask);
 	v[1].t = v0.t.blend32(v1.t, mask);
 
+	if (!m_stereo)
+	{
+		DrawSpriteEye(vertex, index, v, 0, true);
+		return;
+	}
+
+	SetStereoOffset(static_cast<double>(v[0].t.U32[3]));
+
+	const GSScanlineGlobalData* global = m_local.gd;
+	bool setup = true;
+
+	for (int eye = 0; eye < 2; eye++)
+	{
+		m_local.gd = eye ? &m_stereo_global : global;
+
+		if (DrawSpriteEye(vertex, index, v, m_stereo_dx[eye], setup))
+			setup = false;
+	}
+
+	m_local.gd = global;
+}
+
+// Returns true if the primitive was set up, so the other eye can reuse it.
+bool GSRasterizer::DrawSpriteEye(const GSVertexSW* vertex, const u16* index, const GSVertexSW* v, int dx, bool setup)
+{
 	GSVector4i r(v[0].p.xyxy(v[1].p).ceil());
 
-	r = r.rintersect(m_scissor);
+	r = (r + GSVector4i(dx, 0, dx, 0)).rintersect(m_draw_scissor);
 
 	if (r.rempty())
-		return;
+		return false;
 
 	GSVertexSW scan = v[0];
 
@@ -1140,7 +1252,7 @@ void GSRasterizer::DrawSprite(const GSVertexSW* vertex, const u16* index)
 			}
 		}
 
-		return;
+		return false;
 	}
 
 	GSVector4 dxy = v[1].p - v[0].p;
@@ -1154,11 +1266,12 @@ void GSRasterizer::DrawSprite(const GSVertexSW* vertex, const u16* index)
 	dedge.t = GSVector4::zero().insert32<1, 1>(dt);
 	dscan.t = GSVector4::zero().insert32<0, 0>(dt);
 
-	GSVector4 prestep = GSVector4(r.left, r.top) - scan.p;
+	GSVector4 prestep = GSVector4(r.left - dx, r.top) - scan.p;
 
 	scan.t = (scan.t + dt * prestep).xyzw(scan.t);
 
-	m_setup_prim(vertex, index, dscan, m_local);
+	if (setup)
+		m_setup_prim(vertex, index, dscan, m_local);
 
 	while (1)
 	{
@@ -1172,6 +1285,8 @@ void GSRasterizer::DrawSprite(const GSVertexSW* vertex, const u16* index)
 
 		scan.t += dedge.t;
 	}
+
+	return true;
 }
 
 void GSRasterizer::DrawEdge(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& dv, int orientation, int side)
@@ -1389,6 +1504,13 @@ void GSRasterizer::Flush(const GSVertexSW* vertex, const u16* index, const GSVer
 	{
 		m_setup_prim(vertex, index, dscan, m_local);
 
+		if (m_stereo)
+		{
+			FlushStereo(dscan, edge);
+			m_edge.count = 0;
+			return;
+		}
+
 		const GSVertexSW* RESTRICT e = m_edge.buff;
 		const GSVertexSW* RESTRICT ee = e + count;
 
@@ -1419,6 +1541,50 @@ void GSRasterizer::Flush(const GSVertexSW* vertex, const u16* index, const GSVer
 	}
 }
 
+void GSRasterizer::FlushStereo(const GSVertexSW& dscan, bool edge)
+{
+	const GSScanlineGlobalData* global = m_local.gd;
+	const GSVertexSW* RESTRICT ee = m_edge.buff + m_edge.count;
+
+	for (int eye = 0; eye < 2; eye++)
+	{
+		m_local.gd = eye ? &m_stereo_global : global;
+
+		const int dx = m_stereo_dx[eye];
+
+		for (const GSVertexSW* RESTRICT e = m_edge.buff; e < ee; e++)
+		{
+			const int left = e->_pad.I32[1] + dx;
+			const int top = e->_pad.I32[2];
+			const int l = std::max(left, m_draw_scissor.left);
+			const int r = std::min(left + e->_pad.I32[0], m_draw_scissor.right);
+
+			if (l >= r)
+				continue;
+
+			// step to the first visible pixel when the shifted span is clipped on the left,
+			// edges keep their coverage in p.x so it has to survive the step
+
+			GSVertexSW scan = *e;
+
+			if (l != left)
+			{
+				scan = scan + dscan * GSVector4(static_cast<float>(l - left));
+
+				if (edge)
+					scan.p.U32[0] = e->p.U32[0];
+			}
+
+			if (edge)
+				DrawEdge(r - l, l, top, scan);
+			else
+				DrawScanline(r - l, l, top, scan);
+		}
+	}
+
+	m_local.gd = global;
+}
+
 #if _M_SSE >= 0x501
 #define PIXELS_PER_LOOP 8
 #else
@@ -1499,22 +1665,23 @@ void GSSingleRasterizer::PrintStats()
 GSRasterizerList::GSRasterizerList(int threads)
 {
 	m_thread_height = compute_best_thread_height(threads);
-
-	const int rows = (2048 >> m_thread_height) + 16;
-	m_scanline = static_cast<u8*>(_aligned_malloc(rows, 64));
-
-	for (int i = 0; i < rows; i++)
-	{
-		m_scanline[i] = static_cast<u8>(i % threads);
-	}
+	m_tile_count = 2048 >> m_thread_height;
+	m_tiles = std::make_unique<Tile[]>(m_tile_count);
 
 	PerformanceMetrics::SetGSSWThreadCount(threads);
 }
 
 GSRasterizerList::~GSRasterizerList()
 {
+	m_exit.store(true, std::memory_order_release);
+
+	for (const std::unique_ptr<Worker>& worker : m_workers)
+		worker->sema.NotifyOfWork();
+
+	for (const std::unique_ptr<Worker>& worker : m_workers)
+		worker->thread.join();
+
 	PerformanceMetrics::SetGSSWThreadCount(0);
-	_aligned_free(m_scanline);
 }
 
 void GSRasterizerList::OnWorkerStartup(int i, u64 affinity)
@@ -1535,6 +1702,196 @@ void GSRasterizerList::OnWorkerShutdown(int i)
 {
 }
 
+void GSRasterizerList::WorkerThread(int i, u64 affinity)
+{
+	OnWorkerStartup(i, affinity);
+
+	Worker& worker = *m_workers[i];
+
+	while (true)
+	{
+		worker.sema.WaitForWorkWithSpin();
+		if (m_exit.load(std::memory_order_acquire))
+			break;
+
+		while (DrawTiles(i))
+			;
+	}
+
+	OnWorkerShutdown(i);
+}
+
+bool GSRasterizerList::DrawTiles(int i)
+{
+	const int threads = static_cast<int>(m_workers.size());
+	bool drawn = false;
+
+	// our own tiles first, then help out with whatever the other workers haven't got to yet
+
+	for (int tile = i; tile < m_tile_count; tile += threads)
+	{
+		if (!m_tiles[tile].queue.empty())
+			drawn |= DrawTile(i, tile);
+	}
+
+	for (int n = 0; n < m_tile_count; n++)
+	{
+		const int tile = (i + n) % m_tile_count;
+
+		if (!m_tiles[tile].queue.empty())
+			drawn |= DrawTile(i, tile);
+	}
+
+	return drawn;
+}
+
+bool GSRasterizerList::DrawTile(int i, int tile)
+{
+	Tile& t = m_tiles[tile];
+	GSRasterizer& r = *m_r[i];
+
+	const GSVector4i clip(0, tile << m_thread_height, 2048, (tile + 1) << m_thread_height);
+
+	auto draw = [&r, &clip, tile](DrawPtr& item) {
+		GSRasterizerData& data = *item.get();
+
+		if (data.bin_offsets)
+		{
+			const u32* offsets = data.bin_offsets + (tile - data.bin_top);
+			r.Draw(data, clip, data.bin_index + offsets[0], static_cast<int>(offsets[1] - offsets[0]));
+		}
+		else
+		{
+			r.Draw(data, clip, data.index, data.index_count);
+		}
+	};
+
+	// only one worker may drain a tile at a time, otherwise the draws could land out of order,
+	// if someone else has it they will pick up anything we'd have drawn
+
+	bool drawn = false;
+
+	while (!t.busy.exchange(true))
+	{
+		drawn = true;
+
+		while (t.queue.consume_one(draw))
+		{
+			if (m_pending.fetch_sub(1) == 1 && m_sync_waiting.exchange(false))
+				m_sync_sema.Post();
+		}
+
+		t.busy.store(false);
+
+		// a draw pushed after we saw the queue empty but before we let go of it would have been
+		// skipped by anyone else looking at the tile, so check again after releasing it
+
+		if (t.queue.empty())
+			break;
+	}
+
+	return drawn;
+}
+
+void GSRasterizerList::BinPrimitives(GSRasterizerData& data, int top, int bottom)
+{
+	const int tiles = bottom - top;
+	const int n = (data.primclass == GS_POINT_CLASS) ? 1 : (data.primclass == GS_TRIANGLE_CLASS) ? 3 : 2;
+	const int prims = data.index_count / n;
+
+	// conservative vertical range of each primitive, the extra row either side covers edge
+	// antialiasing and the rounding done by the rasterizer
+
+	m_bin_ranges.resize(prims);
+	m_bin_cursors.assign(tiles + 1, 0);
+
+	u32 total = 0;
+
+	for (int i = 0; i < prims; i++)
+	{
+		const u16* index = data.index + i * n;
+
+		float ymin = data.vertex[index[0]].p.y;
+		float ymax = ymin;
+
+		for (int j = 1; j < n; j++)
+		{
+			const float y = data.vertex[index[j]].p.y;
+
+			ymin = std::min(ymin, y);
+			ymax = std::max(ymax, y);
+		}
+
+		int t0 = top;
+		int t1 = bottom - 1;
+
+		if (ymin >= 0.0f && ymax < 2048.0f)
+		{
+			t0 = std::max((static_cast<int>(ymin) - 1) >> m_thread_height, top);
+			t1 = std::min((static_cast<int>(ymax) + 2) >> m_thread_height, bottom - 1);
+		}
+
+		if (t0 > t1)
+		{
+			m_bin_ranges[i] = 0xffffffff;
+			continue;
+		}
+
+		m_bin_ranges[i] = (static_cast<u32>(t0 - top) << 16) | static_cast<u32>(t1 - top);
+
+		for (int t = t0; t <= t1; t++)
+			m_bin_cursors[t - top]++;
+
+		total += t1 - t0 + 1;
+	}
+
+	// when most primitives touch most of the tiles there's nothing to gain from copying the indices
+
+	if (static_cast<u64>(total) * 2 > static_cast<u64>(prims) * tiles)
+		return;
+
+	const size_t offsets_size = sizeof(u32) * (tiles + 1);
+	u32* offsets = static_cast<u32*>(m_bin_heap.alloc(offsets_size + sizeof(u16) * total * n, 64));
+	u16* bin_index = reinterpret_cast<u16*>(reinterpret_cast<u8*>(offsets) + offsets_size);
+
+	u32 offset = 0;
+
+	for (int t = 0; t < tiles; t++)
+	{
+		const u32 count = m_bin_cursors[t] * n;
+
+		offsets[t] = offset;
+		m_bin_cursors[t] = offset;
+		offset += count;
+	}
+
+	offsets[tiles] = offset;
+
+	for (int i = 0; i < prims; i++)
+	{
+		const u32 range = m_bin_ranges[i];
+
+		if (range == 0xffffffff)
+			continue;
+
+		const u16* index = data.index + i * n;
+
+		for (u32 t = range >> 16; t <= (range & 0xffff); t++)
+		{
+			u16* RESTRICT dst = bin_index + m_bin_cursors[t];
+
+			for (int j = 0; j < n; j++)
+				dst[j] = index[j];
+
+			m_bin_cursors[t] += n;
+		}
+	}
+
+	data.bin_offsets = offsets;
+	data.bin_index = bin_index;
+	data.bin_top = top;
+}
+
 void GSRasterizerList::Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data)
 {
 	GSVector4i r = data->bbox.rintersect(data->scissor);
@@ -1548,48 +1905,75 @@ void GSRasterizerList::Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data
 
 	pxAssert(r.top >= 0 && r.top < 2048 && r.bottom >= 0 && r.bottom < 2048);
 
-	int top = r.top >> m_thread_height;
-	int bottom = std::min<int>((r.bottom + (1 << m_thread_height) - 1) >> m_thread_height, top + (int)m_workers.size());
+	const int top = r.top >> m_thread_height;
+	const int bottom = std::min<int>((r.bottom + (1 << m_thread_height) - 1) >> m_thread_height, m_tile_count);
+	const int threads = static_cast<int>(m_workers.size());
 
-	while (top < bottom)
+	if (bottom - top > 1 && data->index && data->index_count >= MIN_BIN_PRIMITIVES * 3)
+		BinPrimitives(*data.get(), top, bottom);
+
+	for (int tile = top; tile < bottom; tile++)
 	{
-		m_workers[m_scanline[top++]]->Push(data);
+		const u32* offsets = data->bin_offsets;
+		if (offsets && offsets[tile - top] == offsets[tile - top + 1])
+			continue;
+
+		m_pending.fetch_add(1);
+
+		Tile& t = m_tiles[tile];
+		while (!t.queue.push(data))
+			std::this_thread::yield();
+
+		const int home = tile % threads;
+		m_workers[home]->sema.NotifyOfWork();
+
+		// the home worker hasn't got to the previous draw yet, so it's probably stuck on another
+		// tile, wake someone else as well, they'll drain whichever tiles are still waiting
+
+		if (threads > 1 && t.queue.size() > 1)
+		{
+			if (m_wake_next == home)
+				m_wake_next = (m_wake_next + 1) % threads;
+
+			m_workers[m_wake_next]->sema.NotifyOfWork();
+			m_wake_next = (m_wake_next + 1) % threads;
+		}
 	}
 }
 
 void GSRasterizerList::Sync()
 {
+	if (IsSynced())
+		return;
+
+	for (int i = 0; i < 256 && !IsSynced(); i++)
+		Threading::SpinWait();
+
 	if (!IsSynced())
 	{
-		for (size_t i = 0; i < m_workers.size(); i++)
-		{
-			m_workers[i]->Wait();
-		}
+		// the worker that retires the last draw posts the semaphore if it sees the flag, so if
+		// it already took the flag, the post is on its way and has to be consumed here
 
-		g_perfmon.Put(GSPerfMon::SyncPoint, 1);
+		m_sync_waiting.store(true);
+		if (!IsSynced() || !m_sync_waiting.exchange(false))
+			m_sync_sema.Wait();
 	}
+
+	g_perfmon.Put(GSPerfMon::SyncPoint, 1);
 }
 
 bool GSRasterizerList::IsSynced() const
 {
-	for (size_t i = 0; i < m_workers.size(); i++)
-	{
-		if (!m_workers[i]->IsEmpty())
-		{
-			return false;
-		}
-	}
-
-	return true;
+	return m_pending.load(std::memory_order_acquire) == 0;
 }
 
 int GSRasterizerList::GetPixels(bool reset)
 {
 	int pixels = 0;
 
-	for (size_t i = 0; i < m_workers.size(); i++)
+	for (const std::unique_ptr<GSRasterizer>& r : m_r)
 	{
-		pixels += m_r[i]->GetPixels(reset);
+		pixels += r->GetPixels(reset);
 	}
 
 	return pixels;
@@ -1611,15 +1995,18 @@ std::unique_ptr<IRasterizer> GSRasterizerList::Create(int threads)
 	if (EmuConfig.EnableThreadPinning && !pin)
 		WARNING_LOG("Not pinning SW threads, we need {} processors, but only have {}", threads, procs.size());
 
+	// each worker rasterizes whole tiles, so they all own every scanline
+
+	for (int i = 0; i < threads; i++)
+	{
+		rl->m_r.push_back(std::unique_ptr<GSRasterizer>(new GSRasterizer(&rl->m_ds, i, 1)));
+		rl->m_workers.push_back(std::make_unique<Worker>());
+	}
+
 	for (int i = 0; i < threads; i++)
 	{
 		const u64 affinity = pin ? (static_cast<u64>(1u) << procs[i]) : 0;
-		rl->m_r.push_back(std::unique_ptr<GSRasterizer>(new GSRasterizer(&rl->m_ds, i, threads)));
-		auto& r = *rl->m_r[i];
-		rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker(
-			[i, affinity]() { GSRasterizerList::OnWorkerStartup(i, affinity); },
-			[&r](GSRingHeap::SharedPtr<GSRasterizerData>& item) { r.Draw(*item.get()); },
-			[i]() { GSRasterizerList::OnWorkerShutdown(i); })));
+		rl->m_workers[i]->thread = std::thread(&GSRasterizerList::WorkerThread, rl.get(), i, affinity);
 	}
 
 	return rl;
@@ -36,6 +36,17 @@ public:
 
 	GSScanlineGlobalData global;
 
+	// Stereo output, the right eye is drawn into stereo_vm with global.vm swapped out.
+	// stereo_params: left eye pixel offset scale, right eye pixel offset scale, depth factor (per z unit), convergence.
+	void* stereo_vm;
+	GSVector4 stereo_params;
+
+	// Per tile index lists built by GSRasterizerList::BinPrimitives(), tile t draws
+	// bin_index[bin_offsets[t - bin_top]] to bin_index[bin_offsets[t - bin_top + 1]].
+	u32* bin_offsets;
+	u16* bin_index;
+	int bin_top;
+
 	GSDrawScanline::SetupPrimPtr setup_prim;
 	GSDrawScanline::DrawScanlinePtr draw_scanline;
 	GSDrawScanline::DrawScanlinePtr draw_edge;
@@ -53,6 +64,11 @@ public:
 		, start(0)
 		, pixels(0)
 		, scanmsk_value(0)
+		, stereo_vm(nullptr)
+		, stereo_params(GSVector4::zero())
+		, bin_offsets(nullptr)
+		, bin_index(nullptr)
+		, bin_top(0)
 	{
 		counter = s_counter++;
 	}
@@ -61,6 +77,9 @@ public:
 	{
 		if (buff != NULL)
 			GSRingHeap::free(buff);
+
+		if (bin_offsets)
+			GSRingHeap::free(bin_offsets);
 	}
 };
 
@@ -86,8 +105,20 @@ protected:
 	GSDrawScanline::DrawScanlinePtr m_draw_scanline = nullptr;
 	GSDrawScanline::DrawScanlinePtr m_draw_edge = nullptr;
 
+	// Stereo, m_scissor is widened per primitive so the spans cover both shifted eyes,
+	// m_draw_scissor is the real one they are clipped against.
+	GSScanlineGlobalData m_stereo_global = {};
+	GSVector4 m_stereo_params;
+	GSVector4i m_draw_scissor;
+	int m_stereo_dx[2] = {};
+	bool m_stereo = false;
+
 	__forceinline bool HasEdge() const { return (m_draw_edge != nullptr); }
 
+	void SetStereoOffset(double z);
+	void DrawStereoPoint(const GSVertexSW* vertex, const u16* index, const GSVertexSW& v);
+	bool DrawSpriteEye(const GSVertexSW* vertex, const u16* index, const GSVertexSW* v, int dx, bool setup);
+
 	template <bool step_x, bool pos_x, bool pos_y, bool tl, bool side>
 	void DrawEdgeTriangle(const GSVertexSW& v0, const GSVertexSW& v1, const GSVertexSW& dv,
 		const GSVector4i& efun1, const GSVector4i& efun2);
@@ -120,6 +151,7 @@ protected:
 
 	__forceinline void AddScanline(GSVertexSW* e, int pixels, int left, int top, const GSVertexSW& scan);
 	__forceinline void Flush(const GSVertexSW* vertex, const u16* index, const GSVertexSW& dscan, bool edge = false);
+	void FlushStereo(const GSVertexSW& dscan, bool edge);
 
 	__forceinline void DrawScanline(int pixels, int left, int top, const GSVertexSW& scan);
 	__forceinline void DrawEdge(int pixels, int left, int top, const GSVertexSW& scan);
@@ -133,6 +165,8 @@ public:
 	__forceinline int FindMyNextScanline(int top) const;
 
 	void Draw(GSRasterizerData& data);
+	/// Draws the part of data inside clip, from index instead of data.index.
+	void Draw(GSRasterizerData& data, const GSVector4i& clip, const u16* index, int index_count);
 	int GetPixels(bool reset);
 };
 
@@ -170,21 +204,56 @@ private:
 class GSRasterizerList final : public IRasterizer
 {
 protected:
-	using GSWorker = GSJobQueue<GSRingHeap::SharedPtr<GSRasterizerData>, 65536>;
+	using DrawPtr = GSRingHeap::SharedPtr<GSRasterizerData>;
+
+	/// A full width band of 1 << m_thread_height scanlines. Draws are queued per tile in submission order, and a
+	/// tile is only ever drawn by one worker at a time, which is what keeps the per-tile ordering.
+	struct alignas(64) Tile
+	{
+		ringbuffer_base<DrawPtr, 4096> queue;
+		std::atomic<bool> busy{false};
+	};
+
+	struct Worker
+	{
+		std::thread thread;
+		Threading::WorkSema sema;
+	};
+
+	static constexpr int MIN_BIN_PRIMITIVES = 16;
 
 	GSDrawScanline m_ds;
+	GSRingHeap m_bin_heap;
 
-	// Worker threads depend on the rasterizers, so don't change the order.
+	// Worker threads depend on the rasterizers and tiles, so don't change the order.
 	std::vector<std::unique_ptr<GSRasterizer>> m_r;
-	std::vector<std::unique_ptr<GSWorker>> m_workers;
-	u8* m_scanline;
+	std::unique_ptr<Tile[]> m_tiles;
+	std::vector<std::unique_ptr<Worker>> m_workers;
+	int m_tile_count;
 	int m_thread_height;
 
+	std::atomic<u32> m_pending{0};
+	std::atomic<bool> m_sync_waiting{false};
+	std::atomic<bool> m_exit{false};
+	Threading::KernelSemaphore m_sync_sema;
+
+	// Scratch space for binning, only used on the GS thread.
+	std::vector<u32> m_bin_ranges;
+	std::vector<u32> m_bin_cursors;
+
+	// Next worker to wake when a tile has a backlog, only used on the GS thread.
+	int m_wake_next = 0;
+
 	GSRasterizerList(int threads);
 
 	static void OnWorkerStartup(int i, u64 affinity);
 	static void OnWorkerShutdown(int i);
 
+	void WorkerThread(int i, u64 affinity);
+	bool DrawTiles(int i);
+	bool DrawTile(int i, int tile);
+	void BinPrimitives(GSRasterizerData& data, int top, int bottom);
+
 public:
 	~GSRasterizerList() override;
 
@@ -33,6 +33,9 @@ GSRendererSW::GSRendererSW(int threads)
 
 	std::fill(std::begin(m_fzb_pages), std::end(m_fzb_pages), 0);
 	std::fill(std::begin(m_tex_pages), std::end(m_tex_pages), 0);
+
+	if (GSConfig.StereoMode != GSStereoMode::Off)
+		UpdateStereo();
 }
 
 GSRendererSW::~GSRendererSW()
@@ -50,6 +53,16 @@ void GSRendererSW::Reset(bool hardware_reset)
 	m_tc->RemoveAll();
 
 	GSRenderer::Reset(hardware_reset);
+
+	std::fill(std::begin(m_stereo_dirty_pages), std::end(m_stereo_dirty_pages), 0xFFFFFFFFu);
+}
+
+void GSRendererSW::UpdateSettings(const Pcsx2Config::GSOptions& old_config)
+{
+	GSRenderer::UpdateSettings(old_config);
+
+	if ((GSConfig.StereoMode != GSStereoMode::Off) != static_cast<bool>(m_stereo_mem))
+		UpdateStereo();
 }
 
 void GSRendererSW::Destroy()
@@ -66,6 +79,10 @@ void GSRendererSW::Destroy()
 
 	_aligned_free(m_output);
 	m_output = nullptr;
+
+	m_stereo_mem.reset();
+	_aligned_free(m_stereo_output);
+	m_stereo_output = nullptr;
 }
 
 void GSRendererSW::VSync(u32 field, bool registers_written, bool idle_frame)
@@ -101,6 +118,9 @@ GSTexture* GSRendererSW::GetOutput(int i, float& scale, int& y_offset)
 {
 	Sync(1);
 
+	if (m_stereo_mem)
+		UpdateStereoPages();
+
 	int index = i >= 0 ? i : 1;
 	GSPCRTCRegs::PCRTCDisplay& curFramebuffer = PCRTCDisplays.PCRTCDisplays[index];
 	GSVector2i framebufferSize = PCRTCDisplays.GetFramebufferSize(i);
@@ -153,28 +173,40 @@ GSTexture* GSRendererSW::GetOutput(int i, float& scale, int& y_offset)
 		texa.TA0 = (curFramebuffer.PSM == PSMCT24 || curFramebuffer.PSM == PSGPU24) ? 0x80 : 0;
 		texa.TA1 = 0x80;
 
-		// Top left rect
-		psm.rtx(m_mem, m_mem.GetOffset(curFramebuffer.Block(), curFramebuffer.FBW, curFramebuffer.PSM), r.ralign<Align_Outside>(psm.bs), m_output, pitch, texa);
+		const auto read_framebuffer = [&](GSLocalMemory& mem, u8* output) {
+			const GSOffset off = m_mem.GetOffset(curFramebuffer.Block(), curFramebuffer.FBW, curFramebuffer.PSM);
+
+			// Top left rect
+			psm.rtx(mem, off, r.ralign<Align_Outside>(psm.bs), output, pitch, texa);
+
+			int top = (h_wrap) ? ((r.bottom - r.top) * pitch) : 0;
+			int left = (w_wrap) ? (r.right - r.left) * (GSLocalMemory::m_psm[curFramebuffer.PSM].bpp / 8) : 0;
+
+			// The following only happen if the DBX/DBY wrap around at 2048.
 
-		int top = (h_wrap) ? ((r.bottom - r.top) * pitch) : 0;
-		int left = (w_wrap) ? (r.right - r.left) * (GSLocalMemory::m_psm[curFramebuffer.PSM].bpp / 8) : 0;
+			// Top right rect
+			if (w_wrap)
+				psm.rtx(mem, off, rw.ralign<Align_Outside>(psm.bs), &output[left], pitch, texa);
 
-		// The following only happen if the DBX/DBY wrap around at 2048.
+			// Bottom left rect
+			if (h_wrap)
+				psm.rtx(mem, off, rh.ralign<Align_Outside>(psm.bs), &output[top], pitch, texa);
 
-		// Top right rect
-		if (w_wrap)
-			psm.rtx(m_mem, m_mem.GetOffset(curFramebuffer.Block(), curFramebuffer.FBW, curFramebuffer.PSM), rw.ralign<Align_Outside>(psm.bs), &m_output[left], pitch, texa);
+			// Bottom right rect
+			if (h_wrap && w_wrap)
+			{
+				// Needs also rw with the start/end height of rh, fills in the bottom right rect which will be missing if both overflow.
+				const GSVector4i rwh(rw.left, rh.top, rw.right, rh.bottom);
+				psm.rtx(mem, off, rwh.ralign<Align_Outside>(psm.bs), &output[top + left], pitch, texa);
+			}
+		};
 
-		// Bottom left rect
-		if (h_wrap)
-			psm.rtx(m_mem, m_mem.GetOffset(curFramebuffer.Block(), curFramebuffer.FBW, curFramebuffer.PSM), rh.ralign<Align_Outside>(psm.bs), &m_output[top], pitch, texa);
+		read_framebuffer(m_mem, m_output);
 
-		// Bottom right rect
-		if (h_wrap && w_wrap)
+		if (m_stereo_mem)
 		{
-			// Needs also rw with the start/end height of rh, fills in the bottom right rect which will be missing if both overflow.
-			const GSVector4i rwh(rw.left, rh.top, rw.right, rh.bottom);
-			psm.rtx(m_mem, m_mem.GetOffset(curFramebuffer.Block(), curFramebuffer.FBW, curFramebuffer.PSM), rwh.ralign<Align_Outside>(psm.bs), &m_output[top + left], pitch, texa);
+			read_framebuffer(*m_stereo_mem, m_stereo_output);
+			PackStereoOutput(w, h, pitch);
 		}
 
 		m_texture[index]->Update(out_r, m_output, pitch);
@@ -481,6 +513,8 @@ void GSRendererSW::Draw()
 		return;
 	}
 
+	SetupStereo(sd);
+
 	if constexpr (LOG && false)
 	{
 		int n = GSUtil::GetVertexCount(PRIM->PRIM);
@@ -658,6 +692,13 @@ void GSRendererSW::Queue(GSRingHeap::SharedPtr<GSRasterizerData>& item)
 		fflush(s_fp);
 	}
 
+	// bring the right eye up to date with any transfers since the last draw
+
+	if (m_stereo_mem)
+	{
+		UpdateStereoPages();
+	}
+
 	m_rl->Queue(item);
 
 	// invalidate new parts rendered onto
@@ -740,6 +781,14 @@ void GSRendererSW::InvalidateVideoMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 	}
 
 	m_tc->InvalidatePages(pages, off.psm()); // if texture update runs on a thread and Sync(5) happens then this must come later
+
+	if (m_stereo_mem)
+	{
+		pages.loopPages([this](u32 page)
+		{
+			m_stereo_dirty_pages[page / 32] |= 1u << (page % 32);
+		});
+	}
 }
 
 void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GSVector4i& r, bool clut)
@@ -767,6 +816,140 @@ void GSRendererSW::InvalidateLocalMem(const GIFRegBITBLTBUF& BITBLTBUF, const GS
 	}
 }
 
+void GSRendererSW::UpdateStereo()
+{
+	// draws in flight may still be using the right eye memory
+
+	Sync(8);
+
+	if (GSConfig.StereoMode == GSStereoMode::Off)
+	{
+		m_stereo_mem.reset();
+		_aligned_free(m_stereo_output);
+		m_stereo_output = nullptr;
+		return;
+	}
+
+	m_stereo_mem = std::make_unique<GSLocalMemory>();
+
+	if (!m_stereo_output)
+		m_stereo_output = (u8*)_aligned_malloc(1024 * 1024 * sizeof(u32), VECTOR_ALIGNMENT);
+
+	// start the right eye from the current contents of local memory
+
+	std::fill(std::begin(m_stereo_dirty_pages), std::end(m_stereo_dirty_pages), 0xFFFFFFFFu);
+}
+
+void GSRendererSW::SetupStereo(SharedData* data)
+{
+	if (!m_stereo_mem)
+		return;
+
+	// The HW vertex shader moves each eye by separation * min(20, z * depth_factor + convergence) in clip space,
+	// which is half the frame buffer width in pixels. With a dominant eye only the other one moves, twice as far.
+
+	const float separation = GSConfig.StereoSeparation * 0.001f * static_cast<float>(m_context->FRAME.FBW * 64) * 0.5f;
+
+	float left_scale = 1.0f;
+	float right_scale = 1.0f;
+
+	if (GSConfig.StereoDominantEye == GSStereoDominantEye::Left)
+	{
+		left_scale = 0.0f;
+		right_scale = 2.0f;
+	}
+	else if (GSConfig.StereoDominantEye == GSStereoDominantEye::Right)
+	{
+		left_scale = 2.0f;
+		right_scale = 0.0f;
+	}
+
+	data->stereo_vm = m_stereo_mem->vm8();
+	data->stereo_params = GSVector4(separation * left_scale, -separation * right_scale,
+		GSConfig.StereoDepthFactor * 1000.0f / 4294967296.0f, GSConfig.StereoConvergence * 0.1f);
+}
+
+void GSRendererSW::UpdateStereoPages()
+{
+	if (std::all_of(std::begin(m_stereo_dirty_pages), std::end(m_stereo_dirty_pages), [](u32 bits) { return bits == 0; }))
+		return;
+
+	// Right eye draws are moved by the eye offset, so they can write pages outside of m_fzb_pages.
+	// Let them finish before overwriting the right eye memory.
+
+	if (!m_rl->IsSynced())
+		Sync(9);
+
+	const u8* src = m_mem.vm8();
+	u8* dst = m_stereo_mem->vm8();
+
+	for (u32 i = 0; i < std::size(m_stereo_dirty_pages); i++)
+	{
+		u32 bits = m_stereo_dirty_pages[i];
+		m_stereo_dirty_pages[i] = 0;
+
+		while (bits != 0)
+		{
+			const u32 page = i * 32 + std::countr_zero(bits);
+			bits &= bits - 1;
+
+			std::memcpy(dst + page * GS_PAGE_SIZE, src + page * GS_PAGE_SIZE, GS_PAGE_SIZE);
+		}
+	}
+}
+
+void GSRendererSW::PackStereoOutput(int w, int h, int pitch)
+{
+	// Both eyes are drawn at full size, halve them into the layout the HW renderer presents from:
+	// left and right halves, or top and bottom with StereoFlipRendering. pitch is in bytes, like GetOutput's.
+
+	pitch /= sizeof(u32);
+
+	u32* left = reinterpret_cast<u32*>(m_output);
+	const u32* right = reinterpret_cast<const u32*>(m_stereo_output);
+
+	const auto average = [](u32 a, u32 b) { return (a & b) + (((a ^ b) & 0xFEFEFEFEu) >> 1); };
+
+	if (!GSConfig.StereoFlipRendering)
+	{
+		const int half = w / 2;
+
+		for (int y = 0; y < h; y++)
+		{
+			u32* dst = &left[y * pitch];
+			const u32* src = &right[y * pitch];
+
+			for (int x = 0; x < half; x++)
+				dst[x] = average(dst[x * 2], dst[x * 2 + 1]);
+
+			for (int x = 0; x < half; x++)
+				dst[half + x] = average(src[x * 2], src[x * 2 + 1]);
+		}
+	}
+	else
+	{
+		const int half = h / 2;
+
+		for (int y = 0; y < half; y++)
+		{
+			u32* dst = &left[y * pitch];
+			const u32* src = &left[y * 2 * pitch];
+
+			for (int x = 0; x < w; x++)
+				dst[x] = average(src[x], src[x + pitch]);
+		}
+
+		for (int y = 0; y < half; y++)
+		{
+			u32* dst = &left[(half + y) * pitch];
+			const u32* src = &right[y * 2 * pitch];
+
+			for (int x = 0; x < w; x++)
+				dst[x] = average(src[x], src[x + pitch]);
+		}
+	}
+}
+
 void GSRendererSW::UsePages(const GSOffset::PageLooper& pages, const int type)
 {
 	pages.loopPages([this, type](u32 page)
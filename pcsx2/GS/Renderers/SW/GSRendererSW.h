@@ -60,7 +60,14 @@ protected:
 	GIFRegDIMX m_last_dimx = {};
 	GSVector4i m_dimx[8] = {};
 
+	// Stereo output: m_mem holds the left eye, the right eye is drawn into its own copy of local memory.
+	// Pages written by transfers are copied over before the next draw.
+	std::unique_ptr<GSLocalMemory> m_stereo_mem;
+	u8* m_stereo_output = nullptr;
+	u32 m_stereo_dirty_pages[GS_MAX_PAGES / 32] = {};
+
 	void Reset(bool hardware_reset) override;
+	void UpdateSettings(const Pcsx2Config::GSOptions& old_config) override;
 	void VSync(u32 field, bool registers_written, bool idle_frame) override;
 	GSTexture* GetOutput(int i, float& scale, int& y_offset) override;
 	GSTexture* GetFeedbackOutput(float& scale) override;
@@ -79,6 +86,11 @@ protected:
 
 	bool GetScanlineGlobalData(SharedData* data);
 
+	void UpdateStereo();
+	void SetupStereo(SharedData* data);
+	void UpdateStereoPages();
+	void PackStereoOutput(int w, int h, int pitch);
+
 	template <u32 primclass>
 	void RewriteVerticesIfSTOverflow();
 
@@ -40,6 +40,7 @@ static void GSDumpReplayerCpuClear(u32 addr, u32 size);
 static std::unique_ptr<GSDumpFile> s_dump_file;
 static u32 s_current_packet = 0;
 static u32 s_dump_frame_number = 0;
+static s32 s_dump_last_frame = -1;
 static s32 s_dump_loop_count = 0;
 static bool s_dump_running = false;
 static bool s_needs_state_loaded = false;
@@ -85,6 +86,11 @@ int GSDumpReplayer::GetLoopCount()
 	return s_dump_loop_count;
 }
 
+void GSDumpReplayer::SetLastFrame(s32 frame)
+{
+	s_dump_last_frame = frame;
+}
+
 bool GSDumpReplayer::Initialize(const char* filename, Error* error)
 {
 	Common::Timer timer;
@@ -125,7 +131,7 @@ bool GSDumpReplayer::ChangeDump(const char* filename)
 	}
 
 	Error error;
-	std::unique_ptr<GSDumpFile> new_dump(GSDumpFile::OpenGSDump(filename));
+	std::unique_ptr<GSDumpFile> new_dump(GSDumpFile::OpenGSDump(filename, &error));
 	if (!new_dump || !new_dump->ReadFile(&error))
 	{
 		Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to open or read '{}': {}",
@@ -196,6 +202,10 @@ void GSDumpReplayerCpuReset()
 	s_needs_state_loaded = true;
 	s_current_packet = 0;
 	s_dump_frame_number = 0;
+
+	Error error;
+	if (!s_dump_file->SeekToFrame(0, &error))
+		Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to rewind dump: {}", error.GetDescription()));
 }
 
 static void GSDumpReplayerLoadInitialState()
@@ -264,10 +274,19 @@ void GSDumpReplayerCpuStep()
 		s_needs_state_loaded = false;
 	}
 
-	const GSDumpFile::GSData& packet = s_dump_file->GetPackets()[s_current_packet];
-	s_current_packet = (s_current_packet + 1) % static_cast<u32>(s_dump_file->GetPackets().size());
-	if (s_current_packet == 0)
+	GSDumpFile::GSData packet;
+	Error error;
+	if (!s_dump_file->ReadPacket(&packet, &error))
 	{
+		if (!s_dump_file->IsEndOfDump())
+		{
+			Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to read packet: {}", error.GetDescription()));
+			Host::RequestVMShutdown(false, false, false);
+			s_dump_running = false;
+			return;
+		}
+
+		s_current_packet = 0;
 		s_dump_frame_number = 0;
 		if (s_dump_loop_count > 0)
 			s_dump_loop_count--;
@@ -275,9 +294,20 @@ void GSDumpReplayerCpuStep()
 		{
 			Host::RequestVMShutdown(false, false, false);
 			s_dump_running = false;
+			return;
+		}
+
+		if (!s_dump_file->SeekToFrame(0, &error) || !s_dump_file->ReadPacket(&packet, &error))
+		{
+			Host::ReportErrorAsync("GSDumpReplayer", fmt::format("Failed to rewind dump: {}", error.GetDescription()));
+			Host::RequestVMShutdown(false, false, false);
+			s_dump_running = false;
+			return;
 		}
 	}
 
+	s_current_packet++;
+
 	switch (packet.id)
 	{
 		case GSDumpTypes::GSType::Transfer:
@@ -316,6 +346,14 @@ void GSDumpReplayerCpuStep()
 		case GSDumpTypes::GSType::VSync:
 		{
 			s_dump_frame_number++;
+			// s_dump_frame_number is now the number of frames replayed, the last one included
+			if (s_dump_last_frame >= 0 && s_dump_frame_number > static_cast<u32>(s_dump_last_frame))
+			{
+				// nothing after this frame is wanted, so don't bother decoding the rest of the dump
+				Host::RequestVMShutdown(false, false, false);
+				s_dump_running = false;
+			}
+
 			GSDumpReplayerUpdateFrameLimit();
 			GSDumpReplayerFrameLimit();
 			MTGS::PostVsyncStart(false);
@@ -395,11 +433,15 @@ void GSDumpReplayer::RenderUI()
 		position_y += text_size.y + spacing; \
 	} while (0)
 
-	fmt::format_to(std::back_inserter(text), "Dump Frame: {}", s_dump_frame_number);
+	// the frame count is only known once the dump has been read to the end
+	if (const u32 frame_count = s_dump_file->GetFrameCount(); frame_count > 0)
+		fmt::format_to(std::back_inserter(text), "Dump Frame: {}/{}", s_dump_frame_number, frame_count);
+	else
+		fmt::format_to(std::back_inserter(text), "Dump Frame: {}", s_dump_frame_number);
 	DRAW_LINE(font, font_size, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 	text.clear();
-	fmt::format_to(std::back_inserter(text), "Packet Number: {}/{}", s_current_packet, static_cast<u32>(s_dump_file->GetPackets().size()));
+	fmt::format_to(std::back_inserter(text), "Packet Number: {}", s_current_packet);
 	DRAW_LINE(font, font_size, text.c_str(), IM_COL32(255, 255, 255, 255));
 
 #undef DRAW_LINE
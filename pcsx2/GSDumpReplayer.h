@@ -15,6 +15,10 @@ namespace GSDumpReplayer
 	/// If set, playback will repeat once it reaches the last frame.
 	void SetLoopCount(s32 loop_count = 0);
 	int GetLoopCount();
+
+	/// If not negative, playback stops once this frame of the dump (base 0, inclusive) has been
+	/// replayed, instead of at the end of the dump. Frames are counted by the dump's vsync packets.
+	void SetLastFrame(s32 frame);
 	bool IsRunner();
 	void SetIsDumpRunner(bool is_runner);
 
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "GameDatabase.h"
+#include "GameDatabaseCache.h"
 #include "GS/GS.h"
+#include "GS/Renderers/HW/GSStereoFilter.h"
 #include "Host.h"
 #include "IconsFontAwesome.h"
 #include "vtlb.h"
@@ -13,6 +15,7 @@
 #include "common/FileSystem.h"
 #include "common/Path.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 #include "common/Timer.h"
 #include "common/YAML.h"
 
@@ -21,9 +24,11 @@
 #include "ryml.hpp"
 #include "fmt/format.h"
 #include "fmt/ranges.h"
+#include <atomic>
 #include <fstream>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 namespace GameDatabaseSchema
 {
@@ -34,14 +39,35 @@ namespace GameDatabaseSchema
 
 namespace GameDatabase
 {
-	static void parseAndInsert(const std::string_view serial, const ryml::NodeRef& node);
+	using EntryMap = std::unordered_map<std::string, GameDatabaseSchema::GameEntry>;
+
+	static void parseAndInsert(const std::string_view serial, const ryml::NodeRef& node, EntryMap& entries);
+	static void parseDatabase(ryml::Tree& tree, EntryMap& entries);
+	static std::shared_ptr<const GameDatabaseSchema::StereoRuleSets> parseStereoRuleSets(
+		const std::string_view serial, const ryml::ConstNodeRef& node);
+	static bool reloadStereoRules(const std::string& path, const GameDatabaseCache::SourceInfo& source);
+	static std::string getCachePath();
+	static std::optional<ryml::Tree> readDatabaseFile(const std::string& path);
+	static bool openDatabaseCache(const std::string& cache_path, const GameDatabaseCache::SourceInfo& source);
+	static bool writeDatabaseCache(const std::string& cache_path, const GameDatabaseCache::SourceInfo& source,
+		const EntryMap& entries);
 	static void initDatabase();
 } // namespace GameDatabase
 
 static constexpr char GAMEDB_YAML_FILE_NAME[] = "GameIndex.yaml";
+static constexpr char GAMEDB_CACHE_FILE_NAME[] = "gamedb.cache";
 
-static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> s_game_db;
+// When the binary cache is open, this only holds the entries which have been looked up so far.
+// Entries are never removed, so pointers handed out by findGame() stay valid.
+static GameDatabase::EntryMap s_game_db;
+static GameDatabaseCache s_game_db_cache;
+static std::mutex s_game_db_mutex;
 static std::once_flag s_load_once_flag;
+static std::time_t s_game_db_modification_time = 0;
+
+static std::thread s_stereo_reload_thread;
+static std::atomic_bool s_stereo_reload_done{false};
+static bool s_stereo_reload_changed = false;
 
 std::string GameDatabaseSchema::GameEntry::memcardFiltersAsString() const
 {
@@ -85,7 +111,7 @@ const char* GameDatabaseSchema::GameEntry::compatAsString() const
 	}
 }
 
-void GameDatabase::parseAndInsert(const std::string_view serial, const ryml::NodeRef& node)
+void GameDatabase::parseAndInsert(const std::string_view serial, const ryml::NodeRef& node, EntryMap& entries)
 {
 	GameDatabaseSchema::GameEntry gameEntry;
 	if (node.has_child("name"))
@@ -285,6 +311,11 @@ void GameDatabase::parseAndInsert(const std::string_view serial, const ryml::Nod
 		}
 	}
 
+	if (node.has_child("stereo"))
+	{
+		gameEntry.stereoRuleSets = parseStereoRuleSets(serial, node["stereo"]);
+	}
+
 	// Memory Card Filters - Store as a vector to allow flexibility in the future
 	// - currently they are used as a '\n' delimited string in the app
 	if (node.has_child("memcardFilters") && node["memcardFilters"].has_children())
@@ -351,7 +382,76 @@ void GameDatabase::parseAndInsert(const std::string_view serial, const ryml::Nod
 		}
 	}
 
-	s_game_db.emplace(std::move(serial), std::move(gameEntry));
+	entries.emplace(std::move(serial), std::move(gameEntry));
+}
+
+void GameDatabase::parseDatabase(ryml::Tree& tree, EntryMap& entries)
+{
+	for (const ryml::NodeRef& n : tree.rootref().children())
+	{
+		auto serial = StringUtil::toLower(std::string(n.key().str, n.key().len));
+
+		// Serials and CRCs must be inserted as lower-case, as that is how they are retrieved
+		// this is because the application may pass a lowercase CRC or serial along
+		//
+		// However, YAML's keys are as expected case-sensitive, so we have to explicitly do our own duplicate checking
+		if (entries.count(serial) == 1)
+		{
+			Console.ErrorFmt("GameDB: Duplicate serial '{}' found in GameDB. Skipping, Serials are case-insensitive!", serial);
+			continue;
+		}
+
+		if (n.is_map())
+		{
+			parseAndInsert(serial, n, entries);
+		}
+	}
+}
+
+std::shared_ptr<const GameDatabaseSchema::StereoRuleSets> GameDatabase::parseStereoRuleSets(
+	const std::string_view serial, const ryml::ConstNodeRef& node)
+{
+	GameDatabaseSchema::StereoRuleSets rule_sets;
+	for (const auto& set_node : node.children())
+	{
+		GameDatabaseSchema::StereoRuleSet rule_set;
+		rule_set.name = std::string(set_node.key().data(), set_node.key().size());
+		if (!set_node.is_map())
+		{
+			Console.Error(fmt::format("GameDB: Stereo rule set '{}' for serial '{}' is not a map. Dropping!", rule_set.name, serial));
+			continue;
+		}
+		if (std::any_of(rule_sets.begin(), rule_sets.end(),
+				[&rule_set](const GameDatabaseSchema::StereoRuleSet& rs) { return rs.name == rule_set.name; }))
+		{
+			Console.Error(fmt::format("GameDB: Duplicate stereo rule set '{}' for serial '{}'. Dropping!", rule_set.name, serial));
+			continue;
+		}
+
+		for (const auto& n : set_node.children())
+		{
+			const std::string_view option_name(n.key().data(), n.key().size());
+			const GSStereoDrawFilter::Option option = GSStereoDrawFilter::FindOption(option_name);
+			const std::optional<bool> value = n.has_val() ?
+				StringUtil::FromChars<bool>(std::string_view(n.val().data(), n.val().size())) :
+				std::optional<bool>(true);
+			if (!option || !value.has_value())
+			{
+				Console.Error(fmt::format("GameDB: Invalid stereo rule '{}' in set '{}' for serial '{}'. Dropping!",
+					option_name, rule_set.name, serial));
+				continue;
+			}
+
+			rule_set.options.emplace_back(option, value.value());
+		}
+
+		rule_sets.push_back(std::move(rule_set));
+	}
+
+	if (rule_sets.empty())
+		return {};
+
+	return std::make_shared<const GameDatabaseSchema::StereoRuleSets>(std::move(rule_sets));
 }
 
 static const char* s_round_modes[static_cast<u32>(FPRoundMode::MaxCount)] = {
@@ -938,50 +1038,114 @@ void GameDatabaseSchema::GameEntry::applyGSHardwareFixes(Pcsx2Config::GSOptions&
 	}
 }
 
-void GameDatabase::initDatabase()
+void GameDatabaseSchema::GameEntry::applyStereoRules(Pcsx2Config::GSOptions& config) const
 {
-	const std::string path(Path::Combine(EmuFolders::Resources, GAMEDB_YAML_FILE_NAME));
-	const std::string name(GAMEDB_YAML_FILE_NAME);
+	if (config.StereoProfile.empty())
+		return;
+
+	// The snapshot stays alive while we use it, even if a reload replaces it in the meantime.
+	std::shared_ptr<const StereoRuleSets> rule_sets;
+	{
+		std::unique_lock lock(s_game_db_mutex);
+		rule_sets = stereoRuleSets;
+	}
+	if (!rule_sets)
+		return;
+
+	const auto it = std::find_if(rule_sets->begin(), rule_sets->end(),
+		[&config](const StereoRuleSet& rule_set) { return rule_set.name == config.StereoProfile; });
+	if (it == rule_sets->end())
+	{
+		Console.Warning(fmt::format("GameDB: Stereo rule set '{}' is not defined for this game.", config.StereoProfile));
+		return;
+	}
+
+	Console.WriteLn(fmt::format("GameDB: Applying stereo rule set '{}' ({} options).", it->name, it->options.size()));
+	for (const auto& [option, value] : it->options)
+		config.*option = value;
+}
 
+std::optional<ryml::Tree> GameDatabase::readDatabaseFile(const std::string& path)
+{
 	const std::optional<std::string> buffer = FileSystem::ReadFileToString(path.c_str());
 	if (!buffer.has_value())
 	{
 		Console.Error("GameDB: Unable to open GameDB file, file does not exist.");
-		return;
+		return std::nullopt;
 	}
 
 	const ryml::csubstr yaml = ryml::to_csubstr(*buffer);
 
 	Error error;
-	std::optional<ryml::Tree> tree = ParseYAMLFromString(yaml, ryml::to_csubstr(name), &error);
+	std::optional<ryml::Tree> tree = ParseYAMLFromString(yaml, ryml::to_csubstr(GAMEDB_YAML_FILE_NAME), &error);
 	if (!tree.has_value())
 	{
 		Console.ErrorFmt("GameDB: Failed to parse game database file {}:", path);
 		Console.Error(error.GetDescription());
-		return;
+		return std::nullopt;
 	}
 
-	ryml::NodeRef root = tree->rootref();
+	return tree;
+}
 
-	for (const ryml::NodeRef& n : root.children())
+bool GameDatabase::openDatabaseCache(const std::string& cache_path, const GameDatabaseCache::SourceInfo& source)
+{
+	if (!FileSystem::FileExists(cache_path.c_str()))
+		return false;
+
+	Error error;
+	if (!s_game_db_cache.Open(cache_path, source, &error))
 	{
-		auto serial = StringUtil::toLower(std::string(n.key().str, n.key().len));
+		Console.WarningFmt("GameDB: Not using cache: {}", error.GetDescription());
+		return false;
+	}
 
-		// Serials and CRCs must be inserted as lower-case, as that is how they are retrieved
-		// this is because the application may pass a lowercase CRC or serial along
-		//
-		// However, YAML's keys are as expected case-sensitive, so we have to explicitly do our own duplicate checking
-		if (s_game_db.count(serial) == 1)
-		{
-			Console.ErrorFmt("GameDB: Duplicate serial '{}' found in GameDB. Skipping, Serials are case-insensitive!", serial);
-			continue;
-		}
+	return true;
+}
 
-		if (n.is_map())
-		{
-			parseAndInsert(serial, n);
-		}
+bool GameDatabase::writeDatabaseCache(const std::string& cache_path, const GameDatabaseCache::SourceInfo& source,
+	const EntryMap& entries)
+{
+	Common::Timer timer;
+	Error error;
+	if (!GameDatabaseCache::Write(cache_path, source, entries, &error))
+	{
+		Console.ErrorFmt("GameDB: Failed to write cache: {}", error.GetDescription());
+		return false;
 	}
+
+	Console.WriteLn("GameDB: Wrote cache in %.2fms", timer.GetTimeMilliseconds());
+	return true;
+}
+
+std::string GameDatabase::getCachePath()
+{
+	return EmuFolders::Cache.empty() ? std::string() : Path::Combine(EmuFolders::Cache, GAMEDB_CACHE_FILE_NAME);
+}
+
+void GameDatabase::initDatabase()
+{
+	const std::string path(Path::Combine(EmuFolders::Resources, GAMEDB_YAML_FILE_NAME));
+
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(path.c_str(), &sd))
+		sd = {};
+	s_game_db_modification_time = sd.ModificationTime;
+
+	// The cache is keyed on the size and timestamp of the YAML, if either changes it gets rebuilt.
+	const GameDatabaseCache::SourceInfo source = {static_cast<u64>(sd.Size), sd.ModificationTime};
+	const std::string cache_path = getCachePath();
+	if (!cache_path.empty() && sd.Size > 0 && openDatabaseCache(cache_path, source))
+		return;
+
+	std::optional<ryml::Tree> tree = readDatabaseFile(path);
+	if (!tree.has_value())
+		return;
+
+	parseDatabase(tree.value(), s_game_db);
+
+	if (!cache_path.empty())
+		writeDatabaseCache(cache_path, source, s_game_db);
 }
 
 void GameDatabase::ensureLoaded()
@@ -990,7 +1154,9 @@ void GameDatabase::ensureLoaded()
 		Common::Timer timer;
 		Console.WriteLn(fmt::format("GameDB: Has not been initialized yet, initializing..."));
 		initDatabase();
-		Console.WriteLn("GameDB: %zu games on record (loaded in %.2fms)", s_game_db.size(), timer.GetTimeMilliseconds());
+		Console.WriteLn("GameDB: %zu games on record (loaded %sin %.2fms)",
+			s_game_db_cache.IsOpen() ? static_cast<size_t>(s_game_db_cache.GetEntryCount()) : s_game_db.size(),
+			s_game_db_cache.IsOpen() ? "from cache " : "", timer.GetTimeMilliseconds());
 	});
 }
 
@@ -998,8 +1164,113 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 {
 	GameDatabase::ensureLoaded();
 
-	auto iter = s_game_db.find(StringUtil::toLower(serial));
-	return (iter != s_game_db.end()) ? &iter->second : nullptr;
+	std::string lower_serial = StringUtil::toLower(serial);
+	std::unique_lock lock(s_game_db_mutex);
+	auto iter = s_game_db.find(lower_serial);
+	if (iter != s_game_db.end())
+		return &iter->second;
+
+	GameDatabaseSchema::GameEntry entry;
+	if (!s_game_db_cache.IsOpen() || !s_game_db_cache.Find(lower_serial, &entry))
+		return nullptr;
+
+	return &s_game_db.emplace(std::move(lower_serial), std::move(entry)).first->second;
+}
+
+bool GameDatabase::reloadStereoRules(const std::string& path, const GameDatabaseCache::SourceInfo& source)
+{
+	Common::Timer timer;
+	std::optional<ryml::Tree> tree = readDatabaseFile(path);
+	if (!tree.has_value())
+		return false;
+
+	// Parse everything before taking the lock, lookups from other threads only wait for the swap.
+	EntryMap entries;
+	parseDatabase(tree.value(), entries);
+	tree.reset();
+
+	// The cache no longer matches the file, so rebuild it. It's written next to the current one,
+	// which stays mapped and in use until the swap.
+	const std::string cache_path = getCachePath();
+	const std::string new_cache_path = cache_path + ".new";
+	const bool cache_written = !cache_path.empty() && source.size > 0 && writeDatabaseCache(new_cache_path, source, entries);
+
+	std::unique_lock lock(s_game_db_mutex);
+
+	// The old cache has to be unmapped before the new one can replace it on disk.
+	// Decoded entries are copies, so nothing points into the old mapping.
+	s_game_db_cache.Close();
+	if (cache_written)
+	{
+		Error error;
+		if (FileSystem::RenamePath(new_cache_path.c_str(), cache_path.c_str(), &error))
+		{
+			openDatabaseCache(cache_path, source);
+		}
+		else
+		{
+			Console.ErrorFmt("GameDB: Failed to replace cache: {}", error.GetDescription());
+			FileSystem::DeleteFilePath(new_cache_path.c_str());
+		}
+	}
+
+	// Existing entries only get their snapshot swapped, other threads may be holding pointers to them.
+	u32 changed_entries = 0;
+	for (auto& [serial, entry] : s_game_db)
+	{
+		const auto iter = entries.find(serial);
+		std::shared_ptr<const GameDatabaseSchema::StereoRuleSets> sets = (iter != entries.end()) ? iter->second.stereoRuleSets : nullptr;
+		const bool same = (sets && entry.stereoRuleSets) ? (*sets == *entry.stereoRuleSets) : (!sets && !entry.stereoRuleSets);
+		if (!same)
+		{
+			entry.stereoRuleSets = std::move(sets);
+			changed_entries++;
+		}
+	}
+
+	// Without a cache, lookups only see what's in memory. New entries don't move the existing ones.
+	if (!s_game_db_cache.IsOpen())
+		s_game_db.merge(entries);
+
+	Console.WriteLn("GameDB: Reloaded stereo rules, %u entries changed (%.2fms)", changed_entries, timer.GetTimeMilliseconds());
+	return (changed_entries > 0);
+}
+
+bool GameDatabase::pollStereoRules()
+{
+	if (s_stereo_reload_thread.joinable())
+	{
+		if (!s_stereo_reload_done.load(std::memory_order_acquire))
+			return false;
+
+		s_stereo_reload_thread.join();
+		return s_stereo_reload_changed;
+	}
+
+	GameDatabase::ensureLoaded();
+
+	std::string path(Path::Combine(EmuFolders::Resources, GAMEDB_YAML_FILE_NAME));
+	FILESYSTEM_STAT_DATA sd;
+	if (!FileSystem::StatFile(path.c_str(), &sd) || sd.ModificationTime == s_game_db_modification_time)
+		return false;
+
+	s_game_db_modification_time = sd.ModificationTime;
+
+	// Parsing the whole YAML and rebuilding the cache takes a while, keep it off the CPU thread.
+	const GameDatabaseCache::SourceInfo source = {static_cast<u64>(sd.Size), sd.ModificationTime};
+	s_stereo_reload_done.store(false, std::memory_order_relaxed);
+	s_stereo_reload_thread = std::thread([path = std::move(path), source]() {
+		Threading::SetNameOfCurrentThread("GameDB Reload");
+		s_stereo_reload_changed = reloadStereoRules(path, source);
+		s_stereo_reload_done.store(true, std::memory_order_release);
+	});
+	return false;
+}
+
+void GameDatabase::waitForStereoRules()
+{
+	if (s_stereo_reload_thread.joinable())
+		s_stereo_reload_thread.join();
 }
 
 bool GameDatabase::TrackHash::parseHash(const std::string_view str)
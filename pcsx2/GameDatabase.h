@@ -9,6 +9,7 @@
 #include "common/FPControl.h"
 
 #include <cstring>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -85,6 +86,17 @@ namespace GameDatabaseSchema
 		Count
 	};
 
+	/// Named set of boolean stereo option overrides, from the `stereo:` section of a game entry.
+	struct StereoRuleSet
+	{
+		std::string name;
+		std::vector<std::pair<bool Pcsx2Config::GSOptions::*, bool>> options;
+
+		bool operator==(const StereoRuleSet& rhs) const = default;
+	};
+
+	using StereoRuleSets = std::vector<StereoRuleSet>;
+
 	struct GameEntry
 	{
 		std::string name;
@@ -102,6 +114,9 @@ namespace GameDatabaseSchema
 		std::vector<GamefixId> gameFixes;
 		std::vector<std::pair<SpeedHack, int>> speedHacks;
 		std::vector<std::pair<GSHWFixId, s32>> gsHWFixes;
+		// Replaced as a whole when the rules are reloaded, while other threads may be using the entry.
+		// Null if the game has none. Only read through applyStereoRules(), which takes the GameDB lock.
+		std::shared_ptr<const StereoRuleSets> stereoRuleSets;
 		std::vector<std::string> memcardFilters;
 		std::unordered_map<u32, std::string> patches;
 		std::vector<Patch::DynamicPatch> dynaPatches;
@@ -117,6 +132,9 @@ namespace GameDatabaseSchema
 		/// Applies GS hardware fixes to an existing config.
 		void applyGSHardwareFixes(Pcsx2Config::GSOptions& config) const;
 
+		/// Applies the stereo rule set named by StereoProfile to an existing config.
+		void applyStereoRules(Pcsx2Config::GSOptions& config) const;
+
 		/// Returns true if the current config value for the specified hw fix id matches the value.
 		static bool configMatchesHWFix(const Pcsx2Config::GSOptions& config, GSHWFixId id, int value);
 	};
@@ -127,6 +145,15 @@ namespace GameDatabase
 	void ensureLoaded();
 	const GameDatabaseSchema::GameEntry* findGame(const std::string_view serial);
 
+	/// Starts re-reading the stereo rule sets on a worker thread if the GameDB was modified since it
+	/// was last read. The lookup cache is rebuilt from the new file, and only the stereo sections of
+	/// existing entries are replaced, so entry pointers stay valid. Returns true once the reload has
+	/// finished, if any rule set changed.
+	bool pollStereoRules();
+
+	/// Waits for a reload started by pollStereoRules() to finish.
+	void waitForStereoRules();
+
 	struct TrackHash
 	{
 		static constexpr u32 SIZE = 16;
@@ -0,0 +1,523 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "GameDatabaseCache.h"
+#include "BuildVersion.h"
+#include "GS/Renderers/HW/GSStereoFilter.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+#include "common/RedtapeWindows.h"
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
+
+static constexpr u32 CACHE_SIGNATURE = 0x43424447; // GDBC
+static constexpr u32 CACHE_VERSION = 1;
+
+// Enum values are stored as-is, so a build which renumbers any of these can't reuse the cache.
+static constexpr u32 SCHEMA_FINGERPRINT = static_cast<u32>(GamefixId_COUNT) |
+										  (static_cast<u32>(SpeedHack::MaxCount) << 8) |
+										  (static_cast<u32>(GameDatabaseSchema::GSHWFixId::Count) << 16) |
+										  (static_cast<u32>(FPRoundMode::MaxCount) << 24);
+
+struct GameDatabaseCache::Header
+{
+	u32 signature;
+	u32 version;
+	u32 schema;
+	u32 entry_count;
+	u64 source_size;
+	s64 source_modification_time;
+	u32 build_offset;
+	u32 build_length;
+	u32 index_offset;
+	u32 data_offset;
+	u32 data_size;
+	u32 strings_offset;
+	u32 strings_size;
+	u32 reserved;
+};
+
+struct GameDatabaseCache::IndexEntry
+{
+	u32 serial_offset;
+	u32 serial_length;
+	u32 data_offset;
+	u32 data_length;
+};
+
+namespace
+{
+	/// Serializes entries into u32s, deduplicating strings into a shared pool.
+	class EntryWriter
+	{
+	public:
+		std::vector<u32>& GetData() { return m_data; }
+		const std::string& GetStrings() const { return m_strings; }
+
+		void WriteU32(u32 value) { m_data.push_back(value); }
+
+		void WriteCount(size_t count) { m_data.push_back(static_cast<u32>(count)); }
+
+		void WriteString(const std::string_view str)
+		{
+			m_data.push_back(AddString(str));
+			m_data.push_back(static_cast<u32>(str.size()));
+		}
+
+		u32 AddString(const std::string_view str)
+		{
+			if (str.empty())
+				return 0;
+
+			const auto [iter, inserted] = m_string_offsets.emplace(str, static_cast<u32>(m_strings.size()));
+			if (inserted)
+				m_strings.append(str);
+
+			return iter->second;
+		}
+
+	private:
+		std::vector<u32> m_data;
+		std::string m_strings;
+		std::unordered_map<std::string, u32> m_string_offsets;
+	};
+
+	/// Reads an entry back, with every access bounds checked in case the file was damaged.
+	class EntryReader
+	{
+	public:
+		EntryReader(const u32* data, size_t size, std::string_view strings)
+			: m_pos(data)
+			, m_end(data + size)
+			, m_strings(strings)
+		{
+		}
+
+		bool HasFailed() const { return m_failed; }
+
+		u32 ReadU32()
+		{
+			if (m_pos == m_end)
+			{
+				m_failed = true;
+				return 0;
+			}
+
+			return *(m_pos++);
+		}
+
+		/// Reads an item count, rejecting counts which can't possibly fit in the rest of the entry.
+		u32 ReadCount(u32 words_per_item)
+		{
+			const u32 count = ReadU32();
+			if (static_cast<u64>(count) * words_per_item > static_cast<u64>(m_end - m_pos))
+			{
+				m_failed = true;
+				return 0;
+			}
+
+			return count;
+		}
+
+		std::string_view ReadStringView()
+		{
+			const u32 offset = ReadU32();
+			const u32 length = ReadU32();
+			if (offset > m_strings.size() || length > (m_strings.size() - offset))
+			{
+				m_failed = true;
+				return {};
+			}
+
+			return m_strings.substr(offset, length);
+		}
+
+		std::string ReadString() { return std::string(ReadStringView()); }
+
+	private:
+		const u32* m_pos;
+		const u32* m_end;
+		std::string_view m_strings;
+		bool m_failed = false;
+	};
+} // namespace
+
+static void WriteEntry(EntryWriter& writer, const GameDatabaseSchema::GameEntry& entry)
+{
+	writer.WriteString(entry.name);
+	writer.WriteString(entry.name_sort);
+	writer.WriteString(entry.name_en);
+	writer.WriteString(entry.region);
+	writer.WriteU32(static_cast<u32>(entry.compat));
+	writer.WriteU32(static_cast<u32>(entry.eeRoundMode));
+	writer.WriteU32(static_cast<u32>(entry.eeDivRoundMode));
+	writer.WriteU32(static_cast<u32>(entry.vu0RoundMode));
+	writer.WriteU32(static_cast<u32>(entry.vu1RoundMode));
+	writer.WriteU32(static_cast<u32>(entry.eeClampMode));
+	writer.WriteU32(static_cast<u32>(entry.vu0ClampMode));
+	writer.WriteU32(static_cast<u32>(entry.vu1ClampMode));
+
+	writer.WriteCount(entry.gameFixes.size());
+	for (const GamefixId id : entry.gameFixes)
+		writer.WriteU32(static_cast<u32>(id));
+
+	writer.WriteCount(entry.speedHacks.size());
+	for (const auto& [id, value] : entry.speedHacks)
+	{
+		writer.WriteU32(static_cast<u32>(id));
+		writer.WriteU32(static_cast<u32>(value));
+	}
+
+	writer.WriteCount(entry.gsHWFixes.size());
+	for (const auto& [id, value] : entry.gsHWFixes)
+	{
+		writer.WriteU32(static_cast<u32>(id));
+		writer.WriteU32(static_cast<u32>(value));
+	}
+
+	// Options are member pointers, so they're stored by name.
+	static const GameDatabaseSchema::StereoRuleSets no_rule_sets;
+	const GameDatabaseSchema::StereoRuleSets& rule_sets = entry.stereoRuleSets ? *entry.stereoRuleSets : no_rule_sets;
+	writer.WriteCount(rule_sets.size());
+	for (const GameDatabaseSchema::StereoRuleSet& rule_set : rule_sets)
+	{
+		writer.WriteString(rule_set.name);
+		writer.WriteCount(rule_set.options.size());
+		for (const auto& [option, value] : rule_set.options)
+		{
+			writer.WriteString(GSStereoDrawFilter::GetOptionName(option));
+			writer.WriteU32(value);
+		}
+	}
+
+	writer.WriteCount(entry.memcardFilters.size());
+	for (const std::string& filter : entry.memcardFilters)
+		writer.WriteString(filter);
+
+	// Sorted, so the output doesn't depend on hash map ordering.
+	std::vector<std::pair<u32, std::string_view>> patches(entry.patches.begin(), entry.patches.end());
+	std::sort(patches.begin(), patches.end());
+	writer.WriteCount(patches.size());
+	for (const auto& [crc, patch] : patches)
+	{
+		writer.WriteU32(crc);
+		writer.WriteString(patch);
+	}
+
+	writer.WriteCount(entry.dynaPatches.size());
+	for (const Patch::DynamicPatch& patch : entry.dynaPatches)
+	{
+		for (const std::vector<Patch::DynamicPatchEntry>* list : {&patch.pattern, &patch.replacement})
+		{
+			writer.WriteCount(list->size());
+			for (const Patch::DynamicPatchEntry& patch_entry : *list)
+			{
+				writer.WriteU32(patch_entry.offset);
+				writer.WriteU32(patch_entry.value);
+			}
+		}
+	}
+}
+
+static bool ReadEntry(EntryReader& reader, GameDatabaseSchema::GameEntry* entry)
+{
+	entry->name = reader.ReadString();
+	entry->name_sort = reader.ReadString();
+	entry->name_en = reader.ReadString();
+	entry->region = reader.ReadString();
+	entry->compat = static_cast<GameDatabaseSchema::Compatibility>(reader.ReadU32());
+	entry->eeRoundMode = static_cast<FPRoundMode>(reader.ReadU32());
+	entry->eeDivRoundMode = static_cast<FPRoundMode>(reader.ReadU32());
+	entry->vu0RoundMode = static_cast<FPRoundMode>(reader.ReadU32());
+	entry->vu1RoundMode = static_cast<FPRoundMode>(reader.ReadU32());
+	entry->eeClampMode = static_cast<GameDatabaseSchema::ClampMode>(reader.ReadU32());
+	entry->vu0ClampMode = static_cast<GameDatabaseSchema::ClampMode>(reader.ReadU32());
+	entry->vu1ClampMode = static_cast<GameDatabaseSchema::ClampMode>(reader.ReadU32());
+
+	const u32 num_game_fixes = reader.ReadCount(1);
+	entry->gameFixes.reserve(num_game_fixes);
+	for (u32 i = 0; i < num_game_fixes; i++)
+		entry->gameFixes.push_back(static_cast<GamefixId>(reader.ReadU32()));
+
+	const u32 num_speed_hacks = reader.ReadCount(2);
+	entry->speedHacks.reserve(num_speed_hacks);
+	for (u32 i = 0; i < num_speed_hacks; i++)
+	{
+		const SpeedHack id = static_cast<SpeedHack>(reader.ReadU32());
+		entry->speedHacks.emplace_back(id, static_cast<int>(reader.ReadU32()));
+	}
+
+	const u32 num_hw_fixes = reader.ReadCount(2);
+	entry->gsHWFixes.reserve(num_hw_fixes);
+	for (u32 i = 0; i < num_hw_fixes; i++)
+	{
+		const GameDatabaseSchema::GSHWFixId id = static_cast<GameDatabaseSchema::GSHWFixId>(reader.ReadU32());
+		entry->gsHWFixes.emplace_back(id, static_cast<s32>(reader.ReadU32()));
+	}
+
+	const u32 num_rule_sets = reader.ReadCount(3);
+	GameDatabaseSchema::StereoRuleSets rule_sets(num_rule_sets);
+	for (GameDatabaseSchema::StereoRuleSet& rule_set : rule_sets)
+	{
+		rule_set.name = reader.ReadString();
+		const u32 num_options = reader.ReadCount(3);
+		for (u32 i = 0; i < num_options; i++)
+		{
+			const GSStereoDrawFilter::Option option = GSStereoDrawFilter::FindOption(reader.ReadStringView());
+			const bool value = (reader.ReadU32() != 0);
+			if (option)
+				rule_set.options.emplace_back(option, value);
+		}
+	}
+
+	if (!rule_sets.empty())
+		entry->stereoRuleSets = std::make_shared<const GameDatabaseSchema::StereoRuleSets>(std::move(rule_sets));
+
+	const u32 num_memcard_filters = reader.ReadCount(2);
+	entry->memcardFilters.reserve(num_memcard_filters);
+	for (u32 i = 0; i < num_memcard_filters; i++)
+		entry->memcardFilters.push_back(reader.ReadString());
+
+	const u32 num_patches = reader.ReadCount(3);
+	for (u32 i = 0; i < num_patches; i++)
+	{
+		const u32 crc = reader.ReadU32();
+		entry->patches.emplace(crc, reader.ReadString());
+	}
+
+	const u32 num_dyna_patches = reader.ReadCount(2);
+	entry->dynaPatches.resize(num_dyna_patches);
+	for (Patch::DynamicPatch& patch : entry->dynaPatches)
+	{
+		for (std::vector<Patch::DynamicPatchEntry>* list : {&patch.pattern, &patch.replacement})
+		{
+			const u32 num_entries = reader.ReadCount(2);
+			list->resize(num_entries);
+			for (Patch::DynamicPatchEntry& patch_entry : *list)
+			{
+				patch_entry.offset = reader.ReadU32();
+				patch_entry.value = reader.ReadU32();
+			}
+		}
+	}
+
+	return !reader.HasFailed();
+}
+
+GameDatabaseCache::GameDatabaseCache() = default;
+
+GameDatabaseCache::~GameDatabaseCache()
+{
+	Close();
+}
+
+bool GameDatabaseCache::Write(const std::string& path, const SourceInfo& source,
+	const std::unordered_map<std::string, GameDatabaseSchema::GameEntry>& entries, Error* error)
+{
+	std::vector<const std::pair<const std::string, GameDatabaseSchema::GameEntry>*> sorted_entries;
+	sorted_entries.reserve(entries.size());
+	for (const auto& it : entries)
+		sorted_entries.push_back(&it);
+	std::sort(sorted_entries.begin(), sorted_entries.end(), [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+	EntryWriter writer;
+	std::vector<IndexEntry> index;
+	index.reserve(sorted_entries.size());
+	for (const auto* it : sorted_entries)
+	{
+		const u32 data_offset = static_cast<u32>(writer.GetData().size());
+		WriteEntry(writer, it->second);
+		index.push_back({writer.AddString(it->first), static_cast<u32>(it->first.size()), data_offset,
+			static_cast<u32>(writer.GetData().size()) - data_offset});
+	}
+
+	const std::string_view build = BuildVersion::GitHash;
+	const u32 build_offset = writer.AddString(build);
+
+	const std::vector<u32>& data = writer.GetData();
+	const std::string& strings = writer.GetStrings();
+
+	Header header = {};
+	header.signature = CACHE_SIGNATURE;
+	header.version = CACHE_VERSION;
+	header.schema = SCHEMA_FINGERPRINT;
+	header.entry_count = static_cast<u32>(index.size());
+	header.source_size = source.size;
+	header.source_modification_time = static_cast<s64>(source.modification_time);
+	header.build_offset = build_offset;
+	header.build_length = static_cast<u32>(build.size());
+	header.index_offset = sizeof(Header);
+	header.data_offset = header.index_offset + static_cast<u32>(index.size() * sizeof(IndexEntry));
+	header.data_size = static_cast<u32>(data.size() * sizeof(u32));
+	header.strings_offset = header.data_offset + header.data_size;
+	header.strings_size = static_cast<u32>(strings.size());
+
+	// Written under a temporary name so a partial file never looks valid.
+	const std::string temp_path = path + ".tmp";
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(temp_path.c_str(), "wb", error);
+	if (!fp)
+		return false;
+
+	const bool written = std::fwrite(&header, sizeof(header), 1, fp.get()) == 1 &&
+						 std::fwrite(index.data(), sizeof(IndexEntry), index.size(), fp.get()) == index.size() &&
+						 std::fwrite(data.data(), sizeof(u32), data.size(), fp.get()) == data.size() &&
+						 std::fwrite(strings.data(), 1, strings.size(), fp.get()) == strings.size() &&
+						 std::fflush(fp.get()) == 0;
+	fp.reset();
+	if (!written)
+	{
+		Error::SetErrno(error, "fwrite() failed: ", errno);
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return false;
+	}
+
+	if (!FileSystem::RenamePath(temp_path.c_str(), path.c_str(), error))
+	{
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool GameDatabaseCache::Open(const std::string& path, const SourceInfo& source, Error* error)
+{
+	Close();
+
+	FileSystem::ManagedCFilePtr fp = FileSystem::OpenManagedCFile(path.c_str(), "rb", error);
+	if (!fp)
+		return false;
+
+	const s64 size = FileSystem::FSize64(fp.get());
+	if (size < static_cast<s64>(sizeof(Header)))
+	{
+		Error::SetString(error, "Cache file is truncated.");
+		return false;
+	}
+
+#ifdef _WIN32
+	const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(fp.get())));
+	const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+	{
+		Error::SetWin32(error, "CreateFileMappingW() failed: ", GetLastError());
+		return false;
+	}
+
+	// The view keeps the mapping alive.
+	void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!data)
+	{
+		Error::SetWin32(error, "MapViewOfFile() failed: ", GetLastError());
+		return false;
+	}
+#else
+	void* data = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, fileno(fp.get()), 0);
+	if (data == MAP_FAILED)
+	{
+		Error::SetErrno(error, "mmap() failed: ", errno);
+		return false;
+	}
+#endif
+
+	m_data = static_cast<const u8*>(data);
+	m_size = static_cast<size_t>(size);
+
+	Header header;
+	std::memcpy(&header, m_data, sizeof(header));
+	const auto in_file = [this](u64 offset, u64 length) { return (offset <= m_size && length <= (m_size - offset)); };
+	if (header.signature != CACHE_SIGNATURE || header.version != CACHE_VERSION || header.schema != SCHEMA_FINGERPRINT ||
+		!in_file(header.index_offset, static_cast<u64>(header.entry_count) * sizeof(IndexEntry)) ||
+		!in_file(header.data_offset, header.data_size) || !in_file(header.strings_offset, header.strings_size) ||
+		(header.index_offset % alignof(IndexEntry)) != 0 || (header.data_offset % alignof(u32)) != 0)
+	{
+		Error::SetString(error, "Cache file is invalid or from an older version.");
+		Close();
+		return false;
+	}
+
+	m_strings = std::string_view(reinterpret_cast<const char*>(m_data + header.strings_offset), header.strings_size);
+	if (header.build_offset > m_strings.size() || header.build_length > (m_strings.size() - header.build_offset) ||
+		m_strings.substr(header.build_offset, header.build_length) != BuildVersion::GitHash)
+	{
+		Error::SetString(error, "Cache file was written by a different build.");
+		Close();
+		return false;
+	}
+
+	if (header.source_size != source.size || header.source_modification_time != static_cast<s64>(source.modification_time))
+	{
+		Error::SetString(error, "Cache file is out of date.");
+		Close();
+		return false;
+	}
+
+	m_index = reinterpret_cast<const IndexEntry*>(m_data + header.index_offset);
+	m_entry_count = header.entry_count;
+	m_entry_data = reinterpret_cast<const u32*>(m_data + header.data_offset);
+	m_entry_data_size = header.data_size / sizeof(u32);
+	return true;
+}
+
+void GameDatabaseCache::Close()
+{
+	if (!m_data)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+#else
+	munmap(const_cast<u8*>(m_data), m_size);
+#endif
+
+	m_data = nullptr;
+	m_size = 0;
+	m_index = nullptr;
+	m_entry_count = 0;
+	m_entry_data = nullptr;
+	m_entry_data_size = 0;
+	m_strings = {};
+}
+
+bool GameDatabaseCache::Find(const std::string_view serial, GameDatabaseSchema::GameEntry* entry) const
+{
+	const auto get_serial = [this](const IndexEntry& ie) {
+		return (ie.serial_offset <= m_strings.size() && ie.serial_length <= (m_strings.size() - ie.serial_offset)) ?
+				   m_strings.substr(ie.serial_offset, ie.serial_length) :
+				   std::string_view();
+	};
+
+	const IndexEntry* end = m_index + m_entry_count;
+	const IndexEntry* it = std::lower_bound(m_index, end, serial,
+		[&get_serial](const IndexEntry& ie, const std::string_view value) { return get_serial(ie) < value; });
+	if (it == end || get_serial(*it) != serial)
+		return false;
+
+	if (it->data_offset > m_entry_data_size || it->data_length > (m_entry_data_size - it->data_offset))
+	{
+		Console.ErrorFmt("GameDB: Cache entry for '{}' is out of bounds.", serial);
+		return false;
+	}
+
+	*entry = {};
+	EntryReader reader(m_entry_data + it->data_offset, it->data_length, m_strings);
+	if (!ReadEntry(reader, entry))
+	{
+		Console.ErrorFmt("GameDB: Cache entry for '{}' is corrupted.", serial);
+		return false;
+	}
+
+	return true;
+}
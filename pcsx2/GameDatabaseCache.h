@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "GameDatabase.h"
+
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class Error;
+
+/// Precompiled form of GameIndex.yaml. Entries are serialized into a flat array of u32s which
+/// reference a shared string pool, with an index sorted by serial. The file is memory mapped and
+/// only the entries which are actually looked up get decoded, so startup doesn't pay for parsing
+/// every game in the database.
+class GameDatabaseCache
+{
+public:
+	/// Identifies the YAML file the cache was compiled from.
+	struct SourceInfo
+	{
+		u64 size;
+		std::time_t modification_time;
+	};
+
+	GameDatabaseCache();
+	~GameDatabaseCache();
+
+	/// Writes entries to path. Serials must already be lower case.
+	static bool Write(const std::string& path, const SourceInfo& source,
+		const std::unordered_map<std::string, GameDatabaseSchema::GameEntry>& entries, Error* error);
+
+	/// Maps the cache at path. Fails if it was compiled from a different source or by a different build.
+	bool Open(const std::string& path, const SourceInfo& source, Error* error);
+	void Close();
+
+	bool IsOpen() const { return (m_data != nullptr); }
+	u32 GetEntryCount() const { return m_entry_count; }
+
+	/// Decodes the entry for a lower case serial. Returns false if it isn't in the cache.
+	bool Find(const std::string_view serial, GameDatabaseSchema::GameEntry* entry) const;
+
+private:
+	struct Header;
+	struct IndexEntry;
+
+	const u8* m_data = nullptr;
+	size_t m_size = 0;
+	const IndexEntry* m_index = nullptr;
+	u32 m_entry_count = 0;
+	const u32* m_entry_data = nullptr;
+	size_t m_entry_data_size = 0;
+	std::string_view m_strings;
+};
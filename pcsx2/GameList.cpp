@@ -18,18 +18,27 @@
 #include "common/ProgressCallback.h"
 #include "common/ScopedGuard.h"
 #include "common/StringUtil.h"
+#include "common/Threading.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
 #include <cstdio>
 #include <ctime>
 #include <fstream>
 #include <string_view>
+#include <thread>
 #include <utility>
 
-#ifdef _WIN32
+#if defined(_WIN32)
 #include "common/RedtapeWindows.h"
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+#include <sys/mount.h>
+#include <sys/param.h>
+#elif defined(__linux__)
+#include <sys/vfs.h>
 #endif
 
 namespace GameList
@@ -255,18 +264,14 @@ bool GameList::GetIsoSerialAndCRC(const std::string& path, s32* disc_type, std::
 {
 	Error error;
 
-	// This isn't great, we really want to make it all thread-local...
-	CDVD = &CDVDapi_Iso;
-	if (!CDVD->open(path, &error))
+	// Reads the image directly rather than through the global CDVD source, since scanner threads call this concurrently.
+	// TODO: we could include the version in the game list?
+	if (!cdvdGetImageInfo(path, disc_type, serial, crc, &error))
 	{
 		Console.Error(fmt::format("(GameList::GetIsoSerialAndCRC) CDVD open of '{}' failed: {}", path, error.GetDescription()));
 		return false;
 	}
 
-	// TODO: we could include the version in the game list?
-	*disc_type = DoCDVDdetectDiskType();
-	cdvdGetDiscInfo(serial, nullptr, nullptr, crc, nullptr);
-	DoCDVDclose();
 	return true;
 }
 
@@ -680,6 +685,60 @@ static bool IsPathExcluded(const std::vector<std::string>& excluded_paths, const
 	return std::find_if(excluded_paths.begin(), excluded_paths.end(), [&path](const std::string& entry) { return !entry.empty() && path.starts_with(entry); }) != excluded_paths.end();
 }
 
+// Network shares are mostly waiting on round trips, so they benefit from more files being read at once. Local disks
+// are usually limited by seeking instead, where too many readers just thrash the drive.
+static bool IsNetworkPath(const char* path)
+{
+#if defined(_WIN32)
+	const std::wstring wpath(FileSystem::GetWin32Path(path));
+
+	// \\server\share, or \\?\UNC\server\share once it's been through GetWin32Path().
+	if (wpath.starts_with(L"\\\\?\\UNC\\") || (wpath.starts_with(L"\\\\") && !wpath.starts_with(L"\\\\?\\")))
+		return true;
+
+	const std::wstring_view local = wpath.starts_with(L"\\\\?\\") ? std::wstring_view(wpath).substr(4) : std::wstring_view(wpath);
+	if (local.size() < 2 || local[1] != L':')
+		return false;
+
+	const wchar_t root[] = {local[0], L':', L'\\', L'\0'};
+	return (GetDriveTypeW(root) == DRIVE_REMOTE);
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+	struct statfs sfs;
+	return (statfs(path, &sfs) == 0 && !(sfs.f_flags & MNT_LOCAL));
+#elif defined(__linux__)
+	static constexpr u32 NFS_SUPER_MAGIC = 0x6969;
+	static constexpr u32 SMB_SUPER_MAGIC = 0x517B;
+	static constexpr u32 CIFS_SUPER_MAGIC = 0xFF534D42;
+	static constexpr u32 SMB2_SUPER_MAGIC = 0xFE534D42;
+	static constexpr u32 V9FS_MAGIC = 0x01021997;
+
+	struct statfs sfs;
+	if (statfs(path, &sfs) != 0)
+		return false;
+
+	const u32 type = static_cast<u32>(sfs.f_type);
+	return (type == NFS_SUPER_MAGIC || type == SMB_SUPER_MAGIC || type == CIFS_SUPER_MAGIC ||
+			type == SMB2_SUPER_MAGIC || type == V9FS_MAGIC);
+#else
+	return false;
+#endif
+}
+
+static u32 GetScanThreadCount(const char* path)
+{
+	static constexpr u32 LOCAL_SCAN_THREADS = 4;
+	static constexpr u32 NETWORK_SCAN_THREADS = 8;
+	static constexpr u32 MAX_SCAN_THREADS = 32;
+
+	if (const u32 threads = Host::GetBaseUIntSettingValue("GameList", "ScanThreads", 0); threads > 0)
+		return std::min(threads, MAX_SCAN_THREADS);
+
+	if (IsNetworkPath(path))
+		return NETWORK_SCAN_THREADS;
+
+	return std::clamp(std::thread::hardware_concurrency(), 1u, LOCAL_SCAN_THREADS);
+}
+
 void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache, const std::vector<std::string>& excluded_paths,
 	const PlayedTimeMap& played_time_map, const INISettingsInterface& custom_attributes_ini, ProgressCallback* progress)
 {
@@ -704,25 +763,97 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 	progress->SetProgressRange(static_cast<u32>(files.size()));
 	progress->SetProgressValue(0);
 
+	// Cached files are added straight away, the rest are opened by the scanner threads below.
+	std::vector<FILESYSTEM_FIND_DATA*> uncached_files;
 	for (FILESYSTEM_FIND_DATA& ffd : files)
 	{
-		files_scanned++;
-
 		if (progress->IsCancelled() || !GameList::IsScannableFilename(ffd.FileName) || IsPathExcluded(excluded_paths, ffd.FileName))
 		{
+			files_scanned++;
 			continue;
 		}
 
 		std::unique_lock lock(s_mutex);
 		if (GetEntryForPath(ffd.FileName.c_str()) || AddFileFromCache(ffd.FileName, ffd.ModificationTime, played_time_map) || only_cache)
 		{
+			files_scanned++;
 			continue;
 		}
 
-		const std::string_view filename = Path::GetFileName(ffd.FileName);
-		progress->SetStatusText(fmt::format(TRANSLATE_FS("GameList", "Scanning {}..."), filename.data()).c_str());
-		ScanFile(std::move(ffd.FileName), ffd.ModificationTime, lock, played_time_map, custom_attributes_ini);
-		progress->SetProgressValue(files_scanned);
+		uncached_files.push_back(&ffd);
+	}
+
+	progress->SetProgressValue(files_scanned);
+
+	if (!uncached_files.empty() && !progress->IsCancelled())
+	{
+		// Each thread has one file open at a time, so the thread count also limits how many reads are in flight.
+		const u32 thread_count = std::min(GetScanThreadCount(path), static_cast<u32>(uncached_files.size()));
+		DevCon.WriteLn("Scanning %zu files with %u threads", uncached_files.size(), thread_count);
+
+		std::mutex progress_mutex;
+		std::condition_variable progress_cv;
+		std::string last_filename;
+		size_t files_completed = 0;
+		std::atomic_bool cancelled{false};
+		std::atomic<size_t> next_file{0};
+
+		const auto scan_thread = [&]() {
+			Threading::SetNameOfCurrentThread("Game List Scanner");
+			for (;;)
+			{
+				const size_t index = next_file.fetch_add(1, std::memory_order_relaxed);
+				if (index >= uncached_files.size() || cancelled.load(std::memory_order_relaxed))
+					break;
+
+				FILESYSTEM_FIND_DATA* ffd = uncached_files[index];
+				std::string filename(Path::GetFileName(ffd->FileName));
+				{
+					std::unique_lock lock(s_mutex);
+					ScanFile(std::move(ffd->FileName), ffd->ModificationTime, lock, played_time_map, custom_attributes_ini);
+				}
+
+				std::unique_lock progress_lock(progress_mutex);
+				last_filename = std::move(filename);
+				files_completed++;
+				progress_cv.notify_one();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count);
+		for (u32 i = 0; i < thread_count; i++)
+			threads.emplace_back(scan_thread);
+
+		// The progress callback isn't thread safe, so it's only updated from here.
+		{
+			std::unique_lock progress_lock(progress_mutex);
+			size_t files_reported = 0;
+			while (files_reported < uncached_files.size())
+			{
+				progress_cv.wait_for(progress_lock, std::chrono::milliseconds(100));
+				if (progress->IsCancelled())
+				{
+					cancelled.store(true, std::memory_order_relaxed);
+					break;
+				}
+
+				if (files_completed == files_reported)
+					continue;
+
+				files_reported = files_completed;
+				const std::string status(fmt::format(TRANSLATE_FS("GameList", "Scanning {}..."), last_filename));
+				progress_lock.unlock();
+				progress->SetStatusText(status.c_str());
+				progress->SetProgressValue(files_scanned + static_cast<u32>(files_reported));
+				progress_lock.lock();
+			}
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		files_scanned += static_cast<u32>(files_completed);
 	}
 
 	progress->SetProgressValue(files_scanned);
@@ -764,6 +895,9 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
 
 	entry.last_modified_time = timestamp;
 
+	// the cache file is shared with any other scanner threads
+	lock.lock();
+
 	if (s_cache_write_stream || OpenCacheForWriting())
 	{
 		if (!WriteEntryToCache(&entry))
@@ -773,7 +907,6 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
 	if (entry.type == EntryType::Invalid)
 	{
 		// don't add invalid entries to list
-		lock.lock();
 		return true;
 	}
 
@@ -799,8 +932,6 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
 		}
 	}
 
-	lock.lock();
-
 	// remove if present
 	auto it = std::find_if(
 		s_entries.begin(), s_entries.end(), [&entry](const Entry& existing_entry) { return (existing_entry.path == entry.path); });
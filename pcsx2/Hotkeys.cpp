@@ -9,6 +9,7 @@
 #include "ImGui/ImGuiOverlays.h"
 #include "Input/InputManager.h"
 #include "Recording/InputRecording.h"
+#include "Rewind.h"
 #include "SPU2/spu2.h"
 #include "VMManager.h"
 #include "SIO/Memcard/MemoryCardFile.h"
@@ -293,6 +294,11 @@ DEFINE_HOTKEY("SelectNextSlotAndSaveState", TRANSLATE_NOOP("Hotkeys", "Save Stat
 			SaveStateSelectorUI::SaveCurrentSlot();
 		}
 	})
+DEFINE_HOTKEY("HoldRewind", TRANSLATE_NOOP("Hotkeys", "Save States"),
+	TRANSLATE_NOOP("Hotkeys", "Rewind (Hold)"), [](s32 pressed) {
+		if (VMManager::HasValidVM() && pressed >= 0)
+			Rewind::SetRewinding(pressed > 0);
+	})
 
 #define DEFINE_HOTKEY_SAVESTATE_X(slotnum, title) \
 	DEFINE_HOTKEY("SaveStateToSlot" #slotnum, "Save States", title, [](s32 pressed) { \
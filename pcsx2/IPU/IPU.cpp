@@ -4,6 +4,7 @@
 #include "Common.h"
 
 #include "IPU.h"
+#include "IPU_DecodeAhead.h"
 #include "IPU_MultiISA.h"
 #include "IPUdma.h"
 
@@ -102,6 +103,7 @@ void ipuReset()
 	ipu_fifo.init();
 	ipu_cmd.clear();
 	ipuDmaReset();
+	IPUDecodeAhead::Reset();
 }
 
 void ReportIPU()
@@ -135,6 +137,9 @@ bool SaveStateBase::ipuFreeze()
 	Freeze(ipu_cmd);
 	Freeze(IPUCoreStatus);
 
+	if (IsLoading())
+		IPUDecodeAhead::Reset();
+
 	return IsOkay();
 }
 
@@ -0,0 +1,650 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-2.0+
+
+// Some of the functions in this file are based on the mpeg2dec library,
+//
+// Copyright (C) 2000-2002 Michel Lespinasse <walken@zoy.org>
+// Copyright (C) 1999-2000 Aaron Holtzman <aholtzma@ess.engr.uvic.ca>
+//
+// under the GPL license. However, they have been heavily rewritten for PCSX2 usage.
+// The original author's copyright statement is included above for completeness sake.
+
+// The bitstream reader and the intra macroblock decoder. IPU_MultiISA.cpp includes this twice:
+// once for the IPU, and once in a namespace where decoder, g_BP, ipu_cmd and g_ipu_thresh are
+// the decode thread's own copies (see IPU_DecodeAhead.h). No #pragma once for that reason.
+
+// --------------------------------------------------------------------------------------
+//  Buffer reader
+// --------------------------------------------------------------------------------------
+
+__ri static u32 UBITS(uint bits)
+{
+	uint readpos8 = g_BP.BP/8;
+
+	uint result = BigEndian(*(u32*)( (u8*)g_BP.internal_qwc + readpos8 ));
+	uint bp7 = (g_BP.BP & 7);
+	result <<= bp7;
+	result >>= (32 - bits);
+
+	return result;
+}
+
+__ri static s32 SBITS(uint bits)
+{
+	// Read an unaligned 32 bit value and then shift the bits up and then back down.
+
+	uint readpos8 = g_BP.BP/8;
+
+	int result = BigEndian(*(s32*)( (s8*)g_BP.internal_qwc + readpos8 ));
+	uint bp7 = (g_BP.BP & 7);
+	result <<= bp7;
+	result >>= (32 - bits);
+
+	return result;
+}
+
+__fi static int GETWORD()
+{
+	return g_BP.FillBuffer(16);
+}
+
+// Removes bits from the bitstream.  This is done independently of UBITS/SBITS because a
+// lot of mpeg streams have to read ahead and rewind bits and re-read them at different
+// bit depths or sign'age.
+__fi static void DUMPBITS(uint num)
+{
+	g_BP.Advance(num);
+	//pxAssume(g_BP.FP != 0);
+}
+
+__fi static u32 GETBITS(uint num)
+{
+	uint retVal = UBITS(num);
+	g_BP.Advance(num);
+
+	return retVal;
+}
+
+static const DCTtab * tab;
+static int mbaCount = 0;
+
+static int GetMacroblockModes()
+{
+	int macroblock_modes;
+	const MBtab * tab;
+
+	switch (decoder.coding_type)
+	{
+		case I_TYPE:
+			macroblock_modes = UBITS(2);
+
+			if (macroblock_modes == 0) return 0;   // error
+
+			tab = MB_I + (macroblock_modes >> 1);
+			DUMPBITS(tab->len);
+			macroblock_modes = tab->modes;
+
+			if ((!(decoder.frame_pred_frame_dct)) &&
+				(decoder.picture_structure == FRAME_PICTURE))
+			{
+				macroblock_modes |= GETBITS(1) * DCT_TYPE_INTERLACED;
+			}
+			return macroblock_modes;
+
+		case P_TYPE:
+			macroblock_modes = UBITS(6);
+
+			if (macroblock_modes == 0) return 0;   // error
+
+			tab = MB_P + (macroblock_modes >> 1);
+			DUMPBITS(tab->len);
+			macroblock_modes = tab->modes;
+
+			if (decoder.picture_structure != FRAME_PICTURE)
+			{
+				if (macroblock_modes & MACROBLOCK_MOTION_FORWARD)
+				{
+					macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
+				}
+
+				return macroblock_modes;
+			}
+			else if (decoder.frame_pred_frame_dct)
+			{
+				if (macroblock_modes & MACROBLOCK_MOTION_FORWARD)
+					macroblock_modes |= MC_FRAME;
+
+				return macroblock_modes;
+			}
+			else
+			{
+				if (macroblock_modes & MACROBLOCK_MOTION_FORWARD)
+				{
+					macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
+				}
+
+				if (macroblock_modes & (MACROBLOCK_INTRA | MACROBLOCK_PATTERN))
+				{
+					macroblock_modes |= GETBITS(1) * DCT_TYPE_INTERLACED;
+				}
+
+				return macroblock_modes;
+			}
+
+		case B_TYPE:
+			macroblock_modes = UBITS(6);
+
+			if (macroblock_modes == 0) return 0;   // error
+
+			tab = MB_B + macroblock_modes;
+			DUMPBITS(tab->len);
+			macroblock_modes = tab->modes;
+
+			if (decoder.picture_structure != FRAME_PICTURE)
+			{
+				if (!(macroblock_modes & MACROBLOCK_INTRA))
+				{
+					macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
+				}
+				return (macroblock_modes | (tab->len << 16));
+			}
+			else if (decoder.frame_pred_frame_dct)
+			{
+				/* if (! (macroblock_modes & MACROBLOCK_INTRA)) */
+				macroblock_modes |= MC_FRAME;
+				return (macroblock_modes | (tab->len << 16));
+			}
+			else
+			{
+				if (macroblock_modes & MACROBLOCK_INTRA) goto intra;
+
+				macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
+
+				if (macroblock_modes & (MACROBLOCK_INTRA | MACROBLOCK_PATTERN))
+				{
+intra:
+					macroblock_modes |= GETBITS(1) * DCT_TYPE_INTERLACED;
+				}
+				return (macroblock_modes | (tab->len << 16));
+			}
+
+		case D_TYPE:
+			macroblock_modes = GETBITS(1);
+			//I suspect (as this is actually a 2 bit command) that this should be getbits(2)
+			//additionally, we arent dumping any bits here when i think we should be, need a game to test. (Refraction)
+			DevCon.Warning(" Rare MPEG command! ");
+			if (macroblock_modes == 0) return 0;   // error
+			return (MACROBLOCK_INTRA | (1 << 16));
+
+		default:
+			return 0;
+	}
+}
+
+__fi static int get_luma_dc_dct_diff()
+{
+	int size;
+	int dc_diff;
+	u16 code = UBITS(5);
+
+	if (code < 31)
+	{
+		size = DCtable.lum0[code].size;
+		DUMPBITS(DCtable.lum0[code].len);
+
+		// 5 bits max
+	}
+	else
+	{
+		code = UBITS(9) - 0x1f0;
+		size = DCtable.lum1[code].size;
+		DUMPBITS(DCtable.lum1[code].len);
+
+		// 9 bits max
+	}
+
+	if (size==0)
+		dc_diff = 0;
+	else
+	{
+		dc_diff = GETBITS(size);
+
+		// 6 for tab0 and 11 for tab1
+		if ((dc_diff & (1<<(size-1)))==0)
+		  dc_diff-= (1<<size) - 1;
+	}
+
+	return dc_diff;
+}
+
+__fi static int get_chroma_dc_dct_diff()
+{
+	int size;
+	int dc_diff;
+	u16 code = UBITS(5);
+
+	if (code<31)
+	{
+		size = DCtable.chrom0[code].size;
+		DUMPBITS(DCtable.chrom0[code].len);
+	}
+	else
+	{
+		code = UBITS(10) - 0x3e0;
+		size = DCtable.chrom1[code].size;
+		DUMPBITS(DCtable.chrom1[code].len);
+	}
+
+	if (size==0)
+		dc_diff = 0;
+	else
+	{
+		dc_diff = GETBITS(size);
+
+		if ((dc_diff & (1<<(size-1)))==0)
+		{
+			dc_diff-= (1<<size) - 1;
+		}
+	}
+
+	return dc_diff;
+}
+
+__ri static bool get_intra_block()
+{
+	const u8 * scan = decoder.scantype ? mpeg2_scan.alt : mpeg2_scan.norm;
+	const u8 (&quant_matrix)[64] = decoder.iq;
+	int quantizer_scale = decoder.quantizer_scale;
+	s16 * dest = decoder.DCTblock;
+	u16 code;
+
+	/* decode AC coefficients */
+  for (int i=1 + ipu_cmd.pos[4]; ; i++)
+  {
+	  switch (ipu_cmd.pos[5])
+	  {
+	  case 0:
+		if (!GETWORD())
+		{
+		  ipu_cmd.pos[4] = i - 1;
+		  return false;
+		}
+
+		code = UBITS(16);
+
+		if (code >= 16384 && (!decoder.intra_vlc_format || decoder.mpeg1))
+		{
+		  tab = &DCT.next[(code >> 12) - 4];
+		}
+		else if (code >= 1024)
+		{
+			if (decoder.intra_vlc_format && !decoder.mpeg1)
+			{
+				tab = &DCT.tab0a[(code >> 8) - 4];
+			}
+			else
+			{
+				tab = &DCT.tab0[(code >> 8) - 4];
+			}
+		}
+		else if (code >= 512)
+		{
+			if (decoder.intra_vlc_format && !decoder.mpeg1)
+			{
+				tab = &DCT.tab1a[(code >> 6) - 8];
+			}
+			else
+			{
+				tab = &DCT.tab1[(code >> 6) - 8];
+			}
+		}
+
+		// [TODO] Optimization: Following codes can all be done by a single "expedited" lookup
+		// that should use a single unrolled DCT table instead of five separate tables used
+		// here.  Multiple conditional statements are very slow, while modern CPU data caches
+		// have lots of room to spare.
+
+		else if (code >= 256)
+		{
+			tab = &DCT.tab2[(code >> 4) - 16];
+		}
+		else if (code >= 128)
+		{
+			tab = &DCT.tab3[(code >> 3) - 16];
+		}
+		else if (code >= 64)
+		{
+			tab = &DCT.tab4[(code >> 2) - 16];
+		}
+		else if (code >= 32)
+		{
+			tab = &DCT.tab5[(code >> 1) - 16];
+		}
+		else if (code >= 16)
+		{
+			tab = &DCT.tab6[code - 16];
+		}
+		else
+		{
+		  ipu_cmd.pos[4] = 0;
+		  return true;
+		}
+
+		DUMPBITS(tab->len);
+
+		if (tab->run==64) /* end_of_block */
+		{
+			ipu_cmd.pos[4] = 0;
+			return true;
+		}
+
+		i += (tab->run == 65) ? GETBITS(6) : tab->run;
+		if (i >= 64)
+		{
+			ipu_cmd.pos[4] = 0;
+			return true;
+		}
+		[[fallthrough]];
+
+	  case 1:
+	  {
+			if (!GETWORD())
+			{
+				ipu_cmd.pos[4] = i - 1;
+				ipu_cmd.pos[5] = 1;
+				return false;
+			}
+
+			uint j = scan[i];
+			int val;
+
+			if (tab->run==65) /* escape */
+			{
+				if(!decoder.mpeg1)
+				{
+				  val = (SBITS(12) * quantizer_scale * quant_matrix[i]) >> 4;
+				  DUMPBITS(12);
+				}
+				else
+				{
+				  val = SBITS(8);
+				  DUMPBITS(8);
+
+				  if (!(val & 0x7f))
+				  {
+					val = GETBITS(8) + 2 * val;
+				  }
+
+				  val = (val * quantizer_scale * quant_matrix[i]) >> 4;
+				  val = (val + ~ (((s32)val) >> 31)) | 1;
+				}
+			}
+			else
+			{
+				val = (tab->level * quantizer_scale * quant_matrix[i]) >> 4;
+				if(decoder.mpeg1)
+				{
+					/* oddification */
+					val = (val - 1) | 1;
+				}
+
+				/* if (bitstream_get (1)) val = -val; */
+				int bit1 = SBITS(1);
+				val = (val ^ bit1) - bit1;
+				DUMPBITS(1);
+			}
+
+			SATURATE(val);
+			dest[j] = val;
+			ipu_cmd.pos[5] = 0;
+		}
+	 }
+  }
+
+  ipu_cmd.pos[4] = 0;
+  return true;
+}
+
+__ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride, const bool skip)
+{
+	if (!skip || ipu_cmd.pos[3])
+	{
+		ipu_cmd.pos[3] = 0;
+		if (!GETWORD())
+		{
+			ipu_cmd.pos[3] = 1;
+			return false;
+		}
+
+		/* Get the intra DC coefficient and inverse quantize it */
+		if (cc == 0)
+			decoder.dc_dct_pred[0] += get_luma_dc_dct_diff();
+		else
+			decoder.dc_dct_pred[cc] += get_chroma_dc_dct_diff();
+
+		decoder.DCTblock[0] = decoder.dc_dct_pred[cc] << (3 - decoder.intra_dc_precision);
+	}
+
+	if (!get_intra_block())
+	{
+		return false;
+	}
+
+	IDCT_Copy(decoder.DCTblock, dest, stride);
+
+	return true;
+}
+
+__fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
+{
+	int i;
+	u8* p = (u8*)&rgb32;
+
+	yuv2rgb(mb8, rgb32);
+
+	if (g_ipu_thresh[0] > 0)
+	{
+		for (i = 0; i < 16*16; i++, p += 4)
+		{
+			if ((p[0] < g_ipu_thresh[0]) && (p[1] < g_ipu_thresh[0]) && (p[2] < g_ipu_thresh[0]))
+				*(u32*)p = 0;
+			else if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
+				p[3] = 0x40;
+		}
+	}
+	else if (g_ipu_thresh[1] > 0)
+	{
+		for (i = 0; i < 16*16; i++, p += 4)
+		{
+			if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
+				p[3] = 0x40;
+		}
+	}
+	if (sgn)
+	{
+		for (i = 0; i < 16*16; i++, p += 4)
+		{
+			*(u32*)p ^= 0x808080;
+		}
+	}
+}
+
+
+// Decodes the six blocks of an intra macroblock, and converts it to the output format.
+__ri static bool slice_intra_macroblock()
+{
+	macroblock_8& mb8 = decoder.mb8;
+	macroblock_rgb16& rgb16 = decoder.rgb16;
+	macroblock_rgb32& rgb32 = decoder.rgb32;
+
+	int DCT_offset, DCT_stride;
+
+	switch (ipu_cmd.pos[1])
+	{
+	case 0:
+		decoder.macroblock_modes = GetMacroblockModes();
+
+		if (decoder.macroblock_modes & MACROBLOCK_QUANT) //only IDEC
+		{
+			const int quantizer_scale_code = GETBITS(5);
+			if (decoder.q_scale_type)
+				decoder.quantizer_scale = non_linear_quantizer_scale[quantizer_scale_code];
+			else
+				decoder.quantizer_scale = quantizer_scale_code << 1;
+		}
+
+		decoder.coded_block_pattern = 0x3F;//all 6 blocks
+		std::memset(&mb8, 0, sizeof(mb8));
+		std::memset(&rgb32, 0, sizeof(rgb32));
+		[[fallthrough]];
+
+	case 1:
+		ipu_cmd.pos[1] = 1;
+
+		if (decoder.macroblock_modes & DCT_TYPE_INTERLACED)
+		{
+			DCT_offset = decoder_stride;
+			DCT_stride = decoder_stride * 2;
+		}
+		else
+		{
+			DCT_offset = decoder_stride * 8;
+			DCT_stride = decoder_stride;
+		}
+
+		switch (ipu_cmd.pos[2])
+		{
+		case 0:
+		case 1:
+			if (!slice_intra_DCT(0, (u8*)mb8.Y, DCT_stride, ipu_cmd.pos[2] == 1))
+			{
+				ipu_cmd.pos[2] = 1;
+				return false;
+			}
+			[[fallthrough]];
+
+		case 2:
+			if (!slice_intra_DCT(0, (u8*)mb8.Y + 8, DCT_stride, ipu_cmd.pos[2] == 2))
+			{
+				ipu_cmd.pos[2] = 2;
+				return false;
+			}
+			[[fallthrough]];
+
+		case 3:
+			if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset, DCT_stride, ipu_cmd.pos[2] == 3))
+			{
+				ipu_cmd.pos[2] = 3;
+				return false;
+			}
+			[[fallthrough]];
+
+		case 4:
+			if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset + 8, DCT_stride, ipu_cmd.pos[2] == 4))
+			{
+				ipu_cmd.pos[2] = 4;
+				return false;
+			}
+			[[fallthrough]];
+
+		case 5:
+			if (!slice_intra_DCT(1, (u8*)mb8.Cb, decoder_stride >> 1, ipu_cmd.pos[2] == 5))
+			{
+				ipu_cmd.pos[2] = 5;
+				return false;
+			}
+			[[fallthrough]];
+
+		case 6:
+			if (!slice_intra_DCT(2, (u8*)mb8.Cr, decoder_stride >> 1, ipu_cmd.pos[2] == 6))
+			{
+				ipu_cmd.pos[2] = 6;
+				return false;
+			}
+			break;
+
+		jNO_DEFAULT;
+		}
+		break;
+
+	jNO_DEFAULT;
+	}
+
+	// Send The MacroBlock via DmaIpuFrom
+	ipu_csc(mb8, rgb32, decoder.sgn);
+
+	if (decoder.ofm == 0)
+		decoder.SetOutputTo(rgb32);
+	else
+	{
+		ipu_dither(rgb32, rgb16, decoder.dte);
+		decoder.SetOutputTo(rgb16);
+	}
+
+	return true;
+}
+
+// Reads the address increment of the next macroblock, and waits for enough data to start decoding it.
+// Sets end_of_slice instead if the slice has no more macroblocks.
+__ri static bool slice_intra_address_increment(bool& end_of_slice)
+{
+	const MBAtab * mba;
+	u16 code;
+
+	switch (ipu_cmd.pos[1])
+	{
+	case 3:
+		while (1)
+		{
+			if (!GETWORD())
+				return false;
+
+			code = UBITS(16);
+			if (code >= 0x1000)
+			{
+				mba = MBA.mba5 + (UBITS(5) - 2);
+				break;
+			}
+			else if (code >= 0x0300)
+			{
+				mba = MBA.mba11 + (UBITS(11) - 24);
+				break;
+			}
+			else switch (UBITS(11))
+			{
+				case 8:		/* macroblock_escape */
+					mbaCount += 33;
+					[[fallthrough]];
+
+				case 15:	/* macroblock_stuffing (MPEG1 only) */
+					DUMPBITS(11);
+					continue;
+
+				default:	/* end of slice/frame, or error? */
+				{
+					end_of_slice = true;
+					return true;
+				}
+			}
+		}
+
+		DUMPBITS(mba->len);
+		mbaCount += mba->mba;
+
+		if (mbaCount)
+		{
+			decoder.dc_dct_pred[0] =
+			decoder.dc_dct_pred[1] =
+			decoder.dc_dct_pred[2] = 128 << decoder.intra_dc_precision;
+		}
+		[[fallthrough]];
+
+	case 4:
+		ipu_cmd.pos[1] = 4;
+		break;
+
+	jNO_DEFAULT;
+	}
+
+	return GETWORD();
+}
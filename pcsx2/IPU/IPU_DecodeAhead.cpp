@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Common.h"
+#include "IPU/IPU.h"
+#include "IPU/IPU_DecodeAhead.h"
+
+#include "common/Threading.h"
+
+#include <atomic>
+
+namespace IPUDecodeAhead
+{
+	static void ThreadEntryPoint();
+	static bool FIFOMatches();
+
+	alignas(16) static Job s_job;
+	alignas(16) static Result s_result;
+
+	static Threading::Thread s_thread;
+	static Threading::WorkSema s_work_sema;
+	static std::atomic_bool s_busy{false};
+	static std::atomic_bool s_shutdown{false};
+	static void (*s_decode)(const Job& job, Result& result) = nullptr;
+
+	// EE thread only.
+	static bool s_pending = false;
+	static Stats s_stats = {};
+} // namespace IPUDecodeAhead
+
+void IPUDecodeAhead::ThreadEntryPoint()
+{
+	Threading::SetNameOfCurrentThread("IPU Decode Thread");
+
+	for (;;)
+	{
+		// Macroblocks come in quick succession during a movie, so spin for a bit before sleeping.
+		s_work_sema.WaitForWorkWithSpin();
+		if (s_shutdown.load(std::memory_order_acquire))
+			break;
+
+		if (!s_busy.load(std::memory_order_acquire))
+			continue;
+
+		s_decode(s_job, s_result);
+		s_busy.store(false, std::memory_order_release);
+	}
+}
+
+void IPUDecodeAhead::Start()
+{
+	if (!EmuConfig.Speedhacks.ipuDecodeAhead || s_busy.load(std::memory_order_acquire))
+		return;
+
+	if (!s_thread.Joinable())
+	{
+		s_decode = MULTI_ISA_SELECT(ipu_decode_ahead);
+		s_shutdown.store(false, std::memory_order_relaxed);
+		if (!s_thread.Start(&IPUDecodeAhead::ThreadEntryPoint))
+			return;
+	}
+
+	std::memcpy(&s_job.decoder, &decoder, sizeof(decoder));
+	CopyQWC(&s_job.internal_qwc[0], &g_BP.internal_qwc[0]);
+	CopyQWC(&s_job.internal_qwc[1], &g_BP.internal_qwc[1]);
+	s_job.BP = g_BP.BP;
+	s_job.FP = g_BP.FP;
+
+	s_job.fifo_size = g_BP.IFC;
+	for (u32 i = 0; i < g_BP.IFC; i++)
+		CopyQWC(&s_job.fifo[i], &ipu_fifo.in.data[(ipu_fifo.in.readpos + i * 4) & 31]);
+
+	s_job.thresh[0] = g_ipu_thresh[0];
+	s_job.thresh[1] = g_ipu_thresh[1];
+
+	s_pending = true;
+	s_stats.started++;
+	s_busy.store(true, std::memory_order_release);
+	s_work_sema.NotifyOfWork();
+}
+
+bool IPUDecodeAhead::FIFOMatches()
+{
+	if (g_BP.IFC < s_result.fifo_reads)
+		return false;
+
+	for (u32 i = 0; i < s_result.fifo_reads; i++)
+	{
+		if (std::memcmp(&ipu_fifo.in.data[(ipu_fifo.in.readpos + i * 4) & 31], &s_job.fifo[s_result.fifo_start + i], sizeof(u128)) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+bool IPUDecodeAhead::Consume()
+{
+	// Don't wait if the thread isn't done yet, the IPU can decode it just as fast.
+	if (!s_pending || s_busy.load(std::memory_order_acquire))
+		return false;
+
+	s_pending = false;
+	if (!s_result.valid)
+		return false;
+
+	// Sending the previous macroblock is the only thing that should have changed the decoder.
+	s_result.start_decoder.ipu0_data = decoder.ipu0_data;
+	s_result.start_decoder.ipu0_idx = decoder.ipu0_idx;
+	if (g_BP.BP != s_result.start_BP || g_BP.FP != s_result.start_FP ||
+		std::memcmp(g_BP.internal_qwc, s_result.start_qwc, sizeof(g_BP.internal_qwc)) != 0 ||
+		std::memcmp(&decoder, &s_result.start_decoder, sizeof(decoder)) != 0 ||
+		g_ipu_thresh[0] != s_job.thresh[0] || g_ipu_thresh[1] != s_job.thresh[1] || !FIFOMatches())
+	{
+		return false;
+	}
+
+	// Read the same quadwords the IPU would have, so DMA requests happen the same way.
+	for (u32 i = 0; i < s_result.fifo_reads; i++)
+	{
+		alignas(16) u128 qwc;
+		ipu_fifo.in.read(&qwc);
+	}
+
+	std::memcpy(&decoder, &s_result.decoder, sizeof(decoder));
+	CopyQWC(&g_BP.internal_qwc[0], &s_result.end_qwc[0]);
+	CopyQWC(&g_BP.internal_qwc[1], &s_result.end_qwc[1]);
+	g_BP.BP = s_result.end_BP;
+	g_BP.FP = s_result.end_FP;
+
+	s_stats.used++;
+	return true;
+}
+
+void IPUDecodeAhead::Wait()
+{
+	if (s_thread.Joinable())
+		s_work_sema.WaitForEmpty();
+}
+
+void IPUDecodeAhead::Reset()
+{
+	s_pending = false;
+}
+
+void IPUDecodeAhead::Shutdown()
+{
+	if (!s_thread.Joinable())
+		return;
+
+	s_shutdown.store(true, std::memory_order_release);
+	s_work_sema.NotifyOfWork();
+	s_thread.Join();
+	s_work_sema.Reset();
+
+	s_busy.store(false, std::memory_order_relaxed);
+	s_pending = false;
+}
+
+IPUDecodeAhead::Stats IPUDecodeAhead::GetStats()
+{
+	return s_stats;
+}
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "IPU/IPU_MultiISA.h"
+
+// Decodes IDEC macroblocks ahead of the IPU on a separate thread.
+//
+// Once the IPU has decoded a macroblock, it spends thousands of cycles sending it through IPU0.
+// Meanwhile, the decode thread decodes the next macroblock from a copy of the decoder state and
+// of the input FIFO. The IPU only uses the result once it gets to that macroblock itself, and only
+// if the decoder state, bit position and FIFO data it would decode it from are the same ones the
+// thread used. Decoding is deterministic, so the output is the same as decoding it there and then,
+// and the FIFO reads are replayed so DMA requests happen at the same time as before. Anything else
+// (the thread was still busy, the copy of the FIFO didn't have enough data, the game reset the IPU
+// in the meantime) is decoded by the IPU itself, as before.
+namespace IPUDecodeAhead
+{
+	// Reads from a copy of the input FIFO, the same way tIPU_BP reads from the FIFO itself.
+	struct alignas(16) Bitstream
+	{
+		alignas(16) u128 internal_qwc[2];
+
+		u32 BP;
+		u32 FP;
+
+		const u128* fifo;
+		u32 fifo_pos;
+		u32 fifo_size;
+		bool starved; // Ran out of data, where the IPU would have waited for it instead
+
+		__fi bool Read(u128* qwc)
+		{
+			if (fifo_pos == fifo_size)
+			{
+				starved = true;
+				return false;
+			}
+
+			CopyQWC(qwc, &fifo[fifo_pos++]);
+			return true;
+		}
+
+		__fi void Advance(uint bits)
+		{
+			FillBuffer(bits);
+
+			BP += bits;
+			if (BP >= 128)
+			{
+				BP -= 128;
+
+				if (FP == 2)
+				{
+					CopyQWC(&internal_qwc[0], &internal_qwc[1]);
+					FP = 1;
+				}
+				else
+				{
+					FP = Read(&internal_qwc[0]) ? 1 : 0;
+				}
+			}
+		}
+
+		__fi bool FillBuffer(u32 bits)
+		{
+			while ((FP * 128) < (BP + bits))
+			{
+				if (!Read(&internal_qwc[FP]))
+					return false;
+
+				++FP;
+			}
+
+			return true;
+		}
+	};
+
+	// The IPU as the previous macroblock left it.
+	struct Job
+	{
+		alignas(16) decoder_t decoder;
+		alignas(16) u128 internal_qwc[2];
+		u32 BP;
+		u32 FP;
+
+		alignas(16) u128 fifo[8];
+		u32 fifo_size;
+
+		u16 thresh[2];
+	};
+
+	struct Result
+	{
+		// Where the macroblock starts, after its address increment.
+		alignas(16) decoder_t start_decoder;
+		alignas(16) u128 start_qwc[2];
+		u32 start_BP;
+		u32 start_FP;
+		u32 fifo_start; // Index of the first FIFO quadword the macroblock reads
+
+		// Where it ends.
+		alignas(16) decoder_t decoder;
+		alignas(16) u128 end_qwc[2];
+		u32 end_BP;
+		u32 end_FP;
+		u32 fifo_reads; // Number of FIFO quadwords the macroblock reads
+
+		bool valid;
+	};
+
+	struct Stats
+	{
+		u64 started; // Macroblocks the thread was asked to decode
+		u64 used;    // Macroblocks the IPU used instead of decoding them
+	};
+
+	// Starts decoding the macroblock after the one the IPU just decoded, if the thread isn't busy.
+	void Start();
+
+	// Uses the decoded macroblock if it starts where the IPU is now. Returns false if the IPU has to
+	// decode it itself.
+	bool Consume();
+
+	// Waits for the thread to finish the macroblock it's decoding.
+	void Wait();
+
+	// Drops the decoded macroblock, if any.
+	void Reset();
+
+	// Stops the thread.
+	void Shutdown();
+
+	Stats GetStats();
+} // namespace IPUDecodeAhead
+
+MULTI_ISA_DEF(
+	void ipu_decode_ahead(const IPUDecodeAhead::Job& job, IPUDecodeAhead::Result& result);
+)
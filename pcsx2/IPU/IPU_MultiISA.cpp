@@ -13,6 +13,7 @@
 #include "IPU/IPUdma.h"
 #include "IPU/yuv2rgb.h"
 #include "IPU/IPU_MultiISA.h"
+#include "IPU/IPU_DecodeAhead.h"
 
 // the IPU is fixed to 16 byte strides (128-bit / QWC resolution):
 static const uint decoder_stride = 16;
@@ -64,61 +65,8 @@ alignas(16) const mpeg2_scan_pack mpeg2_scan = make_scan_pack();
 
 MULTI_ISA_UNSHARED_START
 
-static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn);
 static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4);
 
-// --------------------------------------------------------------------------------------
-//  Buffer reader
-// --------------------------------------------------------------------------------------
-
-__ri static u32 UBITS(uint bits)
-{
-	uint readpos8 = g_BP.BP/8;
-
-	uint result = BigEndian(*(u32*)( (u8*)g_BP.internal_qwc + readpos8 ));
-	uint bp7 = (g_BP.BP & 7);
-	result <<= bp7;
-	result >>= (32 - bits);
-
-	return result;
-}
-
-__ri static s32 SBITS(uint bits)
-{
-	// Read an unaligned 32 bit value and then shift the bits up and then back down.
-
-	uint readpos8 = g_BP.BP/8;
-
-	int result = BigEndian(*(s32*)( (s8*)g_BP.internal_qwc + readpos8 ));
-	uint bp7 = (g_BP.BP & 7);
-	result <<= bp7;
-	result >>= (32 - bits);
-
-	return result;
-}
-
-__fi static int GETWORD()
-{
-	return g_BP.FillBuffer(16);
-}
-
-// Removes bits from the bitstream.  This is done independently of UBITS/SBITS because a
-// lot of mpeg streams have to read ahead and rewind bits and re-read them at different
-// bit depths or sign'age.
-__fi static void DUMPBITS(uint num)
-{
-	g_BP.Advance(num);
-	//pxAssume(g_BP.FP != 0);
-}
-
-__fi static u32 GETBITS(uint num)
-{
-	uint retVal = UBITS(num);
-	g_BP.Advance(num);
-
-	return retVal;
-}
-
 // whenever reading fractions of bytes. The low bits always come from the next byte
 // while the high bits come from the current byte
 __ri static u8 getBits64(u8 *address, bool advance)
@@ -375,133 +323,25 @@ __ri static void IDCT_Add(const int last, s16* block, s16* dest, const int strid
 	}
 }
 
+__fi static void SATURATE(int& val)
+{
+	if ((u32)(val + 2048) > 4095)
+		val = (val >> 31) ^ 2047;
+}
+
+#include "IPU/IPU_Decode.inl"
+
 /* Bitstream and buffer needs to be reallocated in order for successful
 	reading of the old data. Here the old data stored in the 2nd slot
 	of the internal buffer is copied to 1st slot, and the new data read
 	into 1st slot is copied to the 2nd slot. Which will later be copied
 	back to the 1st slot when 128bits have been read.
 */
-static const DCTtab * tab;
-static int mbaCount = 0;
-
 __ri static int BitstreamInit ()
 {
 	return g_BP.FillBuffer(32);
 }
 
-static int GetMacroblockModes()
-{
-	int macroblock_modes;
-	const MBtab * tab;
-
-	switch (decoder.coding_type)
-	{
-		case I_TYPE:
-			macroblock_modes = UBITS(2);
-
-			if (macroblock_modes == 0) return 0;   // error
-
-			tab = MB_I + (macroblock_modes >> 1);
-			DUMPBITS(tab->len);
-			macroblock_modes = tab->modes;
-
-			if ((!(decoder.frame_pred_frame_dct)) &&
-				(decoder.picture_structure == FRAME_PICTURE))
-			{
-				macroblock_modes |= GETBITS(1) * DCT_TYPE_INTERLACED;
-			}
-			return macroblock_modes;
-
-		case P_TYPE:
-			macroblock_modes = UBITS(6);
-
-			if (macroblock_modes == 0) return 0;   // error
-
-			tab = MB_P + (macroblock_modes >> 1);
-			DUMPBITS(tab->len);
-			macroblock_modes = tab->modes;
-
-			if (decoder.picture_structure != FRAME_PICTURE)
-			{
-				if (macroblock_modes & MACROBLOCK_MOTION_FORWARD)
-				{
-					macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
-				}
-
-				return macroblock_modes;
-			}
-			else if (decoder.frame_pred_frame_dct)
-			{
-				if (macroblock_modes & MACROBLOCK_MOTION_FORWARD)
-					macroblock_modes |= MC_FRAME;
-
-				return macroblock_modes;
-			}
-			else
-			{
-				if (macroblock_modes & MACROBLOCK_MOTION_FORWARD)
-				{
-					macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
-				}
-
-				if (macroblock_modes & (MACROBLOCK_INTRA | MACROBLOCK_PATTERN))
-				{
-					macroblock_modes |= GETBITS(1) * DCT_TYPE_INTERLACED;
-				}
-
-				return macroblock_modes;
-			}
-
-		case B_TYPE:
-			macroblock_modes = UBITS(6);
-
-			if (macroblock_modes == 0) return 0;   // error
-
-			tab = MB_B + macroblock_modes;
-			DUMPBITS(tab->len);
-			macroblock_modes = tab->modes;
-
-			if (decoder.picture_structure != FRAME_PICTURE)
-			{
-				if (!(macroblock_modes & MACROBLOCK_INTRA))
-				{
-					macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
-				}
-				return (macroblock_modes | (tab->len << 16));
-			}
-			else if (decoder.frame_pred_frame_dct)
-			{
-				/* if (! (macroblock_modes & MACROBLOCK_INTRA)) */
-				macroblock_modes |= MC_FRAME;
-				return (macroblock_modes | (tab->len << 16));
-			}
-			else
-			{
-				if (macroblock_modes & MACROBLOCK_INTRA) goto intra;
-
-				macroblock_modes |= GETBITS(2) * MOTION_TYPE_BASE;
-
-				if (macroblock_modes & (MACROBLOCK_INTRA | MACROBLOCK_PATTERN))
-				{
-intra:
-					macroblock_modes |= GETBITS(1) * DCT_TYPE_INTERLACED;
-				}
-				return (macroblock_modes | (tab->len << 16));
-			}
-
-		case D_TYPE:
-			macroblock_modes = GETBITS(1);
-			//I suspect (as this is actually a 2 bit command) that this should be getbits(2)
-			//additionally, we arent dumping any bits here when i think we should be, need a game to test. (Refraction)
-			DevCon.Warning(" Rare MPEG command! ");
-			if (macroblock_modes == 0) return 0;   // error
-			return (MACROBLOCK_INTRA | (1 << 16));
-
-		default:
-			return 0;
-	}
-}
-
 __ri static int get_macroblock_address_increment()
 {
 	const MBAtab *mba;
@@ -535,236 +375,6 @@ __ri static int get_macroblock_address_increment()
 	return ((mba->mba + 1) | (mba->len << 16));
 }
 
-__fi static int get_luma_dc_dct_diff()
-{
-	int size;
-	int dc_diff;
-	u16 code = UBITS(5);
-
-	if (code < 31)
-	{
-		size = DCtable.lum0[code].size;
-		DUMPBITS(DCtable.lum0[code].len);
-
-		// 5 bits max
-	}
-	else
-	{
-		code = UBITS(9) - 0x1f0;
-		size = DCtable.lum1[code].size;
-		DUMPBITS(DCtable.lum1[code].len);
-
-		// 9 bits max
-	}
-
-	if (size==0)
-		dc_diff = 0;
-	else
-	{
-		dc_diff = GETBITS(size);
-
-		// 6 for tab0 and 11 for tab1
-		if ((dc_diff & (1<<(size-1)))==0)
-		  dc_diff-= (1<<size) - 1;
-	}
-
-	return dc_diff;
-}
-
-__fi static int get_chroma_dc_dct_diff()
-{
-	int size;
-	int dc_diff;
-	u16 code = UBITS(5);
-
-	if (code<31)
-	{
-		size = DCtable.chrom0[code].size;
-		DUMPBITS(DCtable.chrom0[code].len);
-	}
-	else
-	{
-		code = UBITS(10) - 0x3e0;
-		size = DCtable.chrom1[code].size;
-		DUMPBITS(DCtable.chrom1[code].len);
-	}
-
-	if (size==0)
-		dc_diff = 0;
-	else
-	{
-		dc_diff = GETBITS(size);
-
-		if ((dc_diff & (1<<(size-1)))==0)
-		{
-			dc_diff-= (1<<size) - 1;
-		}
-	}
-
-	return dc_diff;
-}
-
-__fi static void SATURATE(int& val)
-{
-	if ((u32)(val + 2048) > 4095)
-		val = (val >> 31) ^ 2047;
-}
-
-__ri static bool get_intra_block()
-{
-	const u8 * scan = decoder.scantype ? mpeg2_scan.alt : mpeg2_scan.norm;
-	const u8 (&quant_matrix)[64] = decoder.iq;
-	int quantizer_scale = decoder.quantizer_scale;
-	s16 * dest = decoder.DCTblock;
-	u16 code;
-
-	/* decode AC coefficients */
-  for (int i=1 + ipu_cmd.pos[4]; ; i++)
-  {
-	  switch (ipu_cmd.pos[5])
-	  {
-	  case 0:
-		if (!GETWORD())
-		{
-		  ipu_cmd.pos[4] = i - 1;
-		  return false;
-		}
-
-		code = UBITS(16);
-
-		if (code >= 16384 && (!decoder.intra_vlc_format || decoder.mpeg1))
-		{
-		  tab = &DCT.next[(code >> 12) - 4];
-		}
-		else if (code >= 1024)
-		{
-			if (decoder.intra_vlc_format && !decoder.mpeg1)
-			{
-				tab = &DCT.tab0a[(code >> 8) - 4];
-			}
-			else
-			{
-				tab = &DCT.tab0[(code >> 8) - 4];
-			}
-		}
-		else if (code >= 512)
-		{
-			if (decoder.intra_vlc_format && !decoder.mpeg1)
-			{
-				tab = &DCT.tab1a[(code >> 6) - 8];
-			}
-			else
-			{
-				tab = &DCT.tab1[(code >> 6) - 8];
-			}
-		}
-
-		// [TODO] Optimization: Following codes can all be done by a single "expedited" lookup
-		// that should use a single unrolled DCT table instead of five separate tables used
-		// here.  Multiple conditional statements are very slow, while modern CPU data caches
-		// have lots of room to spare.
-
-		else if (code >= 256)
-		{
-			tab = &DCT.tab2[(code >> 4) - 16];
-		}
-		else if (code >= 128)
-		{
-			tab = &DCT.tab3[(code >> 3) - 16];
-		}
-		else if (code >= 64)
-		{
-			tab = &DCT.tab4[(code >> 2) - 16];
-		}
-		else if (code >= 32)
-		{
-			tab = &DCT.tab5[(code >> 1) - 16];
-		}
-		else if (code >= 16)
-		{
-			tab = &DCT.tab6[code - 16];
-		}
-		else
-		{
-		  ipu_cmd.pos[4] = 0;
-		  return true;
-		}
-
-		DUMPBITS(tab->len);
-
-		if (tab->run==64) /* end_of_block */
-		{
-			ipu_cmd.pos[4] = 0;
-			return true;
-		}
-
-		i += (tab->run == 65) ? GETBITS(6) : tab->run;
-		if (i >= 64)
-		{
-			ipu_cmd.pos[4] = 0;
-			return true;
-		}
-		[[fallthrough]];
-
-	  case 1:
-	  {
-			if (!GETWORD())
-			{
-				ipu_cmd.pos[4] = i - 1;
-				ipu_cmd.pos[5] = 1;
-				return false;
-			}
-
-			uint j = scan[i];
-			int val;
-
-			if (tab->run==65) /* escape */
-			{
-				if(!decoder.mpeg1)
-				{
-				  val = (SBITS(12) * quantizer_scale * quant_matrix[i]) >> 4;
-				  DUMPBITS(12);
-				}
-				else
-				{
-				  val = SBITS(8);
-				  DUMPBITS(8);
-
-				  if (!(val & 0x7f))
-				  {
-					val = GETBITS(8) + 2 * val;
-				  }
-
-				  val = (val * quantizer_scale * quant_matrix[i]) >> 4;
-				  val = (val + ~ (((s32)val) >> 31)) | 1;
-				}
-			}
-			else
-			{
-				val = (tab->level * quantizer_scale * quant_matrix[i]) >> 4;
-				if(decoder.mpeg1)
-				{
-					/* oddification */
-					val = (val - 1) | 1;
-				}
-
-				/* if (bitstream_get (1)) val = -val; */
-				int bit1 = SBITS(1);
-				val = (val ^ bit1) - bit1;
-				DUMPBITS(1);
-			}
-
-			SATURATE(val);
-			dest[j] = val;
-			ipu_cmd.pos[5] = 0;
-		}
-	 }
-  }
-
-  ipu_cmd.pos[4] = 0;
-  return true;
-}
-
 __ri static bool get_non_intra_block(int * last)
 {
 	int i;
@@ -908,36 +518,6 @@ __ri static bool get_non_intra_block(int * last)
 	return true;
 }
 
-__ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride, const bool skip)
-{
-	if (!skip || ipu_cmd.pos[3])
-	{
-		ipu_cmd.pos[3] = 0;
-		if (!GETWORD())
-		{
-			ipu_cmd.pos[3] = 1;
-			return false;
-		}
-
-		/* Get the intra DC coefficient and inverse quantize it */
-		if (cc == 0)
-			decoder.dc_dct_pred[0] += get_luma_dc_dct_diff();
-		else
-			decoder.dc_dct_pred[cc] += get_chroma_dc_dct_diff();
-
-		decoder.DCTblock[0] = decoder.dc_dct_pred[cc] << (3 - decoder.intra_dc_precision);
-	}
-
-	if (!get_intra_block())
-	{
-		return false;
-	}
-
-	IDCT_Copy(decoder.DCTblock, dest, stride);
-
-	return true;
-}
-
 __ri static bool slice_non_intra_DCT(s16 * const dest, const int stride, const bool skip)
 {
 	if (!skip)
@@ -959,7 +539,6 @@ __fi static void finishmpeg2sliceIDEC()
 
 __ri static bool mpeg2sliceIDEC()
 {
-	u16 code;
 	static bool ready_to_decode = true;
 	switch (ipu_cmd.pos[0])
 	{
@@ -990,110 +569,17 @@ __ri static bool mpeg2sliceIDEC()
 				IPUCoreStatus.WaitingOnIPUFrom = true;
 				return false;
 			}
-			macroblock_8& mb8 = decoder.mb8;
-			macroblock_rgb16& rgb16 = decoder.rgb16;
-			macroblock_rgb32& rgb32 = decoder.rgb32;
-
-			int DCT_offset, DCT_stride;
-			const MBAtab * mba;
 
 			switch (ipu_cmd.pos[1])
 			{
 			case 0:
-				decoder.macroblock_modes = GetMacroblockModes();
-
-				if (decoder.macroblock_modes & MACROBLOCK_QUANT) //only IDEC
-				{
-					const int quantizer_scale_code = GETBITS(5);
-					if (decoder.q_scale_type)
-						decoder.quantizer_scale = non_linear_quantizer_scale[quantizer_scale_code];
-					else
-						decoder.quantizer_scale = quantizer_scale_code << 1;
-				}
-
-				decoder.coded_block_pattern = 0x3F;//all 6 blocks
-				std::memset(&mb8, 0, sizeof(mb8));
-				std::memset(&rgb32, 0, sizeof(rgb32));
-				[[fallthrough]];
-
 			case 1:
-				ipu_cmd.pos[1] = 1;
-
-				if (decoder.macroblock_modes & DCT_TYPE_INTERLACED)
-				{
-					DCT_offset = decoder_stride;
-					DCT_stride = decoder_stride * 2;
-				}
-				else
-				{
-					DCT_offset = decoder_stride * 8;
-					DCT_stride = decoder_stride;
-				}
-
-				switch (ipu_cmd.pos[2])
-				{
-				case 0:
-				case 1:
-					if (!slice_intra_DCT(0, (u8*)mb8.Y, DCT_stride, ipu_cmd.pos[2] == 1))
-					{
-						ipu_cmd.pos[2] = 1;
-						return false;
-					}
-					[[fallthrough]];
-
-				case 2:
-					if (!slice_intra_DCT(0, (u8*)mb8.Y + 8, DCT_stride, ipu_cmd.pos[2] == 2))
-					{
-						ipu_cmd.pos[2] = 2;
-						return false;
-					}
-					[[fallthrough]];
-
-				case 3:
-					if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset, DCT_stride, ipu_cmd.pos[2] == 3))
-					{
-						ipu_cmd.pos[2] = 3;
-						return false;
-					}
-					[[fallthrough]];
-
-				case 4:
-					if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset + 8, DCT_stride, ipu_cmd.pos[2] == 4))
-					{
-						ipu_cmd.pos[2] = 4;
-						return false;
-					}
-					[[fallthrough]];
-
-				case 5:
-					if (!slice_intra_DCT(1, (u8*)mb8.Cb, decoder_stride >> 1, ipu_cmd.pos[2] == 5))
-					{
-						ipu_cmd.pos[2] = 5;
-						return false;
-					}
-					[[fallthrough]];
-
-				case 6:
-					if (!slice_intra_DCT(2, (u8*)mb8.Cr, decoder_stride >> 1, ipu_cmd.pos[2] == 6))
-					{
-						ipu_cmd.pos[2] = 6;
-						return false;
-					}
-					break;
-
-				jNO_DEFAULT;
-				}
-
-				// Send The MacroBlock via DmaIpuFrom
-				ipu_csc(mb8, rgb32, decoder.sgn);
+				// Use the macroblock the decode thread decoded ahead, if it started from the same place.
+				if ((ipu_cmd.pos[1] != 0 || !IPUDecodeAhead::Consume()) && !slice_intra_macroblock())
+					return false;
 
-				if (decoder.ofm == 0)
-					decoder.SetOutputTo(rgb32);
-				else
-				{
-					ipu_dither(rgb32, rgb16, decoder.dte);
-					decoder.SetOutputTo(rgb16);
-				}
+				// Let it start on the next one while this one is sent.
+				IPUDecodeAhead::Start();
 				ipu_cmd.pos[1] = 2;
 				[[fallthrough]];
 			case 2:
@@ -1131,60 +617,19 @@ __ri static bool mpeg2sliceIDEC()
 
 			case 3:
 				ready_to_decode = true;
-				while (1)
-				{
-					if (!GETWORD())
-					{
-						ipu_cmd.pos[1] = 3;
-						return false;
-					}
-
-					code = UBITS(16);
-					if (code >= 0x1000)
-					{
-						mba = MBA.mba5 + (UBITS(5) - 2);
-						break;
-					}
-					else if (code >= 0x0300)
-					{
-						mba = MBA.mba11 + (UBITS(11) - 24);
-						break;
-					}
-					else switch (UBITS(11))
-					{
-						case 8:		/* macroblock_escape */
-							mbaCount += 33;
-							[[fallthrough]];
-
-						case 15:	/* macroblock_stuffing (MPEG1 only) */
-							DUMPBITS(11);
-							continue;
-
-						default:	/* end of slice/frame, or error? */
-						{
-							goto finish_idec;
-						}
-					}
-				}
-
-				DUMPBITS(mba->len);
-				mbaCount += mba->mba;
-
-				if (mbaCount)
-				{
-					decoder.dc_dct_pred[0] =
-					decoder.dc_dct_pred[1] =
-					decoder.dc_dct_pred[2] = 128 << decoder.intra_dc_precision;
-				}
+				ipu_cmd.pos[1] = 3;
 				[[fallthrough]];
 
 			case 4:
-				if (!GETWORD())
-				{
-					ipu_cmd.pos[1] = 4;
+			{
+				bool end_of_slice = false;
+				if (!slice_intra_address_increment(end_of_slice))
 					return false;
-				}
+
+				if (end_of_slice)
+					goto finish_idec;
 				break;
+			}
 
 			jNO_DEFAULT;
 			}
@@ -1875,40 +1320,6 @@ __ri static bool ipuPACK(tIPU_CMD_CSC csc)
 //  CORE Functions (referenced from MPEG library)
 // --------------------------------------------------------------------------------------
 
-__fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
-{
-	int i;
-	u8* p = (u8*)&rgb32;
-
-	yuv2rgb();
-
-	if (g_ipu_thresh[0] > 0)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			if ((p[0] < g_ipu_thresh[0]) && (p[1] < g_ipu_thresh[0]) && (p[2] < g_ipu_thresh[0]))
-				*(u32*)p = 0;
-			else if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
-				p[3] = 0x40;
-		}
-	}
-	else if (g_ipu_thresh[1] > 0)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
-				p[3] = 0x40;
-		}
-	}
-	if (sgn)
-	{
-		for (i = 0; i < 16*16; i++, p += 4)
-		{
-			*(u32*)p ^= 0x808080;
-		}
-	}
-}
-
 __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 {
 	const auto closest_index = [&](int i, int j) {
@@ -1937,6 +1348,73 @@ __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 			indx4[i * 8 + j] = closest_index(i, 2 * j + 1) << 4 | closest_index(i, 2 * j);
 }
 
+// --------------------------------------------------------------------------------------
+//  Decode ahead (see IPU_DecodeAhead.h)
+// --------------------------------------------------------------------------------------
+
+// The same decoder as above, working on the decode thread's own copy of the IPU.
+namespace DecodeAhead
+{
+	alignas(16) static decoder_t decoder;
+	alignas(16) static IPUDecodeAhead::Bitstream g_BP;
+	alignas(16) static tIPU_cmd ipu_cmd;
+	static u16 g_ipu_thresh[2];
+
+#include "IPU/IPU_Decode.inl"
+
+	static void Decode(const IPUDecodeAhead::Job& job, IPUDecodeAhead::Result& result)
+	{
+		result.valid = false;
+
+		std::memcpy(&decoder, &job.decoder, sizeof(decoder));
+		CopyQWC(&g_BP.internal_qwc[0], &job.internal_qwc[0]);
+		CopyQWC(&g_BP.internal_qwc[1], &job.internal_qwc[1]);
+		g_BP.BP = job.BP;
+		g_BP.FP = job.FP;
+		g_BP.fifo = job.fifo;
+		g_BP.fifo_pos = 0;
+		g_BP.fifo_size = job.fifo_size;
+		g_BP.starved = false;
+		g_ipu_thresh[0] = job.thresh[0];
+		g_ipu_thresh[1] = job.thresh[1];
+
+		// The IPU reads the address increment of the next macroblock once it's done sending this one.
+		ipu_cmd.clear();
+		ipu_cmd.pos[1] = 3;
+		mbaCount = 0;
+
+		bool end_of_slice = false;
+		if (!slice_intra_address_increment(end_of_slice) || end_of_slice || g_BP.starved)
+			return;
+
+		std::memcpy(&result.start_decoder, &decoder, sizeof(decoder));
+		CopyQWC(&result.start_qwc[0], &g_BP.internal_qwc[0]);
+		CopyQWC(&result.start_qwc[1], &g_BP.internal_qwc[1]);
+		result.start_BP = g_BP.BP;
+		result.start_FP = g_BP.FP;
+		result.fifo_start = g_BP.fifo_pos;
+
+		// Then decodes the macroblock itself.
+		ipu_cmd.pos[1] = 0;
+		ipu_cmd.pos[2] = 0;
+		if (!slice_intra_macroblock() || g_BP.starved)
+			return;
+
+		std::memcpy(&result.decoder, &decoder, sizeof(decoder));
+		CopyQWC(&result.end_qwc[0], &g_BP.internal_qwc[0]);
+		CopyQWC(&result.end_qwc[1], &g_BP.internal_qwc[1]);
+		result.end_BP = g_BP.BP;
+		result.end_FP = g_BP.FP;
+		result.fifo_reads = g_BP.fifo_pos - result.fifo_start;
+		result.valid = true;
+	}
+} // namespace DecodeAhead
+
+void ipu_decode_ahead(const IPUDecodeAhead::Job& job, IPUDecodeAhead::Result& result)
+{
+	DecodeAhead::Decode(job, result);
+}
+
 __noinline void IPUWorker()
 {
 	pxAssert(ipuRegs.ctrl.BUSY);
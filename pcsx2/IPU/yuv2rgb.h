@@ -5,16 +5,19 @@
 
 #include "GS/MultiISA.h"
 
-MULTI_ISA_DEF(extern void yuv2rgb_reference();)
+struct macroblock_8;
+struct macroblock_rgb32;
+
+MULTI_ISA_DEF(extern void yuv2rgb_reference(const macroblock_8& mb8, macroblock_rgb32& rgb32);)
 
 #if defined(_M_X86)
 
 #define yuv2rgb yuv2rgb_sse2
-MULTI_ISA_DEF(extern void yuv2rgb_sse2();)
+MULTI_ISA_DEF(extern void yuv2rgb_sse2(const macroblock_8& mb8, macroblock_rgb32& rgb32);)
 
 #elif defined(_M_ARM64)
 
 #define yuv2rgb yuv2rgb_neon
-MULTI_ISA_DEF(extern void yuv2rgb_neon();)
+MULTI_ISA_DEF(extern void yuv2rgb_neon(const macroblock_8& mb8, macroblock_rgb32& rgb32);)
 
 #endif
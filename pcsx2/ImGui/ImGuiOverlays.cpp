@@ -63,6 +63,7 @@ SmallString s_hardware_info_gpu_line;
 SmallString s_cpu_usage_ee_line;
 SmallString s_cpu_usage_gs_line;
 SmallString s_cpu_usage_vu_line;
+SmallString s_mtvu_line;
 std::vector<SmallString> s_software_thread_lines;
 SmallString s_capture_line;
 SmallString s_gpu_usage_line;
@@ -356,6 +357,15 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 					s_cpu_usage_vu_line.assign("VU: ");
 					FormatProcessorStat(s_cpu_usage_vu_line, PerformanceMetrics::GetVUThreadUsage(), PerformanceMetrics::GetVUThreadAverageTime());
 					DRAW_LINE(fixed_font, font_size, s_cpu_usage_vu_line.c_str(), white_color);
+
+					s_mtvu_line.format("MTVU: Ring {:.1f}% | Idle {:.1f}% | {:.1f} cmd/batch | EE wait ", PerformanceMetrics::GetVURingPeakUsage(),
+						PerformanceMetrics::GetVUThreadIdleUsage(), PerformanceMetrics::GetVUCommandsPerBatch());
+					FormatProcessorStat(s_mtvu_line, PerformanceMetrics::GetVUEEWaitUsage(), PerformanceMetrics::GetVUEEWaitAverageTime());
+					DRAW_LINE(fixed_font, font_size, s_mtvu_line.c_str(), white_color);
+
+					s_mtvu_line.format("MTVU JIT: Ready {:.1f}% | Compiling {:.2f}ms", PerformanceMetrics::GetVUReadyCycleUsage(),
+						PerformanceMetrics::GetVUCompileAverageTime());
+					DRAW_LINE(fixed_font, font_size, s_mtvu_line.c_str(), white_color);
 				}
 
 				const u32 gs_sw_threads = PerformanceMetrics::GetGSSWThreadCount();
@@ -413,7 +423,10 @@ __ri void ImGuiManager::DrawPerformanceOverlay(float& position_y, float scale, f
 				DRAW_LINE(fixed_font, font_size, s_cpu_usage_ee_line.c_str(), white_color);
 				DRAW_LINE(fixed_font, font_size, s_cpu_usage_gs_line.c_str(), white_color);
 				if (THREAD_VU1)
+				{
 					DRAW_LINE(fixed_font, font_size, s_cpu_usage_vu_line.c_str(), white_color);
+					DRAW_LINE(fixed_font, font_size, s_mtvu_line.c_str(), white_color);
+				}
 
 				const u32 thread_count = std::min(
 					PerformanceMetrics::GetGSSWThreadCount(),
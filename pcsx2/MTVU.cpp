@@ -7,6 +7,8 @@
 #include "VMManager.h"
 #include "Vif_Dynarec.h"
 
+#include "common/Timer.h"
+
 #include <thread>
 
 VU_Thread vu1Thread;
@@ -14,6 +16,9 @@ VU_Thread vu1Thread;
 #define MTVU_ALWAYS_KICK 0
 #define MTVU_SYNC_MODE 0
 
+// Blocks from the program cache compiled per idle period, the rest wait for the next one.
+static constexpr u32 PRECOMPILE_CACHED_BLOCKS = 32;
+
 // Rounds up a size in bytes for size in u32's
 static __fi u32 size_u32(u32 x) { return (x + 3) >> 2; }
 
@@ -118,11 +123,75 @@ void VU_Thread::Reset()
 	m_write_pos = 0;
 	m_ato_read_pos = 0;
 	m_read_pos = 0;
+	m_batch_depth = 0;
 	std::memset(&vif, 0, sizeof(vif));
 	std::memset(&vifRegs, 0, sizeof(vifRegs));
 	for (size_t i = 0; i < 4; ++i)
 		vu1Thread.vuCycles[i] = 0;
 	vu1Thread.mtvuInterrupts = 0;
+	m_num_start_pcs = 0;
+	m_micro_changed = false;
+	m_precompile_pending = false;
+}
+
+void VU_Thread::RecordStartPC(u32 start_pc)
+{
+	u32 pos = 0;
+	while (pos < m_num_start_pcs && m_start_pcs[pos] != start_pc)
+		pos++;
+
+	// Not seen recently, take a new slot or replace the least recently used one.
+	if (pos == m_num_start_pcs)
+	{
+		if (m_num_start_pcs < std::size(m_start_pcs))
+			m_num_start_pcs++;
+		else
+			pos--;
+	}
+
+	for (; pos > 0; pos--)
+		m_start_pcs[pos] = m_start_pcs[pos - 1];
+	m_start_pcs[0] = start_pc;
+}
+
+bool VU_Thread::PrecompileInterrupted()
+{
+	// Anything we don't get to will be compiled when it's started, as usual. The VU thread only
+	// counts as idle once it's back in WaitForWork(), so WaitVU() would otherwise wait for us.
+	return m_ee_waiting.load(std::memory_order_acquire) || m_ato_read_pos.load(std::memory_order_relaxed) != GetWritePos();
+}
+
+void VU_Thread::Precompile()
+{
+	// Once VU1 has been started on new microcode, the upload is over. Games usually continue at
+	// TPC (MSCNT) or call one of the entry points they used before. The compiler isn't thread safe, so instead of compiling on
+	// another thread, compile those now, while we'd otherwise be waiting for the EE.
+	const u32 tpc = VU1.VI[REG_TPC].UL << 3;
+	for (u32 i = 0; i <= m_num_start_pcs; i++)
+	{
+		if (PrecompileInterrupted())
+			return;
+
+		const u32 start_pc = (i == 0) ? tpc : m_start_pcs[i - 1];
+		if (i != 0 && start_pc == tpc)
+			continue;
+
+		CpuVU1->Precompile(start_pc);
+	}
+
+	// Then anything a previous session ran with the same microcode. There can be a lot of it, so
+	// only do a slice at a time.
+	for (u32 i = 0; i < PRECOMPILE_CACHED_BLOCKS; i++)
+	{
+		if (PrecompileInterrupted())
+			return;
+
+		if (!CpuVU1->PrecompileCached())
+		{
+			m_precompile_pending = false;
+			return;
+		}
+	}
 }
 
 void VU_Thread::ExecuteRingBuffer()
@@ -131,7 +200,16 @@ void VU_Thread::ExecuteRingBuffer()
 
 	for (;;)
 	{
+		if (m_precompile_pending && EmuConfig.Speedhacks.vuThreadPrecompile)
+			Precompile();
+
+		const Common::Timer::Value idle_start = Common::Timer::GetCurrentValue();
+		m_vu_idle_since.store(idle_start, std::memory_order_relaxed);
 		semaEvent.WaitForWork();
+		m_vu_idle_ticks.store(m_vu_idle_ticks.load(std::memory_order_relaxed) + (Common::Timer::GetCurrentValue() - idle_start),
+			std::memory_order_relaxed);
+		m_vu_idle_since.store(0, std::memory_order_relaxed);
+
 		if (m_shutdown_flag.load(std::memory_order_acquire))
 			break;
 
@@ -148,9 +226,35 @@ void VU_Thread::ExecuteRingBuffer()
 					vifRegs.itop = Read();
 					vuFBRST = Read();
 					if (addr != -1)
+					{
 						VU1.VI[REG_TPC].UL = addr & 0x7FF;
+						RecordStartPC(VU1.VI[REG_TPC].UL << 3);
+					}
 					CpuVU1->SetStartPC(VU1.VI[REG_TPC].UL << 3);
+
+					// Any cache growth means the program, or part of it, had to be compiled first.
+					const size_t cache_used = CpuVU1->GetCommittedCache();
+					const Common::Timer::Value exec_start = Common::Timer::GetCurrentValue();
 					CpuVU1->Execute(vu1RunCycles);
+					if (CpuVU1->GetCommittedCache() != cache_used)
+					{
+						m_vu_compiled_cycles.store(m_vu_compiled_cycles.load(std::memory_order_relaxed) + VU1.cycle, std::memory_order_relaxed);
+						m_vu_compile_ticks.store(m_vu_compile_ticks.load(std::memory_order_relaxed) + (Common::Timer::GetCurrentValue() - exec_start),
+							std::memory_order_relaxed);
+					}
+					else
+					{
+						m_vu_ready_cycles.store(m_vu_ready_cycles.load(std::memory_order_relaxed) + VU1.cycle, std::memory_order_relaxed);
+					}
+
+					// Microcode is often uploaded over several transfers, so don't precompile until
+					// the EE has started it, by then the upload is complete.
+					if (m_micro_changed)
+					{
+						m_micro_changed = false;
+						m_precompile_pending = true;
+					}
+
 					gifUnit.gifPath[GIF_PATH_1].FinishGSPacketMTVU();
 					semaXGkick.Post(); // Tell MTGS a path1 packet is complete
 					vuCycles[vuCycleIdx].store(VU1.cycle, std::memory_order_release);
@@ -163,6 +267,8 @@ void VU_Thread::ExecuteRingBuffer()
 					u32 size = Read();
 					CpuVU1->Clear(vu_micro_addr, size);
 					Read(&VU1.Micro[vu_micro_addr], size);
+					m_micro_changed = true;
+					m_precompile_pending = false;
 					break;
 				}
 				case MTVU_VU_WRITE_DATA:
@@ -211,6 +317,7 @@ void VU_Thread::ExecuteRingBuffer()
 // Should only be called by ReserveSpace()
 __ri void VU_Thread::WaitOnSize(s32 size)
 {
+	Common::Timer::Value wait_start = 0;
 	for (;;)
 	{
 		s32 readPos = GetReadPos();
@@ -224,6 +331,12 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 		if (readPos > m_write_pos + size + _4kb)
 			break; // Enough free front space
 		{          // Let MTVU run to free up buffer space
+			if (wait_start == 0)
+				wait_start = Common::Timer::GetCurrentValue();
+
+			// The VU thread can't free anything we haven't published yet.
+			if (m_ato_write_pos.load(std::memory_order_relaxed) != m_write_pos)
+				CommitWritePos();
 			KickStart();
 			// Locking might trigger a full flush of the ring buffer. Yield
 			// will be more aggressive, and only flush the minimal size.
@@ -232,6 +345,12 @@ __ri void VU_Thread::WaitOnSize(s32 size)
 			std::this_thread::yield();
 		}
 	}
+
+	if (wait_start != 0)
+	{
+		m_ee_wait_ticks.store(m_ee_wait_ticks.load(std::memory_order_relaxed) + (Common::Timer::GetCurrentValue() - wait_start),
+			std::memory_order_relaxed);
+	}
 }
 
 // Makes sure theres enough room in the ring buffer
@@ -277,6 +396,12 @@ __fi void VU_Thread::CommitWritePos()
 {
 	m_ato_write_pos.store(m_write_pos, std::memory_order_release);
 
+	const s32 read_pos = GetReadPos();
+	const u32 usage = static_cast<u32>((m_write_pos >= read_pos) ? (m_write_pos - read_pos) : (buffer_size - read_pos + m_write_pos)) * sizeof(u32);
+	if (usage > m_peak_ring_usage.load(std::memory_order_relaxed))
+		m_peak_ring_usage.store(usage, std::memory_order_relaxed);
+	m_publishes.store(m_publishes.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
 	if (MTVU_ALWAYS_KICK)
 		KickStart();
 	if (MTVU_SYNC_MODE)
@@ -288,6 +413,22 @@ __fi void VU_Thread::CommitReadPos()
 	m_ato_read_pos.store(m_read_pos, std::memory_order_release);
 }
 
+__fi void VU_Thread::Submit()
+{
+	m_commands.store(m_commands.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	if (m_batch_depth == 0)
+		Publish();
+}
+
+void VU_Thread::Publish()
+{
+	if (m_ato_write_pos.load(std::memory_order_relaxed) == m_write_pos)
+		return;
+
+	CommitWritePos();
+	KickStart();
+}
+
 __fi u32 VU_Thread::Read()
 {
 	u32 ret = buffer[m_read_pos];
@@ -429,13 +570,52 @@ void VU_Thread::KickStart()
 
 bool VU_Thread::IsDone()
 {
-	return GetReadPos() == GetWritePos();
+	return GetReadPos() == m_write_pos;
 }
 
 void VU_Thread::WaitVU()
 {
 	MTVU_LOG("MTVU - WaitVU!");
+	m_ee_waiting.store(true, std::memory_order_release);
+	Publish();
+
+	const Common::Timer::Value wait_start = Common::Timer::GetCurrentValue();
 	semaEvent.WaitForEmpty();
+	m_ee_waiting.store(false, std::memory_order_relaxed);
+	m_ee_wait_ticks.store(m_ee_wait_ticks.load(std::memory_order_relaxed) + (Common::Timer::GetCurrentValue() - wait_start),
+		std::memory_order_relaxed);
+}
+
+void VU_Thread::BeginBatch()
+{
+	m_batch_depth++;
+}
+
+void VU_Thread::EndBatch()
+{
+	pxAssert(m_batch_depth > 0);
+	if (--m_batch_depth == 0)
+		Publish();
+}
+
+VU_Thread::Stats VU_Thread::GetStats()
+{
+	Stats stats;
+	stats.ee_wait_ticks = m_ee_wait_ticks.load(std::memory_order_relaxed);
+	stats.vu_idle_ticks = m_vu_idle_ticks.load(std::memory_order_relaxed);
+	stats.commands = m_commands.load(std::memory_order_relaxed);
+	stats.publishes = m_publishes.load(std::memory_order_relaxed);
+	stats.peak_ring_usage = m_peak_ring_usage.exchange(0, std::memory_order_relaxed);
+	stats.ready_cycles = m_vu_ready_cycles.load(std::memory_order_relaxed);
+	stats.compiled_cycles = m_vu_compiled_cycles.load(std::memory_order_relaxed);
+	stats.compile_ticks = m_vu_compile_ticks.load(std::memory_order_relaxed);
+
+	// Count the current wait too, otherwise an idle VU thread would show up as busy.
+	const u64 idle_since = m_vu_idle_since.load(std::memory_order_relaxed);
+	if (idle_since != 0)
+		stats.vu_idle_ticks += Common::Timer::GetCurrentValue() - idle_since;
+
+	return stats;
 }
 
 void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst)
@@ -448,6 +628,8 @@ void VU_Thread::ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst)
 	Write(vif_top);
 	Write(vif_itop);
 	Write(fbrst);
+	// Always published, even in a batch: MTGS waits for this program's path 1 packet.
+	m_commands.store(m_commands.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 	CommitWritePos();
 	gifUnit.TransferGSPacketData(GIF_TRANS_MTVU, NULL, 0);
 	KickStart();
@@ -474,8 +656,7 @@ void VU_Thread::VifUnpack(vifStruct& _vif, VIFregisters& _vifRegs, const u8* dat
 	WriteRegs(&_vifRegs);
 	Write(size);
 	Write(data, size);
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
 
 void VU_Thread::WriteMicroMem(u32 vu_micro_addr, const void* data, u32 size)
@@ -486,8 +667,7 @@ void VU_Thread::WriteMicroMem(u32 vu_micro_addr, const void* data, u32 size)
 	Write(vu_micro_addr);
 	Write(size);
 	Write(data, size);
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
 
 void VU_Thread::WriteDataMem(u32 vu_data_addr, const void* data, u32 size)
@@ -498,8 +678,7 @@ void VU_Thread::WriteDataMem(u32 vu_data_addr, const void* data, u32 size)
 	Write(vu_data_addr);
 	Write(size);
 	Write(data, size);
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
 
 void VU_Thread::WriteVIRegs(REG_VI* viRegs)
@@ -508,8 +687,7 @@ void VU_Thread::WriteVIRegs(REG_VI* viRegs)
 	ReserveSpace(1 + size_u32(32));
 	Write(MTVU_VU_WRITE_VIREGS);
 	Write(viRegs, size_u32(32));
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
 
 void VU_Thread::WriteVFRegs(VECTOR* vfRegs)
@@ -518,8 +696,7 @@ void VU_Thread::WriteVFRegs(VECTOR* vfRegs)
 	ReserveSpace(1 + size_u32(32*4));
 	Write(MTVU_VU_WRITE_VFREGS);
 	Write(vfRegs, size_u32(32*4));
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
 
 void VU_Thread::WriteCol(vifStruct& _vif)
@@ -528,8 +705,7 @@ void VU_Thread::WriteCol(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskCol)));
 	Write(MTVU_VIF_WRITE_COL);
 	Write(&_vif.MaskCol, sizeof(_vif.MaskCol));
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
 
 void VU_Thread::WriteRow(vifStruct& _vif)
@@ -538,6 +714,5 @@ void VU_Thread::WriteRow(vifStruct& _vif)
 	ReserveSpace(1 + size_u32(sizeof(_vif.MaskRow)));
 	Write(MTVU_VIF_WRITE_ROW);
 	Write(&_vif.MaskRow, sizeof(_vif.MaskRow));
-	CommitWritePos();
-	KickStart();
+	Submit();
 }
@@ -25,8 +25,27 @@ class VU_Thread final {
 	alignas(__cachelinesize) std::atomic<int> m_ato_write_pos;    // Only modified by EE thread
 	alignas(__cachelinesize) int  m_read_pos; // temporary read pos (local to the VU thread)
 	int  m_write_pos; // temporary write pos (local to the EE thread)
+	int  m_batch_depth = 0; // nesting of BeginBatch() (local to the EE thread)
 	Threading::WorkSema semaEvent;
 	std::atomic_bool m_shutdown_flag{false};
+	std::atomic_bool m_ee_waiting{false}; // Set by the EE while WaitVU() waits for the VU thread to go idle
+
+	// Telemetry, read by PerformanceMetrics on the GS thread.
+	alignas(__cachelinesize) std::atomic<u64> m_ee_wait_ticks{0}; // Only modified by EE thread
+	std::atomic<u64> m_commands{0};                             // Only modified by EE thread
+	std::atomic<u64> m_publishes{0};                            // Only modified by EE thread
+	std::atomic<u32> m_peak_ring_usage{0};
+	alignas(__cachelinesize) std::atomic<u64> m_vu_idle_ticks{0}; // Only modified by VU thread
+	std::atomic<u64> m_vu_idle_since{0};                        // Only modified by VU thread, 0 while busy
+	std::atomic<u64> m_vu_ready_cycles{0};                      // Only modified by VU thread
+	std::atomic<u64> m_vu_compiled_cycles{0};                   // Only modified by VU thread
+	std::atomic<u64> m_vu_compile_ticks{0};                     // Only modified by VU thread
+
+	// Recently used MSCAL start addresses, most recent first (local to the VU thread)
+	u32 m_start_pcs[4];
+	u32 m_num_start_pcs = 0;
+	bool m_micro_changed = false;      // Micro memory written since VU1 was last started (local to the VU thread)
+	bool m_precompile_pending = false; // VU1 was started on new micro memory since the last precompile (local to the VU thread)
 
 	Threading::Thread m_thread;
 
@@ -50,6 +69,21 @@ public:
 	std::atomic<u64> gsLabel; // Used for GS Label command
 	std::atomic<u64> gsSignal; // Used for GS Signal command
 
+	/// Cumulative ring buffer counters. Times are in Common::Timer ticks.
+	struct Stats
+	{
+		u64 ee_wait_ticks;   ///< EE time spent waiting for ring space or for the VU thread to finish.
+		u64 vu_idle_ticks;   ///< VU thread time spent waiting for commands.
+		u64 commands;        ///< Commands written to the ring.
+		u64 publishes;       ///< Times the write position was published to the VU thread.
+		u32 peak_ring_usage; ///< Highest ring occupancy in bytes since the previous GetStats() call.
+		u64 ready_cycles;    ///< VU1 cycles run by programs that were already compiled when started.
+		u64 compiled_cycles; ///< VU1 cycles run by programs that had to compile code before or while running.
+		u64 compile_ticks;   ///< VU thread time spent running programs that had to compile code.
+	};
+
+	static constexpr u32 RING_SIZE_BYTES = buffer_size * sizeof(u32);
+
 	VU_Thread();
 	~VU_Thread();
 
@@ -75,6 +109,15 @@ public:
 	// Waits till MTVU is done processing
 	void WaitVU();
 
+	/// Commands written until the matching EndBatch() are published to the VU thread with a single
+	/// store, instead of one per command. Batches nest, and are published early when the EE has to
+	/// wait on the VU thread or a VU program is started.
+	void BeginBatch();
+	void EndBatch();
+
+	/// Safe to call from any thread. Resets the peak ring usage.
+	Stats GetStats();
+
 	void Get_MTVUChanges();
 
 	void ExecuteVU(u32 vu_addr, u32 vif_top, u32 vif_itop, u32 fbrst);
@@ -98,6 +141,11 @@ public:
 private:
 	void ExecuteRingBuffer();
 
+	void RecordStartPC(u32 start_pc);
+	// Compiles the programs the EE is likely to start next, until it sends more work or waits for us.
+	void Precompile();
+	bool PrecompileInterrupted();
+
 	void WaitOnSize(s32 size);
 	void ReserveSpace(s32 size);
 
@@ -109,6 +157,11 @@ private:
 	void CommitWritePos();
 	void CommitReadPos();
 
+	// Publishes a finished command, unless a batch is open
+	void Submit();
+	// Publishes any commands written since the last publish
+	void Publish();
+
 	u32 Read();
 	void Read(void* dest, u32 size);
 	void ReadRegs(VIFregisters* dest);
@@ -9,12 +9,17 @@
 #include "SaveState.h"
 #include "PINE.h"
 #include "VMManager.h"
+#include "vtlb.h"
 #include "common/Error.h"
 #include "common/Threading.h"
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <mutex>
 #include <span>
 #include <sys/types.h>
 #include <thread>
@@ -159,6 +164,10 @@ namespace PINEServer
 		MsgUUID = 0xD, /**< Returns the game UUID. */
 		MsgGameVersion = 0xE, /**< Returns the game verion. */
 		MsgStatus = 0xF, /**< Returns the emulator status. */
+		MsgReadRange = 0x10, /**< Reads a block of memory. */
+		MsgWatchAdd = 0x11, /**< Registers a memory range to watch. */
+		MsgWatchRemove = 0x12, /**< Unregisters a watched memory range. */
+		MsgWatchWait = 0x13, /**< Waits for a vsync and returns the watched bytes which changed. */
 		MsgUnimplemented = 0xFF /**< Unimplemented IPC message. */
 	};
 
@@ -183,6 +192,56 @@ namespace PINEServer
 		std::vector<u8> buffer; /**< Buffer. */
 	};
 
+	/**
+	 * Memory watch.
+	 * An address range registered with MsgWatchAdd. Its contents are
+	 * snapshotted on the CPU thread at every vsync, and MsgWatchWait replies
+	 * with the bytes which differ from what the client was last sent.
+	 */
+	struct MemoryWatch
+	{
+		u32 id; /**< Identifier handed back to the client. */
+		u32 addr; /**< Start address of the range. */
+		bool valid; /**< Whether the last snapshot could be read. */
+		bool sent; /**< Whether the client has received the range yet. */
+		std::vector<u8> snapshot; /**< Contents at the last vsync. */
+		std::vector<u8> shadow; /**< Contents last sent to the client. */
+	};
+
+	/**
+	 * Maximum number of ranges a client can watch at once.
+	 */
+#define MAX_WATCHES 64
+
+	/**
+	 * Maximum number of bytes a client can watch in total.
+	 * Small enough that a full delta always fits in a reply, run headers
+	 * included.
+	 */
+#define MAX_WATCH_BYTES (MAX_IPC_RETURN_SIZE / 4)
+
+	/**
+	 * Unchanged bytes between two changed runs below which they are sent as
+	 * one run, as that is cheaper than another run header.
+	 */
+#define WATCH_MERGE_GAP 8
+
+	/**
+	 * How long MsgWatchWait waits for a vsync before replying with no
+	 * changes, so that a client isn't stuck while the VM is paused.
+	 */
+#define WATCH_WAIT_TIMEOUT_MS 1000
+
+	static std::mutex s_watch_mutex;
+	static std::condition_variable s_watch_cv;
+	static std::vector<MemoryWatch> s_watches;
+	static std::atomic_bool s_watch_active{false};
+	static u32 s_watch_next_id = 1;
+	static u32 s_watch_bytes = 0;
+	// vsyncs snapshotted, and the last one whose changes were sent.
+	static u32 s_watch_frame = 0;
+	static u32 s_watch_sent_frame = 0;
+
 	/**
 	 * IPC result codes.
 	 * A list of possible result codes the IPC can send back.
@@ -223,6 +282,23 @@ namespace PINEServer
 	 */
 	bool AcceptClient();
 
+	/**
+	 * Registers a watched memory range.
+	 * return value: the watch identifier, 0 if the range cannot be watched.
+	 */
+	static u32 AddWatch(u32 addr, u32 size);
+	static bool RemoveWatch(u32 id);
+	static void ClearWatches();
+
+	/**
+	 * Waits for the next vsync snapshot, then writes the watched bytes which
+	 * changed since the last call to the reply.
+	 * ret_buffer: buffer that will be used to send the reply.
+	 * ret_cnt: where to write in the reply.
+	 * return value: the new reply size, 0 if the changes didn't fit.
+	 */
+	static u32 WaitForWatches(std::vector<u8>& ret_buffer, u32 ret_cnt);
+
 	/**
 	 * Converts a primitive value to bytes in little endian
 	 * res_vector: the vector to modify
@@ -425,6 +501,7 @@ void PINEServer::MainLoop()
 
 		Console.WriteLn("PINE: Client disconnected.");
 		safe_close_portable(s_msgsock);
+		ClearWatches();
 	}
 }
 
@@ -504,10 +581,160 @@ void PINEServer::Deinitialize()
 	safe_close_portable(s_sock);
 	safe_close_portable(s_msgsock);
 
+	// wake up a client waiting on its watches.
+	s_watch_cv.notify_all();
+
 	if (s_thread.joinable())
 		s_thread.join();
 }
 
+void PINEServer::OnVsync()
+{
+	if (!s_watch_active.load(std::memory_order_acquire))
+		return;
+
+	{
+		std::unique_lock lock(s_watch_mutex);
+		for (MemoryWatch& watch : s_watches)
+			watch.valid = vtlb_memSafeReadBytes(watch.addr, watch.snapshot.data(), static_cast<u32>(watch.snapshot.size()));
+		s_watch_frame++;
+	}
+
+	s_watch_cv.notify_one();
+}
+
+u32 PINEServer::AddWatch(u32 addr, u32 size)
+{
+	std::unique_lock lock(s_watch_mutex);
+	if (size == 0 || s_watches.size() >= MAX_WATCHES || size > MAX_WATCH_BYTES - s_watch_bytes)
+		return 0;
+
+	MemoryWatch watch;
+	watch.id = s_watch_next_id++;
+	watch.addr = addr;
+	watch.snapshot.resize(size);
+	watch.shadow.resize(size);
+	watch.sent = false;
+
+	// reject ranges backed by I/O handlers up front, we only ever memcpy.
+	watch.valid = vtlb_memSafeReadBytes(addr, watch.snapshot.data(), size);
+	if (!watch.valid)
+		return 0;
+
+	s_watch_bytes += size;
+	s_watches.push_back(std::move(watch));
+	s_watch_active.store(true, std::memory_order_release);
+	return s_watches.back().id;
+}
+
+bool PINEServer::RemoveWatch(u32 id)
+{
+	std::unique_lock lock(s_watch_mutex);
+	const auto it = std::find_if(s_watches.begin(), s_watches.end(), [id](const MemoryWatch& watch) { return watch.id == id; });
+	if (it == s_watches.end())
+		return false;
+
+	s_watch_bytes -= static_cast<u32>(it->snapshot.size());
+	s_watches.erase(it);
+	s_watch_active.store(!s_watches.empty(), std::memory_order_release);
+	return true;
+}
+
+void PINEServer::ClearWatches()
+{
+	std::unique_lock lock(s_watch_mutex);
+	s_watches.clear();
+	s_watch_bytes = 0;
+	s_watch_sent_frame = s_watch_frame;
+	s_watch_active.store(false, std::memory_order_release);
+}
+
+u32 PINEServer::WaitForWatches(std::vector<u8>& ret_buffer, u32 ret_cnt)
+{
+	std::unique_lock lock(s_watch_mutex);
+	s_watch_cv.wait_for(lock, std::chrono::milliseconds(WATCH_WAIT_TIMEOUT_MS), []() {
+		return s_watch_frame != s_watch_sent_frame || s_end.load(std::memory_order_acquire);
+	});
+
+	// reply: frame (4 bytes), run count (4 bytes), then for each run
+	//        address (4 bytes), length (4 bytes), bytes.
+	const u32 header_pos = ret_cnt;
+	u32 runs = 0;
+	ret_cnt += 8;
+
+	if (s_watch_frame != s_watch_sent_frame)
+	{
+		// the shadows are only updated once the whole reply fits, otherwise the client
+		// would never be sent the runs that didn't.
+		struct Run
+		{
+			MemoryWatch* watch;
+			u32 pos;
+			u32 len;
+		};
+		std::vector<Run> sent_runs;
+
+		for (MemoryWatch& watch : s_watches)
+		{
+			if (!watch.valid)
+				continue;
+
+			const u8* snapshot = watch.snapshot.data();
+			const u8* shadow = watch.shadow.data();
+			const u32 size = static_cast<u32>(watch.snapshot.size());
+			u32 pos = 0;
+			while (pos < size)
+			{
+				u32 last_changed;
+				if (!watch.sent)
+				{
+					last_changed = size - 1;
+				}
+				else
+				{
+					// skip over unchanged memory a word at a time.
+					while ((size - pos) >= 8 && std::memcmp(&snapshot[pos], &shadow[pos], 8) == 0)
+						pos += 8;
+					while (pos < size && snapshot[pos] == shadow[pos])
+						pos++;
+					if (pos == size)
+						break;
+
+					last_changed = pos;
+					for (u32 i = pos + 1; i < size && (i - last_changed) <= WATCH_MERGE_GAP; i++)
+					{
+						if (snapshot[i] != shadow[i])
+							last_changed = i;
+					}
+				}
+
+				const u32 len = last_changed - pos + 1;
+				if (!SafetyChecks(0, 0, ret_cnt, 8 + len)) [[unlikely]]
+					return 0;
+
+				ToResultVector(ret_buffer, watch.addr + pos, ret_cnt);
+				ToResultVector(ret_buffer, len, ret_cnt + 4);
+				std::memcpy(&ret_buffer[ret_cnt + 8], &snapshot[pos], len);
+				sent_runs.push_back({&watch, pos, len});
+				ret_cnt += 8 + len;
+				runs++;
+				pos = last_changed + 1;
+			}
+		}
+
+		for (const Run& run : sent_runs)
+			std::memcpy(&run.watch->shadow[run.pos], &run.watch->snapshot[run.pos], run.len);
+		for (MemoryWatch& watch : s_watches)
+			watch.sent |= watch.valid;
+
+		s_watch_sent_frame = s_watch_frame;
+	}
+
+	ToResultVector(ret_buffer, s_watch_frame, header_pos);
+	ToResultVector(ret_buffer, runs, header_pos + 4);
+	return ret_cnt;
+}
+
 PINEServer::IPCBuffer PINEServer::ParseCommand(std::span<u8> buf, std::vector<u8>& ret_buffer, u32 buf_size)
 {
 	u32 ret_cnt = 5;
@@ -748,6 +975,58 @@ PINEServer::IPCBuffer PINEServer::ParseCommand(std::span<u8> buf, std::vector<u8
 				ret_cnt += 4;
 				break;
 			}
+			case MsgReadRange:
+			{
+				if (!VMManager::HasValidVM())
+					goto error;
+				if (!SafetyChecks(buf_cnt, 4 + 4, ret_cnt, 0, buf_size)) [[unlikely]]
+					goto error;
+				const u32 a = FromSpan<u32>(buf, buf_cnt);
+				const u32 size = FromSpan<u32>(buf, buf_cnt + 4);
+				if (size >= MAX_IPC_RETURN_SIZE || !SafetyChecks(buf_cnt, 4 + 4, ret_cnt, size, buf_size)) [[unlikely]]
+					goto error;
+				// straight from guest memory into the reply, no per-byte handler
+				// dispatch. ranges backed by I/O handlers are refused.
+				if (!vtlb_memSafeReadBytes(a, &ret_buffer[ret_cnt], size))
+					goto error;
+				ret_cnt += size;
+				buf_cnt += 8;
+				break;
+			}
+			case MsgWatchAdd:
+			{
+				if (!VMManager::HasValidVM())
+					goto error;
+				if (!SafetyChecks(buf_cnt, 4 + 4, ret_cnt, 4, buf_size)) [[unlikely]]
+					goto error;
+				const u32 id = AddWatch(FromSpan<u32>(buf, buf_cnt), FromSpan<u32>(buf, buf_cnt + 4));
+				if (id == 0)
+					goto error;
+				ToResultVector(ret_buffer, id, ret_cnt);
+				ret_cnt += 4;
+				buf_cnt += 8;
+				break;
+			}
+			case MsgWatchRemove:
+			{
+				if (!SafetyChecks(buf_cnt, 4, ret_cnt, 0, buf_size)) [[unlikely]]
+					goto error;
+				if (!RemoveWatch(FromSpan<u32>(buf, buf_cnt)))
+					goto error;
+				buf_cnt += 4;
+				break;
+			}
+			case MsgWatchWait:
+			{
+				if (!VMManager::HasValidVM())
+					goto error;
+				if (!SafetyChecks(buf_cnt, 0, ret_cnt, 8, buf_size)) [[unlikely]]
+					goto error;
+				ret_cnt = WaitForWatches(ret_buffer, ret_cnt);
+				if (ret_cnt == 0)
+					goto error;
+				break;
+			}
 			default:
 			{
 			error:
@@ -19,4 +19,7 @@ namespace PINEServer
 
 	bool Initialize(int slot = PINE_DEFAULT_SLOT);
 	void Deinitialize();
+
+	/// Snapshots the memory ranges watched by the client. Called on the CPU thread at vsync.
+	void OnVsync();
 } // namespace PINEServer
@@ -384,6 +384,8 @@ Pcsx2Config::SpeedhackOptions::SpeedhackOptions()
 	IntcStat = true;
 	vuFlagHack = true;
 	vu1Instant = true;
+	vuThreadPrecompile = true;
+	ipuDecodeAhead = true;
 }
 
 Pcsx2Config::SpeedhackOptions& Pcsx2Config::SpeedhackOptions::DisableAll()
@@ -407,6 +409,8 @@ void Pcsx2Config::SpeedhackOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(vuFlagHack);
 	SettingsWrapBitBool(vuThread);
 	SettingsWrapBitBool(vu1Instant);
+	SettingsWrapBitBool(vuThreadPrecompile);
+	SettingsWrapBitBool(ipuDecodeAhead);
 
 	EECycleRate = std::clamp(EECycleRate, MIN_EE_CYCLE_RATE, MAX_EE_CYCLE_RATE);
 	EECycleSkip = std::min(EECycleSkip, MAX_EE_CYCLE_SKIP);
@@ -1255,7 +1259,9 @@ bool Pcsx2Config::GSOptions::OptionsAreEqual(const GSOptions& right) const
 		OpEqu(Adapter) &&
 
 		OpEqu(HWDumpDirectory) &&
-		OpEqu(SWDumpDirectory));
+		OpEqu(SWDumpDirectory) &&
+		OpEqu(StereoProfile) &&
+		OpEqu(StereoTracePath));
 }
 
 bool Pcsx2Config::GSOptions::operator!=(const GSOptions& right) const
@@ -1814,6 +1820,8 @@ void Pcsx2Config::GSOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapEntry(StereoSbsRemapMono);
 	SettingsWrapEntry(StereoInstancedShaderScissor);
 	SettingsWrapEntry(StereoInstancedShaderDrawArea);
+	SettingsWrapEntry(StereoProfile);
+	SettingsWrapEntry(StereoTracePath);
 
 	// Sanity check: don't dump a bunch of crap in the current working directory.
 	if (DumpGSData && (HWDumpDirectory.empty() || SWDumpDirectory.empty()))
@@ -2383,6 +2391,9 @@ void Pcsx2Config::SavestateOptions::LoadSave(SettingsWrapper& wrap)
 
 	SettingsWrapIntEnumEx(CompressionType, "SavestateCompressionType");
 	SettingsWrapIntEnumEx(CompressionRatio, "SavestateCompressionRatio");
+	SettingsWrapEntry(RewindEnable);
+	SettingsWrapEntry(RewindFrequency);
+	SettingsWrapEntry(RewindBufferSize);
 }
 
 bool Pcsx2Config::SavestateOptions::operator!=(const SavestateOptions& right) const
@@ -2392,7 +2403,8 @@ bool Pcsx2Config::SavestateOptions::operator!=(const SavestateOptions& right) co
 
 bool Pcsx2Config::SavestateOptions::operator==(const SavestateOptions& right) const
 {
-	return OpEqu(CompressionType) && OpEqu(CompressionRatio);
+	return OpEqu(CompressionType) && OpEqu(CompressionRatio) && OpEqu(RewindEnable) && OpEqu(RewindFrequency) &&
+		   OpEqu(RewindBufferSize);
 };
 
 Pcsx2Config::FilenameOptions::FilenameOptions()
@@ -2676,6 +2688,9 @@ Pcsx2Config::Pcsx2Config()
 	}
 
 	GzipIsoIndexTemplate = "$(f).pindex.tmp";
+	CdvdDecompressThreads = 2;
+	CdvdChunkCacheSize = 64;
+	CdvdPrefetchChunks = 16;
 	PINESlot = 28011;
 	RtcYear = 0;
 	RtcMonth = 1;
@@ -2732,6 +2747,9 @@ void Pcsx2Config::LoadSaveCore(SettingsWrapper& wrap)
 	Achievements.LoadSave(wrap);
 
 	SettingsWrapEntry(GzipIsoIndexTemplate);
+	SettingsWrapEntry(CdvdDecompressThreads);
+	SettingsWrapEntry(CdvdChunkCacheSize);
+	SettingsWrapEntry(CdvdPrefetchChunks);
 	SettingsWrapEntry(PINESlot);
 	SettingsWrapEntry(RtcYear);
 	SettingsWrapEntry(RtcMonth);
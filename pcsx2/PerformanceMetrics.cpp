@@ -54,6 +54,15 @@ static float s_vu_thread_time = 0.0f;
 static float s_capture_thread_usage = 0.0f;
 static float s_capture_thread_time = 0.0f;
 
+static VU_Thread::Stats s_last_vu_stats = {};
+static float s_vu_ring_peak_usage = 0.0f;
+static float s_vu_ee_wait_usage = 0.0f;
+static float s_vu_ee_wait_time = 0.0f;
+static float s_vu_idle_usage = 0.0f;
+static float s_vu_commands_per_batch = 0.0f;
+static float s_vu_ready_cycle_usage = 0.0f;
+static float s_vu_compile_time = 0.0f;
+
 static PerformanceMetrics::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
 
@@ -91,6 +100,14 @@ void PerformanceMetrics::Clear()
 	s_capture_thread_usage = 0.0f;
 	s_capture_thread_time = 0.0f;
 
+	s_vu_ring_peak_usage = 0.0f;
+	s_vu_ee_wait_usage = 0.0f;
+	s_vu_ee_wait_time = 0.0f;
+	s_vu_idle_usage = 0.0f;
+	s_vu_commands_per_batch = 0.0f;
+	s_vu_ready_cycle_usage = 0.0f;
+	s_vu_compile_time = 0.0f;
+
 	s_average_gpu_time = 0.0f;
 	s_gpu_usage = 0.0f;
 
@@ -119,6 +136,7 @@ void PerformanceMetrics::Reset()
 	s_last_cpu_time = s_cpu_thread_handle.GetCPUTime();
 	s_last_gs_time = MTGS::GetThreadHandle().GetCPUTime();
 	s_last_vu_time = THREAD_VU1 ? vu1Thread.GetThreadHandle().GetCPUTime() : 0;
+	s_last_vu_stats = THREAD_VU1 ? vu1Thread.GetStats() : VU_Thread::Stats{};
 	s_last_ticks = GetCPUTicks();
 	s_last_capture_time = GSCapture::IsCapturing() ? GSCapture::GetEncoderThreadHandle().GetCPUTime() : 0;
 
@@ -212,6 +230,25 @@ void PerformanceMetrics::Update(bool gs_register_write, bool fb_blit, bool is_sk
 	s_vu_thread_time = static_cast<double>(vu_delta) * time_divider;
 	s_capture_thread_time = static_cast<double>(capture_delta) * time_divider;
 
+	if (THREAD_VU1)
+	{
+		const VU_Thread::Stats vu_stats = vu1Thread.GetStats();
+		const double ee_wait = Common::Timer::ConvertValueToSeconds(vu_stats.ee_wait_ticks - s_last_vu_stats.ee_wait_ticks);
+		const double vu_idle = Common::Timer::ConvertValueToSeconds(vu_stats.vu_idle_ticks - s_last_vu_stats.vu_idle_ticks);
+		const u64 publishes = vu_stats.publishes - s_last_vu_stats.publishes;
+		s_vu_ring_peak_usage = static_cast<float>(vu_stats.peak_ring_usage) * (100.0f / VU_Thread::RING_SIZE_BYTES);
+		s_vu_ee_wait_usage = static_cast<float>(ee_wait * 100.0 / time);
+		s_vu_ee_wait_time = static_cast<float>(ee_wait * 1000.0 / s_frames_since_last_update);
+		s_vu_idle_usage = std::min(static_cast<float>(vu_idle * 100.0 / time), 100.0f);
+		s_vu_commands_per_batch = publishes ? static_cast<float>(vu_stats.commands - s_last_vu_stats.commands) / publishes : 0.0f;
+		const u64 ready_cycles = vu_stats.ready_cycles - s_last_vu_stats.ready_cycles;
+		const u64 vu_cycles = ready_cycles + (vu_stats.compiled_cycles - s_last_vu_stats.compiled_cycles);
+		const double compile_time = Common::Timer::ConvertValueToSeconds(vu_stats.compile_ticks - s_last_vu_stats.compile_ticks);
+		s_vu_ready_cycle_usage = vu_cycles ? static_cast<float>(static_cast<double>(ready_cycles) * 100.0 / static_cast<double>(vu_cycles)) : 100.0f;
+		s_vu_compile_time = static_cast<float>(compile_time * 1000.0 / s_frames_since_last_update);
+		s_last_vu_stats = vu_stats;
+	}
+
 	for (GSSWThreadStats& thread : s_gs_sw_threads)
 	{
 		const u64 time = thread.handle.GetCPUTime();
@@ -327,6 +364,41 @@ float PerformanceMetrics::GetVUThreadAverageTime()
 	return s_vu_thread_time;
 }
 
+float PerformanceMetrics::GetVURingPeakUsage()
+{
+	return s_vu_ring_peak_usage;
+}
+
+float PerformanceMetrics::GetVUEEWaitUsage()
+{
+	return s_vu_ee_wait_usage;
+}
+
+float PerformanceMetrics::GetVUEEWaitAverageTime()
+{
+	return s_vu_ee_wait_time;
+}
+
+float PerformanceMetrics::GetVUThreadIdleUsage()
+{
+	return s_vu_idle_usage;
+}
+
+float PerformanceMetrics::GetVUCommandsPerBatch()
+{
+	return s_vu_commands_per_batch;
+}
+
+float PerformanceMetrics::GetVUReadyCycleUsage()
+{
+	return s_vu_ready_cycle_usage;
+}
+
+float PerformanceMetrics::GetVUCompileAverageTime()
+{
+	return s_vu_compile_time;
+}
+
 float PerformanceMetrics::GetCaptureThreadUsage()
 {
 	return s_capture_thread_usage;
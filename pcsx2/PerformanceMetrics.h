@@ -48,6 +48,17 @@ namespace PerformanceMetrics
 	float GetGSThreadAverageTime();
 	float GetVUThreadUsage();
 	float GetVUThreadAverageTime();
+
+	/// MTVU ring buffer telemetry, zero when the VU thread is not in use.
+	float GetVURingPeakUsage();
+	float GetVUEEWaitUsage();
+	float GetVUEEWaitAverageTime();
+	float GetVUThreadIdleUsage();
+	float GetVUCommandsPerBatch();
+	/// Share of VU1 cycles run by programs that didn't need compiling, and the time per frame spent
+	/// running programs that did.
+	float GetVUReadyCycleUsage();
+	float GetVUCompileAverageTime();
 	float GetCaptureThreadUsage();
 	float GetCaptureThreadAverageTime();
 
@@ -0,0 +1,462 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "Rewind.h"
+#include "Achievements.h"
+#include "Config.h"
+#include "GSDumpReplayer.h"
+#include "Host.h"
+#include "SaveState.h"
+#include "SaveStateDelta.h"
+#include "VMManager.h"
+
+#include "common/Console.h"
+#include "common/Error.h"
+#include "common/Threading.h"
+#include "common/Timer.h"
+
+#include "IconsFontAwesome.h"
+#include "fmt/format.h"
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+RewindBuffer::RewindBuffer(size_t memory_budget, int compression_level)
+	: m_memory_budget(memory_budget)
+	, m_compression_level(compression_level)
+{
+	m_thread = std::thread(&RewindBuffer::WorkerThread, this);
+}
+
+RewindBuffer::~RewindBuffer()
+{
+	{
+		std::unique_lock lock(m_mutex);
+		m_shutdown = true;
+	}
+	m_work_cv.notify_one();
+	m_thread.join();
+}
+
+std::vector<u8> RewindBuffer::GetFreeBuffer()
+{
+	std::unique_lock lock(m_mutex);
+	if (m_free_buffers.empty())
+		return {};
+
+	std::vector<u8> buffer = std::move(m_free_buffers.back());
+	m_free_buffers.pop_back();
+	return buffer;
+}
+
+bool RewindBuffer::Push(std::vector<u8> data)
+{
+	{
+		std::unique_lock lock(m_mutex);
+		if (m_pending.size() >= MAX_PENDING)
+		{
+			m_free_buffers.push_back(std::move(data));
+			return false;
+		}
+
+		m_pending.push_back(std::move(data));
+	}
+
+	m_work_cv.notify_one();
+	return true;
+}
+
+bool RewindBuffer::Rewind(u32 steps, std::vector<u8>* data)
+{
+	std::unique_lock lock(m_mutex);
+	m_done_cv.wait(lock, [this]() { return (m_pending.empty() && !m_busy); });
+	if (m_newest.empty())
+		return false;
+
+	steps = std::min<u32>(steps, static_cast<u32>(m_snapshots.size()));
+	for (u32 i = 0; i < steps; i++)
+	{
+		const Snapshot& snapshot = m_snapshots.back();
+		if (!Restore(snapshot, &m_newest))
+		{
+			Console.Error("Rewind: Failed to restore snapshot, discarding history.");
+			m_snapshots.clear();
+			m_compressed_size = 0;
+			m_newest.clear();
+			return false;
+		}
+
+		m_compressed_size -= snapshot.compressed.size();
+		m_snapshots.pop_back();
+	}
+
+	data->assign(m_newest.begin(), m_newest.end());
+	return true;
+}
+
+void RewindBuffer::WaitForWorker()
+{
+	std::unique_lock lock(m_mutex);
+	m_done_cv.wait(lock, [this]() { return (m_pending.empty() && !m_busy); });
+}
+
+void RewindBuffer::Clear()
+{
+	std::unique_lock lock(m_mutex);
+	m_done_cv.wait(lock, [this]() { return (m_pending.empty() && !m_busy); });
+	m_snapshots.clear();
+	m_newest.clear();
+	m_compressed_size = 0;
+}
+
+u32 RewindBuffer::GetCount()
+{
+	std::unique_lock lock(m_mutex);
+	return static_cast<u32>(m_snapshots.size()) + !m_newest.empty();
+}
+
+RewindBuffer::Stats RewindBuffer::GetStats()
+{
+	std::unique_lock lock(m_mutex);
+	Stats stats;
+	stats.snapshots = static_cast<u32>(m_snapshots.size()) + !m_newest.empty();
+	stats.memory_used = m_compressed_size + m_newest.size();
+	stats.last_compressed_size = m_last_compressed_size;
+	stats.average_compress_ms = m_compress_count ? (m_total_compress_ms / m_compress_count) : 0.0;
+	return stats;
+}
+
+void RewindBuffer::WorkerThread()
+{
+	Threading::SetNameOfCurrentThread("Rewind Compression");
+
+	std::unique_lock lock(m_mutex);
+	for (;;)
+	{
+		m_work_cv.wait(lock, [this]() { return (m_shutdown || !m_pending.empty()); });
+		if (m_shutdown)
+			break;
+
+		std::vector<u8> data = std::move(m_pending.front());
+		m_pending.pop_front();
+		m_busy = true;
+
+		// Snapshots are only touched here or by the caller once we're idle, so this can run unlocked.
+		lock.unlock();
+		AddSnapshot(std::move(data));
+		lock.lock();
+
+		m_busy = false;
+		m_done_cv.notify_all();
+	}
+}
+
+void RewindBuffer::AddSnapshot(std::vector<u8> data)
+{
+	if (m_newest.empty())
+	{
+		m_newest = std::move(data);
+		return;
+	}
+
+	Common::Timer timer;
+
+	// The current newest snapshot becomes the pages which differ from the new one.
+	Snapshot snapshot;
+	std::vector<u8> delta;
+	std::span<const u8> raw = m_newest;
+	snapshot.is_delta = (data.size() == m_newest.size());
+	if (snapshot.is_delta)
+	{
+		SaveStateDelta::Encode(data, m_newest, &delta);
+		raw = delta;
+	}
+
+	snapshot.size = raw.size();
+	snapshot.compressed.resize(ZSTD_compressBound(raw.size()));
+	const size_t compressed_size =
+		ZSTD_compress(snapshot.compressed.data(), snapshot.compressed.size(), raw.data(), raw.size(), m_compression_level);
+	if (ZSTD_isError(compressed_size))
+	{
+		Console.Error(fmt::format("Rewind: Failed to compress snapshot: {}", ZSTD_getErrorName(compressed_size)));
+		return;
+	}
+
+	snapshot.compressed.resize(compressed_size);
+	snapshot.compressed.shrink_to_fit();
+	const double compress_ms = timer.GetTimeMilliseconds();
+
+	std::unique_lock lock(m_mutex);
+	m_compressed_size += compressed_size;
+	m_snapshots.push_back(std::move(snapshot));
+	if (m_free_buffers.size() < MAX_PENDING)
+		m_free_buffers.push_back(std::move(m_newest));
+	m_newest = std::move(data);
+
+	m_last_compressed_size = compressed_size;
+	m_total_compress_ms += compress_ms;
+	m_compress_count++;
+	EvictToBudget();
+}
+
+bool RewindBuffer::Restore(const Snapshot& snapshot, std::vector<u8>* data)
+{
+	std::vector<u8> raw(snapshot.size);
+	const size_t size = ZSTD_decompress(raw.data(), raw.size(), snapshot.compressed.data(), snapshot.compressed.size());
+	if (ZSTD_isError(size) || size != snapshot.size)
+		return false;
+
+	if (!snapshot.is_delta)
+	{
+		*data = std::move(raw);
+		return true;
+	}
+
+	return SaveStateDelta::Apply(raw, *data);
+}
+
+void RewindBuffer::EvictToBudget()
+{
+	while (!m_snapshots.empty() && (m_compressed_size + m_newest.size()) > m_memory_budget)
+	{
+		m_compressed_size -= m_snapshots.front().compressed.size();
+		m_snapshots.pop_front();
+	}
+}
+
+// Snapshots are the raw state buffer followed by its entry list, so they can be diffed page by page.
+void RewindBuffer::WriteEntryTable(ArchiveEntryList* list)
+{
+	std::vector<u8>& buffer = list->GetBuffer();
+	const u32 table_offset = static_cast<u32>(buffer.size());
+	const auto append = [&buffer](const void* data, size_t size) {
+		const u8* ptr = static_cast<const u8*>(data);
+		buffer.insert(buffer.end(), ptr, ptr + size);
+	};
+
+	const u32 count = static_cast<u32>(list->GetLength());
+	for (u32 i = 0; i < count; i++)
+	{
+		const ArchiveEntry& entry = (*list)[i];
+		const u32 header[3] = {static_cast<u32>(entry.GetDataIndex()), static_cast<u32>(entry.GetDataSize()),
+			static_cast<u32>(entry.GetFilename().size())};
+		append(header, sizeof(header));
+		append(entry.GetFilename().data(), entry.GetFilename().size());
+	}
+
+	append(&count, sizeof(count));
+	append(&table_offset, sizeof(table_offset));
+}
+
+bool RewindBuffer::ReadEntryTable(ArchiveEntryList* list)
+{
+	const std::vector<u8>& buffer = list->GetBuffer();
+	u32 footer[2];
+	if (buffer.size() < sizeof(footer))
+		return false;
+
+	std::memcpy(footer, buffer.data() + buffer.size() - sizeof(footer), sizeof(footer));
+	const size_t table_end = buffer.size() - sizeof(footer);
+	size_t pos = footer[1];
+	for (u32 i = 0; i < footer[0]; i++)
+	{
+		u32 header[3];
+		if (pos + sizeof(header) > table_end)
+			return false;
+
+		std::memcpy(header, buffer.data() + pos, sizeof(header));
+		pos += sizeof(header);
+		if (pos + header[2] > table_end || static_cast<size_t>(header[0]) + header[1] > footer[1])
+			return false;
+
+		list->Add(ArchiveEntry(std::string(reinterpret_cast<const char*>(buffer.data() + pos), header[2]))
+					  .SetDataIndex(header[0])
+					  .SetDataSize(header[1]));
+		pos += header[2];
+	}
+
+	return (pos == table_end);
+}
+
+namespace Rewind
+{
+	static void Capture();
+
+	// Frames between steps while the hotkey is held.
+	static constexpr u32 REWIND_STEP_FRAMES = 2;
+
+	static std::unique_ptr<RewindBuffer> s_buffer;
+	static size_t s_buffer_budget = 0;
+	static ArchiveEntryList s_capture_list;
+	static u32 s_frames_since_capture = 0;
+	static bool s_rewinding = false;
+	static bool s_capture_pending = false;
+	static bool s_step_back_pending = false;
+
+	static double s_total_capture_ms = 0.0;
+	static u64 s_capture_count = 0;
+} // namespace Rewind
+
+void Rewind::UpdateSettings()
+{
+	const bool enabled = EmuConfig.Savestate.RewindEnable && VMManager::HasValidVM();
+	const size_t budget = static_cast<size_t>(EmuConfig.Savestate.RewindBufferSize) * _1mb;
+	if (!enabled)
+	{
+		Shutdown();
+		return;
+	}
+
+	// Changing the budget throws the history away, it's cheap to rebuild.
+	if (s_buffer && s_buffer_budget == budget)
+		return;
+
+	Console.WriteLn(fmt::format("Rewind: Capturing every {} frames into a {} MB buffer.",
+		EmuConfig.Savestate.RewindFrequency, EmuConfig.Savestate.RewindBufferSize));
+	s_buffer = std::make_unique<RewindBuffer>(budget);
+	s_buffer_budget = budget;
+	s_frames_since_capture = 0;
+	s_total_capture_ms = 0.0;
+	s_capture_count = 0;
+}
+
+void Rewind::Shutdown()
+{
+	if (s_buffer && s_capture_count > 0)
+	{
+		const RewindBuffer::Stats stats = s_buffer->GetStats();
+		DevCon.WriteLn(fmt::format("Rewind: {} snapshots in {:.1f} MB, {:.2f} ms capture, {:.2f} ms compression on average.",
+			stats.snapshots, static_cast<double>(stats.memory_used) / _1mb, s_total_capture_ms / s_capture_count,
+			stats.average_compress_ms));
+	}
+
+	s_buffer.reset();
+	s_capture_list.Clear();
+	s_capture_list.GetBuffer().shrink_to_fit();
+	s_rewinding = false;
+	s_capture_pending = false;
+	s_step_back_pending = false;
+}
+
+void Rewind::OnVsync()
+{
+	if (!s_buffer || GSDumpReplayer::IsReplayingDump())
+		return;
+
+	if (s_rewinding)
+	{
+		if (++s_frames_since_capture < REWIND_STEP_FRAMES)
+			return;
+
+		s_frames_since_capture = 0;
+		s_step_back_pending = true;
+		return;
+	}
+
+	if (++s_frames_since_capture < std::max(EmuConfig.Savestate.RewindFrequency, 1u))
+		return;
+
+	s_frames_since_capture = 0;
+	s_capture_pending = true;
+}
+
+bool Rewind::HasPendingWork()
+{
+	return (s_capture_pending || s_step_back_pending);
+}
+
+void Rewind::RunPendingWork()
+{
+	// The vsync event has been fully handled by now (counter modes, VBLANK IRQ, IOP vblank), so the
+	// state is the same as one saved while paused, and loads the same way.
+	if (std::exchange(s_step_back_pending, false) && s_rewinding)
+	{
+		Error error;
+		if (!StepBack(1, &error))
+		{
+			Host::AddIconOSDMessage("Rewind", ICON_FA_BACKWARD,
+				fmt::format(TRANSLATE_FS("Rewind", "Failed to rewind: {}"), error.GetDescription()),
+				Host::OSD_QUICK_DURATION);
+			s_rewinding = false;
+		}
+	}
+
+	if (std::exchange(s_capture_pending, false) && s_buffer && !s_rewinding)
+		Capture();
+}
+
+void Rewind::SetRewinding(bool rewinding)
+{
+	if (!s_buffer || s_rewinding == rewinding)
+		return;
+
+	s_rewinding = rewinding;
+	s_frames_since_capture = REWIND_STEP_FRAMES;
+	if (rewinding)
+	{
+		Host::AddIconOSDMessage("Rewind", ICON_FA_BACKWARD, TRANSLATE_STR("Rewind", "Rewinding..."),
+			Host::OSD_QUICK_DURATION);
+	}
+}
+
+bool Rewind::StepBack(u32 steps, Error* error)
+{
+	if (!s_buffer)
+	{
+		Error::SetString(error, TRANSLATE_STR("Rewind", "Rewind is not enabled."));
+		return false;
+	}
+
+	if (Achievements::IsHardcoreModeActive())
+	{
+		Error::SetString(error,
+			TRANSLATE_STR("VMManager", "Cannot load state while RetroAchievements Hardcore Mode is active."));
+		return false;
+	}
+
+	ArchiveEntryList list;
+	if (!s_buffer->Rewind(steps, &list.GetBuffer()))
+	{
+		Error::SetString(error, TRANSLATE_STR("Rewind", "No rewind history is available."));
+		return false;
+	}
+
+	if (!RewindBuffer::ReadEntryTable(&list))
+	{
+		Error::SetString(error, "Rewind snapshot is corrupted.");
+		s_buffer->Clear();
+		return false;
+	}
+
+	if (!SaveState_LoadFromEntryList(list, error))
+	{
+		s_buffer->Clear();
+		return false;
+	}
+
+	return true;
+}
+
+void Rewind::Capture()
+{
+	Common::Timer timer;
+	s_capture_list.GetBuffer() = s_buffer->GetFreeBuffer();
+
+	Error error;
+	if (!SaveState_DownloadState(&s_capture_list, &error))
+	{
+		Console.Error(fmt::format("Rewind: Failed to capture snapshot: {}", error.GetDescription()));
+		return;
+	}
+
+	RewindBuffer::WriteEntryTable(&s_capture_list);
+	s_total_capture_ms += timer.GetTimeMilliseconds();
+	s_capture_count++;
+
+	if (!s_buffer->Push(std::move(s_capture_list.GetBuffer())))
+		DevCon.Warning("Rewind: Compression is behind, dropped a snapshot.");
+}
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ArchiveEntryList;
+class Error;
+
+/// Ring of state snapshots within a fixed memory budget. The newest snapshot is kept as-is, every
+/// older one is stored as the zstd compressed pages which differ from the snapshot after it, so
+/// stepping back one snapshot is a decompress and a handful of page copies. Diffing and compression
+/// happen on a worker thread, the caller only hands over the buffer.
+class RewindBuffer
+{
+public:
+	struct Stats
+	{
+		u32 snapshots;
+		size_t memory_used;
+		size_t last_compressed_size;
+		double average_compress_ms;
+	};
+
+	RewindBuffer(size_t memory_budget, int compression_level = 1);
+	~RewindBuffer();
+
+	/// Returns a buffer from a previous snapshot to capture into, or an empty one.
+	std::vector<u8> GetFreeBuffer();
+
+	/// Queues a snapshot. Returns false if the worker is behind and the snapshot was dropped.
+	bool Push(std::vector<u8> data);
+
+	/// Restores the snapshot steps back from the newest, dropping everything after it. Steps past
+	/// the oldest snapshot stop there. Returns false if there is nothing to restore.
+	bool Rewind(u32 steps, std::vector<u8>* data);
+
+	/// Blocks until every queued snapshot has been compressed.
+	void WaitForWorker();
+
+	void Clear();
+
+	u32 GetCount();
+	Stats GetStats();
+
+	/// Appends the entry list to the end of its buffer, so a captured state is pushed as a single buffer.
+	static void WriteEntryTable(ArchiveEntryList* list);
+
+	/// Rebuilds the entry list of a restored snapshot from the table at the end of its buffer.
+	static bool ReadEntryTable(ArchiveEntryList* list);
+
+private:
+	struct Snapshot
+	{
+		std::vector<u8> compressed;
+		size_t size;
+		bool is_delta;
+	};
+
+	static constexpr u32 MAX_PENDING = 2;
+
+	void WorkerThread();
+	void AddSnapshot(std::vector<u8> data);
+	bool Restore(const Snapshot& snapshot, std::vector<u8>* data);
+	void EvictToBudget();
+
+	size_t m_memory_budget;
+	int m_compression_level;
+
+	std::mutex m_mutex;
+	std::condition_variable m_work_cv;
+	std::condition_variable m_done_cv;
+	std::thread m_thread;
+	bool m_shutdown = false;
+	bool m_busy = false;
+
+	std::deque<std::vector<u8>> m_pending;
+	std::vector<std::vector<u8>> m_free_buffers;
+
+	// Oldest first. Each snapshot turns the one after it, or m_newest for the last, into itself.
+	std::deque<Snapshot> m_snapshots;
+	std::vector<u8> m_newest;
+	size_t m_compressed_size = 0;
+
+	size_t m_last_compressed_size = 0;
+	double m_total_compress_ms = 0.0;
+	u64 m_compress_count = 0;
+};
+
+namespace Rewind
+{
+	/// Creates or destroys the rewind buffer to match EmuConfig.
+	void UpdateSettings();
+
+	/// Releases the buffer and all snapshots.
+	void Shutdown();
+
+	/// Called on the CPU thread at vsync, asks for a snapshot every few frames and a step back
+	/// while the rewind hotkey is held. Neither can happen in the middle of the vsync event, so
+	/// execution stops at the end of it and they're done by RunPendingWork().
+	void OnVsync();
+
+	/// Returns true if OnVsync() asked for a snapshot or a step back.
+	bool HasPendingWork();
+
+	/// Called on the CPU thread outside of execution, takes the snapshot or steps back.
+	void RunPendingWork();
+
+	/// Holds or releases rewinding.
+	void SetRewinding(bool rewinding);
+
+	/// Loads the snapshot steps back from the newest.
+	bool StepBack(u32 steps, Error* error);
+} // namespace Rewind
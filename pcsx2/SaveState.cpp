@@ -25,6 +25,8 @@
 #include "SIO/Sio2.h"
 #include "SPU2/spu2.h"
 #include "SaveState.h"
+#include "SaveStateCompression.h"
+#include "SaveStateDelta.h"
 #include "StateWrapper.h"
 #include "USB/USB.h"
 #include "VMManager.h"
@@ -42,7 +44,9 @@
 #include "fmt/format.h"
 
 #include <csetjmp>
+#include <deque>
 #include <png.h>
+#include <random>
 
 using namespace R5900;
 
@@ -339,7 +343,18 @@ void memLoadingState::FreezeMem( void* data, int size )
 static const char* EntryFilename_StateVersion = "PCSX2 Savestate Version.id";
 static const char* EntryFilename_Screenshot = "Screenshot.png";
 static const char* EntryFilename_InternalStructures = "PCSX2 Internal Structures.dat";
+static const char* EntryFilename_Chain = "PCSX2 Savestate Chain.dat";
+static constexpr const char* ENTRY_DELTA_SUFFIX = ".delta";
 static constexpr u32 STATE_PCSX2_VERSION_SIZE = 32;
+static constexpr u32 STATE_CHAIN_MAGIC = 0x43435350; // PSCC
+
+// Identifies a checkpoint, so deltas can't be applied to the wrong base or out of order.
+struct SaveStateChainHeader
+{
+	u32 magic;
+	u32 sequence;
+	u64 chain_id;
+};
 
 struct SysState_Component
 {
@@ -357,28 +372,27 @@ static int SysState_MTGSFreeze(FreezeAction mode, freezeData* fP)
 static constexpr SysState_Component SPU2_{ "SPU2", SPU2freeze };
 static constexpr SysState_Component GS{ "GS", SysState_MTGSFreeze };
 
-static bool SysState_ComponentFreezeIn(zip_file_t* zf, SysState_Component comp)
+static bool SysState_ComponentFreezeIn(std::span<const u8> data, SysState_Component comp)
 {
-	if (!zf)
-		return true;
-
 	freezeData fP = { 0, nullptr };
 	if (comp.freeze(FreezeAction::Size, &fP) != 0)
 		fP.size = 0;
 
 	Console.WriteLn("  Loading %s", comp.name);
 
-	std::unique_ptr<u8[]> data;
+	// The freeze functions take a mutable pointer, so the data still needs a copy.
+	std::unique_ptr<u8[]> buffer;
 	if (fP.size > 0)
 	{
-		data = std::make_unique<u8[]>(fP.size);
-		fP.data = data.get();
-
-		if (zip_fread(zf, data.get(), fP.size) != static_cast<zip_int64_t>(fP.size))
+		if (data.size() < static_cast<size_t>(fP.size))
 		{
-			Console.Error(fmt::format("* {}: Failed to decompress save data", comp.name));
+			Console.Error(fmt::format("* {}: Save data is incomplete", comp.name));
 			return false;
 		}
+
+		buffer = std::make_unique<u8[]>(fP.size);
+		std::memcpy(buffer.get(), data.data(), fP.size);
+		fP.data = buffer.get();
 	}
 
 	if (comp.freeze(FreezeAction::Load, &fP) != 0)
@@ -418,17 +432,8 @@ static bool SysState_ComponentFreezeOut(SaveStateBase& writer, SysState_Componen
 	return true;
 }
 
-static bool SysState_ComponentFreezeInNew(zip_file_t* zf, const char* name, bool(*do_state_func)(StateWrapper&))
+static bool SysState_ComponentFreezeInNew(std::span<const u8> data, const char* name, bool(*do_state_func)(StateWrapper&))
 {
-	// TODO: We could decompress on the fly here for a little bit more speed.
-	std::vector<u8> data;
-	if (zf)
-	{
-		std::optional<std::vector<u8>> optdata(ReadBinaryFileInZip(zf));
-		if (optdata.has_value())
-			data = std::move(optdata.value());
-	}
-
 	StateWrapper::ReadOnlyMemoryStream stream(data.empty() ? nullptr : data.data(), data.size());
 	StateWrapper sw(&stream, StateWrapper::Mode::Read, g_SaveVersion);
 
@@ -466,7 +471,8 @@ public:
 	virtual ~BaseSavestateEntry() = default;
 
 	virtual const char* GetFilename() const = 0;
-	virtual bool FreezeIn(zip_file_t* zf) const = 0;
+	// data is empty when the entry is not in the state.
+	virtual bool FreezeIn(std::span<const u8> data) const = 0;
 	virtual bool FreezeOut(SaveStateBase& writer) const = 0;
 	virtual bool IsRequired() const = 0;
 };
@@ -478,7 +484,7 @@ protected:
 	virtual ~MemorySavestateEntry() = default;
 
 public:
-	virtual bool FreezeIn(zip_file_t* zf) const;
+	virtual bool FreezeIn(std::span<const u8> data) const;
 	virtual bool FreezeOut(SaveStateBase& writer) const;
 	virtual bool IsRequired() const { return true; }
 
@@ -487,14 +493,16 @@ protected:
 	virtual u32 GetDataSize() const = 0;
 };
 
-bool MemorySavestateEntry::FreezeIn(zip_file_t* zf) const
+bool MemorySavestateEntry::FreezeIn(std::span<const u8> data) const
 {
 	const u32 expectedSize = GetDataSize();
-	const s64 bytesRead = zip_fread(zf, GetDataPtr(), expectedSize);
-	if (bytesRead != static_cast<s64>(expectedSize))
+	const u32 bytesRead = static_cast<u32>(std::min<size_t>(data.size(), expectedSize));
+	if (bytesRead > 0)
+		std::memcpy(GetDataPtr(), data.data(), bytesRead);
+	if (bytesRead != expectedSize)
 	{
 		Console.WriteLn(Color_Yellow, " '%s' is incomplete (expected 0x%x bytes, loading only 0x%x bytes)",
-			GetFilename(), expectedSize, static_cast<u32>(bytesRead));
+			GetFilename(), expectedSize, bytesRead);
 	}
 
 	return true;
@@ -524,9 +532,9 @@ public:
 	u8* GetDataPtr() const override { return eeMem->Main; }
 	uint GetDataSize() const override { return Ps2MemSize::ExposedRam; }
 
-	virtual bool FreezeIn(zip_file_t* zf) const override
+	virtual bool FreezeIn(std::span<const u8> data) const override
 	{
-		return MemorySavestateEntry::FreezeIn(zf);
+		return MemorySavestateEntry::FreezeIn(data);
 	}
 };
 
@@ -616,7 +624,7 @@ public:
 	~SavestateEntry_SPU2() override = default;
 
 	const char* GetFilename() const override { return "SPU2.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override { return SysState_ComponentFreezeIn(zf, SPU2_); }
+	bool FreezeIn(std::span<const u8> data) const override { return SysState_ComponentFreezeIn(data, SPU2_); }
 	bool FreezeOut(SaveStateBase& writer) const override { return SysState_ComponentFreezeOut(writer, SPU2_); }
 	bool IsRequired() const override { return true; }
 };
@@ -627,7 +635,7 @@ public:
 	~SavestateEntry_USB() override = default;
 
 	const char* GetFilename() const override { return "USB.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override { return SysState_ComponentFreezeInNew(zf, "USB", &USB::DoState); }
+	bool FreezeIn(std::span<const u8> data) const override { return SysState_ComponentFreezeInNew(data, "USB", &USB::DoState); }
 	bool FreezeOut(SaveStateBase& writer) const override { return SysState_ComponentFreezeOutNew(writer, "USB", 16 * 1024, &USB::DoState); }
 	bool IsRequired() const override { return false; }
 };
@@ -638,7 +646,7 @@ public:
 	~SavestateEntry_PAD() override = default;
 
 	const char* GetFilename() const override { return "PAD.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override { return SysState_ComponentFreezeInNew(zf, "PAD", &Pad::Freeze); }
+	bool FreezeIn(std::span<const u8> data) const override { return SysState_ComponentFreezeInNew(data, "PAD", &Pad::Freeze); }
 	bool FreezeOut(SaveStateBase& writer) const override { return SysState_ComponentFreezeOutNew(writer, "PAD", 16 * 1024, &Pad::Freeze); }
 	bool IsRequired() const override { return true; }
 };
@@ -649,7 +657,7 @@ public:
 	~SavestateEntry_GS() = default;
 
 	const char* GetFilename() const { return "GS.bin"; }
-	bool FreezeIn(zip_file_t* zf) const { return SysState_ComponentFreezeIn(zf, GS); }
+	bool FreezeIn(std::span<const u8> data) const { return SysState_ComponentFreezeIn(data, GS); }
 	bool FreezeOut(SaveStateBase& writer) const { return SysState_ComponentFreezeOut(writer, GS); }
 	bool IsRequired() const { return true; }
 };
@@ -659,20 +667,12 @@ class SaveStateEntry_Achievements final : public BaseSavestateEntry
 	~SaveStateEntry_Achievements() override = default;
 
 	const char* GetFilename() const override { return "Achievements.bin"; }
-	bool FreezeIn(zip_file_t* zf) const override
+	bool FreezeIn(std::span<const u8> data) const override
 	{
 		if (!Achievements::IsActive())
 			return true;
 
-		std::optional<std::vector<u8>> data;
-		if (zf)
-			data = ReadBinaryFileInZip(zf);
-
-		if (data.has_value())
-			Achievements::LoadState(data.value());
-		else
-			Achievements::LoadState(std::span<const u8>());
-
+		Achievements::LoadState(data);
 		return true;
 	}
 
@@ -713,7 +713,17 @@ static const std::unique_ptr<BaseSavestateEntry> SavestateEntries[] = {
 std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 {
 	std::unique_ptr<ArchiveEntryList> destlist = std::make_unique<ArchiveEntryList>();
-	destlist->GetBuffer().resize(1024 * 1024 * 64);
+	if (!SaveState_DownloadState(destlist.get(), error))
+		destlist.reset();
+
+	return destlist;
+}
+
+bool SaveState_DownloadState(ArchiveEntryList* destlist, Error* error)
+{
+	// Reusing a list skips reallocating and clearing the buffer on every save.
+	destlist->Clear();
+	destlist->GetBuffer().reserve(1024 * 1024 * 64);
 
 	memSavingState saveme(destlist->GetBuffer());
 	ArchiveEntry internals(EntryFilename_InternalStructures);
@@ -722,7 +732,7 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 	if (!saveme.FreezeBios())
 	{
 		Error::SetString(error, "FreezeBios() failed");
-		return nullptr;
+		return false;
 	}
 
 	if (!saveme.FreezeInternals(error))
@@ -730,7 +740,7 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 		if (!error->IsValid())
 			Error::SetString(error, "FreezeInternals() failed");
 
-		return nullptr;
+		return false;
 	}
 
 	internals.SetDataSize(saveme.GetCurrentPos() - internals.GetDataIndex());
@@ -742,8 +752,7 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 		if (!entry->FreezeOut(saveme))
 		{
 			Error::SetString(error, fmt::format("FreezeOut() failed for {}.", entry->GetFilename()));
-			destlist.reset();
-			break;
+			return false;
 		}
 
 		destlist->Add(
@@ -752,7 +761,7 @@ std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error)
 				.SetDataSize(saveme.GetCurrentPos() - startpos));
 	}
 
-	return destlist;
+	return true;
 }
 
 std::unique_ptr<SaveStateScreenshotData> SaveState_SaveScreenshot()
@@ -924,7 +933,90 @@ static bool SaveState_ReadScreenshot(zip_t* zf, u32* out_width, u32* out_height,
 // --------------------------------------------------------------------------------------
 //  CompressThread_VmState
 // --------------------------------------------------------------------------------------
-static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateScreenshotData* screenshot)
+static const ArchiveEntry* SaveState_FindEntry(const ArchiveEntryList& list, const std::string& filename)
+{
+	for (uint i = 0; i < list.GetLength(); i++)
+	{
+		if (list[i].GetFilename() == filename)
+			return &list[i];
+	}
+
+	return nullptr;
+}
+
+namespace
+{
+	struct PendingZipFile
+	{
+		std::string name;
+		std::span<const u8> data;
+
+		// Data which only lives as long as SaveState_AddToZip(), and has to be copied if libzip compresses it.
+		bool temporary;
+	};
+} // namespace
+
+static bool SaveState_AddBufferToZip(zip_t* zf, const char* name, std::span<const u8> data, bool copy, u32 compression, u32 compression_level)
+{
+	void* ptr = const_cast<u8*>(data.data());
+	if (copy)
+	{
+		ptr = std::malloc(std::max<size_t>(data.size(), 1));
+		if (!ptr)
+			return false;
+
+		if (!data.empty())
+			std::memcpy(ptr, data.data(), data.size());
+	}
+
+	zip_source_t* const zs = zip_source_buffer(zf, ptr, data.size(), copy ? 1 : 0);
+	if (!zs)
+	{
+		if (copy)
+			std::free(ptr);
+		return false;
+	}
+
+	// NOTE: Source should not be freed if successful.
+	const s64 fi = zip_file_add(zf, name, zs, ZIP_FL_ENC_UTF_8);
+	if (fi < 0)
+	{
+		zip_source_free(zs);
+		return false;
+	}
+
+	zip_set_file_compression(zf, fi, compression, compression_level);
+	return true;
+}
+
+// Compresses the files on several threads, rather than leaving it to libzip in zip_close(), which
+// works through the entries one at a time.
+static bool SaveState_AddCompressedFilesToZip(zip_t* zf, std::span<const PendingZipFile> files, int compression_level)
+{
+	std::vector<SaveStateCompression::CompressJob> jobs(files.size());
+	for (size_t i = 0; i < files.size(); i++)
+		jobs[i].data = files[i].data;
+
+	Error error;
+	if (!SaveStateCompression::Compress(jobs, compression_level, &error))
+	{
+		Console.ErrorFmt("Failed to compress save state: {}", error.GetDescription());
+		return false;
+	}
+
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		if (!SaveStateCompression::AddToZip(zf, files[i].name.c_str(), jobs[i]))
+			return false;
+	}
+
+	return true;
+}
+
+// When previous is set, entries which are the same size as they were in the previous checkpoint
+// are stored as a delta of the pages which changed.
+static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateScreenshotData* screenshot,
+	const ArchiveEntryList* previous = nullptr, const SaveStateChainHeader* chain = nullptr, size_t* written_bytes = nullptr)
 {
 	u32 compression;
 	u32 compression_level;
@@ -972,6 +1064,10 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 		compression_level = 0;
 	}
 
+	// Everything is gathered up front, so zstd can compress the entries concurrently.
+	std::vector<PendingZipFile> files;
+	std::deque<std::vector<u8>> storage;
+
 	// version indicator
 	{
 		struct VersionIndicator
@@ -980,54 +1076,67 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 			char version[STATE_PCSX2_VERSION_SIZE];
 		};
 
-		VersionIndicator* vi = static_cast<VersionIndicator*>(std::malloc(sizeof(VersionIndicator)));
-		vi->save_version = g_SaveVersion;
+		VersionIndicator vi = {};
+		vi.save_version = g_SaveVersion;
 		if (BuildVersion::GitTaggedCommit)
 		{
-			StringUtil::Strlcpy(vi->version, BuildVersion::GitTag, std::size(vi->version));
+			StringUtil::Strlcpy(vi.version, BuildVersion::GitTag, std::size(vi.version));
 		}
 		else
 		{
-			StringUtil::Strlcpy(vi->version, "Unknown", std::size(vi->version));
-		}
-
-		zip_source_t* const zs = zip_source_buffer(zf, vi, sizeof(*vi), 1);
-		if (!zs)
-		{
-			std::free(vi);
-			return false;
+			StringUtil::Strlcpy(vi.version, "Unknown", std::size(vi.version));
 		}
 
-		// NOTE: Source should not be freed if successful.
-		const s64 fi = zip_file_add(zf, EntryFilename_StateVersion, zs, ZIP_FL_ENC_UTF_8);
-		if (fi < 0)
-		{
-			zip_source_free(zs);
-			return false;
-		}
+		std::vector<u8>& data = storage.emplace_back(sizeof(vi));
+		std::memcpy(data.data(), &vi, sizeof(vi));
+		files.push_back({EntryFilename_StateVersion, data, true});
+	}
 
-		zip_set_file_compression(zf, fi, compression, compression_level);
+	if (chain)
+	{
+		std::vector<u8>& data = storage.emplace_back(sizeof(*chain));
+		std::memcpy(data.data(), chain, sizeof(*chain));
+		files.push_back({EntryFilename_Chain, data, true});
 	}
 
+	size_t written = 0;
 	const uint listlen = srclist->GetLength();
 	for (uint i = 0; i < listlen; ++i)
 	{
 		const ArchiveEntry& entry = (*srclist)[i];
-		if (!entry.GetDataSize())
+		const ArchiveEntry* prev_entry = previous ? SaveState_FindEntry(*previous, entry.GetFilename()) : nullptr;
+		if (prev_entry && prev_entry->GetDataSize() == entry.GetDataSize() && entry.GetDataSize() > 0)
+		{
+			std::vector<u8>& delta = storage.emplace_back();
+			const u32 dirty_pages = SaveStateDelta::Encode(
+				std::span<const u8>(previous->GetPtr(prev_entry->GetDataIndex()), prev_entry->GetDataSize()),
+				std::span<const u8>(srclist->GetPtr(entry.GetDataIndex()), entry.GetDataSize()), &delta);
+
+			files.push_back({entry.GetFilename() + ENTRY_DELTA_SUFFIX, delta, true});
+			written += std::min<size_t>(static_cast<size_t>(dirty_pages) * SaveStateDelta::PAGE_SIZE, entry.GetDataSize());
 			continue;
+		}
 
-		zip_source_t* const zs = zip_source_buffer(zf, srclist->GetPtr(entry.GetDataIndex()), entry.GetDataSize(), 0);
-		if (!zs)
-			return false;
+		// An entry which has gone away still needs to be written, otherwise the loader keeps the old contents.
+		if (!entry.GetDataSize() && (!prev_entry || !prev_entry->GetDataSize()))
+			continue;
 
-		const s64 fi = zip_file_add(zf, entry.GetFilename().c_str(), zs, ZIP_FL_ENC_UTF_8);
-		if (fi < 0)
-		{
-			zip_source_free(zs);
+		written += entry.GetDataSize();
+		files.push_back({entry.GetFilename(), std::span<const u8>(srclist->GetPtr(entry.GetDataIndex()), entry.GetDataSize()), false});
+	}
+
+	if (compression == ZIP_CM_ZSTD)
+	{
+		if (!SaveState_AddCompressedFilesToZip(zf, files, static_cast<int>(compression_level)))
 			return false;
+	}
+	else
+	{
+		for (const PendingZipFile& file : files)
+		{
+			if (!SaveState_AddBufferToZip(zf, file.name.c_str(), file.data, file.temporary, compression, compression_level))
+				return false;
 		}
-
-		zip_set_file_compression(zf, fi, compression, compression_level);
 	}
 
 	if (screenshot)
@@ -1036,12 +1145,15 @@ static bool SaveState_AddToZip(zip_t* zf, ArchiveEntryList* srclist, SaveStateSc
 			return false;
 	}
 
+	if (written_bytes)
+		*written_bytes = written;
+
 	return true;
 }
 
-bool SaveState_ZipToDisk(
-	std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot,
-	const char* filename, Error* error)
+static bool SaveState_WriteZip(ArchiveEntryList* srclist, SaveStateScreenshotData* screenshot,
+	const ArchiveEntryList* previous, const SaveStateChainHeader* chain, size_t* written_bytes, const char* filename,
+	Error* error)
 {
 	zip_error_t ze = {};
 	zip_source_t* zs = zip_source_file_create(filename, 0, 0, &ze);
@@ -1058,7 +1170,7 @@ bool SaveState_ZipToDisk(
 	}
 
 	// discard zip file if we fail saving something
-	if (!SaveState_AddToZip(zf, srclist.get(), screenshot.get()))
+	if (!SaveState_AddToZip(zf, srclist, screenshot, previous, chain, written_bytes))
 	{
 		Error::SetStringFmt(error,
 			TRANSLATE_FS("SaveState", "Failed to save state to zip file '{}'."), filename);
@@ -1078,6 +1190,42 @@ bool SaveState_ZipToDisk(
 	return true;
 }
 
+bool SaveState_ZipToDisk(
+	std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot,
+	const char* filename, Error* error)
+{
+	return SaveState_WriteZip(srclist.get(), screenshot.get(), nullptr, nullptr, nullptr, filename, error);
+}
+
+SaveStateCheckpointWriter::SaveStateCheckpointWriter() = default;
+
+SaveStateCheckpointWriter::~SaveStateCheckpointWriter() = default;
+
+bool SaveStateCheckpointWriter::Save(std::unique_ptr<ArchiveEntryList> srclist, const char* filename, Error* error)
+{
+	if (!m_previous)
+	{
+		std::random_device rd;
+		m_chain_id = (static_cast<u64>(rd()) << 32) | rd();
+		m_sequence = 0;
+	}
+
+	// If the write fails, the next checkpoint is still diffed against the last one which made it to disk.
+	const SaveStateChainHeader chain = {STATE_CHAIN_MAGIC, m_sequence, m_chain_id};
+	if (!SaveState_WriteZip(srclist.get(), nullptr, m_previous.get(), &chain, &m_last_written_bytes, filename, error))
+		return false;
+
+	m_previous = std::move(srclist);
+	m_sequence++;
+	return true;
+}
+
+void SaveStateCheckpointWriter::Reset()
+{
+	m_previous.reset();
+	m_sequence = 0;
+}
+
 bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels)
 {
 	zip_error_t ze = {};
@@ -1130,13 +1278,16 @@ static bool CheckVersion(const std::string& filename, zip_t* zf, Error* error)
 	return true;
 }
 
-static zip_int64_t CheckFileExistsInState(zip_t* zf, const char* name, bool required)
+using StateEntryBuffer = std::pair<std::string_view, std::span<const u8>>;
+using ZipEntryData = SaveStateCompression::ZipEntry;
+
+static const std::span<const u8>* CheckFileExistsInState(std::span<const StateEntryBuffer> entries, const char* name, bool required)
 {
-	zip_int64_t index = zip_name_locate(zf, name, /*ZIP_FL_NOCASE*/ 0);
-	if (index >= 0)
+	const auto it = std::find_if(entries.begin(), entries.end(), [name](const StateEntryBuffer& entry) { return (entry.first == name); });
+	if (it != entries.end())
 	{
 		DevCon.WriteLn(Color_Green, " ... found '%s'", name);
-		return index;
+		return &it->second;
 	}
 
 	if (required)
@@ -1144,24 +1295,16 @@ static zip_int64_t CheckFileExistsInState(zip_t* zf, const char* name, bool requ
 	else
 		DevCon.WriteLn(Color_Red, " ... not found '%s'!", name);
 
-	return index;
+	return nullptr;
 }
 
-static bool LoadInternalStructuresState(zip_t* zf, s64 index, Error* error)
+static bool LoadInternalStructuresState(std::span<const u8> data, Error* error)
 {
-	zip_stat_t zst;
-	if (zip_stat_index(zf, index, 0, &zst) != 0 || zst.size > std::numeric_limits<int>::max())
+	if (data.size() > std::numeric_limits<int>::max())
 		return false;
 
 	// Load all the internal data
-	auto zff = zip_fopen_index_managed(zf, index, 0);
-	if (!zff)
-		return false;
-
-	std::vector<u8> buffer(zst.size);
-	if (zip_fread(zff.get(), buffer.data(), buffer.size()) != static_cast<zip_int64_t>(buffer.size()))
-		return false;
-
+	const std::vector<u8> buffer(data.begin(), data.end());
 	memLoadingState state(buffer);
 	if (!state.FreezeBios())
 		return false;
@@ -1172,7 +1315,7 @@ static bool LoadInternalStructuresState(zip_t* zf, s64 index, Error* error)
 	return true;
 }
 
-bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
+static std::unique_ptr<zip_t, void (*)(zip_t*)> OpenStateZip(const std::string& filename, Error* error)
 {
 	zip_error_t ze = {};
 	auto zf = zip_open_managed(filename.c_str(), ZIP_RDONLY, &ze);
@@ -1184,24 +1327,29 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 		else
 			Error::SetString(error, fmt::format("Savestate zip error: {}", zip_error_strerror(&ze)));
 
-		return false;
+		return zf;
 	}
 
 	// look for version and screenshot information in the zip stream:
 	if (!CheckVersion(filename, zf.get(), error))
-		return false;
+		zf.reset();
+
+	return zf;
+}
 
+static bool SaveState_LoadFromBuffers(std::span<const StateEntryBuffer> entries, Error* error)
+{
 	// check that all parts are included
-	const s64 internal_index = CheckFileExistsInState(zf.get(), EntryFilename_InternalStructures, true);
-	s64 entryIndices[std::size(SavestateEntries)];
+	const std::span<const u8>* internals = CheckFileExistsInState(entries, EntryFilename_InternalStructures, true);
+	const std::span<const u8>* entryData[std::size(SavestateEntries)];
 
 	// Log any parts and pieces that are missing, and then generate an exception.
-	bool allPresent = (internal_index >= 0);
+	bool allPresent = (internals != nullptr);
 	for (u32 i = 0; i < std::size(SavestateEntries); i++)
 	{
 		const bool required = SavestateEntries[i]->IsRequired();
-		entryIndices[i] = CheckFileExistsInState(zf.get(), SavestateEntries[i]->GetFilename(), required);
-		if (entryIndices[i] < 0 && required)
+		entryData[i] = CheckFileExistsInState(entries, SavestateEntries[i]->GetFilename(), required);
+		if (!entryData[i] && required)
 		{
 			allPresent = false;
 			break;
@@ -1215,7 +1363,7 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 
 	PreLoadPrep();
 
-	if (!LoadInternalStructuresState(zf.get(), internal_index, error))
+	if (!LoadInternalStructuresState(*internals, error))
 	{
 		if (!error->IsValid())
 			Error::SetString(error, "Save state corruption in internal structures.");
@@ -1226,14 +1374,7 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 
 	for (u32 i = 0; i < std::size(SavestateEntries); ++i)
 	{
-		if (entryIndices[i] < 0)
-		{
-			SavestateEntries[i]->FreezeIn(nullptr);
-			continue;
-		}
-
-		auto zff = zip_fopen_index_managed(zf.get(), entryIndices[i], 0);
-		if (!zff || !SavestateEntries[i]->FreezeIn(zff.get()))
+		if (!SavestateEntries[i]->FreezeIn(entryData[i] ? *entryData[i] : std::span<const u8>()))
 		{
 			Error::SetString(error, fmt::format("Save state corruption in {}.", SavestateEntries[i]->GetFilename()));
 			VMManager::Reset();
@@ -1245,6 +1386,131 @@ bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
 	return true;
 }
 
+static bool SaveState_LoadFromZip(zip_t* zf, Error* error)
+{
+	std::vector<ZipEntryData> entries;
+	if (!SaveStateCompression::ReadZipEntries(zf, &entries, error))
+		return false;
+
+	std::vector<StateEntryBuffer> buffers;
+	buffers.reserve(entries.size());
+	for (const auto& [name, data] : entries)
+		buffers.emplace_back(name, data);
+
+	return SaveState_LoadFromBuffers(buffers, error);
+}
+
+bool SaveState_UnzipFromDisk(const std::string& filename, Error* error)
+{
+	auto zf = OpenStateZip(filename, error);
+	return zf && SaveState_LoadFromZip(zf.get(), error);
+}
+
+static bool ReadChainHeader(zip_t* zf, SaveStateChainHeader* header)
+{
+	auto zff = zip_fopen_managed(zf, EntryFilename_Chain, 0);
+	return (zff && zip_fread(zff.get(), header, sizeof(*header)) == sizeof(*header) && header->magic == STATE_CHAIN_MAGIC);
+}
+
+bool SaveState_ReadChainFromDisk(std::span<const std::string> filenames, ArchiveEntryList* destlist, Error* error)
+{
+	if (filenames.empty())
+	{
+		Error::SetString(error, "No checkpoints to load.");
+		return false;
+	}
+
+	// Put the chain back together in memory, starting from the base state. Entries which aren't in
+	// a delta carry over from the previous checkpoint.
+	std::vector<ZipEntryData> entries;
+	u64 chain_id = 0;
+	for (size_t i = 0; i < filenames.size(); i++)
+	{
+		const std::string& filename = filenames[i];
+		auto zf = OpenStateZip(filename, error);
+		if (!zf)
+			return false;
+
+		SaveStateChainHeader header;
+		if (!ReadChainHeader(zf.get(), &header))
+		{
+			Error::SetString(error, fmt::format("'{}' is not a checkpoint.", Path::GetFileName(filename)));
+			return false;
+		}
+		if (header.sequence != i || (i > 0 && header.chain_id != chain_id))
+		{
+			Error::SetString(error, fmt::format("'{}' does not follow the previous checkpoint.", Path::GetFileName(filename)));
+			return false;
+		}
+		chain_id = header.chain_id;
+
+		std::vector<ZipEntryData> zip_entries;
+		if (!SaveStateCompression::ReadZipEntries(zf.get(), &zip_entries, error))
+			return false;
+
+		for (auto& [zip_name, data] : zip_entries)
+		{
+			std::string_view name(zip_name);
+			const bool is_delta = name.ends_with(ENTRY_DELTA_SUFFIX);
+			if (is_delta)
+				name.remove_suffix(std::char_traits<char>::length(ENTRY_DELTA_SUFFIX));
+
+			auto it = std::find_if(entries.begin(), entries.end(), [&name](const auto& entry) { return (entry.first == name); });
+			if (!is_delta)
+			{
+				if (it != entries.end())
+					it->second = std::move(data);
+				else
+					entries.emplace_back(name, std::move(data));
+			}
+			else if (it == entries.end() || !SaveStateDelta::Apply(data, it->second))
+			{
+				Error::SetString(error, fmt::format("Checkpoint corruption in {}.", name));
+				return false;
+			}
+		}
+	}
+
+	// Entries which were emptied along the chain are left out, as if they had never been written.
+	size_t total_size = 0;
+	for (const auto& [name, data] : entries)
+		total_size += data.size();
+
+	destlist->Clear();
+	ArchiveEntryList::VmStateBuffer& buffer = destlist->GetBuffer();
+	buffer.reserve(total_size);
+	for (const auto& [name, data] : entries)
+	{
+		if (data.empty())
+			continue;
+
+		destlist->Add(ArchiveEntry(name).SetDataIndex(buffer.size()).SetDataSize(data.size()));
+		buffer.insert(buffer.end(), data.begin(), data.end());
+	}
+
+	return true;
+}
+
+bool SaveState_UnzipChainFromDisk(std::span<const std::string> filenames, Error* error)
+{
+	ArchiveEntryList list;
+	return SaveState_ReadChainFromDisk(filenames, &list, error) && SaveState_LoadFromEntryList(list, error);
+}
+
+bool SaveState_LoadFromEntryList(const ArchiveEntryList& srclist, Error* error)
+{
+	std::vector<StateEntryBuffer> buffers;
+	buffers.reserve(srclist.GetLength());
+	for (uint i = 0; i < srclist.GetLength(); i++)
+	{
+		const ArchiveEntry& entry = srclist[i];
+		if (entry.GetDataSize() > 0)
+			buffers.emplace_back(entry.GetFilename(), std::span<const u8>(srclist.GetPtr(entry.GetDataIndex()), entry.GetDataSize()));
+	}
+
+	return SaveState_LoadFromBuffers(buffers, error);
+}
+
 void SaveState_ReportLoadErrorOSD(const std::string& message, std::optional<s32> slot, bool backup)
 {
 	std::string full_message;
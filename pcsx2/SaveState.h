@@ -6,6 +6,7 @@
 #include <deque>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,7 @@ class ArchiveEntryList;
 // Wrappers to generate a save state compatible across all frontends.
 // These functions assume that the caller has paused the core thread.
 extern std::unique_ptr<ArchiveEntryList> SaveState_DownloadState(Error* error);
+extern bool SaveState_DownloadState(ArchiveEntryList* destlist, Error* error);
 extern std::unique_ptr<SaveStateScreenshotData> SaveState_SaveScreenshot();
 extern bool SaveState_ZipToDisk(
 	std::unique_ptr<ArchiveEntryList> srclist, std::unique_ptr<SaveStateScreenshotData> screenshot,
@@ -60,6 +62,15 @@ extern bool SaveState_ZipToDisk(
 extern bool SaveState_ReadScreenshot(const std::string& filename, u32* out_width, u32* out_height, std::vector<u32>* out_pixels);
 extern bool SaveState_UnzipFromDisk(const std::string& filename, Error* error);
 
+// Puts a checkpoint chain written by SaveStateCheckpointWriter back together, without loading it.
+extern bool SaveState_ReadChainFromDisk(std::span<const std::string> filenames, ArchiveEntryList* destlist, Error* error);
+
+// Loads a checkpoint chain written by SaveStateCheckpointWriter, the base state followed by its deltas in order.
+extern bool SaveState_UnzipChainFromDisk(std::span<const std::string> filenames, Error* error);
+
+// Loads a state captured with SaveState_DownloadState() without going through a file.
+extern bool SaveState_LoadFromEntryList(const ArchiveEntryList& srclist, Error* error);
+
 // --------------------------------------------------------------------------------------
 //  SaveStateBase class
 // --------------------------------------------------------------------------------------
@@ -309,6 +320,12 @@ public:
 		return &m_data[idx];
 	}
 
+	void Clear()
+	{
+		m_list.clear();
+		m_data.clear();
+	}
+
 	ArchiveEntryList& Add(const ArchiveEntry& src)
 	{
 		m_list.push_back(src);
@@ -357,5 +374,35 @@ public:
 	bool IsSaving() const override { return false; }
 };
 
+// --------------------------------------------------------------------------------------
+//  SaveStateCheckpointWriter
+// --------------------------------------------------------------------------------------
+// Writes a chain of checkpoints. The first is a full state, each one after that only stores the
+// pages which changed since the previous checkpoint, plus any entries which changed size.
+class SaveStateCheckpointWriter final
+{
+public:
+	SaveStateCheckpointWriter();
+	~SaveStateCheckpointWriter();
+
+	/// Writes srclist to filename, as a new chain if Reset() was called since the last save.
+	bool Save(std::unique_ptr<ArchiveEntryList> srclist, const char* filename, Error* error);
+
+	/// Starts a new chain on the next save, and releases the previous checkpoint.
+	void Reset();
+
+	/// Position the next checkpoint will take in the chain, zero for the base state.
+	u32 GetSequence() const { return m_sequence; }
+
+	/// Bytes of state data, before compression, stored by the last save.
+	size_t GetLastWrittenBytes() const { return m_last_written_bytes; }
+
+private:
+	std::unique_ptr<ArchiveEntryList> m_previous;
+	u64 m_chain_id = 0;
+	u32 m_sequence = 0;
+	size_t m_last_written_bytes = 0;
+};
+
 void SaveState_ReportLoadErrorOSD(const std::string& message, std::optional<s32> slot, bool backup);
 void SaveState_ReportSaveErrorOSD(const std::string& message, std::optional<s32> slot);
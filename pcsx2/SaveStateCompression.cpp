@@ -0,0 +1,405 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "SaveStateCompression.h"
+
+#include "common/Error.h"
+#include "common/ZipHelpers.h"
+
+#include "fmt/format.h"
+
+#include <zlib.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace
+{
+	struct CompressFrame
+	{
+		std::span<const u8> data;
+		std::vector<u8> compressed;
+		u32 crc;
+	};
+
+	struct DecompressFrame
+	{
+		std::span<const u8> compressed;
+		std::span<u8> data;
+		u32 crc;
+	};
+
+	/// zstd data which has already been compressed, libzip copies it into the archive as-is.
+	struct PrecompressedZipSource
+	{
+		std::vector<u8> compressed;
+		zip_uint64_t size;
+		zip_uint32_t crc;
+		zip_uint64_t position;
+		zip_error_t error;
+	};
+
+	/// Records the first error raised by any of the worker threads.
+	class SharedError
+	{
+	public:
+		bool HasError() const { return m_failed.load(std::memory_order_relaxed); }
+
+		void Set(std::string message)
+		{
+			std::unique_lock lock(m_mutex);
+			if (m_failed.load(std::memory_order_relaxed))
+				return;
+
+			m_message = std::move(message);
+			m_failed.store(true, std::memory_order_relaxed);
+		}
+
+		bool Report(Error* error) const
+		{
+			if (!m_failed.load(std::memory_order_relaxed))
+				return true;
+
+			Error::SetString(error, m_message);
+			return false;
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::string m_message;
+		std::atomic_bool m_failed{false};
+	};
+} // namespace
+
+static constexpr u32 MAX_THREADS = 8;
+
+template <typename T>
+static void RunOnThreads(std::span<T> frames, const SharedError& shared_error, const auto& func)
+{
+	std::atomic<size_t> next_frame{0};
+	const auto worker = [&]() {
+		for (;;)
+		{
+			const size_t index = next_frame.fetch_add(1, std::memory_order_relaxed);
+			if (index >= frames.size() || shared_error.HasError())
+				break;
+
+			func(frames[index]);
+		}
+	};
+
+	const u32 thread_count = SaveStateCompression::GetThreadCount(frames.size());
+	std::vector<std::thread> threads;
+	threads.reserve(thread_count - 1);
+	for (u32 i = 1; i < thread_count; i++)
+		threads.emplace_back(worker);
+
+	worker();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+static u32 ComputeCRC(std::span<const u8> data)
+{
+	return static_cast<u32>(crc32_z(crc32_z(0L, Z_NULL, 0), data.data(), data.size()));
+}
+
+u32 SaveStateCompression::GetThreadCount(size_t frames)
+{
+	const u32 hardware_threads = std::max(std::thread::hardware_concurrency(), 1u);
+	return static_cast<u32>(std::clamp<size_t>(frames, 1, std::min(hardware_threads, MAX_THREADS)));
+}
+
+bool SaveStateCompression::Compress(std::span<CompressJob> jobs, int level, Error* error)
+{
+	std::vector<CompressFrame> frames;
+	for (const CompressJob& job : jobs)
+	{
+		size_t offset = 0;
+		do
+		{
+			const size_t length = std::min(FRAME_SIZE, job.data.size() - offset);
+			frames.push_back({job.data.subspan(offset, length), {}, 0});
+			offset += length;
+		} while (offset < job.data.size());
+	}
+
+	SharedError shared_error;
+	RunOnThreads(std::span<CompressFrame>(frames), shared_error, [&shared_error, level](CompressFrame& frame) {
+		// Contexts are cheap next to compressing a frame, and this keeps them local to the thread.
+		ZSTD_CCtx* cctx = ZSTD_createCCtx();
+		if (!cctx)
+		{
+			shared_error.Set("Failed to create zstd compression context.");
+			return;
+		}
+
+		frame.compressed.resize(ZSTD_compressBound(frame.data.size()));
+		const size_t size = ZSTD_compressCCtx(
+			cctx, frame.compressed.data(), frame.compressed.size(), frame.data.data(), frame.data.size(), level);
+		ZSTD_freeCCtx(cctx);
+		if (ZSTD_isError(size))
+		{
+			shared_error.Set(fmt::format("ZSTD_compressCCtx() failed: {}", ZSTD_getErrorName(size)));
+			return;
+		}
+
+		frame.compressed.resize(size);
+		frame.crc = ComputeCRC(frame.data);
+	});
+	if (!shared_error.Report(error))
+		return false;
+
+	auto frame = frames.begin();
+	for (CompressJob& job : jobs)
+	{
+		size_t compressed_size = 0;
+		size_t offset = 0;
+		auto job_frame = frame;
+		do
+		{
+			compressed_size += job_frame->compressed.size();
+			offset += job_frame->data.size();
+			++job_frame;
+		} while (offset < job.data.size());
+
+		job.compressed.clear();
+		job.compressed.reserve(compressed_size);
+		job.crc = ComputeCRC({});
+		for (; frame != job_frame; ++frame)
+		{
+			job.compressed.insert(job.compressed.end(), frame->compressed.begin(), frame->compressed.end());
+			job.crc = static_cast<u32>(crc32_combine(job.crc, frame->crc, static_cast<z_off_t>(frame->data.size())));
+		}
+	}
+
+	return true;
+}
+
+/// Splits a job at its frame boundaries. Frames without a content size (anything libzip wrote itself
+/// streams its output) can't be placed in the output, so the rest of the job becomes one piece.
+static bool SplitFrames(const SaveStateCompression::DecompressJob& job, std::vector<DecompressFrame>* frames)
+{
+	std::span<const u8> compressed = job.compressed;
+	std::span<u8> data = job.data;
+	while (!compressed.empty())
+	{
+		const size_t frame_size = ZSTD_findFrameCompressedSize(compressed.data(), compressed.size());
+		const unsigned long long content_size = ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+		if (ZSTD_isError(frame_size) || content_size == ZSTD_CONTENTSIZE_ERROR)
+			return false;
+
+		if (content_size == ZSTD_CONTENTSIZE_UNKNOWN)
+		{
+			frames->push_back({compressed, data, 0});
+			return true;
+		}
+
+		if (content_size > data.size())
+			return false;
+
+		frames->push_back({compressed.first(frame_size), data.first(static_cast<size_t>(content_size)), 0});
+		compressed = compressed.subspan(frame_size);
+		data = data.subspan(static_cast<size_t>(content_size));
+	}
+
+	// Empty entries are written as a single empty frame, but don't require one.
+	if (frames->empty() || !data.empty())
+		frames->push_back({compressed, data, 0});
+
+	return true;
+}
+
+bool SaveStateCompression::Decompress(std::span<DecompressJob> jobs, Error* error)
+{
+	std::vector<DecompressFrame> frames;
+	std::vector<size_t> job_frame_counts;
+	job_frame_counts.reserve(jobs.size());
+	for (const DecompressJob& job : jobs)
+	{
+		const size_t start = frames.size();
+		if (!SplitFrames(job, &frames))
+		{
+			Error::SetString(error, "Compressed data is corrupted.");
+			return false;
+		}
+
+		job_frame_counts.push_back(frames.size() - start);
+	}
+
+	SharedError shared_error;
+	RunOnThreads(std::span<DecompressFrame>(frames), shared_error, [&shared_error](DecompressFrame& frame) {
+		if (!frame.compressed.empty() || !frame.data.empty())
+		{
+			ZSTD_DCtx* dctx = ZSTD_createDCtx();
+			if (!dctx)
+			{
+				shared_error.Set("Failed to create zstd decompression context.");
+				return;
+			}
+
+			const size_t size = ZSTD_decompressDCtx(
+				dctx, frame.data.data(), frame.data.size(), frame.compressed.data(), frame.compressed.size());
+			ZSTD_freeDCtx(dctx);
+			if (ZSTD_isError(size))
+			{
+				shared_error.Set(fmt::format("ZSTD_decompressDCtx() failed: {}", ZSTD_getErrorName(size)));
+				return;
+			}
+			else if (size != frame.data.size())
+			{
+				shared_error.Set(fmt::format("Decompressed {} bytes, expected {}.", size, frame.data.size()));
+				return;
+			}
+		}
+
+		frame.crc = ComputeCRC(frame.data);
+	});
+	if (!shared_error.Report(error))
+		return false;
+
+	auto frame = frames.begin();
+	for (size_t i = 0; i < jobs.size(); i++)
+	{
+		u32 crc = ComputeCRC({});
+		for (size_t j = 0; j < job_frame_counts[i]; j++, ++frame)
+			crc = static_cast<u32>(crc32_combine(crc, frame->crc, static_cast<z_off_t>(frame->data.size())));
+
+		if (crc != jobs[i].crc)
+		{
+			Error::SetString(error, fmt::format("CRC mismatch, got {:08X} expected {:08X}.", crc, jobs[i].crc));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static zip_int64_t PrecompressedSourceCallback(void* userdata, void* data, zip_uint64_t len, zip_source_cmd_t cmd)
+{
+	PrecompressedZipSource* const src = static_cast<PrecompressedZipSource*>(userdata);
+	switch (cmd)
+	{
+		case ZIP_SOURCE_OPEN:
+			src->position = 0;
+			return 0;
+
+		case ZIP_SOURCE_READ:
+		{
+			const zip_uint64_t count = std::min<zip_uint64_t>(len, src->compressed.size() - src->position);
+			std::memcpy(data, src->compressed.data() + src->position, count);
+			src->position += count;
+			return static_cast<zip_int64_t>(count);
+		}
+
+		case ZIP_SOURCE_CLOSE:
+			return 0;
+
+		case ZIP_SOURCE_STAT:
+		{
+			zip_stat_t* const st = ZIP_SOURCE_GET_ARGS(zip_stat_t, data, len, &src->error);
+			if (!st)
+				return -1;
+
+			// Reporting the data as zstd compressed stops libzip from compressing it again.
+			zip_stat_init(st);
+			st->valid = ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE | ZIP_STAT_COMP_METHOD | ZIP_STAT_CRC | ZIP_STAT_ENCRYPTION_METHOD;
+			st->size = src->size;
+			st->comp_size = src->compressed.size();
+			st->comp_method = ZIP_CM_ZSTD;
+			st->crc = src->crc;
+			st->encryption_method = ZIP_EM_NONE;
+			return sizeof(*st);
+		}
+
+		case ZIP_SOURCE_ERROR:
+			return zip_error_to_data(&src->error, data, len);
+
+		case ZIP_SOURCE_FREE:
+			delete src;
+			return 0;
+
+		case ZIP_SOURCE_SUPPORTS:
+			return zip_source_make_command_bitmap(ZIP_SOURCE_OPEN, ZIP_SOURCE_READ, ZIP_SOURCE_CLOSE, ZIP_SOURCE_STAT,
+				ZIP_SOURCE_ERROR, ZIP_SOURCE_FREE, -1);
+
+		default:
+			zip_error_set(&src->error, ZIP_ER_OPNOTSUPP, 0);
+			return -1;
+	}
+}
+
+bool SaveStateCompression::AddToZip(zip_t* zf, const char* name, CompressJob& job)
+{
+	PrecompressedZipSource* const src = new PrecompressedZipSource{std::move(job.compressed), job.data.size(), job.crc, 0, {}};
+	zip_error_init(&src->error);
+
+	zip_source_t* const zs = zip_source_function(zf, PrecompressedSourceCallback, src);
+	if (!zs)
+	{
+		delete src;
+		return false;
+	}
+
+	// NOTE: Source should not be freed if successful. Compression is left at the default, which keeps
+	// the method reported by the source.
+	if (zip_file_add(zf, name, zs, ZIP_FL_ENC_UTF_8) < 0)
+	{
+		zip_source_free(zs);
+		return false;
+	}
+
+	return true;
+}
+
+bool SaveStateCompression::ReadZipEntries(zip_t* zf, std::vector<ZipEntry>* entries, Error* error)
+{
+	static constexpr zip_uint64_t REQUIRED_STAT = ZIP_STAT_NAME | ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE |
+		ZIP_STAT_COMP_METHOD | ZIP_STAT_CRC | ZIP_STAT_ENCRYPTION_METHOD;
+
+	const zip_int64_t count = zip_get_num_entries(zf, 0);
+	entries->clear();
+	entries->reserve(static_cast<size_t>(std::max<zip_int64_t>(count, 0)));
+
+	std::vector<std::vector<u8>> compressed;
+	std::vector<DecompressJob> jobs;
+	for (zip_int64_t index = 0; index < count; index++)
+	{
+		zip_stat_t zst;
+		if (zip_stat_index(zf, index, 0, &zst) != 0 || (zst.valid & REQUIRED_STAT) != REQUIRED_STAT)
+		{
+			Error::SetString(error, "Failed to read save state contents.");
+			return false;
+		}
+
+		auto& [name, data] = entries->emplace_back(zst.name, std::vector<u8>(zst.size));
+		// libzip doesn't hand out the raw data of an empty entry, and there's nothing to decompress anyway.
+		const bool precompressed = (zst.size > 0 && zst.comp_method == ZIP_CM_ZSTD && zst.encryption_method == ZIP_EM_NONE);
+		std::vector<u8>& buffer = precompressed ? compressed.emplace_back(zst.comp_size) : data;
+
+		auto zff = zip_fopen_index_managed(zf, index, precompressed ? ZIP_FL_COMPRESSED : 0);
+		if (!zff || (!buffer.empty() && zip_fread(zff.get(), buffer.data(), buffer.size()) != static_cast<zip_int64_t>(buffer.size())))
+		{
+			Error::SetString(error, fmt::format("Failed to read {} from save state.", name));
+			return false;
+		}
+
+		if (precompressed)
+			jobs.push_back({buffer, data, zst.crc});
+	}
+
+	Error decompress_error;
+	if (!Decompress(jobs, &decompress_error))
+	{
+		Error::SetString(error, fmt::format("Failed to decompress save state: {}", decompress_error.GetDescription()));
+		return false;
+	}
+
+	return true;
+}
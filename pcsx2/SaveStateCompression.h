@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include "zip.h"
+
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Error;
+
+/// Multi-threaded zstd compression of save state entries. Each entry is split into independent
+/// frames which are concatenated back together, so the result is still a plain zstd stream which
+/// libzip (or any other decoder) can read, but both directions can be spread over several threads.
+/// Frames from every entry share the same pool, so small entries don't leave threads idle.
+namespace SaveStateCompression
+{
+	/// Size of the uncompressed data in each frame.
+	static constexpr size_t FRAME_SIZE = 4 * 1024 * 1024;
+
+	struct CompressJob
+	{
+		std::span<const u8> data;
+		std::vector<u8> compressed;
+		u32 crc;
+	};
+
+	struct DecompressJob
+	{
+		std::span<const u8> compressed;
+		std::span<u8> data;
+		u32 crc;
+	};
+
+	/// Name and decompressed data of an entry read from a zip.
+	using ZipEntry = std::pair<std::string, std::vector<u8>>;
+
+	/// Returns the number of threads used for a given number of frames.
+	u32 GetThreadCount(size_t frames);
+
+	/// Compresses the data of each job into compressed, and computes the CRC-32 of the data.
+	bool Compress(std::span<CompressJob> jobs, int level, Error* error);
+
+	/// Decompresses each job into data, which must already be the decompressed size, and checks it
+	/// against the CRC-32 in the job.
+	bool Decompress(std::span<DecompressJob> jobs, Error* error);
+
+	/// Adds the output of a compressed job to the zip as a zstd entry, which libzip stores as-is
+	/// rather than compressing it again. The compressed data is moved out of the job.
+	bool AddToZip(zip_t* zf, const char* name, CompressJob& job);
+
+	/// Reads every entry in the zip. zstd entries are read as they are stored and then decompressed
+	/// together on several threads, everything else goes through libzip.
+	bool ReadZipEntries(zip_t* zf, std::vector<ZipEntry>* entries, Error* error);
+} // namespace SaveStateCompression
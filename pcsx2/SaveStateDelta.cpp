@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "SaveStateDelta.h"
+
+#include "common/Assertions.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	struct DeltaHeader
+	{
+		u32 magic;
+		u32 page_count;
+		u64 size;
+	};
+} // namespace
+
+static constexpr u32 DELTA_MAGIC = 0x4C445350; // PSDL
+
+u32 SaveStateDelta::Encode(std::span<const u8> previous, std::span<const u8> current, std::vector<u8>* out)
+{
+	pxAssert(previous.size() == current.size());
+
+	const size_t size = current.size();
+	const u32 total_pages = GetPageCount(size);
+	std::vector<u32> dirty;
+	for (u32 page = 0; page < total_pages; page++)
+	{
+		const size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+		const size_t length = std::min<size_t>(PAGE_SIZE, size - offset);
+		if (std::memcmp(previous.data() + offset, current.data() + offset, length) != 0)
+			dirty.push_back(page);
+	}
+
+	const DeltaHeader header = {DELTA_MAGIC, static_cast<u32>(dirty.size()), size};
+	const size_t start = out->size();
+	out->resize(start + sizeof(header) + dirty.size() * sizeof(u32));
+	u8* ptr = out->data() + start;
+	std::memcpy(ptr, &header, sizeof(header));
+	if (!dirty.empty())
+		std::memcpy(ptr + sizeof(header), dirty.data(), dirty.size() * sizeof(u32));
+
+	for (const u32 page : dirty)
+	{
+		const size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+		const size_t length = std::min<size_t>(PAGE_SIZE, size - offset);
+		out->insert(out->end(), current.data() + offset, current.data() + offset + length);
+	}
+
+	return header.page_count;
+}
+
+bool SaveStateDelta::Apply(std::span<const u8> delta, std::span<u8> data)
+{
+	DeltaHeader header;
+	if (delta.size() < sizeof(header))
+		return false;
+
+	std::memcpy(&header, delta.data(), sizeof(header));
+	if (header.magic != DELTA_MAGIC || header.size != data.size() || header.page_count > GetPageCount(data.size()) ||
+		delta.size() < sizeof(header) + static_cast<size_t>(header.page_count) * sizeof(u32))
+	{
+		return false;
+	}
+
+	const u8* indices = delta.data() + sizeof(header);
+	const u8* pages = indices + header.page_count * sizeof(u32);
+	const u8* end = delta.data() + delta.size();
+	for (u32 i = 0; i < header.page_count; i++)
+	{
+		u32 page;
+		std::memcpy(&page, indices + i * sizeof(u32), sizeof(page));
+		const size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+		if (offset >= data.size())
+			return false;
+
+		const size_t length = std::min<size_t>(PAGE_SIZE, data.size() - offset);
+		if (static_cast<size_t>(end - pages) < length)
+			return false;
+
+		std::memcpy(data.data() + offset, pages, length);
+		pages += length;
+	}
+
+	return (pages == end);
+}
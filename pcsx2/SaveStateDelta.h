@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <span>
+#include <vector>
+
+/// Page level deltas between two copies of a save state entry, used for checkpoint chains.
+/// An encoded delta holds the size of the entry, the indices of the pages which changed, and their
+/// contents. Pages are compared against the previous checkpoint's copy, so anything which writes to
+/// memory (recompilers, DMA, the VU and GS threads) is picked up without needing write barriers.
+namespace SaveStateDelta
+{
+	static constexpr u32 PAGE_SIZE = 4096;
+
+	/// Returns the number of pages needed to hold size bytes.
+	static constexpr u32 GetPageCount(size_t size) { return static_cast<u32>((size + PAGE_SIZE - 1) / PAGE_SIZE); }
+
+	/// Encodes the pages of current which differ from previous. Both must be the same size.
+	/// Returns the number of dirty pages.
+	u32 Encode(std::span<const u8> previous, std::span<const u8> current, std::vector<u8>* out);
+
+	/// Applies an encoded delta to data, which must hold the entry from the previous checkpoint.
+	/// Returns false if the delta is corrupted or does not match the size of data.
+	bool Apply(std::span<const u8> delta, std::span<u8> data);
+} // namespace SaveStateDelta
@@ -4,3 +4,7 @@
 /// Version number for GS and other shaders. Increment whenever any of the contents of the
 /// shaders change, to invalidate the cache.
 static constexpr u32 SHADER_CACHE_VERSION = 81;
+
+/// Version number for the software renderer's JIT selector cache. Increment whenever the meaning
+/// of GSScanlineSelector bits changes, to invalidate the recorded selectors.
+static constexpr u32 SW_JIT_CACHE_VERSION = 1;
@@ -8,6 +8,7 @@
 #include "Counters.h"
 #include "DEV9/DEV9.h"
 #include "DebugTools/DebugInterface.h"
+#include "DebugTools/HotBlockProfiler.h"
 #include "DebugTools/SymbolImporter.h"
 #include "Elfheader.h"
 #include "FW.h"
@@ -18,6 +19,7 @@
 #include "GameList.h"
 #include "Host.h"
 #include "INISettingsInterface.h"
+#include "IPU/IPU_DecodeAhead.h"
 #include "ImGui/FullscreenUI.h"
 #include "ImGui/ImGuiOverlays.h"
 #include "Input/InputManager.h"
@@ -31,6 +33,7 @@
 #include "R5900.h"
 #include "Recording/InputRecording.h"
 #include "Recording/InputRecordingControls.h"
+#include "Rewind.h"
 #include "SIO/Memcard/MemoryCardFile.h"
 #include "SIO/Pad/Pad.h"
 #include "SIO/Sio.h"
@@ -89,6 +92,7 @@ namespace VMManager
 	static void UpdateCPUImplementations();
 
 	static void ApplyGameFixes();
+	static void PollStereoRules();
 	static bool UpdateGameSettingsLayer();
 	static void CheckForConfigChanges(const Pcsx2Config& old_config);
 	static void CheckForCPUConfigChanges(const Pcsx2Config& old_config);
@@ -122,6 +126,12 @@ namespace VMManager
 	static void ZipSaveStateOnThread(std::unique_ptr<ArchiveEntryList> elist,
 		std::unique_ptr<SaveStateScreenshotData> screenshot, std::string filename,
 		s32 slot_for_message, std::function<void(const std::string&)> error_callback);
+	static void RemoveCurrentSaveStateThread();
+	static void WriteCheckpoint(std::unique_ptr<ArchiveEntryList> elist, const char* filename,
+		std::function<void(const std::string&)> error_callback);
+	static void WriteCheckpointOnThread(std::unique_ptr<ArchiveEntryList> elist, std::string filename,
+		std::function<void(const std::string&)> error_callback);
+	static void WaitForCheckpointThread();
 
 	static void LoadSettings();
 	static void LoadCoreSettings(SettingsInterface& si);
@@ -160,6 +170,8 @@ static Threading::ThreadHandle s_vm_thread_handle;
 
 static std::deque<std::thread> s_save_state_threads;
 static std::mutex s_save_state_threads_mutex;
+static SaveStateCheckpointWriter s_checkpoint_writer;
+static std::thread::id s_checkpoint_thread_id;
 
 static std::recursive_mutex s_info_mutex;
 static std::string s_disc_serial;
@@ -195,6 +207,10 @@ static u64 s_session_accumulated_playtime = 0;
 
 static bool s_screensaver_inhibited = false;
 
+// GameDB stereo rules are re-read at most this often while a game is running.
+static constexpr double STEREO_RULES_POLL_INTERVAL = 1.0;
+static Common::Timer s_stereo_rules_poll_timer;
+
 static bool s_discord_presence_active = false;
 static time_t s_discord_presence_time_epoch;
 
@@ -434,6 +450,8 @@ void VMManager::Internal::CPUThreadShutdown()
 
 	PINEServer::Deinitialize();
 
+	HotBlockProfiler::Stop();
+
 	Achievements::Shutdown(false);
 
 	InputManager::CloseSources();
@@ -703,12 +721,31 @@ void VMManager::ApplyGameFixes()
 
 	game->applyGameFixes(EmuConfig, EmuConfig.EnableGameFixes);
 	game->applyGSHardwareFixes(EmuConfig.GS);
+	game->applyStereoRules(EmuConfig.GS);
 
 	// Re-remove upscaling fixes, make sure they don't apply at native res.
 	// We do this in LoadCoreSettings(), but game fixes get applied afterwards because of the unsafe warning.
 	EmuConfig.GS.MaskUpscalingHacks();
 }
 
+void VMManager::PollStereoRules()
+{
+	if (EmuConfig.GS.StereoMode == GSStereoMode::Off || EmuConfig.GS.StereoProfile.empty() ||
+		s_stereo_rules_poll_timer.GetTimeSeconds() < STEREO_RULES_POLL_INTERVAL)
+	{
+		return;
+	}
+
+	s_stereo_rules_poll_timer.Reset();
+	if (!GameDatabase::pollStereoRules())
+		return;
+
+	// Reapplying the settings recompiles the renderer's stereo draw filter, no restart needed.
+	Host::AddIconOSDMessage("StereoRulesReloaded", ICON_FA_GLASSES,
+		TRANSLATE_STR("VMManager", "Stereo rules reloaded from the game database."), Host::OSD_QUICK_DURATION);
+	Host::RunOnCPUThread(&VMManager::ApplySettings);
+}
+
 void VMManager::ApplySettings()
 {
 	Console.WriteLn("Applying settings...");
@@ -1598,6 +1635,7 @@ VMBootResult VMManager::Initialize(const VMBootParameters& boot_params, Error* e
 		}
 	}
 
+	Rewind::UpdateSettings();
 	PerformanceMetrics::Clear();
 	return VMBootResult::StartupSuccess;
 }
@@ -1632,6 +1670,7 @@ void VMManager::Shutdown(bool save_resume_state)
 		g_InputRecording.stop();
 
 	SaveSessionTime(s_disc_serial);
+	GameDatabase::waitForStereoRules();
 	s_elf_override = {};
 	ClearELFInfo();
 	CDVDsys_ClearFiles();
@@ -1652,9 +1691,12 @@ void VMManager::Shutdown(bool save_resume_state)
 
 	FPControlRegister::SetCurrent(FPControlRegister::GetDefault());
 
+	s_checkpoint_writer.Reset();
+	Rewind::Shutdown();
 	Patch::UnloadPatches();
 	R3000A::ioman::reset();
 	vtlb_Shutdown();
+	IPUDecodeAhead::Shutdown();
 	USBclose();
 	SPU2::Close();
 	Pad::Shutdown();
@@ -1933,7 +1975,11 @@ void VMManager::ZipSaveStateOnThread(std::unique_ptr<ArchiveEntryList> elist,
 {
 	ZipSaveState(
 		std::move(elist), std::move(screenshot), filename.c_str(), slot_for_message, std::move(error_callback));
+	RemoveCurrentSaveStateThread();
+}
 
+void VMManager::RemoveCurrentSaveStateThread()
+{
 	// remove ourselves from the thread list. if we're joining, we might not be in there.
 	const auto this_id = std::this_thread::get_id();
 	std::unique_lock lock(s_save_state_threads_mutex);
@@ -2011,6 +2057,126 @@ bool VMManager::LoadState(const char* filename, Error* error)
 	return true;
 }
 
+void VMManager::SaveCheckpoint(const char* filename, bool new_chain, bool zip_on_thread,
+	std::function<void(const std::string&)> error_callback)
+{
+	if (GSDumpReplayer::IsReplayingDump())
+	{
+		error_callback(TRANSLATE_STR("VMManager", "Cannot save state while replaying a GS dump."));
+		return;
+	}
+
+	Error error;
+	std::unique_ptr<ArchiveEntryList> elist = SaveState_DownloadState(&error);
+	if (!elist)
+	{
+		error_callback(error.GetDescription());
+		return;
+	}
+
+	// The writer diffs against the previous checkpoint, so that one has to be on disk first.
+	WaitForCheckpointThread();
+	if (new_chain)
+		s_checkpoint_writer.Reset();
+
+	if (zip_on_thread)
+	{
+		// lock order here is important; the thread could exit before we resume here.
+		std::unique_lock lock(s_save_state_threads_mutex);
+		const std::thread& thread = s_save_state_threads.emplace_back(&VMManager::WriteCheckpointOnThread,
+			std::move(elist), std::string(filename), std::move(error_callback));
+		s_checkpoint_thread_id = thread.get_id();
+	}
+	else
+	{
+		WriteCheckpoint(std::move(elist), filename, std::move(error_callback));
+	}
+
+	Host::OnSaveStateSaved(filename);
+	MemcardBusy::CheckSaveStateDependency();
+}
+
+void VMManager::WriteCheckpoint(std::unique_ptr<ArchiveEntryList> elist, const char* filename,
+	std::function<void(const std::string&)> error_callback)
+{
+	Common::Timer timer;
+
+	Error error;
+	const u32 sequence = s_checkpoint_writer.GetSequence();
+	if (!s_checkpoint_writer.Save(std::move(elist), filename, &error))
+	{
+		error_callback(error.GetDescription());
+		return;
+	}
+
+	DevCon.WriteLn(fmt::format("Saved checkpoint {} to '{}', {} KB of state in {:.2f} ms", sequence,
+		Path::GetFileName(filename), s_checkpoint_writer.GetLastWrittenBytes() / 1024, timer.GetTimeMilliseconds()));
+}
+
+void VMManager::WriteCheckpointOnThread(std::unique_ptr<ArchiveEntryList> elist, std::string filename,
+	std::function<void(const std::string&)> error_callback)
+{
+	WriteCheckpoint(std::move(elist), filename.c_str(), std::move(error_callback));
+	RemoveCurrentSaveStateThread();
+}
+
+void VMManager::WaitForCheckpointThread()
+{
+	std::unique_lock lock(s_save_state_threads_mutex);
+	const auto it = std::find_if(s_save_state_threads.begin(), s_save_state_threads.end(),
+		[](const std::thread& thread) { return (thread.get_id() == s_checkpoint_thread_id); });
+	if (it == s_save_state_threads.end())
+		return;
+
+	std::thread checkpoint_thread(std::move(*it));
+	s_save_state_threads.erase(it);
+	lock.unlock();
+	checkpoint_thread.join();
+}
+
+bool VMManager::LoadCheckpointChain(std::span<const std::string> filenames, Error* error)
+{
+	if (filenames.empty())
+	{
+		Error::SetString(error, "No checkpoints to load.");
+		return false;
+	}
+
+	if (GSDumpReplayer::IsReplayingDump())
+	{
+		Error::SetString(error, TRANSLATE_STR("VMManager", "Cannot load state while replaying a GS dump."));
+		return false;
+	}
+
+	if (Achievements::IsHardcoreModeActive())
+	{
+		Error::SetString(error,
+			TRANSLATE_STR("VMManager", "Cannot load state while RetroAchievements Hardcore Mode is active."));
+		return false;
+	}
+
+	if (MemcardBusy::IsBusy())
+	{
+		Error::SetString(error,
+			TRANSLATE_STR("VMManager", "The memory card is busy, so the state load operation has been cancelled to prevent data loss."));
+		return false;
+	}
+
+	// The last checkpoint could still be compressing.
+	WaitForSaveStateFlush();
+
+	Host::OnSaveStateLoading(filenames.back());
+	if (!SaveState_UnzipChainFromDisk(filenames, error))
+	{
+		Reset();
+		return false;
+	}
+
+	Host::OnSaveStateLoaded(filenames.back(), true);
+	MemcardBusy::CheckSaveStateDependency();
+	return true;
+}
+
 bool VMManager::LoadStateFromSlot(s32 slot, bool backup, Error* error)
 {
 	const std::string filename = GetCurrentSaveStateFileName(slot, backup);
@@ -2704,6 +2870,9 @@ void VMManager::Execute()
 		vtlb_ResetFastmem();
 	}
 
+	// Rewind snapshots are taken between frames, not in the middle of the vsync event.
+	Rewind::RunPendingWork();
+
 	// Execute until we're asked to stop.
 	Cpu->Execute();
 }
@@ -2866,6 +3035,12 @@ void VMManager::Internal::VSyncOnCPUThread()
 
 	Achievements::FrameUpdate();
 
+	PINEServer::OnVsync();
+
+	Rewind::OnVsync();
+
+	PollStereoRules();
+
 	PollDiscordPresence();
 }
 
@@ -3045,6 +3220,9 @@ void VMManager::CheckForMiscConfigChanges(const Pcsx2Config& old_config)
 			ShutdownDiscordPresence();
 	}
 
+	if (HasValidVM() && EmuConfig.Savestate != old_config.Savestate)
+		Rewind::UpdateSettings();
+
 	if (HasValidVM() && (EmuConfig.EnableThreadPinning != old_config.EnableThreadPinning ||
 							(s_thread_affinities_set && EmuConfig.Speedhacks.vuThread != old_config.Speedhacks.vuThread)))
 	{
@@ -172,6 +172,14 @@ namespace VMManager
 	/// Saves state to the specified slot.
 	void SaveStateToSlot(s32 slot, bool zip_on_thread, std::function<void(const std::string&)> error_callback);
 
+	/// Saves a checkpoint to the specified filename. Only the first checkpoint of a chain is a full state,
+	/// later ones store the pages which changed since the previous checkpoint.
+	void SaveCheckpoint(const char* filename, bool new_chain, bool zip_on_thread,
+		std::function<void(const std::string&)> error_callback);
+
+	/// Loads a checkpoint chain, the base state followed by its deltas in the order they were saved.
+	bool LoadCheckpointChain(std::span<const std::string> filenames, Error* error = nullptr);
+
 	/// Waits until all compressing save states have finished saving to disk.
 	void WaitForSaveStateFlush();
 
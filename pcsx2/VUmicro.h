@@ -71,6 +71,14 @@ public:
 	// recompiled code.
 	static void ExecuteBlockJIT(BaseVUmicroCPU* cpu, bool interlocked);
 
+	// Compiles the program the VU would run if it was started at startPC now, without running
+	// it. Returns true if any code had to be generated. Does nothing for interpreters.
+	virtual bool Precompile(u32 startPC) { return false; }
+
+	// Compiles the next block of a program from a previous session which matches micro memory.
+	// Returns false once there's nothing left to compile until micro memory changes.
+	virtual bool PrecompileCached() { return false; }
+
 	// VU1 sometimes needs to break execution on XGkick Path1 transfers if
 	// there is another gif path 2/3 transfer already taking place.
 	// Use this method to resume execution of VU1.
@@ -148,6 +156,8 @@ public:
 	const char* GetShortName() const override { return "mVU1"; }
 	const char* GetLongName() const override { return "microVU1 Recompiler"; }
 
+	size_t GetCommittedCache() const override;
+
 	void Reserve();
 	void Shutdown() override;
 	void Reset() override;
@@ -155,7 +165,18 @@ public:
 	void SetStartPC(u32 startPC) override;
 	void Execute(u32 cycles) override;
 	void Clear(u32 addr, u32 size) override;
+	bool Precompile(u32 startPC) override;
+	bool PrecompileCached() override;
 	void ResumeXGkick() override;
+
+	// Switches the persistent program cache to the file at path, saving the previous one. An empty
+	// path turns it off. Normally the cache of the running game is picked on reset.
+	void SetProgramCache(std::string path);
+
+	// Adds the programs compiled so far to the program cache, and writes it to its file.
+	void SaveProgramCache();
+
+	size_t GetCachedProgramCount() const;
 };
 
 extern InterpVU0 CpuIntVU0;
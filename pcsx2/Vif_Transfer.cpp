@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0+
 
 #include "Common.h"
+#include "MTVU.h"
 #include "Vif_Dma.h"
 #include "Vif_Dynarec.h"
 
@@ -62,7 +63,14 @@ _vifT static __fi bool vifTransfer(u32 *data, int size, bool TTE) {
 	int transferred = vifX.irqoffset.enabled ? vifX.irqoffset.value : 0;
 
 	vifX.vifpacketsize = size;
+
+	// Publish the packet's unpacks and microprogram uploads to the VU thread together.
+	const bool mtvu_batch = idx && THREAD_VU1;
+	if (mtvu_batch)
+		vu1Thread.BeginBatch();
 	vifTransferLoop<idx>(data);
+	if (mtvu_batch)
+		vu1Thread.EndBatch();
 
 	transferred += size - vifX.vifpacketsize;
 
@@ -492,7 +492,9 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
 
 	VifUnpackNEON_Dynarec(v, block).CompileRoutine();
 
-	Perf::vif.RegisterPC(v.recWritePtr, armGetCurrentCodePointer() - v.recWritePtr, block.upkType /* FIXME ideally a key*/);
+	// Unpacks have no guest PC, they're named after the same key used to look them up (minus the mask).
+	Perf::vif.RegisterKey(v.recWritePtr, armGetCurrentCodePointer() - v.recWritePtr, "Unpack_",
+		(static_cast<u64>(block.hash_key) << 32) | block.key1);
 	v.recWritePtr = armEndBlock();
 
 	return &block;
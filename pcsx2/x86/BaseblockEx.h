@@ -162,6 +162,7 @@ public:
 
 	BASEBLOCKEX* New(u32 startpc, uptr fnptr);
 	int LastIndex(u32 startpc) const;
+	__fi u32 Count() const { return blocks.size(); }
 	//BASEBLOCKEX* GetByX86(uptr ip);
 
 	__fi int Index(u32 startpc) const
@@ -66,6 +66,7 @@ static u32 s_nInstCacheSize = 0;
 
 static BASEBLOCK* s_pCurBlock = nullptr;
 static BASEBLOCKEX* s_pCurBlockEx = nullptr;
+static std::vector<Perf::LineInfo> s_perfLines; // where each instruction of the current block starts
 
 static u32 s_nEndBlock = 0; // what psxpc the current block ends
 static u32 s_branchTo;
@@ -1442,6 +1443,9 @@ void psxRecompileNextInstruction(bool delayslot, bool swapped_delayslot)
 	}
 #endif
 
+	if constexpr (Perf::LineInfoEnabled)
+		s_perfLines.push_back({static_cast<u32>(xGetPtr() - recPtr), psxpc});
+
 	const int old_code = psxRegs.code;
 	EEINST* old_inst_info = g_pCurInstInfo;
 	s_recompilingDelaySlot = delayslot;
@@ -1576,6 +1580,7 @@ static void iopRecRecompile(const u32 startpc)
 
 	xSetPtr(recPtr);
 	recPtr = xGetAlignedCallTarget();
+	s_perfLines.clear();
 
 	s_pCurBlock = PSX_GETBLOCK(startpc);
 
@@ -1761,7 +1766,7 @@ StartRecomp:
 	pxAssert(xGetPtr() - recPtr < _64kb);
 	s_pCurBlockEx->x86size = xGetPtr() - recPtr;
 
-	Perf::iop.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc);
+	Perf::iop.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc, s_perfLines);
 
 	recPtr = xGetPtr();
 
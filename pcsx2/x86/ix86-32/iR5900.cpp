@@ -4,6 +4,7 @@
 #include "Common.h"
 #include "CDVD/CDVD.h"
 #include "DebugTools/Breakpoints.h"
+#include "DebugTools/HotBlockProfiler.h"
 #include "Elfheader.h"
 #include "GS.h"
 #include "Memory.h"
@@ -87,6 +88,7 @@ static u32 s_nInstCacheSize = 0;
 
 static BASEBLOCK* s_pCurBlock = nullptr;
 static BASEBLOCKEX* s_pCurBlockEx = nullptr;
+static std::vector<Perf::LineInfo> s_perfLines; // where each instruction of the current block starts
 u32 s_nEndBlock = 0; // what pc the current block ends
 u32 s_branchTo;
 static bool s_nBlockFF;
@@ -354,10 +356,18 @@ static const void* EnterRecompiledCode = nullptr;
 static const void* DispatchBlockDiscard = nullptr;
 static const void* DispatchPageReset = nullptr;
 
+static void recProcessProfilerSamples()
+{
+	HotBlockProfiler::ProcessSamples(std::span<const BASEBLOCKEX>(recBlocks[0], recBlocks.Count()));
+}
+
 static void recEventTest()
 {
 	_cpuEventTest_Shared();
 
+	if (HotBlockProfiler::HasPendingSamples()) [[unlikely]]
+		recProcessProfilerSamples();
+
 	if (eeRecExitRequested)
 	{
 		eeRecExitRequested = false;
@@ -569,6 +579,9 @@ static void recResetRaw()
 {
 	Console.WriteLn(Color_StrongBlack, "EE/iR5900 Recompiler Reset");
 
+	// Samples point into the code buffer we're about to reuse.
+	recProcessProfilerSamples();
+
 	if (CHECK_EXTRAMEM != extraRam)
 	{
 		recReserveRAM();
@@ -606,6 +619,7 @@ void recShutdown()
 	recRAMCopy.deallocate();
 	recLutReserve_RAM.deallocate();
 
+	recProcessProfilerSamples();
 	recBlocks.Reset();
 
 	recRAM = recROM = recROM1 = recROM2 = nullptr;
@@ -1658,6 +1672,9 @@ bool encodeMemcheck()
 
 void recompileNextInstruction(bool delayslot, bool swapped_delay_slot)
 {
+	if constexpr (Perf::LineInfoEnabled)
+		s_perfLines.push_back({static_cast<u32>(xGetPtr() - recPtr), pc});
+
 	if (EmuConfig.EnablePatches)
 		Patch::ApplyDynamicPatches(pc);
 
@@ -2196,6 +2213,7 @@ static void recRecompile(const u32 startpc)
 
 	xSetPtr(recPtr);
 	recPtr = xGetAlignedCallTarget();
+	s_perfLines.clear();
 
 	s_pCurBlock = PC_GETBLOCK(startpc);
 
@@ -2732,7 +2750,7 @@ StartRecomp:
 		iDumpBlock(s_pCurBlockEx->startpc, s_pCurBlockEx->size*4, s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size);
 	}
 #endif
-	Perf::ee.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc);
+	Perf::ee.RegisterPC((void*)s_pCurBlockEx->fnptr, s_pCurBlockEx->x86size, s_pCurBlockEx->startpc, s_perfLines);
 
 	recPtr = xGetPtr();
 
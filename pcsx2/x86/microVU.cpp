@@ -42,6 +42,15 @@ void mVUreset(microVU& mVU, bool resetReserve)
 		VU0.VI[REG_VPU_STAT].UL &= ~0x100;
 	}
 
+	// Remember the programs we're about to throw away, and switch caches if the game changed.
+	if (mVUcacheEnabled(mVU))
+		mVUcacheAddAllProgs(mVU);
+	if (resetReserve && mVU.index)
+	{
+		mVUcacheSave();
+		mVUcacheSetGame(mVU);
+	}
+
 	xSetPtr(mVU.cache);
 	mVUdispatcherAB(mVU);
 	mVUdispatcherCD(mVU);
@@ -85,6 +94,12 @@ void mVUreset(microVU& mVU, bool resetReserve)
 // Free Allocated Resources
 void mVUclose(microVU& mVU)
 {
+	if (mVUcacheEnabled(mVU))
+	{
+		mVUcacheAddAllProgs(mVU);
+		mVUcacheSave();
+	}
+
 	// Delete Programs and Block Managers
 	for (u32 i = 0; i < (mVU.progSize / 2); i++)
 	{
@@ -102,6 +117,13 @@ void mVUclose(microVU& mVU)
 // Clears Block Data in specified range
 __fi void mVUclear(mV, u32 addr, u32 size)
 {
+	if (mVU.index)
+	{
+		// Check the cached programs against the new micro memory
+		mVUprogCache.next = 0;
+		mVUprogCache.next_block = 0;
+	}
+
 	if (!mVU.prog.cleared)
 	{
 		mVU.prog.cleared = 1; // Next execution searches/creates a new microprogram
@@ -301,6 +323,40 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 	return mVUentryGet(mVU, quick.block, startPC, pState);
 }
 
+// Running out of cache is handled by mVUcleanUp() resetting it, so leave the last
+// safe-zone's worth of space for programs compiled on demand.
+bool mVUcanPrecompile(microVU& mVU)
+{
+	return (mVU.prog.x86ptr < mVU.prog.x86end - (mVUcacheSafeZone * _1mb));
+}
+
+// Looks up (and compiles if needed) the block mVUsearchProg() would find for startPC and pState when
+// the program was started at progPC, without running it. Returns true if any code was generated.
+// Must be called from the thread that executes the VU.
+_mVUt bool mVUprecompile(u32 progPC, u32 startPC, const microRegInfo& pState)
+{
+	microVU& mVU = mVUx;
+	const u32 vuLimit = vuIndex ? 0x3ff8 : 0xff8;
+
+	if (!mVUcanPrecompile(mVU))
+		return false;
+
+	// Compiling overwrites the saved pipeline state with the one of each block compiled, which is
+	// normally fixed up when the program exits. Since we don't run it, put it back ourselves.
+	const microRegInfo lpState = mVU.prog.lpState;
+	const microRegInfo blockState = pState;
+	const u32 oldStartPC = mVU.regs().start_pc;
+	mVU.regs().start_pc = progPC & vuLimit;
+	xSetPtr(mVU.prog.x86ptr);
+	mVUsearchProg<vuIndex>(startPC & vuLimit, (uptr)&blockState);
+	mVU.regs().start_pc = oldStartPC;
+	mVU.prog.lpState = lpState;
+
+	const bool compiled = (xGetPtr() != mVU.prog.x86ptr);
+	mVU.prog.x86ptr = xGetPtr();
+	return compiled;
+}
+
 //------------------------------------------------------------------
 // recMicroVU0 / recMicroVU1
 //------------------------------------------------------------------
@@ -405,6 +461,37 @@ void recMicroVU1::Clear(u32 addr, u32 size)
 	mVUclear(microVU1, addr, size);
 }
 
+bool recMicroVU1::Precompile(u32 startPC)
+{
+	return mVUprecompile<1>(startPC, startPC, microVU1.prog.lpState);
+}
+
+bool recMicroVU1::PrecompileCached()
+{
+	return mVUcachePrecompileNext<1>();
+}
+
+size_t recMicroVU1::GetCommittedCache() const
+{
+	return static_cast<size_t>(microVU1.prog.x86ptr - microVU1.prog.x86start);
+}
+
+void recMicroVU1::SetProgramCache(std::string path)
+{
+	mVUcacheSetPath(microVU1, std::move(path));
+}
+
+void recMicroVU1::SaveProgramCache()
+{
+	mVUcacheAddAllProgs(microVU1);
+	mVUcacheSave();
+}
+
+size_t recMicroVU1::GetCachedProgramCount() const
+{
+	return mVUprogCache.programs.size();
+}
+
 void recMicroVU1::ResumeXGkick()
 {
 	if (!(VU0.VI[REG_VPU_STAT].UL & 0x100))
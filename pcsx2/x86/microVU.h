@@ -208,6 +208,15 @@ public:
 		}
 		return thisBlock;
 	}
+	// Calls f for every block in the manager
+	template <typename F>
+	void forEach(F&& f) const
+	{
+		for (const microBlockLink* linkI = qBlockList; linkI != nullptr; linkI = linkI->next)
+			f(linkI->block);
+		for (const microBlockLink* linkI = fBlockList; linkI != nullptr; linkI = linkI->next)
+			f(linkI->block);
+	}
 	__ri microBlock* search(microVU& mVU, microRegInfo* pState)
 	{
 		if (pState->needExactMatch) // Needs Detailed Search (Exact Match of Pipeline State)
@@ -295,6 +304,8 @@ mVUop(mVUopL);
 extern void mVUcacheProg(microVU& mVU, microProgram& prog);
 extern void mVUdeleteProg(microVU& mVU, microProgram*& prog);
 _mVUt extern void* mVUsearchProg(u32 startPC, uptr pState);
+extern bool mVUcanPrecompile(microVU& mVU);
+_mVUt extern bool mVUprecompile(u32 progPC, u32 startPC, const microRegInfo& pState);
 extern void* mVUexecuteVU0(u32 startPC, u32 cycles);
 extern void* mVUexecuteVU1(u32 startPC, u32 cycles);
 
@@ -328,3 +339,4 @@ void sortVector(T& v)
 #include "microVU_Compile.inl"
 #include "microVU_Execute.inl"
 #include "microVU_Macro.inl"
+#include "microVU_Cache.inl"
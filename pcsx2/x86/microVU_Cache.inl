@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#pragma once
+
+#include "BuildVersion.h"
+#include "VMManager.h"
+
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+
+//------------------------------------------------------------------
+// Micro VU - Persistent Program Cache (VU1 only)
+//------------------------------------------------------------------
+// Remembers the programs each game ran, and the pipeline states their blocks were compiled for,
+// so the next boot can compile them while the VU thread is idle instead of when they're first
+// started (see VU_Thread::Precompile()). A cached program is only compiled once the micro memory
+// matches it over all of its ranges, like mVUcmpProg() checks, so a stale cache only costs time.
+
+struct microCachedBlock
+{
+	u32 pc;               // Start PC of the block
+	microRegInfo pState;  // Pipeline state the block was compiled for
+};
+
+struct microCachedProgram
+{
+	u32 startPC;                          // Program list the program belongs to (start_pc / 8)
+	std::vector<microRange> ranges;       // Ranges of micro memory the program was compiled from
+	std::vector<u32> data;                // Contents of those ranges, one after the other
+	std::vector<microCachedBlock> blocks; // Blocks compiled for the program
+};
+
+struct microProgCache
+{
+	std::string path;                         // Cache file of the current game, empty if there isn't one
+	std::vector<microCachedProgram> programs; // Most recently used first
+	size_t next;                              // Next program to check against micro memory
+	size_t next_block;                        // Next block of that program to compile
+	bool dirty;                               // Programs were added since the cache was loaded or saved
+};
+
+static microProgCache mVUprogCache;
+
+static constexpr u32 mVUcacheMagic = 0x4355564D; // MVUC
+static constexpr u32 mVUcacheVersion = 1;
+static constexpr size_t mVUcacheMaxPrograms = 1024;
+static constexpr size_t mVUcacheMaxBlocks = 256; // Per program, programs with more states are mostly one-offs
+
+__fi bool mVUcacheEnabled(microVU& mVU)
+{
+	return mVU.index && THREAD_VU1 && EmuConfig.Speedhacks.vuThreadPrecompile;
+}
+
+// Adds a program that's about to be deleted to the cache
+static void mVUcacheAddProg(microVU& mVU, const microProgram& prog)
+{
+	if (mVUprogCache.path.empty())
+		return;
+
+	microCachedProgram cached;
+	cached.startPC = prog.startPC;
+	for (const microRange& range : *prog.ranges)
+	{
+		if (range.start < 0 || range.end <= range.start || range.end > static_cast<s32>(mVU.microMemSize))
+			continue;
+		cached.ranges.push_back(range);
+		cached.data.insert(cached.data.end(), prog.data + range.start / 4, prog.data + range.end / 4);
+	}
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		if (prog.block[i])
+			prog.block[i]->forEach([&](const microBlock& block) {
+				if (cached.blocks.size() < mVUcacheMaxBlocks)
+					cached.blocks.push_back({i * 8, block.pState});
+			});
+	}
+	if (cached.ranges.empty() || cached.blocks.empty())
+		return;
+
+	auto sameRange = [](const microRange& lhs, const microRange& rhs) { return lhs.start == rhs.start && lhs.end == rhs.end; };
+	auto it = std::find_if(mVUprogCache.programs.begin(), mVUprogCache.programs.end(), [&](const microCachedProgram& other) {
+		return other.startPC == cached.startPC && other.data == cached.data &&
+			   std::equal(other.ranges.begin(), other.ranges.end(), cached.ranges.begin(), cached.ranges.end(), sameRange);
+	});
+
+	if (it != mVUprogCache.programs.end())
+	{
+		// Seen before, keep any blocks that were compiled for new pipeline states.
+		for (const microCachedBlock& block : cached.blocks)
+		{
+			if (it->blocks.size() >= mVUcacheMaxBlocks)
+				break;
+			if (std::none_of(it->blocks.begin(), it->blocks.end(), [&](const microCachedBlock& other) {
+					return other.pc == block.pc && !std::memcmp(&other.pState, &block.pState, sizeof(microRegInfo));
+				}))
+			{
+				it->blocks.push_back(block);
+			}
+		}
+		std::rotate(mVUprogCache.programs.begin(), it, it + 1);
+	}
+	else
+	{
+		mVUprogCache.programs.insert(mVUprogCache.programs.begin(), std::move(cached));
+		if (mVUprogCache.programs.size() > mVUcacheMaxPrograms)
+			mVUprogCache.programs.pop_back();
+	}
+
+	mVUprogCache.next = 0;
+	mVUprogCache.next_block = 0;
+	mVUprogCache.dirty = true;
+}
+
+// Adds all programs compiled so far to the cache
+static void mVUcacheAddAllProgs(microVU& mVU)
+{
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		if (!mVU.prog.prog[i])
+			continue;
+		for (const microProgram* prog : *mVU.prog.prog[i])
+			mVUcacheAddProg(mVU, *prog);
+	}
+}
+
+template <typename T>
+static void mVUcacheWriteValue(std::vector<u8>& buffer, const T& value)
+{
+	const u8* ptr = reinterpret_cast<const u8*>(&value);
+	buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+static bool mVUcacheReadValue(const std::vector<u8>& buffer, size_t& pos, T* value)
+{
+	if ((buffer.size() - pos) < sizeof(T))
+		return false;
+	std::memcpy(value, &buffer[pos], sizeof(T));
+	pos += sizeof(T);
+	return true;
+}
+
+static void mVUcacheSave()
+{
+	if (!mVUprogCache.dirty || mVUprogCache.path.empty())
+		return;
+
+	const std::string_view build = BuildVersion::GitHash;
+	std::vector<u8> buffer;
+	mVUcacheWriteValue(buffer, mVUcacheMagic);
+	mVUcacheWriteValue(buffer, mVUcacheVersion);
+	mVUcacheWriteValue(buffer, static_cast<u32>(sizeof(microRegInfo)));
+	mVUcacheWriteValue(buffer, static_cast<u32>(build.size()));
+	buffer.insert(buffer.end(), build.begin(), build.end());
+	mVUcacheWriteValue(buffer, static_cast<u32>(mVUprogCache.programs.size()));
+	for (const microCachedProgram& prog : mVUprogCache.programs)
+	{
+		mVUcacheWriteValue(buffer, prog.startPC);
+		mVUcacheWriteValue(buffer, static_cast<u32>(prog.ranges.size()));
+		for (const microRange& range : prog.ranges)
+			mVUcacheWriteValue(buffer, range);
+		for (u32 word : prog.data)
+			mVUcacheWriteValue(buffer, word);
+		mVUcacheWriteValue(buffer, static_cast<u32>(prog.blocks.size()));
+		for (const microCachedBlock& block : prog.blocks)
+		{
+			mVUcacheWriteValue(buffer, block.pc);
+			mVUcacheWriteValue(buffer, block.pState);
+		}
+	}
+
+	// Written under a temporary name, so a crash or a full disk never leaves a truncated cache.
+	const std::string temp_path = mVUprogCache.path + ".tmp";
+	Error error;
+	if (!FileSystem::WriteBinaryFile(temp_path.c_str(), buffer.data(), buffer.size()))
+	{
+		Console.Error("microVU1: Failed to write program cache to '%s'", temp_path.c_str());
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return;
+	}
+	if (!FileSystem::RenamePath(temp_path.c_str(), mVUprogCache.path.c_str(), &error))
+	{
+		Console.ErrorFmt("microVU1: Failed to rename program cache to '{}': {}", mVUprogCache.path, error.GetDescription());
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return;
+	}
+
+	DevCon.WriteLn(Color_Orange, "microVU1: Saved %zu programs to program cache.", mVUprogCache.programs.size());
+	mVUprogCache.dirty = false;
+}
+
+static bool mVUcacheParse(const std::vector<u8>& buffer, microVU& mVU)
+{
+	size_t pos = 0;
+	u32 magic, version, state_size, build_length, count;
+	if (!mVUcacheReadValue(buffer, pos, &magic) || !mVUcacheReadValue(buffer, pos, &version) ||
+		!mVUcacheReadValue(buffer, pos, &state_size) || !mVUcacheReadValue(buffer, pos, &build_length) ||
+		magic != mVUcacheMagic || version != mVUcacheVersion || state_size != sizeof(microRegInfo) ||
+		(buffer.size() - pos) < build_length)
+	{
+		return false;
+	}
+
+	// Pipeline states are only meaningful to the build that produced them.
+	const std::string_view build(reinterpret_cast<const char*>(&buffer[pos]), build_length);
+	pos += build_length;
+	if (build != BuildVersion::GitHash || !mVUcacheReadValue(buffer, pos, &count) || count > mVUcacheMaxPrograms)
+		return false;
+
+	mVUprogCache.programs.resize(count);
+	for (microCachedProgram& prog : mVUprogCache.programs)
+	{
+		u32 range_count, block_count;
+		if (!mVUcacheReadValue(buffer, pos, &prog.startPC) || prog.startPC >= (mVU.progSize / 2) ||
+			!mVUcacheReadValue(buffer, pos, &range_count) || range_count > mVU.progSize)
+		{
+			return false;
+		}
+
+		u32 words = 0;
+		prog.ranges.resize(range_count);
+		for (microRange& range : prog.ranges)
+		{
+			if (!mVUcacheReadValue(buffer, pos, &range) || range.start < 0 || range.end <= range.start ||
+				range.end > static_cast<s32>(mVU.microMemSize) || ((range.start | range.end) & 3))
+			{
+				return false;
+			}
+			words += (range.end - range.start) / 4;
+		}
+
+		prog.data.resize(words);
+		for (u32& word : prog.data)
+		{
+			if (!mVUcacheReadValue(buffer, pos, &word))
+				return false;
+		}
+
+		if (!mVUcacheReadValue(buffer, pos, &block_count) || block_count > mVUcacheMaxBlocks ||
+			block_count > ((buffer.size() - pos) / (sizeof(u32) + sizeof(microRegInfo))))
+			return false;
+		prog.blocks.resize(block_count);
+		for (microCachedBlock& block : prog.blocks)
+		{
+			if (!mVUcacheReadValue(buffer, pos, &block.pc) || !mVUcacheReadValue(buffer, pos, &block.pState) ||
+				(block.pc & 7) || block.pc > (mVU.microMemSize - 8))
+			{
+				return false;
+			}
+		}
+	}
+
+	return (pos == buffer.size());
+}
+
+static void mVUcacheLoad(microVU& mVU)
+{
+	std::optional<std::vector<u8>> buffer = FileSystem::ReadBinaryFile(mVUprogCache.path.c_str());
+	if (!buffer.has_value())
+		return;
+
+	if (!mVUcacheParse(buffer.value(), mVU))
+	{
+		Console.Warning("microVU1: Ignoring invalid or outdated program cache '%s'", mVUprogCache.path.c_str());
+		mVUprogCache.programs.clear();
+		return;
+	}
+
+	Console.WriteLn(Color_Orange, "microVU1: Loaded %zu programs from program cache.", mVUprogCache.programs.size());
+}
+
+// Saves the cache to its current file and loads the one at path, if it changed. An empty path
+// turns the cache off. Must be called while the VU thread is idle.
+static void mVUcacheSetPath(microVU& mVU, std::string path)
+{
+	if (path == mVUprogCache.path)
+		return;
+
+	mVUcacheSave();
+	mVUprogCache.path = std::move(path);
+	mVUprogCache.programs.clear();
+	mVUprogCache.next = 0;
+	mVUprogCache.next_block = 0;
+	mVUprogCache.dirty = false;
+	if (!mVUprogCache.path.empty())
+		mVUcacheLoad(mVU);
+}
+
+// Saves the cache of the previous game and loads the one of the current game, if it changed.
+// Must be called while the VU thread is idle.
+static void mVUcacheSetGame(microVU& mVU)
+{
+	std::string path;
+	if (mVUcacheEnabled(mVU) && !EmuFolders::Cache.empty())
+	{
+		const std::string serial = VMManager::GetDiscSerial();
+		const u32 crc = VMManager::GetDiscCRC();
+		if (!serial.empty() && crc != 0)
+			path = Path::Combine(EmuFolders::Cache, fmt::format("microvu1_{}_{:08X}.bin", Path::SanitizeFileName(serial), crc));
+	}
+	mVUcacheSetPath(mVU, std::move(path));
+}
+
+__fi bool mVUcacheMatches(microVU& mVU, const microCachedProgram& prog)
+{
+	const u32* data = prog.data.data();
+	for (const microRange& range : prog.ranges)
+	{
+		const u32 size = static_cast<u32>(range.end - range.start);
+		if (std::memcmp(data, reinterpret_cast<const u8*>(mVU.regs().Micro) + range.start, size))
+			return false;
+		data += size / 4;
+	}
+	return true;
+}
+
+// Compiles the next block of a cached program which matches micro memory, so the caller can stop
+// between any two blocks. Returns false once there's nothing left to compile until micro memory changes.
+_mVUt bool mVUcachePrecompileNext()
+{
+	microVU& mVU = mVUx;
+	while (mVUprogCache.next < mVUprogCache.programs.size())
+	{
+		// mVUclear() starts over when micro memory changes, so programs only need checking once.
+		const microCachedProgram& prog = mVUprogCache.programs[mVUprogCache.next];
+		if (mVUprogCache.next_block >= prog.blocks.size() || (mVUprogCache.next_block == 0 && !mVUcacheMatches(mVU, prog)))
+		{
+			mVUprogCache.next++;
+			mVUprogCache.next_block = 0;
+			continue;
+		}
+
+		if (!mVUcanPrecompile(mVU))
+		{
+			mVUprogCache.next = mVUprogCache.programs.size();
+			return false;
+		}
+
+		const microCachedBlock& block = prog.blocks[mVUprogCache.next_block++];
+		mVUprecompile<vuIndex>(prog.startPC * 8, block.pc, block.pState);
+		return true;
+	}
+	return false;
+}
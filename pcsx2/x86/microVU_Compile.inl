@@ -693,6 +693,7 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 {
 	microFlagCycles mFC;
 	u8* thisPtr = x86Ptr;
+	std::vector<Perf::LineInfo> perfLines;
 	const u32 endCount = (((microRegInfo*)pState)->blockType) ? 1 : (mVU.microMemSize / 8);
 
 	// First Pass
@@ -882,6 +883,9 @@ void* mVUcompile(microVU& mVU, u32 startPC, uptr pState)
 		}
 #endif
 
+		if constexpr (Perf::LineInfoEnabled)
+			perfLines.push_back({static_cast<u32>(x86Ptr - thisPtr), xPC});
+
 		if (mVUinfo.isEOB)
 		{
 			handleBadOp(mVU, x);
@@ -1005,9 +1009,9 @@ perf_and_return:
 	if (mVU.regs().start_pc == startPC)
 	{
 		if (mVU.index)
-			Perf::vu1.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC);
+			Perf::vu1.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC, perfLines);
 		else
-			Perf::vu0.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC);
+			Perf::vu0.RegisterPC(thisPtr, static_cast<u32>(x86Ptr - thisPtr), startPC, perfLines);
 	}
 
 	return thisPtr;
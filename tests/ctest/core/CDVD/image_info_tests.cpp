@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/CDVD/CDVD.h"
+#include "pcsx2/CDVD/CDVDcommon.h"
+#include "pcsx2/CDVD/IsoReader.h"
+#include "common/ByteSwap.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+static constexpr u32 SECTOR_SIZE = IsoReader::SECTOR_SIZE;
+static constexpr u32 PVD_SECTOR = 16;
+static constexpr u32 ROOT_SECTOR = 18;
+static constexpr u32 FILE_SECTOR = 19;
+static constexpr u32 SECTOR_COUNT = 20;
+
+static void SetBothEndian(u32* le, u32* be, u32 value)
+{
+	*le = value;
+	*be = ByteSwap(value);
+}
+
+static u32 AddDirectoryEntry(u8* sector, u32 offset, std::string_view name, u32 location, u32 length, bool directory)
+{
+	IsoReader::ISODirectoryEntry de = {};
+	de.entry_length = static_cast<u8>((sizeof(de) + name.size() + 1) & ~1u);
+	SetBothEndian(&de.location_le, &de.location_be, location);
+	SetBothEndian(&de.length_le, &de.length_be, length);
+	de.flags = directory ? IsoReader::ISODirectoryEntryFlag_Directory : static_cast<IsoReader::ISODirectoryEntryFlags>(0);
+	de.filename_length = static_cast<u8>(name.size());
+	std::memcpy(sector + offset, &de, sizeof(de));
+	std::memcpy(sector + offset + sizeof(de), name.data(), name.size());
+	return offset + de.entry_length;
+}
+
+/// Builds a minimal ISO9660 image with SYSTEM.CNF in the root directory.
+static std::vector<u8> BuildImage(std::string_view system_cnf)
+{
+	std::vector<u8> image(SECTOR_COUNT * SECTOR_SIZE);
+
+	IsoReader::ISOPrimaryVolumeDescriptor pvd = {};
+	pvd.header.type_code = 1;
+	std::memcpy(pvd.header.standard_identifier, "CD001", 5);
+	pvd.header.version = 1;
+	SetBothEndian(&pvd.total_sectors_le, &pvd.total_sectors_be, SECTOR_COUNT);
+	pvd.block_size_le = SECTOR_SIZE;
+	pvd.block_size_be = ByteSwap(static_cast<u16>(SECTOR_SIZE));
+	AddDirectoryEntry(pvd.root_directory_entry, 0, std::string_view("\0", 1), ROOT_SECTOR, SECTOR_SIZE, true);
+	std::memcpy(&image[PVD_SECTOR * SECTOR_SIZE], &pvd, sizeof(pvd));
+
+	IsoReader::ISOVolumeDescriptorHeader terminator = {255, {'C', 'D', '0', '0', '1'}, 1};
+	std::memcpy(&image[(PVD_SECTOR + 1) * SECTOR_SIZE], &terminator, sizeof(terminator));
+
+	u8* root = &image[ROOT_SECTOR * SECTOR_SIZE];
+	u32 offset = AddDirectoryEntry(root, 0, std::string_view("\0", 1), ROOT_SECTOR, SECTOR_SIZE, true);
+	offset = AddDirectoryEntry(root, offset, std::string_view("\1", 1), ROOT_SECTOR, SECTOR_SIZE, true);
+	AddDirectoryEntry(root, offset, "SYSTEM.CNF;1", FILE_SECTOR, static_cast<u32>(system_cnf.size()), false);
+
+	std::memcpy(&image[FILE_SECTOR * SECTOR_SIZE], system_cnf.data(), system_cnf.size());
+	return image;
+}
+
+static bool WriteImage(const std::string& path, std::string_view system_cnf)
+{
+	const std::vector<u8> image = BuildImage(system_cnf);
+	return FileSystem::WriteBinaryFile(path.c_str(), image.data(), image.size());
+}
+
+class ImageInfoTest : public ::testing::Test
+{
+protected:
+	static void SetUpTestSuite()
+	{
+		const std::string_view dir = Path::GetDirectory(FileSystem::GetProgramPath());
+		s_ps2_path = Path::Combine(dir, "image_info_test_ps2.iso");
+		s_ps1_path = Path::Combine(dir, "image_info_test_ps1.iso");
+		s_written = WriteImage(s_ps2_path, "BOOT2 = cdrom0:\\SLUS_123.45;1\r\nVER = 1.00\r\nVMODE = NTSC\r\n") &&
+					WriteImage(s_ps1_path, "BOOT = cdrom:\\SLPS_000.01;1\r\n");
+	}
+
+	static void TearDownTestSuite()
+	{
+		FileSystem::DeleteFilePath(s_ps2_path.c_str());
+		FileSystem::DeleteFilePath(s_ps1_path.c_str());
+	}
+
+	void SetUp() override { ASSERT_TRUE(s_written); }
+
+	static inline std::string s_ps2_path;
+	static inline std::string s_ps1_path;
+	static inline bool s_written = false;
+};
+
+TEST_F(ImageInfoTest, DetectsPS2Disc)
+{
+	s32 disc_type = 0;
+	std::string serial;
+	u32 crc = 1;
+	Error error;
+	ASSERT_TRUE(cdvdGetImageInfo(s_ps2_path, &disc_type, &serial, &crc, &error)) << error.GetDescription();
+	EXPECT_EQ(disc_type, CDVD_TYPE_PS2CD);
+	EXPECT_EQ(serial, "SLUS-12345");
+
+	// There's no executable to checksum.
+	EXPECT_EQ(crc, 0u);
+}
+
+TEST_F(ImageInfoTest, DetectsPS1Disc)
+{
+	s32 disc_type = 0;
+	std::string serial;
+	u32 crc = 0;
+	ASSERT_TRUE(cdvdGetImageInfo(s_ps1_path, &disc_type, &serial, &crc, nullptr));
+	EXPECT_EQ(disc_type, CDVD_TYPE_PSCD);
+	EXPECT_EQ(serial, "SLPS-00001");
+}
+
+TEST_F(ImageInfoTest, ConcurrentCallsAreIndependent)
+{
+	// The game list scanner calls this from several threads at once.
+	static constexpr u32 THREADS = 8;
+	static constexpr u32 ITERATIONS = 16;
+
+	std::vector<std::thread> threads;
+	std::vector<int> failures(THREADS, 0);
+	for (u32 i = 0; i < THREADS; i++)
+	{
+		threads.emplace_back([i, &failures]() {
+			const bool ps2 = (i % 2) == 0;
+			for (u32 j = 0; j < ITERATIONS; j++)
+			{
+				s32 disc_type = 0;
+				std::string serial;
+				u32 crc = 0;
+				if (!cdvdGetImageInfo(ps2 ? s_ps2_path : s_ps1_path, &disc_type, &serial, &crc, nullptr) ||
+					disc_type != (ps2 ? CDVD_TYPE_PS2CD : CDVD_TYPE_PSCD) || serial != (ps2 ? "SLUS-12345" : "SLPS-00001"))
+				{
+					failures[i]++;
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+
+	for (u32 i = 0; i < THREADS; i++)
+		EXPECT_EQ(failures[i], 0) << "thread " << i;
+}
+
+TEST_F(ImageInfoTest, MissingFileFails)
+{
+	s32 disc_type = 0;
+	std::string serial;
+	u32 crc = 0;
+	Error error;
+	EXPECT_FALSE(cdvdGetImageInfo(s_ps2_path + ".missing", &disc_type, &serial, &crc, &error));
+	EXPECT_TRUE(error.IsValid());
+}
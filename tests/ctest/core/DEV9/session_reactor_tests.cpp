@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/DEV9/Sessions/SessionReactor.h"
+#include "pcsx2/DEV9/PacketReader/Payload.h"
+#include "common/Timer.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Sessions;
+using namespace PacketReader;
+using namespace PacketReader::IP;
+
+static constexpr int NUM_SESSIONS = 256;
+static constexpr int MESSAGE_SIZE = 64;
+
+namespace
+{
+	// Accepts connections on loopback and echoes back anything it receives.
+	class EchoServer
+	{
+	public:
+		EchoServer()
+		{
+			m_listen = socket(AF_INET, SOCK_STREAM, 0);
+			sockaddr_in addr{};
+			addr.sin_family = AF_INET;
+			addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			socklen_t len = sizeof(addr);
+			if (bind(m_listen, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(m_listen, NUM_SESSIONS) != 0 ||
+				getsockname(m_listen, reinterpret_cast<sockaddr*>(&addr), &len) != 0)
+				return;
+
+			m_port = ntohs(addr.sin_port);
+			m_thread = std::thread(&EchoServer::Run, this);
+		}
+
+		~EchoServer()
+		{
+			m_stop.store(true);
+			if (m_thread.joinable())
+				m_thread.join();
+			for (const pollfd& pfd : m_fds)
+				close(pfd.fd);
+		}
+
+		u16 GetPort() const { return m_port; }
+
+	private:
+		void Run()
+		{
+			m_fds.push_back({m_listen, POLLIN, 0});
+			while (!m_stop.load())
+			{
+				if (poll(m_fds.data(), m_fds.size(), 10) <= 0)
+					continue;
+
+				const size_t count = m_fds.size();
+				for (size_t i = 0; i < count; i++)
+				{
+					if (!(m_fds[i].revents & POLLIN))
+						continue;
+
+					if (m_fds[i].fd == m_listen)
+					{
+						m_fds.push_back({accept(m_listen, nullptr, nullptr), POLLIN, 0});
+						continue;
+					}
+
+					char buffer[MESSAGE_SIZE * 4];
+					const ssize_t len = ::recv(m_fds[i].fd, buffer, sizeof(buffer), 0);
+					if (len > 0)
+						::send(m_fds[i].fd, buffer, len, 0);
+				}
+			}
+		}
+
+		int m_listen = -1;
+		u16 m_port = 0;
+		std::vector<pollfd> m_fds;
+		std::atomic_bool m_stop{false};
+		std::thread m_thread;
+	};
+
+	// Stands in for a TCP_Session, reading whatever the echo server sent back.
+	class LoopbackSession : public BaseSession
+	{
+	public:
+		LoopbackSession(u16 port)
+			: BaseSession({}, {})
+		{
+			m_socket = socket(AF_INET, SOCK_STREAM, 0);
+			sockaddr_in addr{};
+			addr.sin_family = AF_INET;
+			addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			addr.sin_port = htons(port);
+			connect(m_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+			fcntl(m_socket, F_SETFL, fcntl(m_socket, F_GETFL) | O_NONBLOCK);
+		}
+
+		~LoopbackSession() override { close(m_socket); }
+
+		std::optional<ReceivedPayload> Recv() override
+		{
+			recv_calls++;
+			std::unique_ptr<PayloadData> data = std::make_unique<PayloadData>(MESSAGE_SIZE);
+			const ssize_t len = ::recv(m_socket, data->data.get(), MESSAGE_SIZE, 0);
+			if (len <= 0)
+				return std::nullopt;
+
+			received += len;
+			return ReceivedPayload{{}, std::make_unique<IP_PayloadData>(static_cast<int>(len), 0)};
+		}
+
+		bool Send(IP_Payload* payload) override { return false; }
+		void Reset() override {}
+		SessionSocket GetPollSocket() override { return m_socket; }
+
+		void SendMessage()
+		{
+			char buffer[MESSAGE_SIZE] = {};
+			::send(m_socket, buffer, sizeof(buffer), 0);
+		}
+
+		// The old path, check the socket with select() before trying to read.
+		bool PollReadable() const
+		{
+			fd_set read_set;
+			FD_ZERO(&read_set);
+			FD_SET(m_socket, &read_set);
+			timeval nowait{};
+			return select(m_socket + 1, &read_set, nullptr, nullptr, &nowait) > 0;
+		}
+
+		int recv_calls = 0;
+		int received = 0;
+
+	private:
+		int m_socket = -1;
+	};
+
+	class SessionReactorTest : public testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			ASSERT_NE(server.GetPort(), 0);
+			for (int i = 0; i < NUM_SESSIONS; i++)
+				sessions.push_back(std::make_unique<LoopbackSession>(server.GetPort()));
+		}
+
+		void AddAll()
+		{
+			for (auto& session : sessions)
+				reactor.Add(session.get());
+
+			// Sessions are serviced once when added.
+			Drain();
+			for (auto& session : sessions)
+				session->recv_calls = 0;
+		}
+
+		// Services ready sessions like SocketAdapter::recv() does.
+		int Drain()
+		{
+			int serviced = 0;
+			reactor.Poll();
+			while (BaseSession* session = reactor.Next())
+			{
+				serviced++;
+				if (session->Recv().has_value())
+					reactor.Wake(session);
+			}
+			return serviced;
+		}
+
+		void WaitForEcho(LoopbackSession* session, int bytes)
+		{
+			Common::Timer timer;
+			while (session->received < bytes && timer.GetTimeSeconds() < 5.0)
+				Drain();
+		}
+
+		EchoServer server;
+		std::vector<std::unique_ptr<LoopbackSession>> sessions;
+		SessionReactor reactor;
+	};
+} // namespace
+
+TEST_F(SessionReactorTest, OnlyReadySessionsAreServiced)
+{
+	AddAll();
+
+	LoopbackSession* active = sessions[NUM_SESSIONS / 2].get();
+	active->SendMessage();
+	WaitForEcho(active, MESSAGE_SIZE);
+	EXPECT_EQ(active->received, MESSAGE_SIZE);
+
+	// Idle sessions only get looked at by the periodic sweep.
+	int idle_calls = 0;
+	for (auto& session : sessions)
+	{
+		if (session.get() != active)
+			idle_calls += session->recv_calls;
+	}
+	EXPECT_LT(idle_calls, NUM_SESSIONS);
+}
+
+TEST_F(SessionReactorTest, WakeQueuesSession)
+{
+	AddAll();
+
+	LoopbackSession* session = sessions[0].get();
+	reactor.Wake(session);
+	reactor.Wake(session);
+	EXPECT_EQ(reactor.Next(), session);
+	EXPECT_EQ(reactor.Next(), nullptr);
+}
+
+TEST_F(SessionReactorTest, RemovedSessionIsNotServiced)
+{
+	AddAll();
+
+	LoopbackSession* session = sessions[0].get();
+	reactor.Wake(session);
+	reactor.Remove(session);
+	EXPECT_EQ(reactor.Next(), nullptr);
+
+	session->SendMessage();
+	reactor.Wake(session);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	Drain();
+	EXPECT_EQ(session->recv_calls, 0);
+}
+
+TEST_F(SessionReactorTest, PayloadBuffersAreRecycled)
+{
+	{
+		PayloadData first(MESSAGE_SIZE);
+	}
+	const size_t free_count = PacketBufferPool::GetFreeCount();
+	{
+		PayloadData second(MESSAGE_SIZE);
+		EXPECT_EQ(PacketBufferPool::GetFreeCount(), free_count - 1);
+	}
+	EXPECT_EQ(PacketBufferPool::GetFreeCount(), free_count);
+}
+
+TEST_F(SessionReactorTest, OnlyReadySessionsAreChecked)
+{
+	static constexpr int ROUNDS = 500;
+
+	// Old path, every session is polled on every pass.
+	u64 polled_calls = 0;
+	for (int round = 0; round < ROUNDS; round++)
+	{
+		LoopbackSession* active = sessions[round % NUM_SESSIONS].get();
+		const int target = active->received + MESSAGE_SIZE;
+		active->SendMessage();
+		while (active->received < target)
+		{
+			for (auto& session : sessions)
+			{
+				polled_calls++;
+				if (session->PollReadable())
+					session->Recv();
+			}
+		}
+	}
+
+	AddAll();
+	u64 reactor_calls = 0;
+	for (int round = 0; round < ROUNDS; round++)
+	{
+		LoopbackSession* active = sessions[round % NUM_SESSIONS].get();
+		const int target = active->received + MESSAGE_SIZE;
+		active->SendMessage();
+		while (active->received < target)
+			reactor_calls += Drain();
+	}
+
+	EXPECT_LT(reactor_calls, polled_calls);
+}
+
+#endif
@@ -0,0 +1,1038 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/GS/Renderers/Common/GSDevice.h"
+#include "pcsx2/GS/Renderers/HW/GSStereoFilter.h"
+#include "pcsx2/GS/Renderers/HW/GSStereoTrace.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+// Every option the compiled filter reads.
+static bool Pcsx2Config::GSOptions::*const s_stereo_options[] = {
+	&Pcsx2Config::GSOptions::StereoRejectNonPositiveZ,
+	&Pcsx2Config::GSOptions::StereoRejectSmallZRange,
+	&Pcsx2Config::GSOptions::StereoRejectFst,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireRtaSourceCorrection,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireRtaCorrection,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAdjt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTfx,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectBlendMix,
+	&Pcsx2Config::GSOptions::StereoRejectRtaCorrection,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectBlendB,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectIip,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAutomaticLod,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireNoColor1,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireWms,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireWmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireLtf,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireShuffle,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectTcc,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectTfx,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAem,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireBlendB,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectProcessBa,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectProcessRg,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectShuffleAcross,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTextureShuffle,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectRtaSourceCorrection,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectColclipHw,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectColclip,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectPabe,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectFbMask,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectTexIsFb,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectNoColor,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectNoColor1,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAemFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectPalFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectDstFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectDepthFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAem,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectFba,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectFog,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectDate,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAtst,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAfail,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectFst,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectWms,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectWmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAdjs,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectLtf,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectShuffle,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectShuffleSame,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectReal16Src,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectWriteRg,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectBlendA,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectBlendC,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectBlendD,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectFixedOneA,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectBlendHw,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectAMasked,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectRoundInv,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectChannel,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectChannelFb,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectDither,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectDitherAdjust,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectZClamp,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectZFloor,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectTCOffsetHack,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectUrbanChaosHle,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectTalesOfAbyssHle,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectManualLod,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectPointSampler,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectRegionRect,
+	&Pcsx2Config::GSOptions::StereoUniversalRejectScanmask,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireColclipHw,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireColclip,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireBlendMix,
+	&Pcsx2Config::GSOptions::StereoUniversalRequirePabe,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFbMask,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTexIsFb,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireNoColor,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAemFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequirePalFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireDstFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireDepthFmt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFba,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFog,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireIip,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireDate,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAtst,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAfail,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFst,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTcc,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAdjs,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAdjt,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireShuffleSame,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireReal16Src,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireProcessBa,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireProcessRg,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireShuffleAcross,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireWriteRg,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireBlendA,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireBlendC,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireBlendD,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFixedOneA,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireBlendHw,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAMasked,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireRoundInv,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireChannel,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireChannelFb,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireDither,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireDitherAdjust,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireZClamp,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireZFloor,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTCOffsetHack,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireUrbanChaosHle,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTalesOfAbyssHle,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAutomaticLod,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireManualLod,
+	&Pcsx2Config::GSOptions::StereoUniversalRequirePointSampler,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireRegionRect,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireScanmask,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAlphaBlend,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAlphaTest,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireDatm,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireZTest,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireZWrite,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireZTestAlways,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireZTestNever,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireAa1,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireChannelShuffle,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFullscreenShuffle,
+	&Pcsx2Config::GSOptions::StereoUniversalRequirePoints,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireLines,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireTriangles,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireSprites,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFixedQ,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireFixedZ,
+	&Pcsx2Config::GSOptions::StereoUniversalRequireConstantColor,
+	&Pcsx2Config::GSOptions::StereoFixStencilShadows,
+	&Pcsx2Config::GSOptions::StereoRejectScalingDraw,
+	&Pcsx2Config::GSOptions::StereoRejectSbsInput,
+	&Pcsx2Config::GSOptions::StereoRejectTabInput,
+	&Pcsx2Config::GSOptions::StereoRejectSpriteBlit,
+	&Pcsx2Config::GSOptions::StereoRejectConstantColor,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoop,
+	&Pcsx2Config::GSOptions::StereoRejectFullscreenScissor,
+	&Pcsx2Config::GSOptions::StereoRejectFullscreenDraw,
+	&Pcsx2Config::GSOptions::StereoRejectFullCover,
+	&Pcsx2Config::GSOptions::StereoRejectScanmask,
+	&Pcsx2Config::GSOptions::StereoUiSafeDetect,
+	&Pcsx2Config::GSOptions::StereoUiAdvancedDetect,
+	&Pcsx2Config::GSOptions::StereoRejectZTestAlways,
+	&Pcsx2Config::GSOptions::StereoRequireZVaries,
+	&Pcsx2Config::GSOptions::StereoRejectFixedQ,
+	&Pcsx2Config::GSOptions::StereoStencilRequireZTestGequal,
+	&Pcsx2Config::GSOptions::StereoRejectUiLike,
+	&Pcsx2Config::GSOptions::StereoUiBackgroundDepth,
+	&Pcsx2Config::GSOptions::StereoRequirePerspectiveUV,
+	&Pcsx2Config::GSOptions::StereoRequireDepthActive,
+	&Pcsx2Config::GSOptions::StereoRejectSprites,
+	&Pcsx2Config::GSOptions::StereoRequireTextureMapping,
+	&Pcsx2Config::GSOptions::StereoRequireAlphaBlend,
+	&Pcsx2Config::GSOptions::StereoRequireAlphaTest,
+	&Pcsx2Config::GSOptions::StereoRequireUvVaries,
+	&Pcsx2Config::GSOptions::StereoRequireColorVaries,
+	&Pcsx2Config::GSOptions::StereoRequireFog,
+	&Pcsx2Config::GSOptions::StereoStencilRequireDate,
+	&Pcsx2Config::GSOptions::StereoStencilRequireDatm,
+	&Pcsx2Config::GSOptions::StereoStencilRequireAte,
+	&Pcsx2Config::GSOptions::StereoStencilRequireAfailZbOnly,
+	&Pcsx2Config::GSOptions::StereoStencilRequireAfailNotKeep,
+	&Pcsx2Config::GSOptions::StereoStencilRequireZWrite,
+	&Pcsx2Config::GSOptions::StereoStencilRequireZTest,
+	&Pcsx2Config::GSOptions::StereoStencilRequireFbMask,
+	&Pcsx2Config::GSOptions::StereoStencilRequireFbMaskFull,
+	&Pcsx2Config::GSOptions::StereoStencilRequireTexIsFb,
+	&Pcsx2Config::GSOptions::StereoRejectTexIsFb,
+	&Pcsx2Config::GSOptions::StereoRejectChannelShuffle,
+	&Pcsx2Config::GSOptions::StereoRejectTextureShuffle,
+	&Pcsx2Config::GSOptions::StereoRejectFullscreenShuffle,
+	&Pcsx2Config::GSOptions::StereoRejectShaderShuffle,
+	&Pcsx2Config::GSOptions::StereoRejectShuffleAcross,
+	&Pcsx2Config::GSOptions::StereoRejectShuffleSame,
+	&Pcsx2Config::GSOptions::StereoRejectChannelFetch,
+	&Pcsx2Config::GSOptions::StereoRejectChannelFetchFb,
+	&Pcsx2Config::GSOptions::StereoRejectColclip,
+	&Pcsx2Config::GSOptions::StereoRejectBlendMix,
+	&Pcsx2Config::GSOptions::StereoRejectPabe,
+	&Pcsx2Config::GSOptions::StereoRejectDither,
+	&Pcsx2Config::GSOptions::StereoRejectNoColorOutput,
+	&Pcsx2Config::GSOptions::StereoRejectHleShuffle,
+	&Pcsx2Config::GSOptions::StereoRejectTCOffsetHack,
+	&Pcsx2Config::GSOptions::StereoRejectPoints,
+	&Pcsx2Config::GSOptions::StereoRejectLines,
+	&Pcsx2Config::GSOptions::StereoRejectFlatShading,
+	&Pcsx2Config::GSOptions::StereoRejectAa1,
+	&Pcsx2Config::GSOptions::StereoRejectNoZTest,
+	&Pcsx2Config::GSOptions::StereoRejectNoZWrite,
+	&Pcsx2Config::GSOptions::StereoRejectZTestNever,
+	&Pcsx2Config::GSOptions::StereoRejectAlphaTestOff,
+	&Pcsx2Config::GSOptions::StereoRejectAlphaTestAlways,
+	&Pcsx2Config::GSOptions::StereoRejectAlphaTestNever,
+	&Pcsx2Config::GSOptions::StereoRejectTfxModulate,
+	&Pcsx2Config::GSOptions::StereoRejectTfxHighlight,
+	&Pcsx2Config::GSOptions::StereoRejectTfxHighlight2,
+	&Pcsx2Config::GSOptions::StereoRejectSmallDrawArea,
+	&Pcsx2Config::GSOptions::StereoRejectWideDrawBand,
+	&Pcsx2Config::GSOptions::StereoRejectTopDrawBand,
+	&Pcsx2Config::GSOptions::StereoRejectRtSpriteNoDepth,
+	&Pcsx2Config::GSOptions::StereoRejectRtSpriteAlphaBlend,
+	&Pcsx2Config::GSOptions::StereoRequireProcessTexture,
+	&Pcsx2Config::GSOptions::StereoRejectProcessTexture,
+	&Pcsx2Config::GSOptions::StereoRequireSourceFromTarget,
+	&Pcsx2Config::GSOptions::StereoRejectSourceFromTarget,
+	&Pcsx2Config::GSOptions::StereoRequireTexIsRt,
+	&Pcsx2Config::GSOptions::StereoRejectTexIsRt,
+	&Pcsx2Config::GSOptions::StereoRequireInTargetDraw,
+	&Pcsx2Config::GSOptions::StereoRejectInTargetDraw,
+	&Pcsx2Config::GSOptions::StereoRequireTempZ,
+	&Pcsx2Config::GSOptions::StereoRejectTempZ,
+	&Pcsx2Config::GSOptions::StereoRequireOneBarrier,
+	&Pcsx2Config::GSOptions::StereoRejectOneBarrier,
+	&Pcsx2Config::GSOptions::StereoRequireFullBarrier,
+	&Pcsx2Config::GSOptions::StereoRejectFullBarrier,
+	&Pcsx2Config::GSOptions::StereoRequireSinglePass,
+	&Pcsx2Config::GSOptions::StereoRejectSinglePass,
+	&Pcsx2Config::GSOptions::StereoRequireFullscreenDrawArea,
+	&Pcsx2Config::GSOptions::StereoRejectFullscreenDrawArea,
+	&Pcsx2Config::GSOptions::StereoRequireFullscreenSprite,
+	&Pcsx2Config::GSOptions::StereoRejectFullscreenSprite,
+	&Pcsx2Config::GSOptions::StereoRequireTexturedSprite,
+	&Pcsx2Config::GSOptions::StereoRejectTexturedSprite,
+	&Pcsx2Config::GSOptions::StereoRequireRtOutput,
+	&Pcsx2Config::GSOptions::StereoRejectRtOutput,
+	&Pcsx2Config::GSOptions::StereoRequireDepthOutput,
+	&Pcsx2Config::GSOptions::StereoRejectDepthOutput,
+	&Pcsx2Config::GSOptions::StereoRequireDepthRead,
+	&Pcsx2Config::GSOptions::StereoRejectDepthRead,
+	&Pcsx2Config::GSOptions::StereoRequireDepthWrite,
+	&Pcsx2Config::GSOptions::StereoRejectDepthWrite,
+	&Pcsx2Config::GSOptions::StereoRequirePalettedTexture,
+	&Pcsx2Config::GSOptions::StereoRejectPalettedTexture,
+	&Pcsx2Config::GSOptions::StereoRequireDepthTexture,
+	&Pcsx2Config::GSOptions::StereoRejectDepthTexture,
+	&Pcsx2Config::GSOptions::StereoRequireMipmap,
+	&Pcsx2Config::GSOptions::StereoRejectMipmap,
+	&Pcsx2Config::GSOptions::StereoRequireLinearSampling,
+	&Pcsx2Config::GSOptions::StereoRejectLinearSampling,
+	&Pcsx2Config::GSOptions::StereoRequireFmvActive,
+	&Pcsx2Config::GSOptions::StereoRejectFmvActive,
+	&Pcsx2Config::GSOptions::StereoRequireFmvHeuristic,
+	&Pcsx2Config::GSOptions::StereoRejectFmvHeuristic,
+	&Pcsx2Config::GSOptions::StereoRequireFmvSprite,
+	&Pcsx2Config::GSOptions::StereoRejectFmvSprite,
+	&Pcsx2Config::GSOptions::StereoRequireFmvSingleSprite,
+	&Pcsx2Config::GSOptions::StereoRejectFmvSingleSprite,
+	&Pcsx2Config::GSOptions::StereoRequireFmvTextureMapping,
+	&Pcsx2Config::GSOptions::StereoRejectFmvTextureMapping,
+	&Pcsx2Config::GSOptions::StereoRequireFmvProcessTexture,
+	&Pcsx2Config::GSOptions::StereoRejectFmvProcessTexture,
+	&Pcsx2Config::GSOptions::StereoRequireFmvFullscreenDrawArea,
+	&Pcsx2Config::GSOptions::StereoRejectFmvFullscreenDrawArea,
+	&Pcsx2Config::GSOptions::StereoRequireFmvFullscreenScissor,
+	&Pcsx2Config::GSOptions::StereoRejectFmvFullscreenScissor,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoAlphaBlend,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoAlphaBlend,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoAlphaTest,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoAlphaTest,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthTest,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthTest,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthWrite,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthWrite,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthOutput,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthOutput,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoDepthRead,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoDepthRead,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoFbMask,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoFbMask,
+	&Pcsx2Config::GSOptions::StereoRequireFmvColorOutput,
+	&Pcsx2Config::GSOptions::StereoRejectFmvColorOutput,
+	&Pcsx2Config::GSOptions::StereoRequireFmvSourceNotFromTarget,
+	&Pcsx2Config::GSOptions::StereoRejectFmvSourceNotFromTarget,
+	&Pcsx2Config::GSOptions::StereoRequireFmvDrawMatchesTex,
+	&Pcsx2Config::GSOptions::StereoRejectFmvDrawMatchesTex,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoShuffle,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoShuffle,
+	&Pcsx2Config::GSOptions::StereoRequireFmvNoMipmap,
+	&Pcsx2Config::GSOptions::StereoRejectFmvNoMipmap,
+	&Pcsx2Config::GSOptions::StereoRequireFmvLinearSampling,
+	&Pcsx2Config::GSOptions::StereoRejectFmvLinearSampling,
+	&Pcsx2Config::GSOptions::StereoRequireFmvEeUpload,
+	&Pcsx2Config::GSOptions::StereoRejectFmvEeUpload,
+	&Pcsx2Config::GSOptions::StereoRequireFmvDisplayMatch,
+	&Pcsx2Config::GSOptions::StereoRejectFmvDisplayMatch,
+	&Pcsx2Config::GSOptions::StereoRequireFmvRecentTransferDraw,
+	&Pcsx2Config::GSOptions::StereoRejectFmvRecentTransferDraw,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopAny,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopAny,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopShader,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopShader,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopDrawUsesTarget,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopDrawUsesTarget,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopTexIsRt,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopTexIsRt,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopSourceFromTarget,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopSourceFromTarget,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopInTargetDraw,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopInTargetDraw,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopTempZ,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopTempZ,
+	&Pcsx2Config::GSOptions::StereoRequireFeedbackLoopOverlapDrawRange,
+	&Pcsx2Config::GSOptions::StereoRejectFeedbackLoopOverlapDrawRange,
+	&Pcsx2Config::GSOptions::StereoMasterFixTest,
+	&Pcsx2Config::GSOptions::StereoEnableOptions,
+	&Pcsx2Config::GSOptions::StereoRejectSpriteNoGaps,
+	&Pcsx2Config::GSOptions::StereoRejectRegionRect,
+	&Pcsx2Config::GSOptions::StereoFeedbackLoopSourceFromTargetOnly,
+	&Pcsx2Config::GSOptions::StereoFeedbackLoopDisableStereo,
+	&Pcsx2Config::GSOptions::StereoMasterFix,
+	&Pcsx2Config::GSOptions::StereoMasterFix1,
+	&Pcsx2Config::GSOptions::StereoMasterFix2,
+	&Pcsx2Config::GSOptions::StereoMasterFix3,
+	&Pcsx2Config::GSOptions::StereoMasterFix4,
+	&Pcsx2Config::GSOptions::StereoMasterFix5,
+	&Pcsx2Config::GSOptions::StereoMasterFix6,
+	&Pcsx2Config::GSOptions::StereoMasterFix9,
+};
+
+// The per-draw option chain from GSRendererHW::DrawPrims, as it was before the filter existed.
+static bool ReferenceDisableStereoPass(const Pcsx2Config::GSOptions& cfg, const GSStereoFeatureWord& features)
+{
+	const auto F = [&features](GSStereoFeature feature) { return features.Get(feature); };
+	const bool feedback_loop_any = cfg.StereoFeedbackLoopSourceFromTargetOnly ?
+	                                   F(GSStereoFeature::SourceFromTarget) :
+	                                   F(GSStereoFeature::FeedbackLoopAnyRaw);
+
+	if (!cfg.StereoMasterFixTest)
+		return false;
+
+	bool disable = true;
+
+	if (cfg.StereoRejectNonPositiveZ) disable &= F(GSStereoFeature::NonPositiveZ);
+	if (cfg.StereoRejectSmallZRange) disable &= F(GSStereoFeature::SmallZRange);
+	if (cfg.StereoRejectFst) disable &= F(GSStereoFeature::PrimFst);
+	if (cfg.StereoUniversalRequireRtaSourceCorrection) disable &= F(GSStereoFeature::PsRtaSourceCorrection);
+	if (cfg.StereoUniversalRequireRtaCorrection) disable &= F(GSStereoFeature::PsRtaCorrection);
+	if (cfg.StereoUniversalRejectAdjt) disable &= !F(GSStereoFeature::PsAdjt);
+	if (cfg.StereoUniversalRequireTfx) disable &= F(GSStereoFeature::PsTfx);
+	if (cfg.StereoUniversalRejectBlendMix) disable &= !F(GSStereoFeature::PsBlendMix);
+	if (cfg.StereoRejectRtaCorrection) disable &= !F(GSStereoFeature::PsRtaCorrection);
+	if (cfg.StereoUniversalRejectBlendB) disable &= !F(GSStereoFeature::PsBlendB);
+	if (cfg.StereoUniversalRejectIip) disable &= !F(GSStereoFeature::PsIip);
+	if (cfg.StereoUniversalRejectAutomaticLod) disable &= !F(GSStereoFeature::PsAutomaticLod);
+	if (cfg.StereoUniversalRequireNoColor1) disable &= F(GSStereoFeature::PsNoColor1);
+	if (cfg.StereoUniversalRequireWms) disable &= F(GSStereoFeature::PsWms);
+	if (cfg.StereoUniversalRequireWmt) disable &= F(GSStereoFeature::PsWmt);
+	if (cfg.StereoUniversalRequireLtf) disable &= F(GSStereoFeature::PsLtf);
+	if (cfg.StereoUniversalRequireShuffle) disable &= F(GSStereoFeature::PsShuffle);
+	if (cfg.StereoUniversalRejectTcc) disable &= !F(GSStereoFeature::PsTcc);
+	if (cfg.StereoUniversalRejectTfx) disable &= !F(GSStereoFeature::PsTfx);
+	if (cfg.StereoUniversalRequireAem) disable &= F(GSStereoFeature::PsAem);
+	if (cfg.StereoUniversalRequireBlendB) disable &= F(GSStereoFeature::PsBlendB);
+	if (cfg.StereoUniversalRejectProcessBa) disable &= !F(GSStereoFeature::PsProcessBa);
+	if (cfg.StereoUniversalRejectProcessRg) disable &= !F(GSStereoFeature::PsProcessRg);
+	if (cfg.StereoUniversalRejectShuffleAcross) disable &= !F(GSStereoFeature::PsShuffleAcross);
+	if (cfg.StereoUniversalRequireTextureShuffle) disable &= F(GSStereoFeature::TextureShuffle);
+	if (cfg.StereoUniversalRejectRtaSourceCorrection) disable &= !F(GSStereoFeature::PsRtaSourceCorrection);
+	if (cfg.StereoUniversalRejectColclipHw) disable &= !F(GSStereoFeature::PsColclipHw);
+	if (cfg.StereoUniversalRejectColclip) disable &= !F(GSStereoFeature::PsColclip);
+	if (cfg.StereoUniversalRejectPabe) disable &= !F(GSStereoFeature::PsPabe);
+	if (cfg.StereoUniversalRejectFbMask) disable &= !F(GSStereoFeature::PsFbmask);
+	if (cfg.StereoUniversalRejectTexIsFb) disable &= !F(GSStereoFeature::PsTexIsFb);
+	if (cfg.StereoUniversalRejectNoColor) disable &= !F(GSStereoFeature::PsNoColor);
+	if (cfg.StereoUniversalRejectNoColor1) disable &= !F(GSStereoFeature::PsNoColor1);
+	if (cfg.StereoUniversalRejectAemFmt) disable &= !F(GSStereoFeature::PsAemFmt);
+	if (cfg.StereoUniversalRejectPalFmt) disable &= !F(GSStereoFeature::PsPalFmt);
+	if (cfg.StereoUniversalRejectDstFmt) disable &= !F(GSStereoFeature::PsDstFmt);
+	if (cfg.StereoUniversalRejectDepthFmt) disable &= !F(GSStereoFeature::PsDepthFmt);
+	if (cfg.StereoUniversalRejectAem) disable &= !F(GSStereoFeature::PsAem);
+	if (cfg.StereoUniversalRejectFba) disable &= !F(GSStereoFeature::PsFba);
+	if (cfg.StereoUniversalRejectFog) disable &= !F(GSStereoFeature::PsFog);
+	if (cfg.StereoUniversalRejectDate) disable &= !F(GSStereoFeature::PsDate);
+	if (cfg.StereoUniversalRejectAtst) disable &= !F(GSStereoFeature::PsAtst);
+	if (cfg.StereoUniversalRejectAfail) disable &= !F(GSStereoFeature::PsAfail);
+	if (cfg.StereoUniversalRejectFst) disable &= !F(GSStereoFeature::PsFst);
+	if (cfg.StereoUniversalRejectWms) disable &= !F(GSStereoFeature::PsWms);
+	if (cfg.StereoUniversalRejectWmt) disable &= !F(GSStereoFeature::PsWmt);
+	if (cfg.StereoUniversalRejectAdjs) disable &= !F(GSStereoFeature::PsAdjs);
+	if (cfg.StereoUniversalRejectLtf) disable &= !F(GSStereoFeature::PsLtf);
+	if (cfg.StereoUniversalRejectShuffle) disable &= !F(GSStereoFeature::PsShuffle);
+	if (cfg.StereoUniversalRejectShuffleSame) disable &= !F(GSStereoFeature::PsShuffleSame);
+	if (cfg.StereoUniversalRejectReal16Src) disable &= !F(GSStereoFeature::PsReal16Src);
+	if (cfg.StereoUniversalRejectWriteRg) disable &= !F(GSStereoFeature::PsWriteRg);
+	if (cfg.StereoUniversalRejectBlendA) disable &= !F(GSStereoFeature::PsBlendA);
+	if (cfg.StereoUniversalRejectBlendC) disable &= !F(GSStereoFeature::PsBlendC);
+	if (cfg.StereoUniversalRejectBlendD) disable &= !F(GSStereoFeature::PsBlendD);
+	if (cfg.StereoUniversalRejectFixedOneA) disable &= !F(GSStereoFeature::PsFixedOneA);
+	if (cfg.StereoUniversalRejectBlendHw) disable &= !F(GSStereoFeature::PsBlendHw);
+	if (cfg.StereoUniversalRejectAMasked) disable &= !F(GSStereoFeature::PsAMasked);
+	if (cfg.StereoUniversalRejectRoundInv) disable &= !F(GSStereoFeature::PsRoundInv);
+	if (cfg.StereoUniversalRejectChannel) disable &= !F(GSStereoFeature::PsChannel);
+	if (cfg.StereoUniversalRejectChannelFb) disable &= !F(GSStereoFeature::PsChannelFb);
+	if (cfg.StereoUniversalRejectDither) disable &= !F(GSStereoFeature::PsDither);
+	if (cfg.StereoUniversalRejectDitherAdjust) disable &= !F(GSStereoFeature::PsDitherAdjust);
+	if (cfg.StereoUniversalRejectZClamp) disable &= !F(GSStereoFeature::PsZClamp);
+	if (cfg.StereoUniversalRejectZFloor) disable &= !F(GSStereoFeature::PsZFloor);
+	if (cfg.StereoUniversalRejectTCOffsetHack) disable &= !F(GSStereoFeature::PsTCOffsetHack);
+	if (cfg.StereoUniversalRejectUrbanChaosHle) disable &= !F(GSStereoFeature::PsUrbanChaosHle);
+	if (cfg.StereoUniversalRejectTalesOfAbyssHle) disable &= !F(GSStereoFeature::PsTalesOfAbyssHle);
+	if (cfg.StereoUniversalRejectManualLod) disable &= !F(GSStereoFeature::PsManualLod);
+	if (cfg.StereoUniversalRejectPointSampler) disable &= !F(GSStereoFeature::PsPointSampler);
+	if (cfg.StereoUniversalRejectRegionRect) disable &= !F(GSStereoFeature::PsRegionRect);
+	if (cfg.StereoUniversalRejectScanmask) disable &= !F(GSStereoFeature::PsScanmask);
+	if (cfg.StereoUniversalRequireColclipHw) disable &= F(GSStereoFeature::PsColclipHw);
+	if (cfg.StereoUniversalRequireColclip) disable &= F(GSStereoFeature::PsColclip);
+	if (cfg.StereoUniversalRequireBlendMix) disable &= F(GSStereoFeature::PsBlendMix);
+	if (cfg.StereoUniversalRequirePabe) disable &= F(GSStereoFeature::PsPabe);
+	if (cfg.StereoUniversalRequireFbMask) disable &= F(GSStereoFeature::PsFbmask);
+	if (cfg.StereoUniversalRequireTexIsFb) disable &= F(GSStereoFeature::PsTexIsFb);
+	if (cfg.StereoUniversalRequireNoColor) disable &= F(GSStereoFeature::PsNoColor);
+	if (cfg.StereoUniversalRequireAemFmt) disable &= F(GSStereoFeature::PsAemFmt);
+	if (cfg.StereoUniversalRequirePalFmt) disable &= F(GSStereoFeature::PsPalFmt);
+	if (cfg.StereoUniversalRequireDstFmt) disable &= F(GSStereoFeature::PsDstFmt);
+	if (cfg.StereoUniversalRequireDepthFmt) disable &= F(GSStereoFeature::PsDepthFmt);
+	if (cfg.StereoUniversalRequireFba) disable &= F(GSStereoFeature::PsFba);
+	if (cfg.StereoUniversalRequireFog) disable &= F(GSStereoFeature::PsFog);
+	if (cfg.StereoUniversalRequireIip) disable &= F(GSStereoFeature::PsIip);
+	if (cfg.StereoUniversalRequireDate) disable &= F(GSStereoFeature::PsDate);
+	if (cfg.StereoUniversalRequireAtst) disable &= F(GSStereoFeature::PsAtst);
+	if (cfg.StereoUniversalRequireAfail) disable &= F(GSStereoFeature::PsAfail);
+	if (cfg.StereoUniversalRequireFst) disable &= F(GSStereoFeature::PsFst);
+	if (cfg.StereoUniversalRequireTcc) disable &= F(GSStereoFeature::PsTcc);
+	if (cfg.StereoUniversalRequireAdjs) disable &= F(GSStereoFeature::PsAdjs);
+	if (cfg.StereoUniversalRequireAdjt) disable &= F(GSStereoFeature::PsAdjt);
+	if (cfg.StereoUniversalRequireShuffleSame) disable &= F(GSStereoFeature::PsShuffleSame);
+	if (cfg.StereoUniversalRequireReal16Src) disable &= F(GSStereoFeature::PsReal16Src);
+	if (cfg.StereoUniversalRequireProcessBa) disable &= F(GSStereoFeature::PsProcessBa);
+	if (cfg.StereoUniversalRequireProcessRg) disable &= F(GSStereoFeature::PsProcessRg);
+	if (cfg.StereoUniversalRequireShuffleAcross) disable &= F(GSStereoFeature::PsShuffleAcross);
+	if (cfg.StereoUniversalRequireWriteRg) disable &= F(GSStereoFeature::PsWriteRg);
+	if (cfg.StereoUniversalRequireBlendA) disable &= F(GSStereoFeature::PsBlendA);
+	if (cfg.StereoUniversalRequireBlendC) disable &= F(GSStereoFeature::PsBlendC);
+	if (cfg.StereoUniversalRequireBlendD) disable &= F(GSStereoFeature::PsBlendD);
+	if (cfg.StereoUniversalRequireFixedOneA) disable &= F(GSStereoFeature::PsFixedOneA);
+	if (cfg.StereoUniversalRequireBlendHw) disable &= F(GSStereoFeature::PsBlendHw);
+	if (cfg.StereoUniversalRequireAMasked) disable &= F(GSStereoFeature::PsAMasked);
+	if (cfg.StereoUniversalRequireRoundInv) disable &= F(GSStereoFeature::PsRoundInv);
+	if (cfg.StereoUniversalRequireChannel) disable &= F(GSStereoFeature::PsChannel);
+	if (cfg.StereoUniversalRequireChannelFb) disable &= F(GSStereoFeature::PsChannelFb);
+	if (cfg.StereoUniversalRequireDither) disable &= F(GSStereoFeature::PsDither);
+	if (cfg.StereoUniversalRequireDitherAdjust) disable &= F(GSStereoFeature::PsDitherAdjust);
+	if (cfg.StereoUniversalRequireZClamp) disable &= F(GSStereoFeature::PsZClamp);
+	if (cfg.StereoUniversalRequireZFloor) disable &= F(GSStereoFeature::PsZFloor);
+	if (cfg.StereoUniversalRequireTCOffsetHack) disable &= F(GSStereoFeature::PsTCOffsetHack);
+	if (cfg.StereoUniversalRequireUrbanChaosHle) disable &= F(GSStereoFeature::PsUrbanChaosHle);
+	if (cfg.StereoUniversalRequireTalesOfAbyssHle) disable &= F(GSStereoFeature::PsTalesOfAbyssHle);
+	if (cfg.StereoUniversalRequireAutomaticLod) disable &= F(GSStereoFeature::PsAutomaticLod);
+	if (cfg.StereoUniversalRequireManualLod) disable &= F(GSStereoFeature::PsManualLod);
+	if (cfg.StereoUniversalRequirePointSampler) disable &= F(GSStereoFeature::PsPointSampler);
+	if (cfg.StereoUniversalRequireRegionRect) disable &= F(GSStereoFeature::PsRegionRect);
+	if (cfg.StereoUniversalRequireScanmask) disable &= F(GSStereoFeature::PsScanmask);
+	if (cfg.StereoUniversalRequireAlphaBlend) disable &= F(GSStereoFeature::PrimAbe);
+	if (cfg.StereoUniversalRequireAlphaTest) disable &= F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoUniversalRequireDatm) disable &= F(GSStereoFeature::DestAlphaMode);
+	if (cfg.StereoUniversalRequireZTest) disable &= F(GSStereoFeature::ZTest);
+	if (cfg.StereoUniversalRequireZWrite) disable &= !F(GSStereoFeature::ZMask);
+	if (cfg.StereoUniversalRequireZTestAlways) disable &= F(GSStereoFeature::ZTestAlways);
+	if (cfg.StereoUniversalRequireZTestNever) disable &= F(GSStereoFeature::ZTestNever);
+	if (cfg.StereoUniversalRequireAa1) disable &= F(GSStereoFeature::PrimAa1);
+	if (cfg.StereoUniversalRequireChannelShuffle) disable &= F(GSStereoFeature::ChannelShuffle);
+	if (cfg.StereoUniversalRequireFullscreenShuffle) disable &= F(GSStereoFeature::FullScreenShuffle);
+	if (cfg.StereoUniversalRequirePoints) disable &= F(GSStereoFeature::PrimPoint);
+	if (cfg.StereoUniversalRequireLines) disable &= F(GSStereoFeature::PrimLine);
+	if (cfg.StereoUniversalRequireTriangles) disable &= F(GSStereoFeature::PrimTriangle);
+	if (cfg.StereoUniversalRequireSprites) disable &= F(GSStereoFeature::ZTestAlwaysZEqual);
+	if (cfg.StereoUniversalRequireFixedQ) disable &= F(GSStereoFeature::TfxDecal);
+	if (cfg.StereoUniversalRequireFixedZ) disable &= !F(GSStereoFeature::TfxDecal);
+	if (cfg.StereoUniversalRequireConstantColor) disable &= !F(GSStereoFeature::DecalNoRegionRect);
+	if (cfg.StereoFixStencilShadows) disable &= F(GSStereoFeature::StencilShadow);
+	if (cfg.StereoRejectScalingDraw) disable &= F(GSStereoFeature::ScalingDraw);
+	if (cfg.StereoRejectSbsInput) disable &= F(GSStereoFeature::SbsInput);
+	if (cfg.StereoRejectTabInput) disable &= F(GSStereoFeature::TabInput);
+	if (cfg.StereoRejectNonPositiveZ) disable &= F(GSStereoFeature::NonPositiveZ);
+	if (cfg.StereoRejectSmallZRange) disable &= F(GSStereoFeature::SmallZRange);
+	if (cfg.StereoRejectSpriteBlit) disable &= F(GSStereoFeature::SpriteBlit);
+	if (cfg.StereoRejectConstantColor) disable &= F(GSStereoFeature::ConstantColor);
+	if (cfg.StereoRejectFeedbackLoop) disable &= F(GSStereoFeature::PsFeedbackLoop);
+	if (cfg.StereoRejectSpriteNoGaps) disable &= F(GSStereoFeature::SpriteNoGaps) || (cfg.StereoRejectRegionRect && F(GSStereoFeature::PsRegionRect));
+	if (cfg.StereoRejectFullscreenScissor) disable &= !F(GSStereoFeature::FullscreenScissor);
+	if (cfg.StereoRejectFullscreenDraw) disable &= F(GSStereoFeature::FullscreenDraw);
+	if (cfg.StereoRejectFullCover) disable &= F(GSStereoFeature::FullCover);
+	if (cfg.StereoRejectScanmask) disable &= F(GSStereoFeature::PsScanmask);
+	if (cfg.StereoUiSafeDetect) disable &= F(GSStereoFeature::UiSafeDetect);
+	if (cfg.StereoUiAdvancedDetect) disable &= F(GSStereoFeature::UiAdvancedDetect);
+	if (cfg.StereoRejectZTestAlways) disable &= F(GSStereoFeature::ZTestAlways);
+	if (cfg.StereoRequireZVaries) disable &= F(GSStereoFeature::ZEqual);
+	if (cfg.StereoRejectFixedQ) disable &= F(GSStereoFeature::QEqual);
+	if (cfg.StereoStencilRequireZTestGequal) disable &= !F(GSStereoFeature::ZTestGreater);
+	if (cfg.StereoRejectUiLike) disable &= F(GSStereoFeature::UiLike);
+	if (cfg.StereoUiBackgroundDepth) disable &= F(GSStereoFeature::UiBackgroundDepth);
+	if (cfg.StereoRequirePerspectiveUV) disable &= !F(GSStereoFeature::PerspectiveUV);
+	if (cfg.StereoRequireDepthActive) disable &= !F(GSStereoFeature::DepthActive);
+	if (cfg.StereoRejectSprites) disable &= F(GSStereoFeature::PrimSprite);
+	if (cfg.StereoRequireTextureMapping) disable &= !F(GSStereoFeature::PrimTme);
+	if (cfg.StereoRequireAlphaBlend) disable &= !F(GSStereoFeature::PrimAbe);
+	if (cfg.StereoRequireAlphaTest) disable &= !F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoRequireUvVaries) disable &= F(GSStereoFeature::STEqual);
+	if (cfg.StereoRequireColorVaries) disable &= F(GSStereoFeature::RGBAEqualAny);
+	if (cfg.StereoRequireFog) disable &= !F(GSStereoFeature::PrimFge);
+	if (cfg.StereoStencilRequireDate) disable &= !F(GSStereoFeature::DestAlphaTest);
+	if (cfg.StereoStencilRequireDatm) disable &= !F(GSStereoFeature::DestAlphaMode);
+	if (cfg.StereoStencilRequireAte) disable &= !F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoStencilRequireAfailZbOnly) disable &= !F(GSStereoFeature::AfailZbOnly);
+	if (cfg.StereoStencilRequireAfailNotKeep) disable &= !F(GSStereoFeature::AfailNotKeep);
+	if (cfg.StereoStencilRequireZWrite) disable &= F(GSStereoFeature::ZMask);
+	if (cfg.StereoStencilRequireZTest) disable &= !F(GSStereoFeature::ZTest);
+	if (cfg.StereoStencilRequireFbMask) disable &= !F(GSStereoFeature::FbMask);
+	if (cfg.StereoStencilRequireFbMaskFull) disable &= !F(GSStereoFeature::FbMaskFull);
+	if (cfg.StereoStencilRequireTexIsFb) disable &= !F(GSStereoFeature::PsTexIsFb);
+	if (cfg.StereoRejectTexIsFb) disable &= F(GSStereoFeature::PsTexIsFb);
+	if (cfg.StereoRejectChannelShuffle) disable &= F(GSStereoFeature::ChannelShuffle);
+	if (cfg.StereoRejectTextureShuffle) disable &= F(GSStereoFeature::TextureShuffle);
+	if (cfg.StereoRejectFullscreenShuffle) disable &= F(GSStereoFeature::FullScreenShuffle);
+	if (cfg.StereoRejectShaderShuffle) disable &= F(GSStereoFeature::PsShuffle);
+	if (cfg.StereoRejectShuffleAcross) disable &= F(GSStereoFeature::PsShuffleAcross);
+	if (cfg.StereoRejectShuffleSame) disable &= F(GSStereoFeature::PsShuffleSame);
+	if (cfg.StereoRejectChannelFetch) disable &= F(GSStereoFeature::PsChannel);
+	if (cfg.StereoRejectChannelFetchFb) disable &= F(GSStereoFeature::PsChannelFb);
+	if (cfg.StereoRejectColclip) disable &= F(GSStereoFeature::ColclipAny);
+	if (cfg.StereoRejectBlendMix) disable &= F(GSStereoFeature::PsBlendMix);
+	if (cfg.StereoRejectPabe) disable &= F(GSStereoFeature::PsPabe);
+	if (cfg.StereoRejectDither) disable &= F(GSStereoFeature::PsDither);
+	if (cfg.StereoRejectNoColorOutput) disable &= F(GSStereoFeature::NoColorOutput);
+	if (cfg.StereoRejectHleShuffle) disable &= F(GSStereoFeature::HleShuffle);
+	if (cfg.StereoRejectTCOffsetHack) disable &= F(GSStereoFeature::PsTCOffsetHack);
+	if (cfg.StereoRejectPoints) disable &= F(GSStereoFeature::PrimPoint);
+	if (cfg.StereoRejectLines) disable &= F(GSStereoFeature::PrimLine);
+	if (cfg.StereoRejectFlatShading) disable &= !F(GSStereoFeature::PsIip);
+	if (cfg.StereoRejectAa1) disable &= F(GSStereoFeature::PrimAa1);
+	if (cfg.StereoRejectNoZTest) disable &= !F(GSStereoFeature::ZTest);
+	if (cfg.StereoRejectNoZWrite) disable &= F(GSStereoFeature::ZMask);
+	if (cfg.StereoRejectZTestNever) disable &= F(GSStereoFeature::ZTestNever);
+	if (cfg.StereoRejectAlphaTestOff) disable &= !F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoRejectAlphaTestAlways) disable &= F(GSStereoFeature::AlphaTestAlways);
+	if (cfg.StereoRejectAlphaTestNever) disable &= F(GSStereoFeature::AlphaTestNever);
+	if (cfg.StereoRejectTfxModulate) disable &= F(GSStereoFeature::TfxModulate);
+	if (cfg.StereoRejectTfxHighlight) disable &= F(GSStereoFeature::TfxHighlight);
+	if (cfg.StereoRejectTfxHighlight2) disable &= F(GSStereoFeature::TfxHighlight2);
+	if (cfg.StereoRejectSmallDrawArea) disable &= F(GSStereoFeature::SmallDrawArea);
+	if (cfg.StereoRejectWideDrawBand) disable &= F(GSStereoFeature::WideDrawBand);
+	if (cfg.StereoRejectTopDrawBand) disable &= F(GSStereoFeature::TopDrawBand);
+	if (cfg.StereoRejectRtSpriteNoDepth) disable &= F(GSStereoFeature::RtSpriteNoDepth);
+	if (cfg.StereoRejectRtSpriteAlphaBlend) disable &= F(GSStereoFeature::RtSpriteAlphaBlend);
+	if (cfg.StereoRequireProcessTexture) disable &= !F(GSStereoFeature::ProcessTexture);
+	if (cfg.StereoRejectProcessTexture) disable &= F(GSStereoFeature::ProcessTexture);
+	if (cfg.StereoRequireSourceFromTarget) disable &= !F(GSStereoFeature::SourceFromTarget);
+	if (cfg.StereoRejectSourceFromTarget) disable &= F(GSStereoFeature::SourceFromTarget);
+	if (cfg.StereoRequireTexIsRt) disable &= !F(GSStereoFeature::TexIsRt);
+	if (cfg.StereoRejectTexIsRt) disable &= F(GSStereoFeature::TexIsRt);
+	if (cfg.StereoRequireInTargetDraw) disable &= !F(GSStereoFeature::InTargetDraw);
+	if (cfg.StereoRejectInTargetDraw) disable &= F(GSStereoFeature::InTargetDraw);
+	if (cfg.StereoRequireTempZ) disable &= !F(GSStereoFeature::TempZ);
+	if (cfg.StereoRejectTempZ) disable &= F(GSStereoFeature::TempZ);
+	if (cfg.StereoRequireOneBarrier) disable &= !F(GSStereoFeature::OneBarrier);
+	if (cfg.StereoRejectOneBarrier) disable &= F(GSStereoFeature::OneBarrier);
+	if (cfg.StereoRequireFullBarrier) disable &= !F(GSStereoFeature::FullBarrier);
+	if (cfg.StereoRejectFullBarrier) disable &= F(GSStereoFeature::FullBarrier);
+	if (cfg.StereoRequireSinglePass) disable &= !F(GSStereoFeature::SinglePass);
+	if (cfg.StereoRejectSinglePass) disable &= F(GSStereoFeature::SinglePass);
+	if (cfg.StereoRequireFullscreenDrawArea) disable &= !F(GSStereoFeature::FullscreenDrawArea);
+	if (cfg.StereoRejectFullscreenDrawArea) disable &= F(GSStereoFeature::FullscreenDrawArea);
+	if (cfg.StereoRequireFullscreenSprite) disable &= !F(GSStereoFeature::FullscreenSprite);
+	if (cfg.StereoRejectFullscreenSprite) disable &= F(GSStereoFeature::FullscreenSprite);
+	if (cfg.StereoRequireTexturedSprite) disable &= !F(GSStereoFeature::TexturedSprite);
+	if (cfg.StereoRejectTexturedSprite) disable &= F(GSStereoFeature::TexturedSprite);
+	if (cfg.StereoRequireRtOutput) disable &= !F(GSStereoFeature::RtOutput);
+	if (cfg.StereoRejectRtOutput) disable &= F(GSStereoFeature::RtOutput);
+	if (cfg.StereoRequireDepthOutput) disable &= !F(GSStereoFeature::DepthOutput);
+	if (cfg.StereoRejectDepthOutput) disable &= F(GSStereoFeature::DepthOutput);
+	if (cfg.StereoRequireDepthRead) disable &= !F(GSStereoFeature::DepthRead);
+	if (cfg.StereoRejectDepthRead) disable &= F(GSStereoFeature::DepthRead);
+	if (cfg.StereoRequireDepthWrite) disable &= !F(GSStereoFeature::DepthWrite);
+	if (cfg.StereoRejectDepthWrite) disable &= F(GSStereoFeature::DepthWrite);
+	if (cfg.StereoRequirePalettedTexture) disable &= !F(GSStereoFeature::PalettedTexture);
+	if (cfg.StereoRejectPalettedTexture) disable &= F(GSStereoFeature::PalettedTexture);
+	if (cfg.StereoRequireDepthTexture) disable &= !F(GSStereoFeature::DepthTexture);
+	if (cfg.StereoRejectDepthTexture) disable &= F(GSStereoFeature::DepthTexture);
+	if (cfg.StereoRequireMipmap) disable &= !F(GSStereoFeature::Mipmap);
+	if (cfg.StereoRejectMipmap) disable &= F(GSStereoFeature::Mipmap);
+	if (cfg.StereoRequireLinearSampling) disable &= !F(GSStereoFeature::LinearSampling);
+	if (cfg.StereoRejectLinearSampling) disable &= F(GSStereoFeature::LinearSampling);
+	if (cfg.StereoRequireFmvActive) disable &= !F(GSStereoFeature::FmvActive);
+	if (cfg.StereoRejectFmvActive) disable &= F(GSStereoFeature::FmvActive);
+	if (cfg.StereoRequireFmvHeuristic) disable &= !F(GSStereoFeature::FmvHeuristic);
+	if (cfg.StereoRejectFmvHeuristic) disable &= F(GSStereoFeature::FmvHeuristic);
+	if (cfg.StereoRequireFmvSprite) disable &= !F(GSStereoFeature::PrimSprite);
+	if (cfg.StereoRejectFmvSprite) disable &= F(GSStereoFeature::PrimSprite);
+	if (cfg.StereoRequireFmvSingleSprite) disable &= !F(GSStereoFeature::SingleSprite);
+	if (cfg.StereoRejectFmvSingleSprite) disable &= F(GSStereoFeature::SingleSprite);
+	if (cfg.StereoRequireFmvTextureMapping) disable &= !F(GSStereoFeature::PrimTme);
+	if (cfg.StereoRejectFmvTextureMapping) disable &= F(GSStereoFeature::PrimTme);
+	if (cfg.StereoRequireFmvProcessTexture) disable &= !F(GSStereoFeature::ProcessTexture);
+	if (cfg.StereoRejectFmvProcessTexture) disable &= F(GSStereoFeature::ProcessTexture);
+	if (cfg.StereoRequireFmvFullscreenDrawArea) disable &= !F(GSStereoFeature::FullscreenDrawArea);
+	if (cfg.StereoRejectFmvFullscreenDrawArea) disable &= F(GSStereoFeature::FullscreenDrawArea);
+	if (cfg.StereoRequireFmvFullscreenScissor) disable &= !F(GSStereoFeature::FullscreenScissor);
+	if (cfg.StereoRejectFmvFullscreenScissor) disable &= F(GSStereoFeature::FullscreenScissor);
+	if (cfg.StereoRequireFmvNoAlphaBlend) disable &= F(GSStereoFeature::PrimAbe);
+	if (cfg.StereoRejectFmvNoAlphaBlend) disable &= !F(GSStereoFeature::PrimAbe);
+	if (cfg.StereoRequireFmvNoAlphaTest) disable &= F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoRejectFmvNoAlphaTest) disable &= !F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoRequireFmvNoDepthTest) disable &= F(GSStereoFeature::ZTest);
+	if (cfg.StereoRejectFmvNoDepthTest) disable &= !F(GSStereoFeature::ZTest);
+	if (cfg.StereoRequireFmvNoDepthWrite) disable &= !F(GSStereoFeature::ZMask);
+	if (cfg.StereoRejectFmvNoDepthWrite) disable &= F(GSStereoFeature::ZMask);
+	if (cfg.StereoRequireFmvNoDepthOutput) disable &= F(GSStereoFeature::DepthOutput);
+	if (cfg.StereoRejectFmvNoDepthOutput) disable &= !F(GSStereoFeature::DepthOutput);
+	if (cfg.StereoRequireFmvNoDepthRead) disable &= F(GSStereoFeature::DepthRead);
+	if (cfg.StereoRejectFmvNoDepthRead) disable &= !F(GSStereoFeature::DepthRead);
+	if (cfg.StereoRequireFmvNoFbMask) disable &= F(GSStereoFeature::FbMask);
+	if (cfg.StereoRejectFmvNoFbMask) disable &= !F(GSStereoFeature::FbMask);
+	if (cfg.StereoRequireFmvColorOutput) disable &= F(GSStereoFeature::NoColorOutput);
+	if (cfg.StereoRejectFmvColorOutput) disable &= !F(GSStereoFeature::NoColorOutput);
+	if (cfg.StereoRequireFmvSourceNotFromTarget) disable &= F(GSStereoFeature::SourceFromTarget);
+	if (cfg.StereoRejectFmvSourceNotFromTarget) disable &= !F(GSStereoFeature::SourceFromTarget);
+	if (cfg.StereoRequireFmvDrawMatchesTex) disable &= !F(GSStereoFeature::FmvDrawMatchesTex);
+	if (cfg.StereoRejectFmvDrawMatchesTex) disable &= F(GSStereoFeature::FmvDrawMatchesTex);
+	if (cfg.StereoRequireFmvNoShuffle) disable &= !F(GSStereoFeature::NoShuffle);
+	if (cfg.StereoRejectFmvNoShuffle) disable &= F(GSStereoFeature::NoShuffle);
+	if (cfg.StereoRequireFmvNoMipmap) disable &= F(GSStereoFeature::Mipmap);
+	if (cfg.StereoRejectFmvNoMipmap) disable &= !F(GSStereoFeature::Mipmap);
+	if (cfg.StereoRequireFmvLinearSampling) disable &= !F(GSStereoFeature::LinearSampling);
+	if (cfg.StereoRejectFmvLinearSampling) disable &= F(GSStereoFeature::LinearSampling);
+	if (cfg.StereoRequireFmvEeUpload) disable &= !F(GSStereoFeature::FmvEeUpload);
+	if (cfg.StereoRejectFmvEeUpload) disable &= F(GSStereoFeature::FmvEeUpload);
+	if (cfg.StereoRequireFmvDisplayMatch) disable &= !F(GSStereoFeature::FmvDisplayMatch);
+	if (cfg.StereoRejectFmvDisplayMatch) disable &= F(GSStereoFeature::FmvDisplayMatch);
+	if (cfg.StereoRequireFmvRecentTransferDraw) disable &= !F(GSStereoFeature::FmvRecentTransferDraw);
+	if (cfg.StereoRejectFmvRecentTransferDraw) disable &= F(GSStereoFeature::FmvRecentTransferDraw);
+	if (cfg.StereoRequireFeedbackLoopAny) disable &= !feedback_loop_any;
+	if (cfg.StereoRejectFeedbackLoopAny) disable &= feedback_loop_any;
+	if (cfg.StereoRequireFeedbackLoopShader) disable &= !F(GSStereoFeature::PsFeedbackLoop);
+	if (cfg.StereoRejectFeedbackLoopShader) disable &= F(GSStereoFeature::PsFeedbackLoop);
+	if (cfg.StereoRequireFeedbackLoopDrawUsesTarget) disable &= !F(GSStereoFeature::DrawUsesTarget);
+	if (cfg.StereoRejectFeedbackLoopDrawUsesTarget) disable &= F(GSStereoFeature::DrawUsesTarget);
+	if (cfg.StereoRequireFeedbackLoopTexIsRt) disable &= !F(GSStereoFeature::TexIsRt);
+	if (cfg.StereoRejectFeedbackLoopTexIsRt) disable &= F(GSStereoFeature::TexIsRt);
+	if (cfg.StereoRequireFeedbackLoopSourceFromTarget) disable &= !F(GSStereoFeature::SourceFromTarget);
+	if (cfg.StereoRejectFeedbackLoopSourceFromTarget) disable &= F(GSStereoFeature::SourceFromTarget);
+	if (cfg.StereoRequireFeedbackLoopInTargetDraw) disable &= !F(GSStereoFeature::InTargetDraw);
+	if (cfg.StereoRejectFeedbackLoopInTargetDraw) disable &= F(GSStereoFeature::InTargetDraw);
+	if (cfg.StereoRequireFeedbackLoopTempZ) disable &= !F(GSStereoFeature::TempZ);
+	if (cfg.StereoRejectFeedbackLoopTempZ) disable &= F(GSStereoFeature::TempZ);
+	if (cfg.StereoRequireFeedbackLoopOverlapDrawRange) disable &= !F(GSStereoFeature::DrawUsesTarget);
+	if (cfg.StereoRejectFeedbackLoopOverlapDrawRange) disable &= F(GSStereoFeature::DrawUsesTarget);
+	if (cfg.StereoFeedbackLoopDisableStereo && feedback_loop_any) disable = true;
+
+	if (!cfg.StereoEnableOptions)
+		return disable;
+
+	bool double_image_fix = false;
+	if (cfg.StereoUniversalRejectBlendMix) double_image_fix |= !F(GSStereoFeature::PsBlendMix);
+	if (cfg.StereoRejectRtaCorrection) double_image_fix |= !F(GSStereoFeature::PsRtaCorrection);
+	if (cfg.StereoUniversalRejectBlendB) double_image_fix |= !F(GSStereoFeature::PsBlendB);
+	if (cfg.StereoUniversalRejectIip) double_image_fix |= !F(GSStereoFeature::PsIip);
+	if (cfg.StereoUniversalRejectAutomaticLod) double_image_fix |= !F(GSStereoFeature::PsAutomaticLod);
+	if (cfg.StereoUniversalRequireNoColor1) double_image_fix |= F(GSStereoFeature::PsNoColor1);
+	if (cfg.StereoUniversalRequireWms) double_image_fix |= F(GSStereoFeature::PsWms);
+	if (cfg.StereoUniversalRequireWmt) double_image_fix |= F(GSStereoFeature::PsWmt);
+	if (cfg.StereoUniversalRequireLtf) double_image_fix |= F(GSStereoFeature::PsLtf);
+	if (cfg.StereoUniversalRequireShuffle) double_image_fix |= F(GSStereoFeature::PsShuffle);
+	if (cfg.StereoUniversalRejectTcc) double_image_fix |= !F(GSStereoFeature::PsTcc);
+	if (cfg.StereoUniversalRejectTfx) double_image_fix |= !F(GSStereoFeature::PsTfx);
+	if (cfg.StereoUniversalRequireAem) double_image_fix |= F(GSStereoFeature::PsAem);
+	if (cfg.StereoUniversalRequireBlendB) double_image_fix |= F(GSStereoFeature::PsBlendB);
+	if (cfg.StereoUniversalRejectProcessBa) double_image_fix |= !F(GSStereoFeature::PsProcessBa);
+	if (cfg.StereoUniversalRejectProcessRg) double_image_fix |= !F(GSStereoFeature::PsProcessRg);
+	if (cfg.StereoUniversalRejectShuffleAcross) double_image_fix |= !F(GSStereoFeature::PsShuffleAcross);
+	if (cfg.StereoUniversalRequireTextureShuffle) double_image_fix |= F(GSStereoFeature::TextureShuffle);
+	if (cfg.StereoUniversalRejectRtaSourceCorrection) double_image_fix |= !F(GSStereoFeature::PsRtaSourceCorrection);
+	if (cfg.StereoUniversalRejectColclipHw) double_image_fix |= !F(GSStereoFeature::PsColclipHw);
+	if (cfg.StereoUniversalRejectColclip) double_image_fix |= !F(GSStereoFeature::PsColclip);
+	if (cfg.StereoUniversalRejectPabe) double_image_fix |= !F(GSStereoFeature::PsPabe);
+	if (cfg.StereoUniversalRejectFbMask) double_image_fix |= !F(GSStereoFeature::PsFbmask);
+	if (cfg.StereoUniversalRejectTexIsFb) double_image_fix |= !F(GSStereoFeature::PsTexIsFb);
+	if (cfg.StereoUniversalRejectNoColor) double_image_fix |= !F(GSStereoFeature::PsNoColor);
+	if (cfg.StereoUniversalRejectNoColor1) double_image_fix |= !F(GSStereoFeature::PsNoColor1);
+	if (cfg.StereoUniversalRejectAemFmt) double_image_fix |= !F(GSStereoFeature::PsAemFmt);
+	if (cfg.StereoUniversalRejectPalFmt) double_image_fix |= !F(GSStereoFeature::PsPalFmt);
+	if (cfg.StereoUniversalRejectDstFmt) double_image_fix |= !F(GSStereoFeature::PsDstFmt);
+	if (cfg.StereoUniversalRejectDepthFmt) double_image_fix |= !F(GSStereoFeature::PsDepthFmt);
+	if (cfg.StereoUniversalRejectAem) double_image_fix |= !F(GSStereoFeature::PsAem);
+	if (cfg.StereoUniversalRejectFba) double_image_fix |= !F(GSStereoFeature::PsFba);
+	if (cfg.StereoUniversalRejectFog) double_image_fix |= !F(GSStereoFeature::PsFog);
+	if (cfg.StereoUniversalRejectDate) double_image_fix |= !F(GSStereoFeature::PsDate);
+	if (cfg.StereoUniversalRejectAtst) double_image_fix |= !F(GSStereoFeature::PsAtst);
+	if (cfg.StereoUniversalRejectAfail) double_image_fix |= !F(GSStereoFeature::PsAfail);
+	if (cfg.StereoUniversalRejectFst) double_image_fix |= !F(GSStereoFeature::PsFst);
+	if (cfg.StereoUniversalRejectWms) double_image_fix |= !F(GSStereoFeature::PsWms);
+	if (cfg.StereoUniversalRejectWmt) double_image_fix |= !F(GSStereoFeature::PsWmt);
+	if (cfg.StereoUniversalRejectAdjs) double_image_fix |= !F(GSStereoFeature::PsAdjs);
+	if (cfg.StereoUniversalRejectLtf) double_image_fix |= !F(GSStereoFeature::PsLtf);
+	if (cfg.StereoUniversalRejectShuffle) double_image_fix |= !F(GSStereoFeature::PsShuffle);
+	if (cfg.StereoUniversalRejectShuffleSame) double_image_fix |= !F(GSStereoFeature::PsShuffleSame);
+	if (cfg.StereoUniversalRejectReal16Src) double_image_fix |= !F(GSStereoFeature::PsReal16Src);
+	if (cfg.StereoUniversalRejectWriteRg) double_image_fix |= !F(GSStereoFeature::PsWriteRg);
+	if (cfg.StereoUniversalRejectBlendA) double_image_fix |= !F(GSStereoFeature::PsBlendA);
+	if (cfg.StereoUniversalRejectBlendC) double_image_fix |= !F(GSStereoFeature::PsBlendC);
+	if (cfg.StereoUniversalRejectBlendD) double_image_fix |= !F(GSStereoFeature::PsBlendD);
+	if (cfg.StereoUniversalRejectFixedOneA) double_image_fix |= !F(GSStereoFeature::PsFixedOneA);
+	if (cfg.StereoUniversalRejectBlendHw) double_image_fix |= !F(GSStereoFeature::PsBlendHw);
+	if (cfg.StereoUniversalRejectAMasked) double_image_fix |= !F(GSStereoFeature::PsAMasked);
+	if (cfg.StereoUniversalRejectRoundInv) double_image_fix |= !F(GSStereoFeature::PsRoundInv);
+	if (cfg.StereoUniversalRejectChannel) double_image_fix |= !F(GSStereoFeature::PsChannel);
+	if (cfg.StereoUniversalRejectChannelFb) double_image_fix |= !F(GSStereoFeature::PsChannelFb);
+	if (cfg.StereoUniversalRejectDither) double_image_fix |= !F(GSStereoFeature::PsDither);
+	if (cfg.StereoUniversalRejectDitherAdjust) double_image_fix |= !F(GSStereoFeature::PsDitherAdjust);
+	if (cfg.StereoUniversalRejectZClamp) double_image_fix |= !F(GSStereoFeature::PsZClamp);
+	if (cfg.StereoUniversalRejectZFloor) double_image_fix |= !F(GSStereoFeature::PsZFloor);
+	if (cfg.StereoUniversalRejectTCOffsetHack) double_image_fix |= !F(GSStereoFeature::PsTCOffsetHack);
+	if (cfg.StereoUniversalRejectUrbanChaosHle) double_image_fix |= !F(GSStereoFeature::PsUrbanChaosHle);
+	if (cfg.StereoUniversalRejectTalesOfAbyssHle) double_image_fix |= !F(GSStereoFeature::PsTalesOfAbyssHle);
+	if (cfg.StereoUniversalRejectManualLod) double_image_fix |= !F(GSStereoFeature::PsManualLod);
+	if (cfg.StereoUniversalRejectPointSampler) double_image_fix |= !F(GSStereoFeature::PsPointSampler);
+	if (cfg.StereoUniversalRejectRegionRect) double_image_fix |= !F(GSStereoFeature::PsRegionRect);
+	if (cfg.StereoUniversalRejectScanmask) double_image_fix |= !F(GSStereoFeature::PsScanmask);
+	if (cfg.StereoUniversalRequireColclipHw) double_image_fix |= F(GSStereoFeature::PsColclipHw);
+	if (cfg.StereoUniversalRequireColclip) double_image_fix |= F(GSStereoFeature::PsColclip);
+	if (cfg.StereoUniversalRequireBlendMix) double_image_fix |= F(GSStereoFeature::PsBlendMix);
+	if (cfg.StereoUniversalRequirePabe) double_image_fix |= F(GSStereoFeature::PsPabe);
+	if (cfg.StereoUniversalRequireFbMask) double_image_fix |= F(GSStereoFeature::PsFbmask);
+	if (cfg.StereoUniversalRequireTexIsFb) double_image_fix |= F(GSStereoFeature::PsTexIsFb);
+	if (cfg.StereoUniversalRequireNoColor) double_image_fix |= F(GSStereoFeature::PsNoColor);
+	if (cfg.StereoUniversalRequireAemFmt) double_image_fix |= F(GSStereoFeature::PsAemFmt);
+	if (cfg.StereoUniversalRequirePalFmt) double_image_fix |= F(GSStereoFeature::PsPalFmt);
+	if (cfg.StereoUniversalRequireDstFmt) double_image_fix |= F(GSStereoFeature::PsDstFmt);
+	if (cfg.StereoUniversalRequireDepthFmt) double_image_fix |= F(GSStereoFeature::PsDepthFmt);
+	if (cfg.StereoUniversalRequireFba) double_image_fix |= F(GSStereoFeature::PsFba);
+	if (cfg.StereoUniversalRequireFog) double_image_fix |= F(GSStereoFeature::PsFog);
+	if (cfg.StereoUniversalRequireIip) double_image_fix |= F(GSStereoFeature::PsIip);
+	if (cfg.StereoUniversalRequireDate) double_image_fix |= F(GSStereoFeature::PsDate);
+	if (cfg.StereoUniversalRequireAtst) double_image_fix |= F(GSStereoFeature::PsAtst);
+	if (cfg.StereoUniversalRequireAfail) double_image_fix |= F(GSStereoFeature::PsAfail);
+	if (cfg.StereoUniversalRequireFst) double_image_fix |= F(GSStereoFeature::PsFst);
+	if (cfg.StereoUniversalRequireTcc) double_image_fix |= F(GSStereoFeature::PsTcc);
+	if (cfg.StereoUniversalRequireAdjs) double_image_fix |= F(GSStereoFeature::PsAdjs);
+	if (cfg.StereoUniversalRequireAdjt) double_image_fix |= F(GSStereoFeature::PsAdjt);
+	if (cfg.StereoUniversalRequireShuffleSame) double_image_fix |= F(GSStereoFeature::PsShuffleSame);
+	if (cfg.StereoUniversalRequireReal16Src) double_image_fix |= F(GSStereoFeature::PsReal16Src);
+	if (cfg.StereoUniversalRequireProcessBa) double_image_fix |= F(GSStereoFeature::PsProcessBa);
+	if (cfg.StereoUniversalRequireProcessRg) double_image_fix |= F(GSStereoFeature::PsProcessRg);
+	if (cfg.StereoUniversalRequireShuffleAcross) double_image_fix |= F(GSStereoFeature::PsShuffleAcross);
+	if (cfg.StereoUniversalRequireWriteRg) double_image_fix |= F(GSStereoFeature::PsWriteRg);
+	if (cfg.StereoUniversalRequireBlendA) double_image_fix |= F(GSStereoFeature::PsBlendA);
+	if (cfg.StereoUniversalRequireBlendC) double_image_fix |= F(GSStereoFeature::PsBlendC);
+	if (cfg.StereoUniversalRequireBlendD) double_image_fix |= F(GSStereoFeature::PsBlendD);
+	if (cfg.StereoUniversalRequireFixedOneA) double_image_fix |= F(GSStereoFeature::PsFixedOneA);
+	if (cfg.StereoUniversalRequireBlendHw) double_image_fix |= F(GSStereoFeature::PsBlendHw);
+	if (cfg.StereoUniversalRequireAMasked) double_image_fix |= F(GSStereoFeature::PsAMasked);
+	if (cfg.StereoUniversalRequireRoundInv) double_image_fix |= F(GSStereoFeature::PsRoundInv);
+	if (cfg.StereoUniversalRequireChannel) double_image_fix |= F(GSStereoFeature::PsChannel);
+	if (cfg.StereoUniversalRequireChannelFb) double_image_fix |= F(GSStereoFeature::PsChannelFb);
+	if (cfg.StereoUniversalRequireDither) double_image_fix |= F(GSStereoFeature::PsDither);
+	if (cfg.StereoUniversalRequireDitherAdjust) double_image_fix |= F(GSStereoFeature::PsDitherAdjust);
+	if (cfg.StereoUniversalRequireZClamp) double_image_fix |= F(GSStereoFeature::PsZClamp);
+	if (cfg.StereoUniversalRequireZFloor) double_image_fix |= F(GSStereoFeature::PsZFloor);
+	if (cfg.StereoUniversalRequireTCOffsetHack) double_image_fix |= F(GSStereoFeature::PsTCOffsetHack);
+	if (cfg.StereoUniversalRequireUrbanChaosHle) double_image_fix |= F(GSStereoFeature::PsUrbanChaosHle);
+	if (cfg.StereoUniversalRequireTalesOfAbyssHle) double_image_fix |= F(GSStereoFeature::PsTalesOfAbyssHle);
+	if (cfg.StereoUniversalRequireAutomaticLod) double_image_fix |= F(GSStereoFeature::PsAutomaticLod);
+	if (cfg.StereoUniversalRequireManualLod) double_image_fix |= F(GSStereoFeature::PsManualLod);
+	if (cfg.StereoUniversalRequirePointSampler) double_image_fix |= F(GSStereoFeature::PsPointSampler);
+	if (cfg.StereoUniversalRequireRegionRect) double_image_fix |= F(GSStereoFeature::PsRegionRect);
+	if (cfg.StereoUniversalRequireScanmask) double_image_fix |= F(GSStereoFeature::PsScanmask);
+	if (cfg.StereoUniversalRequireAlphaBlend) double_image_fix |= F(GSStereoFeature::PrimAbe);
+	if (cfg.StereoUniversalRequireAlphaTest) double_image_fix |= F(GSStereoFeature::AlphaTest);
+	if (cfg.StereoUniversalRequireDatm) double_image_fix |= F(GSStereoFeature::DestAlphaMode);
+	if (cfg.StereoUniversalRequireZTest) double_image_fix |= F(GSStereoFeature::ZTest);
+	if (cfg.StereoUniversalRequireZWrite) double_image_fix |= !F(GSStereoFeature::ZMask);
+	if (cfg.StereoUniversalRequireZTestAlways) double_image_fix |= F(GSStereoFeature::ZTestAlways);
+	if (cfg.StereoUniversalRequireZTestNever) double_image_fix |= F(GSStereoFeature::ZTestNever);
+	if (cfg.StereoUniversalRequireAa1) double_image_fix |= F(GSStereoFeature::PrimAa1);
+	if (cfg.StereoUniversalRequireChannelShuffle) double_image_fix |= F(GSStereoFeature::ChannelShuffle);
+	if (cfg.StereoUniversalRequireFullscreenShuffle) double_image_fix |= F(GSStereoFeature::FullScreenShuffle);
+	if (cfg.StereoUniversalRequirePoints) double_image_fix |= F(GSStereoFeature::PrimPoint);
+	if (cfg.StereoUniversalRequireLines) double_image_fix |= F(GSStereoFeature::PrimLine);
+	if (cfg.StereoUniversalRequireTriangles) double_image_fix |= F(GSStereoFeature::PrimTriangle);
+	if (cfg.StereoUniversalRequireSprites) double_image_fix |= F(GSStereoFeature::ZTestAlwaysZEqual);
+	return disable && double_image_fix;
+}
+
+static bool ReferenceMasterFixEnabled(const Pcsx2Config::GSOptions& cfg, const GSStereoFeatureWord& features)
+{
+	const auto F = [&features](GSStereoFeature feature) { return features.Get(feature); };
+	return cfg.StereoMasterFix && ((cfg.StereoMasterFix1 && F(GSStereoFeature::MasterFix1)) ||
+	                               (cfg.StereoMasterFix2 && F(GSStereoFeature::MasterFix2)) ||
+	                               (cfg.StereoMasterFix3 && F(GSStereoFeature::MasterFix3)) ||
+	                               (cfg.StereoMasterFix4 && F(GSStereoFeature::MasterFix4)) ||
+	                               (cfg.StereoMasterFix5 && F(GSStereoFeature::MasterFix5)) ||
+	                               (cfg.StereoMasterFix6 && F(GSStereoFeature::MasterFix6)));
+}
+
+static bool ReferenceUiDetect(const Pcsx2Config::GSOptions& cfg, const GSStereoFeatureWord& features)
+{
+	const auto F = [&features](GSStereoFeature feature) { return features.Get(feature); };
+	return (cfg.StereoUiSafeDetect && F(GSStereoFeature::UiSafeDetect)) ||
+	       (cfg.StereoUiAdvancedDetect && F(GSStereoFeature::UiAdvancedDetect)) ||
+	       (cfg.StereoRejectZTestAlways && F(GSStereoFeature::ZTestAlways)) ||
+	       (cfg.StereoRequireZVaries && F(GSStereoFeature::ZEqual)) ||
+	       (cfg.StereoRejectFixedQ && F(GSStereoFeature::QEqual)) ||
+	       (cfg.StereoStencilRequireZTestGequal && !F(GSStereoFeature::ZTestGreater)) ||
+	       (cfg.StereoRejectUiLike && F(GSStereoFeature::UiLike)) ||
+	       (cfg.StereoUiBackgroundDepth && F(GSStereoFeature::UiBackgroundDepth));
+}
+
+static GSStereoFeatureWord RandomFeatures(std::mt19937& rng)
+{
+	GSStereoFeatureWord features;
+	std::bernoulli_distribution bit(0.5);
+	for (u32 i = 0; i < static_cast<u32>(GSStereoFeature::Count); i++)
+	{
+		if (i != static_cast<u32>(GSStereoFeature::SpriteNoGapsOrRegionRect))
+			features.Set(static_cast<GSStereoFeature>(i), bit(rng));
+	}
+
+	// Derived in GSRendererHW, so it has to stay consistent with its inputs.
+	features.Set(GSStereoFeature::SpriteNoGapsOrRegionRect,
+		features.Get(GSStereoFeature::SpriteNoGaps) || features.Get(GSStereoFeature::PsRegionRect));
+	return features;
+}
+
+static Pcsx2Config::GSOptions RandomOptions(std::mt19937& rng)
+{
+	Pcsx2Config::GSOptions cfg;
+	std::uniform_int_distribution<u32> count(0, 4);
+	std::uniform_int_distribution<size_t> pick(0, std::size(s_stereo_options) - 1);
+	const u32 num_enabled = count(rng);
+	for (u32 i = 0; i < num_enabled; i++)
+		cfg.*s_stereo_options[pick(rng)] = true;
+
+	std::bernoulli_distribution coin(0.75);
+	cfg.StereoMasterFixTest = coin(rng);
+	cfg.StereoMasterFix = coin(rng);
+	return cfg;
+}
+
+TEST(GSStereoDrawFilter, MatchesOptionChain)
+{
+	std::mt19937 rng(0x5732E0u);
+	u32 mono_draws = 0;
+	u32 stereo_draws = 0;
+
+	for (u32 config_index = 0; config_index < 4000; config_index++)
+	{
+		const Pcsx2Config::GSOptions cfg = RandomOptions(rng);
+		GSStereoDrawFilter filter;
+		filter.Compile(cfg);
+
+		for (u32 draw_index = 0; draw_index < 64; draw_index++)
+		{
+			const GSStereoFeatureWord features = RandomFeatures(rng);
+			const bool expected = ReferenceDisableStereoPass(cfg, features);
+			ASSERT_EQ(filter.DisableStereoPass(features), expected);
+			ASSERT_EQ(filter.MasterFixEnabled(features), ReferenceMasterFixEnabled(cfg, features));
+			ASSERT_EQ(filter.MasterFixOverride(features),
+				cfg.StereoMasterFix && cfg.StereoMasterFix9 && features.Get(GSStereoFeature::MoviesFixOverride));
+			ASSERT_EQ(filter.UiDetect(features), ReferenceUiDetect(cfg, features));
+			(expected ? mono_draws : stereo_draws)++;
+		}
+	}
+
+	// Make sure both outcomes were actually exercised.
+	ASSERT_GT(mono_draws, 1000u);
+	ASSERT_GT(stereo_draws, 1000u);
+}
+
+TEST(GSStereoDrawFilter, ConflictingOptions)
+{
+	Pcsx2Config::GSOptions cfg;
+	cfg.StereoMasterFixTest = true;
+	cfg.StereoUniversalRejectBlendMix = true;
+	cfg.StereoUniversalRequireBlendMix = true;
+
+	GSStereoDrawFilter filter;
+	filter.Compile(cfg);
+
+	GSStereoFeatureWord blend_mix;
+	blend_mix.Set(GSStereoFeature::PsBlendMix, true);
+	ASSERT_FALSE(filter.DisableStereoPass(GSStereoFeatureWord()));
+	ASSERT_FALSE(filter.DisableStereoPass(blend_mix));
+
+	// StereoEnableOptions with nothing selected never narrows the chain to a match.
+	cfg.StereoUniversalRejectBlendMix = false;
+	cfg.StereoUniversalRequireBlendMix = false;
+	filter.Compile(cfg);
+	ASSERT_TRUE(filter.DisableStereoPass(blend_mix));
+	cfg.StereoEnableOptions = true;
+	filter.Compile(cfg);
+	ASSERT_FALSE(filter.DisableStereoPass(blend_mix));
+}
+
+TEST(GSStereoDrawFilter, FindOption)
+{
+	ASSERT_EQ(GSStereoDrawFilter::FindOption("StereoMasterFixTest"), &Pcsx2Config::GSOptions::StereoMasterFixTest);
+	ASSERT_EQ(GSStereoDrawFilter::FindOption("StereoInstancedShaderDrawArea"), &Pcsx2Config::GSOptions::StereoInstancedShaderDrawArea);
+	ASSERT_EQ(GSStereoDrawFilter::FindOption("stereomasterfixtest"), nullptr);
+	ASSERT_EQ(GSStereoDrawFilter::FindOption("StereoSeparation"), nullptr);
+	ASSERT_EQ(GSStereoDrawFilter::FindOption(""), nullptr);
+}
+
+// Checks exactly the listed features are set.
+static void ExpectFeatures(const GSStereoFeatureWord& features, std::initializer_list<GSStereoFeature> expected)
+{
+	for (u32 i = 0; i < static_cast<u32>(GSStereoFeature::Count); i++)
+	{
+		const GSStereoFeature feature = static_cast<GSStereoFeature>(i);
+		const bool is_expected = std::find(expected.begin(), expected.end(), feature) != expected.end();
+		EXPECT_EQ(features.Get(feature), is_expected) << "feature " << i;
+	}
+}
+
+TEST(GSStereoFeatureWord, PacksRegisters)
+{
+	GIFRegPRIM prim = {};
+	GIFRegTEST test = {};
+	GIFRegFRAME frame = {};
+	GIFRegZBUF zbuf = {};
+	GIFRegTEX0 tex0 = {};
+	tex0.TFX = TFX_MODULATE;
+
+	GSStereoFeatureWord features;
+	features.SetRegisters(prim, test, frame, zbuf, tex0);
+	ExpectFeatures(features, {GSStereoFeature::ZTestNever, GSStereoFeature::TfxModulate});
+
+	prim.FST = 1;
+	prim.ABE = 1;
+	test.ATE = 1;
+	test.ATST = ATST_ALWAYS;
+	test.AFAIL = AFAIL_ZB_ONLY;
+	test.ZTE = 1;
+	test.ZTST = ZTST_GREATER;
+	frame.FBMSK = 0x00FFFFFF;
+	tex0.TFX = TFX_DECAL;
+	features = {};
+	features.SetRegisters(prim, test, frame, zbuf, tex0);
+	ExpectFeatures(features, {GSStereoFeature::PrimFst, GSStereoFeature::PrimAbe, GSStereoFeature::AlphaTest,
+		GSStereoFeature::AlphaTestAlways, GSStereoFeature::AfailZbOnly, GSStereoFeature::AfailNotKeep,
+		GSStereoFeature::ZTest, GSStereoFeature::ZTestGreater, GSStereoFeature::DepthActive, GSStereoFeature::FbMask,
+		GSStereoFeature::FbMaskFull, GSStereoFeature::TfxDecal});
+
+	// Masked depth writes aren't an active depth buffer.
+	zbuf.ZMSK = 1;
+	features = {};
+	features.SetRegisters(prim, test, frame, zbuf, tex0);
+	EXPECT_TRUE(features.Get(GSStereoFeature::ZMask));
+	EXPECT_FALSE(features.Get(GSStereoFeature::DepthActive));
+}
+
+TEST(GSStereoFeatureWord, PacksDrawConfig)
+{
+	GSHWDrawConfig config = {};
+	GSStereoFeatureWord features;
+	features.SetDrawConfig(config);
+	ExpectFeatures(features, {});
+
+	config.ps.blend_mix = 1;
+	config.ps.tfx = TFX_DECAL;
+	config.ps.colclip_hw = 1;
+	config.ps.no_color1 = 1;
+	config.ps.tales_of_abyss_hle = 1;
+	config.ps.scanmsk = 2;
+	features.SetDrawConfig(config);
+	ExpectFeatures(features, {GSStereoFeature::PsBlendMix, GSStereoFeature::PsTfx, GSStereoFeature::PsColclipHw,
+		GSStereoFeature::ColclipAny, GSStereoFeature::PsNoColor1, GSStereoFeature::NoColorOutput,
+		GSStereoFeature::PsTalesOfAbyssHle, GSStereoFeature::HleShuffle, GSStereoFeature::PsScanmask});
+
+	// Reading the framebuffer in the shader is a feedback loop.
+	config.ps = {};
+	config.ps.fbmask = 1;
+	features = {};
+	features.SetDrawConfig(config);
+	ExpectFeatures(features, {GSStereoFeature::PsFbmask, GSStereoFeature::PsFeedbackLoop});
+}
+
+TEST(GSStereoTrace, SummaryAndDiff)
+{
+	Pcsx2Config::GSOptions config_a;
+	config_a.StereoMasterFixTest = true;
+	config_a.StereoRejectFst = true;
+
+	Pcsx2Config::GSOptions config_b = config_a;
+	config_b.StereoUniversalRequireTfx = true;
+
+	GSStereoDrawFilter filter_a;
+	filter_a.Compile(config_a);
+
+	// Recorded the way the renderer does, the last draw was kept mono outside of the rules.
+	std::vector<GSStereoTrace::Record> records(5);
+	for (u32 i = 0; i < records.size(); i++)
+	{
+		records[i].draw = i;
+		records[i].features.Set(GSStereoFeature::PrimFst, (i & 1) != 0);
+		records[i].features.Set(GSStereoFeature::PsTfx, (i & 2) != 0);
+	}
+	records[4].decisions = GSStereoTrace::DecisionRendererMono;
+	for (GSStereoTrace::Record& record : records)
+		record.decisions = GSStereoTrace::Evaluate(filter_a, record);
+	ASSERT_EQ(records[0].decisions, static_cast<u32>(GSStereoTrace::DecisionStereo));
+	ASSERT_EQ(records[4].decisions, static_cast<u32>(GSStereoTrace::DecisionRendererMono));
+
+	const GSStereoTrace::Summary summary = GSStereoTrace::Summarize(records, config_a);
+	ASSERT_EQ(summary.draws, 5u);
+	ASSERT_EQ(summary.decisions[0], 2u); // DecisionStereo
+	ASSERT_EQ(summary.decisions[1], 2u); // DecisionDisableStereoPass
+	ASSERT_EQ(summary.decisions[5], 1u); // DecisionRendererMono
+	ASSERT_EQ(summary.rules.size(), 1u);
+	ASSERT_EQ(summary.rules[0].rule.option, &Pcsx2Config::GSOptions::StereoRejectFst);
+	ASSERT_STREQ(GSStereoDrawFilter::GetOptionName(summary.rules[0].rule.option), "StereoRejectFst");
+	ASSERT_EQ(summary.rules[0].hits, 2u);
+
+	// Requiring TFX as well only keeps draw 3 mono. Draw 4 stays mono whatever the rules say.
+	const std::vector<GSStereoTrace::DiffEntry> diff = GSStereoTrace::Diff(records, config_a, config_b);
+	ASSERT_EQ(diff.size(), 1u);
+	ASSERT_EQ(diff[0].draw, 1u);
+	ASSERT_EQ(diff[0].decisions_a, static_cast<u32>(GSStereoTrace::DecisionDisableStereoPass));
+	ASSERT_EQ(diff[0].decisions_b, static_cast<u32>(GSStereoTrace::DecisionStereo));
+}
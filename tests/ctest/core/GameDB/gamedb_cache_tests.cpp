@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Config.h"
+#include "pcsx2/GameDatabaseCache.h"
+#include "pcsx2/GS/Renderers/HW/GSStereoFilter.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include <gtest/gtest.h>
+#include <fmt/format.h>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using GameDatabaseSchema::GameEntry;
+
+static GameEntry MakeEntry(u32 i)
+{
+	GameEntry entry;
+	entry.name = fmt::format("Game {}", i);
+	entry.name_sort = fmt::format("game {}", i);
+	entry.region = (i % 2) ? "NTSC-U" : "PAL-E";
+	entry.compat = GameDatabaseSchema::Compatibility::Playable;
+	entry.eeRoundMode = FPRoundMode::ChopZero;
+	entry.vu1ClampMode = GameDatabaseSchema::ClampMode::Extra;
+	if (i % 3 == 0)
+	{
+		entry.gameFixes = {Fix_VuAddSub, Fix_FpuMultiply};
+		entry.speedHacks = {{SpeedHack::MVUFlag, 0}};
+		entry.gsHWFixes = {{GameDatabaseSchema::GSHWFixId::HalfPixelOffset, 2}, {GameDatabaseSchema::GSHWFixId::SkipDrawEnd, -1}};
+		entry.memcardFilters = {fmt::format("SLUS-{:05}", i), "SLUS-00000"};
+		entry.patches = {{0, "patch=1,EE,00100000,word,00000000"}, {0x12345678u + i, ""}};
+		entry.dynaPatches = {{{{0, 1}, {4, 2}}, {{8, 3}}}};
+		entry.stereoRuleSets = std::make_shared<const GameDatabaseSchema::StereoRuleSets>(GameDatabaseSchema::StereoRuleSets{
+			{"default", {{GSStereoDrawFilter::FindOption("StereoSwapEyes"), true}}}});
+	}
+	return entry;
+}
+
+static void ExpectSameEntry(const GameEntry& a, const GameEntry& b)
+{
+	EXPECT_EQ(a.name, b.name);
+	EXPECT_EQ(a.name_sort, b.name_sort);
+	EXPECT_EQ(a.name_en, b.name_en);
+	EXPECT_EQ(a.region, b.region);
+	EXPECT_EQ(a.compat, b.compat);
+	EXPECT_EQ(a.eeRoundMode, b.eeRoundMode);
+	EXPECT_EQ(a.eeDivRoundMode, b.eeDivRoundMode);
+	EXPECT_EQ(a.vu0RoundMode, b.vu0RoundMode);
+	EXPECT_EQ(a.vu1RoundMode, b.vu1RoundMode);
+	EXPECT_EQ(a.eeClampMode, b.eeClampMode);
+	EXPECT_EQ(a.vu0ClampMode, b.vu0ClampMode);
+	EXPECT_EQ(a.vu1ClampMode, b.vu1ClampMode);
+	EXPECT_EQ(a.gameFixes, b.gameFixes);
+	EXPECT_EQ(a.speedHacks, b.speedHacks);
+	EXPECT_EQ(a.gsHWFixes, b.gsHWFixes);
+	ASSERT_EQ(a.stereoRuleSets != nullptr, b.stereoRuleSets != nullptr);
+	if (a.stereoRuleSets)
+		EXPECT_EQ(*a.stereoRuleSets, *b.stereoRuleSets);
+	EXPECT_EQ(a.memcardFilters, b.memcardFilters);
+	EXPECT_EQ(a.patches, b.patches);
+	ASSERT_EQ(a.dynaPatches.size(), b.dynaPatches.size());
+	for (size_t i = 0; i < a.dynaPatches.size(); i++)
+	{
+		const auto same = [](const Patch::DynamicPatchEntry& x, const Patch::DynamicPatchEntry& y) {
+			return x.offset == y.offset && x.value == y.value;
+		};
+		EXPECT_TRUE(std::equal(a.dynaPatches[i].pattern.begin(), a.dynaPatches[i].pattern.end(),
+			b.dynaPatches[i].pattern.begin(), b.dynaPatches[i].pattern.end(), same));
+		EXPECT_TRUE(std::equal(a.dynaPatches[i].replacement.begin(), a.dynaPatches[i].replacement.end(),
+			b.dynaPatches[i].replacement.begin(), b.dynaPatches[i].replacement.end(), same));
+	}
+}
+
+class GameDatabaseCacheTest : public ::testing::Test
+{
+protected:
+	static constexpr GameDatabaseCache::SourceInfo SOURCE = {123456, 1700000000};
+
+	void SetUp() override
+	{
+		m_path = Path::Combine(Path::GetDirectory(FileSystem::GetProgramPath()), "gamedb_cache_test.cache");
+		for (u32 i = 0; i < 100; i++)
+			m_entries.emplace(fmt::format("slus-{:05}", i), MakeEntry(i));
+	}
+
+	void TearDown() override { FileSystem::DeleteFilePath(m_path.c_str()); }
+
+	std::string m_path;
+	std::unordered_map<std::string, GameEntry> m_entries;
+};
+
+TEST_F(GameDatabaseCacheTest, RoundTrip)
+{
+	Error error;
+	ASSERT_TRUE(GameDatabaseCache::Write(m_path, SOURCE, m_entries, &error)) << error.GetDescription();
+
+	GameDatabaseCache cache;
+	ASSERT_TRUE(cache.Open(m_path, SOURCE, &error)) << error.GetDescription();
+	EXPECT_EQ(cache.GetEntryCount(), m_entries.size());
+
+	for (const auto& [serial, expected] : m_entries)
+	{
+		SCOPED_TRACE(serial);
+		GameEntry entry;
+		ASSERT_TRUE(cache.Find(serial, &entry));
+		ExpectSameEntry(entry, expected);
+	}
+
+	GameEntry entry;
+	EXPECT_FALSE(cache.Find("slus-99999", &entry));
+	EXPECT_FALSE(cache.Find("", &entry));
+	EXPECT_FALSE(cache.Find("zzzz-00000", &entry));
+}
+
+TEST_F(GameDatabaseCacheTest, StaleCacheIsRejected)
+{
+	ASSERT_TRUE(GameDatabaseCache::Write(m_path, SOURCE, m_entries, nullptr));
+
+	GameDatabaseCache cache;
+	EXPECT_FALSE(cache.Open(m_path, {SOURCE.size + 1, SOURCE.modification_time}, nullptr));
+	EXPECT_FALSE(cache.Open(m_path, {SOURCE.size, SOURCE.modification_time + 1}, nullptr));
+	EXPECT_FALSE(cache.IsOpen());
+	EXPECT_TRUE(cache.Open(m_path, SOURCE, nullptr));
+}
+
+TEST_F(GameDatabaseCacheTest, DamagedCacheIsRejected)
+{
+	ASSERT_TRUE(GameDatabaseCache::Write(m_path, SOURCE, m_entries, nullptr));
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(m_path.c_str());
+	ASSERT_TRUE(data.has_value());
+
+	// Cut off part way through the string pool.
+	ASSERT_TRUE(FileSystem::WriteBinaryFile(m_path.c_str(), data->data(), data->size() - 16));
+	GameDatabaseCache cache;
+	EXPECT_FALSE(cache.Open(m_path, SOURCE, nullptr));
+
+	ASSERT_TRUE(FileSystem::WriteBinaryFile(m_path.c_str(), data->data(), 8));
+	EXPECT_FALSE(cache.Open(m_path, SOURCE, nullptr));
+}
+
+TEST_F(GameDatabaseCacheTest, FullSizeLookups)
+{
+	// About the size of the real GameDB.
+	static constexpr u32 NUM_ENTRIES = 12000;
+	static constexpr u32 NUM_LOOKUPS = 1000;
+
+	std::unordered_map<std::string, GameEntry> entries;
+	for (u32 i = 0; i < NUM_ENTRIES; i++)
+		entries.emplace(fmt::format("slus-{:05}", i), MakeEntry(i));
+
+	ASSERT_TRUE(GameDatabaseCache::Write(m_path, SOURCE, entries, nullptr));
+
+	GameDatabaseCache cache;
+	ASSERT_TRUE(cache.Open(m_path, SOURCE, nullptr));
+	EXPECT_EQ(cache.GetEntryCount(), NUM_ENTRIES);
+
+	for (u32 i = 0; i < NUM_LOOKUPS; i++)
+	{
+		const std::string serial = fmt::format("slus-{:05}", (i * 7919) % NUM_ENTRIES);
+		GameEntry entry;
+		ASSERT_TRUE(cache.Find(serial, &entry)) << serial;
+		ExpectSameEntry(entry, entries.at(serial));
+	}
+
+	GameEntry entry;
+	EXPECT_FALSE(cache.Find("slus-99999", &entry));
+}
+
+static void WriteGameIndex(const std::string& path, const char* stereo, int age_seconds)
+{
+	const std::string yaml = fmt::format(R"(SLUS-00001:
+  name: "Game 1"
+  region: "NTSC-U"
+{}
+SLUS-00002:
+  name: "Game 2"
+  region: "NTSC-U"
+{}
+)",
+		stereo, stereo);
+	ASSERT_TRUE(FileSystem::WriteStringToFile(path.c_str(), yaml));
+
+	// The reload is keyed on the timestamp, which only has second resolution.
+	std::filesystem::last_write_time(std::filesystem::path(path),
+		std::filesystem::file_time_type::clock::now() - std::chrono::seconds(age_seconds));
+}
+
+static Pcsx2Config::GSOptions ApplyStereoRules(const GameEntry& entry, const char* profile)
+{
+	Pcsx2Config::GSOptions config;
+	config.StereoProfile = profile;
+	entry.applyStereoRules(config);
+	return config;
+}
+
+// The only test which loads the GameDB itself, it can't be reset once loaded.
+TEST(GameDatabase, StereoRulesAreSwappedOnReload)
+{
+	const std::string dir = Path::Combine(Path::GetDirectory(FileSystem::GetProgramPath()), "gamedb_reload_test");
+	ASSERT_TRUE(FileSystem::CreateDirectoryPath(dir.c_str(), false));
+	EmuFolders::Resources = dir;
+	EmuFolders::Cache = dir;
+	const std::string yaml_path = Path::Combine(dir, "GameIndex.yaml");
+
+	WriteGameIndex(yaml_path, R"(  stereo:
+    swapped:
+      StereoSwapEyes: true
+    flipped:
+      StereoFlipRendering: true
+      StereoSwapEyes: false)",
+		60);
+
+	const GameEntry* entry = GameDatabase::findGame("SLUS-00001");
+	ASSERT_NE(entry, nullptr);
+	EXPECT_EQ(entry->name, "Game 1");
+	EXPECT_TRUE(ApplyStereoRules(*entry, "swapped").StereoSwapEyes);
+	EXPECT_FALSE(ApplyStereoRules(*entry, "swapped").StereoFlipRendering);
+	EXPECT_TRUE(ApplyStereoRules(*entry, "flipped").StereoFlipRendering);
+	EXPECT_FALSE(ApplyStereoRules(*entry, "flipped").StereoSwapEyes);
+
+	// Unchanged file, nothing to do.
+	EXPECT_FALSE(GameDatabase::pollStereoRules());
+	GameDatabase::waitForStereoRules();
+	EXPECT_FALSE(GameDatabase::pollStereoRules());
+
+	WriteGameIndex(yaml_path, R"(  stereo:
+    swapped:
+      StereoSwapEyes: false
+      StereoRejectSpriteBlit: true)",
+		30);
+	bool changed = false;
+	for (int i = 0; i < 500 && !changed; i++)
+	{
+		changed = GameDatabase::pollStereoRules();
+		if (!changed)
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	EXPECT_TRUE(changed);
+
+	// The entry which was already looked up keeps its address, only its snapshot is swapped.
+	EXPECT_EQ(GameDatabase::findGame("SLUS-00001"), entry);
+	const Pcsx2Config::GSOptions swapped = ApplyStereoRules(*entry, "swapped");
+	EXPECT_FALSE(swapped.StereoSwapEyes);
+	EXPECT_TRUE(swapped.StereoRejectSpriteBlit);
+	EXPECT_FALSE(ApplyStereoRules(*entry, "flipped").StereoFlipRendering);
+
+	// So does every other entry.
+	const GameEntry* other = GameDatabase::findGame("SLUS-00002");
+	ASSERT_NE(other, nullptr);
+	EXPECT_TRUE(ApplyStereoRules(*other, "swapped").StereoRejectSpriteBlit);
+
+	FileSystem::RecursiveDeleteDirectory(dir.c_str());
+}
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Common.h"
+#include "pcsx2/IPU/IPU.h"
+#include "pcsx2/IPU/IPU_DecodeAhead.h"
+#include "pcsx2/IPU/IPU_MultiISA.h"
+#include "pcsx2/ps2/HwInternal.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+static constexpr u32 MACROBLOCKS = 64;
+
+namespace
+{
+	struct BitWriter
+	{
+		std::vector<u8> bytes;
+		u32 bits = 0;
+
+		void Put(u32 value, u32 count)
+		{
+			for (u32 i = count; i > 0; i--)
+			{
+				if ((bits & 7) == 0)
+					bytes.push_back(0);
+				if ((value >> (i - 1)) & 1)
+					bytes.back() |= 0x80 >> (bits & 7);
+				bits++;
+			}
+		}
+	};
+
+	struct DCCode
+	{
+		u32 code;
+		u32 len;
+	};
+} // namespace
+
+// MPEG-2 tables B.12 and B.13, indexed by dct_dc_size.
+static constexpr DCCode LUMA_DC[] = {{0b100, 3}, {0b00, 2}, {0b01, 2}, {0b101, 3}, {0b110, 3}};
+static constexpr DCCode CHROMA_DC[] = {{0b00, 2}, {0b01, 2}, {0b10, 2}, {0b110, 3}};
+
+// Writes a DC difference which moves the prediction back towards the middle, so it can't overflow.
+template <size_t N>
+static void PutDC(BitWriter& bw, std::mt19937& rng, const DCCode (&table)[N], int& pred)
+{
+	const u32 size = rng() % N;
+	bw.Put(table[size].code, table[size].len);
+	if (size == 0)
+		return;
+
+	int diff = (1 << (size - 1)) + static_cast<int>(rng() % (1u << (size - 1)));
+	if (pred > 128)
+		diff = -diff;
+	pred += diff;
+	bw.Put(diff > 0 ? diff : diff + (1 << size) - 1, size);
+}
+
+// An I picture slice of intra macroblocks, using escape codes for the AC coefficients.
+static std::vector<u8> MakeSlice(u32 seed)
+{
+	std::mt19937 rng(seed);
+	BitWriter bw;
+	int pred[3] = {128, 128, 128};
+
+	for (u32 mb = 0; mb < MACROBLOCKS; mb++)
+	{
+		if (mb > 0)
+			bw.Put(1, 1); // macroblock_address_increment = 1
+
+		if (rng() % 4 == 0)
+		{
+			bw.Put(0b01, 2); // Intra, quant
+			bw.Put(1 + rng() % 31, 5);
+		}
+		else
+		{
+			bw.Put(1, 1); // Intra
+		}
+
+		for (u32 block = 0; block < 6; block++)
+		{
+			if (block < 4)
+				PutDC(bw, rng, LUMA_DC, pred[0]);
+			else
+				PutDC(bw, rng, CHROMA_DC, pred[block - 3]);
+
+			const u32 coefficients = rng() % 4;
+			for (u32 i = 0; i < coefficients; i++)
+			{
+				const int level = static_cast<int>(rng() % 400) - 200;
+				bw.Put(0b000001, 6); // Escape
+				bw.Put(rng() % 6, 6);
+				bw.Put(static_cast<u32>(level ? level : 1) & 0xFFF, 12);
+			}
+			bw.Put(0b10, 2); // End of block
+		}
+	}
+
+	// End of slice, then a sequence end code.
+	bw.Put(0, 32 - (bw.bits % 8));
+	for (u8 byte : {0x00, 0x00, 0x01, 0xB3})
+		bw.Put(byte, 8);
+	bw.bytes.resize((bw.bytes.size() + 15 + 8 * 16) & ~15);
+	return bw.bytes;
+}
+
+static std::vector<u128> RunIDEC(const std::vector<u8>& stream, bool rgb16, bool decode_ahead)
+{
+	EmuConfig.Speedhacks.ipuDecodeAhead = decode_ahead;
+
+	ipuReset();
+	std::memset(decoder.iq, 16, sizeof(decoder.iq));
+	ipu0ch.chcr.STR = 1;
+	ipu0ch.qwc = 0xFFFF;
+
+	tIPU_CMD_IDEC idec(0);
+	idec.QSC = 8;
+	idec.SGN = rgb16;
+	idec.DTE = rgb16;
+	idec.OFM = rgb16;
+	idec.cmd = SCE_IPU_IDEC;
+	IPUCMD_WRITE(idec._u32);
+
+	std::vector<u128> output;
+	size_t pos = 0;
+	for (u32 i = 0; i < 100000 && ipuRegs.ctrl.BUSY; i++)
+	{
+		while (g_BP.IFC < 8 && pos < stream.size())
+		{
+			u128 qwc;
+			std::memcpy(&qwc, &stream[pos], sizeof(qwc));
+			WriteFIFO_IPUin(&qwc);
+			pos += sizeof(qwc);
+		}
+
+		IPUProcessInterrupt();
+
+		// Make sure the macroblock is always ready, so the test doesn't depend on timing.
+		IPUDecodeAhead::Wait();
+
+		while (ipuRegs.ctrl.OFC)
+		{
+			u128 qwc;
+			ReadFIFO_IPUout(&qwc);
+			output.push_back(qwc);
+		}
+	}
+
+	EXPECT_FALSE(ipuRegs.ctrl.BUSY);
+	return output;
+}
+
+static void TestDecodeAhead(bool rgb16)
+{
+	const std::vector<u8> stream = MakeSlice(rgb16 ? 0x1234 : 0x5678);
+	const std::vector<u128> expected = RunIDEC(stream, rgb16, false);
+	ASSERT_GE(expected.size(), MACROBLOCKS * (rgb16 ? 32u : 64u));
+
+	const u64 used = IPUDecodeAhead::GetStats().used;
+	const std::vector<u128> output = RunIDEC(stream, rgb16, true);
+	IPUDecodeAhead::Shutdown();
+
+	ASSERT_EQ(output.size(), expected.size());
+	EXPECT_EQ(std::memcmp(output.data(), expected.data(), output.size() * sizeof(u128)), 0);
+	EXPECT_GT(IPUDecodeAhead::GetStats().used, used);
+}
+
+TEST(IPUDecodeAhead, MatchesRGB32)
+{
+	TestDecodeAhead(false);
+}
+
+TEST(IPUDecodeAhead, MatchesDitheredRGB16)
+{
+	TestDecodeAhead(true);
+}
@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Counters.h"
+#include "pcsx2/R5900.h"
+#include "pcsx2/Rewind.h"
+#include "pcsx2/SaveState.h"
+#include "pcsx2/SaveStateDelta.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using SaveStateDelta::PAGE_SIZE;
+
+using StateEntries = std::vector<std::pair<std::string, std::vector<u8>>>;
+
+namespace
+{
+	// Stands in for a captured state, a few pages of which change every snapshot.
+	class SnapshotGenerator
+	{
+	public:
+		SnapshotGenerator(size_t size, u32 dirty_pages)
+			: m_data(size)
+			, m_dirty_pages(dirty_pages)
+		{
+			for (u8& byte : m_data)
+				byte = static_cast<u8>(m_gen() & 0x0F);
+		}
+
+		const std::vector<u8>& Next()
+		{
+			const u32 pages = static_cast<u32>(m_data.size() / PAGE_SIZE);
+			for (u32 i = 0; i < m_dirty_pages; i++)
+			{
+				u8* page = &m_data[(m_gen() % pages) * PAGE_SIZE];
+				for (u32 j = 0; j < 64; j++)
+					page[m_gen() % PAGE_SIZE] = static_cast<u8>(m_gen());
+			}
+			return m_data;
+		}
+
+	private:
+		std::mt19937 m_gen{1234};
+		std::vector<u8> m_data;
+		u32 m_dirty_pages;
+	};
+} // namespace
+
+// Same as Rewind::Capture(), with the entries standing in for the downloaded state.
+static void Capture(RewindBuffer& buffer, const StateEntries& state)
+{
+	ArchiveEntryList list;
+	list.GetBuffer() = buffer.GetFreeBuffer();
+	list.Clear();
+
+	ArchiveEntryList::VmStateBuffer& data = list.GetBuffer();
+	for (const auto& [name, entry_data] : state)
+	{
+		list.Add(ArchiveEntry(name).SetDataIndex(data.size()).SetDataSize(entry_data.size()));
+		data.insert(data.end(), entry_data.begin(), entry_data.end());
+	}
+
+	RewindBuffer::WriteEntryTable(&list);
+	ASSERT_TRUE(buffer.Push(std::move(list.GetBuffer())));
+	buffer.WaitForWorker();
+}
+
+// Same as Rewind::StepBack(), checking the entries instead of loading them.
+static void ExpectStepBack(RewindBuffer& buffer, u32 steps, const StateEntries& expected)
+{
+	ArchiveEntryList list;
+	ASSERT_TRUE(buffer.Rewind(steps, &list.GetBuffer()));
+	ASSERT_TRUE(RewindBuffer::ReadEntryTable(&list));
+	ASSERT_EQ(list.GetLength(), expected.size());
+	for (uint i = 0; i < list.GetLength(); i++)
+	{
+		const auto& [name, data] = expected[i];
+		EXPECT_EQ(list[i].GetFilename(), name);
+		ASSERT_EQ(list[i].GetDataSize(), data.size()) << name;
+		EXPECT_EQ(std::memcmp(list.GetPtr(list[i].GetDataIndex()), data.data(), data.size()), 0) << name;
+	}
+}
+
+static StateEntries MakeState(const std::vector<u8>& memory, u32 frame)
+{
+	StateEntries state;
+	state.emplace_back("PCSX2 Internal Structures.dat", std::vector<u8>(200, static_cast<u8>(frame)));
+	state.emplace_back("eeMemory.bin", memory);
+
+	// Changes size part way through, so some snapshots can't be stored as deltas.
+	state.emplace_back("GS.dat", std::vector<u8>((frame < 3) ? 1000 : 1500, static_cast<u8>(frame * 3)));
+	return state;
+}
+
+TEST(RewindBuffer, CaptureStepBackRestoresInOrder)
+{
+	SnapshotGenerator memory(PAGE_SIZE * 32, 2);
+	RewindBuffer buffer(64 * 1024 * 1024);
+	std::vector<StateEntries> history;
+	for (u32 frame = 0; frame < 6; frame++)
+	{
+		history.push_back(MakeState(memory.Next(), frame));
+		Capture(buffer, history.back());
+	}
+
+	// Holding the hotkey steps back one snapshot at a time.
+	for (int frame = 4; frame >= 2; frame--)
+		ExpectStepBack(buffer, 1, history[frame]);
+	EXPECT_EQ(buffer.GetCount(), 3u);
+
+	// Capturing again continues from the restored state, the later snapshots are gone.
+	const StateEntries next = MakeState(memory.Next(), 6);
+	Capture(buffer, next);
+	ExpectStepBack(buffer, 0, next);
+	ExpectStepBack(buffer, 1, history[2]);
+	ExpectStepBack(buffer, 1, history[1]);
+	EXPECT_EQ(buffer.GetCount(), 2u);
+}
+
+// Saves or loads just the counters, the same as they're frozen into a full state.
+class CounterState final : public SaveStateBase
+{
+public:
+	CounterState(VmStateBuffer& data, bool saving)
+		: SaveStateBase(data)
+		, m_saving(saving)
+	{
+	}
+
+	bool Freeze() { return rcntFreeze(); }
+
+	void FreezeMem(void* data, int size) override
+	{
+		if (m_saving)
+			m_memory.insert(m_memory.end(), static_cast<u8*>(data), static_cast<u8*>(data) + size);
+		else if (static_cast<size_t>(m_idx + size) <= m_memory.size())
+			std::memcpy(data, &m_memory[m_idx], size);
+		else
+			m_error = true;
+		m_idx += size;
+	}
+
+	bool IsSaving() const override { return m_saving; }
+
+private:
+	bool m_saving;
+};
+
+static std::vector<u8> FreezeCounters()
+{
+	std::vector<u8> data;
+	CounterState state(data, true);
+	EXPECT_TRUE(state.Freeze());
+	return data;
+}
+
+TEST(RewindBuffer, StepBackRestoresCounters)
+{
+	// Snapshots are taken once the vsync event has been handled, so the counters are in vblank.
+	cpuRegs.cycle = 100000;
+	vsyncCounter = {MODE_GSBLANK, 99000, 4000};
+	hsyncCounter = {MODE_HRENDER, 99500, 1000};
+	for (int i = 0; i < 4; i++)
+	{
+		counters[i] = {};
+		counters[i].count = 10 * i;
+		counters[i].target = 0xffff;
+		counters[i].rate = 2;
+		counters[i].startCycle = 98000;
+	}
+	const SyncCounter saved_vsync = vsyncCounter;
+	const SyncCounter saved_hsync = hsyncCounter;
+	const Counter saved_counter1 = counters[1];
+
+	RewindBuffer buffer(64 * 1024 * 1024);
+	Capture(buffer, {{"PCSX2 Internal Structures.dat", FreezeCounters()}});
+
+	// The next frame moves on into render.
+	vsyncCounter = {MODE_VRENDER, 103000, 30000};
+	hsyncCounter = {MODE_HBLANK, 103200, 200};
+	counters[1].count = 5000;
+	Capture(buffer, {{"PCSX2 Internal Structures.dat", FreezeCounters()}});
+
+	ArchiveEntryList list;
+	ASSERT_TRUE(buffer.Rewind(1, &list.GetBuffer()));
+	ASSERT_TRUE(RewindBuffer::ReadEntryTable(&list));
+	ASSERT_EQ(list.GetLength(), 1u);
+	const u8* entry = list.GetPtr(list[0].GetDataIndex());
+	std::vector<u8> data(entry, entry + list[0].GetDataSize());
+	CounterState state(data, false);
+	ASSERT_TRUE(state.Freeze());
+
+	EXPECT_EQ(vsyncCounter.Mode, saved_vsync.Mode);
+	EXPECT_EQ(vsyncCounter.startCycle, saved_vsync.startCycle);
+	EXPECT_EQ(vsyncCounter.deltaCycles, saved_vsync.deltaCycles);
+	EXPECT_EQ(hsyncCounter.Mode, saved_hsync.Mode);
+	EXPECT_EQ(hsyncCounter.startCycle, saved_hsync.startCycle);
+	EXPECT_EQ(counters[1].count, saved_counter1.count);
+	EXPECT_EQ(counters[1].startCycle, saved_counter1.startCycle);
+}
+
+TEST(RewindBuffer, SmallStatesEvictOldestFirst)
+{
+	static constexpr size_t STATE_SIZE = PAGE_SIZE * 4;
+	static constexpr size_t BUDGET = STATE_SIZE * 4;
+	static constexpr u32 CAPTURES = 12;
+
+	// Random data doesn't compress, and every page changes, so each snapshot costs a full state.
+	std::mt19937 gen(42);
+	RewindBuffer buffer(BUDGET);
+	std::vector<StateEntries> history;
+	for (u32 i = 0; i < CAPTURES; i++)
+	{
+		std::vector<u8> memory(STATE_SIZE);
+		for (u8& byte : memory)
+			byte = static_cast<u8>(gen());
+		history.push_back({{"eeMemory.bin", std::move(memory)}});
+		Capture(buffer, history.back());
+
+		const RewindBuffer::Stats stats = buffer.GetStats();
+		EXPECT_LE(stats.memory_used, BUDGET);
+	}
+
+	const u32 count = buffer.GetCount();
+	EXPECT_GT(count, 1u);
+	EXPECT_LT(count, CAPTURES);
+
+	// The survivors are the newest ones, and stepping back stops at the oldest of them.
+	for (u32 i = 1; i < count; i++)
+		ExpectStepBack(buffer, 1, history[CAPTURES - 1 - i]);
+	ExpectStepBack(buffer, 1, history[CAPTURES - count]);
+	EXPECT_EQ(buffer.GetCount(), 1u);
+}
+
+TEST(RewindBuffer, RestoresSnapshotsInReverse)
+{
+	SnapshotGenerator generator(PAGE_SIZE * 64, 4);
+	RewindBuffer buffer(64 * 1024 * 1024);
+	std::vector<std::vector<u8>> history;
+	for (int i = 0; i < 10; i++)
+	{
+		history.push_back(generator.Next());
+		ASSERT_TRUE(buffer.Push(history.back()));
+		buffer.WaitForWorker();
+	}
+	EXPECT_EQ(buffer.GetCount(), 10u);
+
+	std::vector<u8> data;
+	ASSERT_TRUE(buffer.Rewind(0, &data));
+	EXPECT_EQ(data, history[9]);
+	ASSERT_TRUE(buffer.Rewind(3, &data));
+	EXPECT_EQ(data, history[6]);
+	EXPECT_EQ(buffer.GetCount(), 7u);
+	ASSERT_TRUE(buffer.Rewind(1, &data));
+	EXPECT_EQ(data, history[5]);
+
+	// Stepping past the oldest stops there.
+	ASSERT_TRUE(buffer.Rewind(100, &data));
+	EXPECT_EQ(data, history[0]);
+	EXPECT_EQ(buffer.GetCount(), 1u);
+}
+
+TEST(RewindBuffer, CaptureAfterRewindContinuesHistory)
+{
+	SnapshotGenerator generator(PAGE_SIZE * 32, 2);
+	RewindBuffer buffer(64 * 1024 * 1024);
+	std::vector<u8> first = generator.Next();
+	buffer.Push(first);
+	buffer.Push(generator.Next());
+	buffer.WaitForWorker();
+
+	std::vector<u8> data;
+	ASSERT_TRUE(buffer.Rewind(1, &data));
+	EXPECT_EQ(data, first);
+
+	const std::vector<u8> next = generator.Next();
+	buffer.Push(next);
+	buffer.WaitForWorker();
+	ASSERT_TRUE(buffer.Rewind(0, &data));
+	EXPECT_EQ(data, next);
+	ASSERT_TRUE(buffer.Rewind(1, &data));
+	EXPECT_EQ(data, first);
+}
+
+TEST(RewindBuffer, SizeChangesAreStoredInFull)
+{
+	RewindBuffer buffer(64 * 1024 * 1024);
+	const std::vector<u8> small(PAGE_SIZE * 2, 1);
+	const std::vector<u8> large(PAGE_SIZE * 3 + 5, 2);
+	buffer.Push(small);
+	buffer.Push(large);
+	buffer.WaitForWorker();
+
+	std::vector<u8> data;
+	ASSERT_TRUE(buffer.Rewind(1, &data));
+	EXPECT_EQ(data, small);
+}
+
+TEST(RewindBuffer, OldestSnapshotsAreEvicted)
+{
+	static constexpr size_t BUDGET = 1024 * 1024;
+
+	std::mt19937 gen(99);
+	RewindBuffer buffer(BUDGET, 1);
+	for (int i = 0; i < 16; i++)
+	{
+		// Random data doesn't compress, so only a few fit.
+		std::vector<u8> data(256 * 1024);
+		for (u8& byte : data)
+			byte = static_cast<u8>(gen());
+		buffer.Push(std::move(data));
+		buffer.WaitForWorker();
+	}
+
+	const RewindBuffer::Stats stats = buffer.GetStats();
+	EXPECT_LE(stats.memory_used, BUDGET);
+	EXPECT_LT(stats.snapshots, 16u);
+	EXPECT_GT(stats.snapshots, 1u);
+}
+
+TEST(RewindBuffer, EmptyBufferCannotRewind)
+{
+	RewindBuffer buffer(1024 * 1024);
+	std::vector<u8> data;
+	EXPECT_FALSE(buffer.Rewind(1, &data));
+}
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/SaveStateCompression.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/ZipHelpers.h"
+#include <gtest/gtest.h>
+#include <zlib.h>
+#include <zstd.h>
+#include <random>
+#include <vector>
+
+using SaveStateCompression::FRAME_SIZE;
+
+// Compressible, but not trivially so.
+static std::vector<u8> MakeStateData(size_t size, u32 seed)
+{
+	std::mt19937 gen(seed);
+	std::vector<u8> data(size);
+	for (size_t i = 0; i < size; i++)
+		data[i] = static_cast<u8>((gen() & 0x0F) + (i >> 12));
+	return data;
+}
+
+static u32 ComputeCRC(const std::vector<u8>& data)
+{
+	return static_cast<u32>(crc32_z(crc32_z(0L, Z_NULL, 0), data.data(), data.size()));
+}
+
+TEST(SaveStateCompression, RoundTrip)
+{
+	const std::vector<std::vector<u8>> inputs = {
+		MakeStateData(FRAME_SIZE * 2 + 1234, 1),
+		MakeStateData(100, 2),
+		{},
+		MakeStateData(FRAME_SIZE, 3),
+	};
+
+	std::vector<SaveStateCompression::CompressJob> jobs(inputs.size());
+	for (size_t i = 0; i < inputs.size(); i++)
+		jobs[i].data = inputs[i];
+	ASSERT_TRUE(SaveStateCompression::Compress(jobs, 3, nullptr));
+
+	std::vector<std::vector<u8>> outputs(inputs.size());
+	std::vector<SaveStateCompression::DecompressJob> decompress_jobs(inputs.size());
+	for (size_t i = 0; i < inputs.size(); i++)
+	{
+		EXPECT_EQ(jobs[i].crc, ComputeCRC(inputs[i]));
+		outputs[i].resize(inputs[i].size());
+		decompress_jobs[i] = {jobs[i].compressed, outputs[i], jobs[i].crc};
+	}
+
+	Error error;
+	ASSERT_TRUE(SaveStateCompression::Decompress(decompress_jobs, &error)) << error.GetDescription();
+	for (size_t i = 0; i < inputs.size(); i++)
+		EXPECT_EQ(outputs[i], inputs[i]);
+
+	// Multiple frames are still one valid zstd stream.
+	std::vector<u8> single(inputs[0].size());
+	EXPECT_EQ(ZSTD_decompress(single.data(), single.size(), jobs[0].compressed.data(), jobs[0].compressed.size()), single.size());
+	EXPECT_EQ(single, inputs[0]);
+}
+
+TEST(SaveStateCompression, DecompressesStreamedFrames)
+{
+	// libzip streams its output, so older states have no content size in the frame header.
+	const std::vector<u8> input = MakeStateData(FRAME_SIZE + 999, 4);
+	std::vector<u8> compressed(ZSTD_compressBound(input.size()));
+	ZSTD_CStream* stream = ZSTD_createCStream();
+	ZSTD_initCStream(stream, 3);
+	ZSTD_inBuffer in = {input.data(), input.size(), 0};
+	ZSTD_outBuffer out = {compressed.data(), compressed.size(), 0};
+	ZSTD_compressStream(stream, &out, &in);
+	EXPECT_EQ(ZSTD_endStream(stream, &out), 0u);
+	ZSTD_freeCStream(stream);
+	compressed.resize(out.pos);
+	ASSERT_EQ(ZSTD_getFrameContentSize(compressed.data(), compressed.size()), ZSTD_CONTENTSIZE_UNKNOWN);
+
+	std::vector<u8> output(input.size());
+	SaveStateCompression::DecompressJob job = {compressed, output, ComputeCRC(input)};
+	ASSERT_TRUE(SaveStateCompression::Decompress(std::span(&job, 1), nullptr));
+	EXPECT_EQ(output, input);
+}
+
+TEST(SaveStateCompression, RejectsCorruptData)
+{
+	const std::vector<u8> input = MakeStateData(FRAME_SIZE + 10, 5);
+	SaveStateCompression::CompressJob job;
+	job.data = input;
+	ASSERT_TRUE(SaveStateCompression::Compress(std::span(&job, 1), 1, nullptr));
+
+	std::vector<u8> output(input.size());
+	SaveStateCompression::DecompressJob bad_crc = {job.compressed, output, job.crc ^ 1};
+	EXPECT_FALSE(SaveStateCompression::Decompress(std::span(&bad_crc, 1), nullptr));
+
+	std::vector<u8> short_output(input.size() - 1);
+	SaveStateCompression::DecompressJob bad_size = {job.compressed, short_output, job.crc};
+	EXPECT_FALSE(SaveStateCompression::Decompress(std::span(&bad_size, 1), nullptr));
+
+	const std::vector<u8> truncated(job.compressed.begin(), job.compressed.end() - 16);
+	SaveStateCompression::DecompressJob bad_data = {truncated, output, job.crc};
+	EXPECT_FALSE(SaveStateCompression::Decompress(std::span(&bad_data, 1), nullptr));
+}
+
+TEST(SaveStateCompression, ZipRoundTrip)
+{
+	const std::vector<std::pair<std::string, std::vector<u8>>> inputs = {
+		{"eeMemory.bin", MakeStateData(FRAME_SIZE * 2 + 1234, 10)},
+		{"Small.bin", MakeStateData(100, 11)},
+		{"Empty.bin", {}},
+	};
+	const std::vector<u8> deflated = MakeStateData(5000, 12);
+
+	const std::string path = Path::Combine(Path::GetDirectory(FileSystem::GetProgramPath()), "savestate_compression_test.zip");
+	{
+		std::vector<SaveStateCompression::CompressJob> jobs(inputs.size());
+		for (size_t i = 0; i < inputs.size(); i++)
+			jobs[i].data = inputs[i].second;
+		ASSERT_TRUE(SaveStateCompression::Compress(jobs, 3, nullptr));
+
+		zip_error_t ze = {};
+		auto zf = zip_open_managed(path.c_str(), ZIP_CREATE | ZIP_TRUNCATE, &ze);
+		ASSERT_TRUE(zf) << zip_error_strerror(&ze);
+		for (size_t i = 0; i < inputs.size(); i++)
+			ASSERT_TRUE(SaveStateCompression::AddToZip(zf.get(), inputs[i].first.c_str(), jobs[i]));
+
+		// Entries which libzip compresses itself can sit next to them.
+		zip_source_t* zs = zip_source_buffer(zf.get(), deflated.data(), deflated.size(), 0);
+		ASSERT_NE(zs, nullptr);
+		const zip_int64_t index = zip_file_add(zf.get(), "Deflated.bin", zs, ZIP_FL_ENC_UTF_8);
+		ASSERT_GE(index, 0);
+		zip_set_file_compression(zf.get(), index, ZIP_CM_DEFLATE, 1);
+		ASSERT_EQ(zip_close(zf.release()), 0);
+	}
+
+	zip_error_t ze = {};
+	auto zf = zip_open_managed(path.c_str(), ZIP_RDONLY, &ze);
+	ASSERT_TRUE(zf) << zip_error_strerror(&ze);
+
+	// The archive has to be readable by anything, libzip decompresses and checks the CRC itself here.
+	for (const auto& [name, data] : inputs)
+	{
+		zip_stat_t zst;
+		ASSERT_EQ(zip_stat(zf.get(), name.c_str(), 0, &zst), 0) << name;
+		EXPECT_EQ(zst.comp_method, ZIP_CM_ZSTD) << name;
+		EXPECT_EQ(zst.size, data.size()) << name;
+		EXPECT_EQ(zst.crc, ComputeCRC(data)) << name;
+
+		// Reads up to EOF, which is where libzip checks the CRC.
+		auto zff = zip_fopen_managed(zf.get(), name.c_str(), 0);
+		ASSERT_TRUE(zff) << name;
+		const std::optional<std::vector<u8>> read = ReadBinaryFileInZip(zff.get());
+		ASSERT_TRUE(read.has_value()) << name;
+		EXPECT_EQ(read.value(), data) << name;
+	}
+
+	std::vector<SaveStateCompression::ZipEntry> entries;
+	Error error;
+	ASSERT_TRUE(SaveStateCompression::ReadZipEntries(zf.get(), &entries, &error)) << error.GetDescription();
+	ASSERT_EQ(entries.size(), inputs.size() + 1);
+	for (size_t i = 0; i < inputs.size(); i++)
+		EXPECT_EQ(entries[i], inputs[i]);
+	EXPECT_EQ(entries.back().first, "Deflated.bin");
+	EXPECT_EQ(entries.back().second, deflated);
+
+	zf.reset();
+	FileSystem::DeleteFilePath(path.c_str());
+}
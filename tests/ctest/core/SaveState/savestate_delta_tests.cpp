@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Config.h"
+#include "pcsx2/SaveState.h"
+#include "pcsx2/SaveStateDelta.h"
+#include "common/Error.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/ZipHelpers.h"
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using SaveStateDelta::PAGE_SIZE;
+
+static std::vector<u8> MakeRandomData(size_t size, u32 seed)
+{
+	std::mt19937 gen(seed);
+	std::vector<u8> data(size);
+	for (u8& byte : data)
+		byte = static_cast<u8>(gen());
+	return data;
+}
+
+TEST(SaveStateDelta, UnchangedDataHasNoDirtyPages)
+{
+	const std::vector<u8> data = MakeRandomData(PAGE_SIZE * 8, 1);
+	std::vector<u8> delta;
+	EXPECT_EQ(SaveStateDelta::Encode(data, data, &delta), 0u);
+
+	std::vector<u8> target = data;
+	EXPECT_TRUE(SaveStateDelta::Apply(delta, target));
+	EXPECT_EQ(target, data);
+}
+
+TEST(SaveStateDelta, OnlyDirtyPagesAreStored)
+{
+	const std::vector<u8> previous = MakeRandomData(PAGE_SIZE * 16, 2);
+	std::vector<u8> current = previous;
+	current[PAGE_SIZE * 3 + 17] ^= 0xFF;
+	current[PAGE_SIZE * 9] ^= 0xFF;
+	current[PAGE_SIZE * 10 - 1] ^= 0xFF;
+
+	std::vector<u8> delta;
+	EXPECT_EQ(SaveStateDelta::Encode(previous, current, &delta), 2u);
+	EXPECT_LT(delta.size(), PAGE_SIZE * 3);
+
+	std::vector<u8> target = previous;
+	EXPECT_TRUE(SaveStateDelta::Apply(delta, target));
+	EXPECT_EQ(target, current);
+}
+
+TEST(SaveStateDelta, PartialLastPage)
+{
+	const std::vector<u8> previous = MakeRandomData(PAGE_SIZE * 2 + 100, 3);
+	std::vector<u8> current = previous;
+	current.back() ^= 0xFF;
+
+	std::vector<u8> delta;
+	EXPECT_EQ(SaveStateDelta::Encode(previous, current, &delta), 1u);
+
+	std::vector<u8> target = previous;
+	EXPECT_TRUE(SaveStateDelta::Apply(delta, target));
+	EXPECT_EQ(target, current);
+}
+
+TEST(SaveStateDelta, ChainedDeltas)
+{
+	std::vector<u8> base = MakeRandomData(PAGE_SIZE * 32, 4);
+	std::vector<u8> previous = base;
+	std::vector<std::vector<u8>> deltas;
+	std::mt19937 gen(5);
+	for (int i = 0; i < 8; i++)
+	{
+		std::vector<u8> current = previous;
+		for (int j = 0; j < 4; j++)
+			current[gen() % current.size()] = static_cast<u8>(gen());
+
+		deltas.emplace_back();
+		SaveStateDelta::Encode(previous, current, &deltas.back());
+		previous = std::move(current);
+	}
+
+	for (const std::vector<u8>& delta : deltas)
+		ASSERT_TRUE(SaveStateDelta::Apply(delta, base));
+	EXPECT_EQ(base, previous);
+}
+
+TEST(SaveStateDelta, RejectsMismatchedOrCorruptDeltas)
+{
+	const std::vector<u8> previous = MakeRandomData(PAGE_SIZE * 4, 6);
+	std::vector<u8> current = previous;
+	current[0] ^= 0xFF;
+
+	std::vector<u8> delta;
+	SaveStateDelta::Encode(previous, current, &delta);
+
+	std::vector<u8> wrong_size(PAGE_SIZE * 5);
+	EXPECT_FALSE(SaveStateDelta::Apply(delta, wrong_size));
+
+	std::vector<u8> target = previous;
+	std::vector<u8> truncated(delta.begin(), delta.end() - 1);
+	EXPECT_FALSE(SaveStateDelta::Apply(truncated, target));
+
+	std::vector<u8> bad_magic = delta;
+	bad_magic[0] ^= 0xFF;
+	EXPECT_FALSE(SaveStateDelta::Apply(bad_magic, target));
+}
+
+namespace
+{
+	using StateEntries = std::vector<std::pair<std::string, std::vector<u8>>>;
+
+	class SaveStateChainTest : public ::testing::Test
+	{
+	protected:
+		void SetUp() override
+		{
+			EmuConfig.Savestate.CompressionType = SavestateCompressionMethod::Zstandard;
+			EmuConfig.Savestate.CompressionRatio = SavestateCompressionLevel::Low;
+		}
+
+		void TearDown() override
+		{
+			for (const std::string& path : m_paths)
+				FileSystem::DeleteFilePath(path.c_str());
+		}
+
+		std::string GetPath(std::string_view name)
+		{
+			m_paths.push_back(Path::Combine(Path::GetDirectory(FileSystem::GetProgramPath()),
+				fmt::format("savestate_chain_test_{}.p2s", name)));
+			return m_paths.back();
+		}
+
+		std::vector<std::string> m_paths;
+	};
+} // namespace
+
+static std::unique_ptr<ArchiveEntryList> MakeEntryList(const StateEntries& entries)
+{
+	auto list = std::make_unique<ArchiveEntryList>();
+	ArchiveEntryList::VmStateBuffer& buffer = list->GetBuffer();
+	for (const auto& [name, data] : entries)
+	{
+		list->Add(ArchiveEntry(name).SetDataIndex(buffer.size()).SetDataSize(data.size()));
+		buffer.insert(buffer.end(), data.begin(), data.end());
+	}
+	return list;
+}
+
+static void SaveCheckpoint(SaveStateCheckpointWriter& writer, const StateEntries& entries, const std::string& path)
+{
+	Error error;
+	ASSERT_TRUE(writer.Save(MakeEntryList(entries), path.c_str(), &error)) << error.GetDescription();
+}
+
+static void ExpectChainMatches(std::span<const std::string> paths, const StateEntries& expected)
+{
+	ArchiveEntryList list;
+	Error error;
+	ASSERT_TRUE(SaveState_ReadChainFromDisk(paths, &list, &error)) << error.GetDescription();
+
+	for (const auto& [name, data] : expected)
+	{
+		const ArchiveEntry* entry = nullptr;
+		for (uint i = 0; i < list.GetLength() && !entry; i++)
+		{
+			if (list[i].GetFilename() == name)
+				entry = &list[i];
+		}
+
+		// Emptied entries are dropped, same as an entry which was never saved.
+		if (data.empty())
+		{
+			EXPECT_EQ(entry, nullptr) << name;
+			continue;
+		}
+
+		ASSERT_NE(entry, nullptr) << name;
+		ASSERT_EQ(entry->GetDataSize(), data.size()) << name;
+		EXPECT_EQ(std::memcmp(list.GetPtr(entry->GetDataIndex()), data.data(), data.size()), 0) << name;
+	}
+}
+
+static StateEntries MakeState(u32 seed)
+{
+	return {
+		{"eeMemory.bin", MakeRandomData(PAGE_SIZE * 64, seed)},
+		{"Small.bin", MakeRandomData(100, seed + 1)},
+		{"Resized.bin", MakeRandomData(3000, seed + 2)},
+	};
+}
+
+TEST_F(SaveStateChainTest, RoundTrip)
+{
+	StateEntries state = MakeState(10);
+	size_t total_size = 0;
+	for (const auto& [name, data] : state)
+		total_size += data.size();
+
+	SaveStateCheckpointWriter writer;
+	std::vector<std::string> chain = {GetPath("base")};
+	SaveCheckpoint(writer, state, chain.back());
+	EXPECT_EQ(writer.GetLastWrittenBytes(), total_size);
+	ExpectChainMatches(chain, state);
+
+	std::mt19937 gen(11);
+	for (u32 i = 1; i <= 4; i++)
+	{
+		std::vector<u8>& memory = state[0].second;
+		for (int j = 0; j < 3; j++)
+			memory[gen() % memory.size()] ^= 0xFF;
+		if (i == 2)
+			state[2].second = MakeRandomData(5000, 12);
+		if (i == 3)
+			state[1].second.clear();
+
+		EXPECT_EQ(writer.GetSequence(), i);
+		chain.push_back(GetPath(fmt::format("delta{}", i)));
+		SaveCheckpoint(writer, state, chain.back());
+		EXPECT_LE(writer.GetLastWrittenBytes(), PAGE_SIZE * 3 + 5000 + 100);
+		ExpectChainMatches(chain, state);
+	}
+}
+
+TEST_F(SaveStateChainTest, RejectsWrongBaseOrOrder)
+{
+	StateEntries state = MakeState(20);
+	SaveStateCheckpointWriter writer;
+	const std::string base = GetPath("base");
+	const std::string delta1 = GetPath("delta1");
+	const std::string delta2 = GetPath("delta2");
+	SaveCheckpoint(writer, state, base);
+	state[0].second[0] ^= 0xFF;
+	SaveCheckpoint(writer, state, delta1);
+	state[0].second[PAGE_SIZE] ^= 0xFF;
+	SaveCheckpoint(writer, state, delta2);
+
+	// Same contents, but a different chain.
+	SaveStateCheckpointWriter other_writer;
+	const std::string other_base = GetPath("other_base");
+	SaveCheckpoint(other_writer, MakeState(20), other_base);
+
+	ArchiveEntryList list;
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{other_base, delta1}, &list, nullptr));
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{base, delta2}, &list, nullptr));
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{delta1, delta2}, &list, nullptr));
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{base, delta2, delta1}, &list, nullptr));
+	ExpectChainMatches(std::vector<std::string>{base, delta1, delta2}, state);
+
+	// Starting a new chain gives it a new identity.
+	writer.Reset();
+	const std::string new_base = GetPath("new_base");
+	SaveCheckpoint(writer, state, new_base);
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{new_base, delta1}, &list, nullptr));
+}
+
+TEST_F(SaveStateChainTest, RejectsCorruptHeader)
+{
+	StateEntries state = MakeState(30);
+	SaveStateCheckpointWriter writer;
+	const std::string base = GetPath("base");
+	const std::string delta = GetPath("delta");
+	SaveCheckpoint(writer, state, base);
+	state[0].second[0] ^= 0xFF;
+	SaveCheckpoint(writer, state, delta);
+	ExpectChainMatches(std::vector<std::string>{base, delta}, state);
+
+	// Replace the chain header of the delta with garbage.
+	{
+		zip_error_t ze = {};
+		auto zf = zip_open_managed(delta.c_str(), 0, &ze);
+		ASSERT_TRUE(zf);
+		const zip_int64_t index = zip_name_locate(zf.get(), "PCSX2 Savestate Chain.dat", 0);
+		ASSERT_GE(index, 0);
+
+		static constexpr u8 garbage[16] = {0xDE, 0xAD, 0xBE, 0xEF};
+		zip_source_t* zs = zip_source_buffer(zf.get(), garbage, sizeof(garbage), 0);
+		ASSERT_NE(zs, nullptr);
+		ASSERT_EQ(zip_file_replace(zf.get(), static_cast<zip_uint64_t>(index), zs, 0), 0);
+		ASSERT_EQ(zip_close(zf.release()), 0);
+	}
+
+	ArchiveEntryList list;
+	Error error;
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{base, delta}, &list, &error));
+	EXPECT_TRUE(error.IsValid());
+
+	// A state without a chain header at all isn't a checkpoint either.
+	const std::string plain = GetPath("plain");
+	ASSERT_TRUE(SaveState_ZipToDisk(MakeEntryList(state), nullptr, plain.c_str(), &error)) << error.GetDescription();
+	EXPECT_FALSE(SaveState_ReadChainFromDisk(std::vector<std::string>{plain}, &list, nullptr));
+}
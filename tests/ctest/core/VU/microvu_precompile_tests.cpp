@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2002-2026 PCSX2 Dev Team
+// SPDX-License-Identifier: GPL-3.0+
+
+#include "pcsx2/Common.h"
+#include "pcsx2/MTVU.h"
+#include "pcsx2/Memory.h"
+#include "pcsx2/VUmicro.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "cpuinfo.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#ifdef _M_X86
+
+static constexpr u32 LOWER_NOP = 0x8000033C;
+static constexpr u32 UPPER_NOP = 0x000002FF;
+static constexpr u32 UPPER_E_BIT = 0x40000000;
+
+class MicroVUPrecompileTest : public ::testing::Test
+{
+protected:
+	static void SetUpTestSuite()
+	{
+		cpuinfo_initialize();
+		ASSERT_TRUE(SysMemory::Allocate());
+		CpuMicroVU1.Reserve();
+	}
+
+	static void TearDownTestSuite()
+	{
+		CpuMicroVU1.Shutdown();
+		vu1Thread.Close();
+		SysMemory::Release();
+	}
+
+	void SetUp() override
+	{
+		EmuConfig.Speedhacks.vuThread = false;
+		EmuConfig.Speedhacks.vuThreadPrecompile = false;
+		CpuMicroVU1.Reset();
+		std::memset(VU1.Micro, 0, VU1_PROGSIZE);
+	}
+
+	// NOP with the E bit set, then a NOP in the delay slot.
+	static void WriteProgram(u32 pc)
+	{
+		const u32 program[] = {LOWER_NOP, UPPER_NOP | UPPER_E_BIT, LOWER_NOP, UPPER_NOP};
+		std::memcpy(&VU1.Micro[pc], program, sizeof(program));
+	}
+
+	// Starts VU1 the way the EE does, returns how much code was generated to run it.
+	static size_t Start(u32 pc)
+	{
+		const size_t before = CpuMicroVU1.GetCommittedCache();
+		VU0.VI[REG_VPU_STAT].UL |= 0x100;
+		VU1.VI[REG_TPC].UL = pc / 8;
+		CpuMicroVU1.SetStartPC(pc / 8);
+		CpuMicroVU1.Execute(vu1RunCycles);
+		EXPECT_FALSE(VU0.VI[REG_VPU_STAT].UL & 0x100);
+		return CpuMicroVU1.GetCommittedCache() - before;
+	}
+};
+
+TEST_F(MicroVUPrecompileTest, PrecompiledStartDoesNotGenerateCode)
+{
+	WriteProgram(0);
+	WriteProgram(0x100);
+
+	const size_t before = CpuMicroVU1.GetCommittedCache();
+	EXPECT_TRUE(CpuMicroVU1.Precompile(0));
+	EXPECT_GT(CpuMicroVU1.GetCommittedCache(), before);
+
+	EXPECT_EQ(Start(0), 0u);
+
+	// A start PC which wasn't precompiled has to be compiled when it runs.
+	EXPECT_GT(Start(0x100), 0u);
+}
+
+TEST_F(MicroVUPrecompileTest, ReplacedProgramIsCompiled)
+{
+	WriteProgram(0);
+	EXPECT_TRUE(CpuMicroVU1.Precompile(0));
+
+	// The game replaced the program, so the precompiled block can't be used.
+	const u32 nop[] = {LOWER_NOP, UPPER_NOP};
+	std::memcpy(&VU1.Micro[0], nop, sizeof(nop));
+	WriteProgram(8);
+	CpuMicroVU1.Clear(0, 24);
+	EXPECT_GT(Start(0), 0u);
+}
+
+class MicroVUProgramCacheTest : public MicroVUPrecompileTest
+{
+protected:
+	void SetUp() override
+	{
+		MicroVUPrecompileTest::SetUp();
+		m_path = Path::Combine(Path::GetDirectory(FileSystem::GetProgramPath()), "microvu1_cache_test.bin");
+		FileSystem::DeleteFilePath(m_path.c_str());
+	}
+
+	void TearDown() override
+	{
+		CpuMicroVU1.SetProgramCache(std::string());
+		FileSystem::DeleteFilePath(m_path.c_str());
+		FileSystem::DeleteFilePath((m_path + ".tmp").c_str());
+	}
+
+	// Compiles two programs and saves them to the cache file.
+	void SaveCache()
+	{
+		CpuMicroVU1.SetProgramCache(m_path);
+		WriteProgram(0);
+		WriteProgram(0x100);
+		EXPECT_TRUE(CpuMicroVU1.Precompile(0));
+		EXPECT_GT(Start(0x100), 0u);
+		CpuMicroVU1.SaveProgramCache();
+		EXPECT_TRUE(FileSystem::FileExists(m_path.c_str()));
+		EXPECT_FALSE(FileSystem::FileExists((m_path + ".tmp").c_str()));
+	}
+
+	// Throws away the compiled programs and loads the cache file, like booting the game again.
+	size_t Reload()
+	{
+		CpuMicroVU1.SetProgramCache(std::string());
+		CpuMicroVU1.Reset();
+		CpuMicroVU1.SetProgramCache(m_path);
+		return CpuMicroVU1.GetCachedProgramCount();
+	}
+
+	std::string m_path;
+};
+
+TEST_F(MicroVUProgramCacheTest, RoundTrip)
+{
+	SaveCache();
+	ASSERT_EQ(Reload(), 2u);
+
+	// Micro memory still matches, so both programs are compiled before they're started, a block
+	// at a time.
+	u32 blocks = 0;
+	while (CpuMicroVU1.PrecompileCached())
+		blocks++;
+	EXPECT_GE(blocks, 2u);
+	EXPECT_EQ(Start(0), 0u);
+	EXPECT_EQ(Start(0x100), 0u);
+}
+
+TEST_F(MicroVUProgramCacheTest, MismatchedMicroMemoryIsSkipped)
+{
+	SaveCache();
+	ASSERT_EQ(Reload(), 2u);
+
+	std::memset(VU1.Micro, 0, VU1_PROGSIZE);
+	EXPECT_FALSE(CpuMicroVU1.PrecompileCached());
+}
+
+TEST_F(MicroVUProgramCacheTest, RejectsCorruptFile)
+{
+	SaveCache();
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(m_path.c_str());
+	ASSERT_TRUE(data.has_value());
+	ASSERT_GT(data->size(), 16u);
+
+	auto check = [&](const char* what, const std::vector<u8>& contents) {
+		ASSERT_TRUE(FileSystem::WriteBinaryFile(m_path.c_str(), contents.data(), contents.size())) << what;
+		EXPECT_EQ(Reload(), 0u) << what;
+		EXPECT_FALSE(CpuMicroVU1.PrecompileCached()) << what;
+	};
+
+	check("empty", {});
+	check("truncated", std::vector<u8>(data->begin(), data->end() - 1));
+	check("header only", std::vector<u8>(data->begin(), data->begin() + 16));
+
+	std::vector<u8> bad_magic = data.value();
+	bad_magic[0] ^= 0xFF;
+	check("bad magic", bad_magic);
+
+	std::vector<u8> bad_version = data.value();
+	bad_version[4]++;
+	check("bad version", bad_version);
+
+	std::vector<u8> trailing_garbage = data.value();
+	trailing_garbage.push_back(0);
+	check("trailing garbage", trailing_garbage);
+
+	// The original file still loads.
+	ASSERT_TRUE(FileSystem::WriteBinaryFile(m_path.c_str(), data->data(), data->size()));
+	EXPECT_EQ(Reload(), 2u);
+}
+
+#endif